@@ -0,0 +1,90 @@
+/* Define preprocessor statements */
+#include "bitboard.h"
+
+/*******************************************************************
+function: bbGeometryInit
+    builds the winning lines of a size x size board where
+    winLength marks in a row win
+
+    Input:
+    geo - geometry to fill in
+    size - board side, MIN_BOARD_SIZE to MAX_BITBOARD_SIZE
+    winLength - marks in a row needed, MIN_WIN_LENGTH to size
+********************************************************************/
+void bbGeometryInit(BoardGeometry *geo, int size, int winLength) {
+    // Row, column, diagonal and anti-diagonal steps
+    const int stepRow[NUM_DIRECTIONS] = {0, 1, 1, 1};
+    const int stepCol[NUM_DIRECTIONS] = {1, 0, 1, -1};
+
+    geo->size = size;
+    geo->winLength = winLength;
+    geo->cells = size * size;
+    geo->full = (geo->cells == 64) ? ~(Bitboard)0 : BB_CELL(geo->cells) - 1;
+    geo->lineCount = 0;
+
+    for(int d = 0; d < NUM_DIRECTIONS; d++) {
+        geo->runShift[d] = stepRow[d] * size + stepCol[d];
+        geo->runStarts[d] = 0;
+
+        for(int row = 0; row < size; row++) {
+            for(int col = 0; col < size; col++) {
+                // Last cell of a line starting here must be on the board
+                int endRow = row + stepRow[d] * (winLength - 1);
+                int endCol = col + stepCol[d] * (winLength - 1);
+                if(endRow >= size || endCol < 0 || endCol >= size) continue;
+
+                Bitboard line = 0;
+                for(int i = 0; i < winLength; i++) {
+                    line |= BB_CELL((row + stepRow[d] * i) * size + col + stepCol[d] * i);
+                }
+                geo->lines[geo->lineCount++] = line;
+                geo->runStarts[d] |= BB_CELL(row * size + col);
+            }
+        }
+    }
+}
+
+/*******************************************************************
+function: hasRun
+    looks for k marks in a row by ANDing the cells with copies
+    of themselves shifted along each direction. Inlined with a
+    constant k so the common lengths get unrolled loops
+
+    Input:
+    geo - board geometry
+    cells - marked cells of one side
+    k - marks in a row needed
+********************************************************************/
+static inline bool hasRun(const BoardGeometry *geo, Bitboard cells, const int k) {
+    for(int d = 0; d < NUM_DIRECTIONS; d++) {
+        Bitboard run = cells & geo->runStarts[d];
+        for(int i = 1; i < k && run; i++) {
+            run &= cells >> (i * geo->runShift[d]);
+        }
+        if(run) return true;
+    }
+    return false;
+}
+
+/*******************************************************************
+function: bbHasWon
+    checks if a side has completed a winning line
+
+    Input:
+    geo - board geometry
+    cells - marked cells of one side
+
+    Return:
+    boolean value - has winning conditions been met
+********************************************************************/
+bool bbHasWon(const BoardGeometry *geo, Bitboard cells) {
+    if(BB_COUNT(cells) < geo->winLength) return false;
+
+    // Fast paths for the usual line lengths
+    switch(geo->winLength) {
+        case 3: return hasRun(geo, cells, 3);
+        case 4: return hasRun(geo, cells, 4);
+        case 5: return hasRun(geo, cells, 5);
+        default: return hasRun(geo, cells, geo->winLength);
+    }
+}
@@ -0,0 +1,35 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef BITBOARD_H  /* Run the following if BITBOARD_H has not been defined */
+#define BITBOARD_H  /* Defines BITBOARD_H */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "board_config.h"
+
+#define MAX_CELLS (MAX_BITBOARD_SIZE * MAX_BITBOARD_SIZE)   // Cells on the largest bitboard
+#define MAX_WIN_LINES (4 * MAX_CELLS)                   // Upper bound on k-in-a-row lines
+#define NUM_DIRECTIONS 4                                // Row, column, diagonal, anti-diagonal
+
+#define BB_CELL(cell) ((Bitboard)1 << (cell))           // Bitboard with one cell set
+#define BB_COUNT(cells) __builtin_popcountll(cells)     // Number of cells set
+#define BB_FIRST(cells) __builtin_ctzll(cells)          // Lowest cell set, cells must not be 0
+
+// One bit per cell, bit (row * size + col) is set when the cell is marked
+typedef uint64_t Bitboard;
+
+// Shape of the board and the lines that win on it
+typedef struct {
+    int size;                           // Board side
+    int winLength;                      // Marks in a row needed to win (k)
+    int cells;                          // size * size
+    Bitboard full;                      // Every cell of the board
+    int lineCount;                      // Number of winning lines
+    Bitboard lines[MAX_WIN_LINES];      // Every k-in-a-row line
+    int runShift[NUM_DIRECTIONS];       // Cell index step along each direction
+    Bitboard runStarts[NUM_DIRECTIONS]; // Cells where a line of k fits along each direction
+} BoardGeometry;
+
+void bbGeometryInit(BoardGeometry* geo, int size, int winLength);
+bool bbHasWon(const BoardGeometry* geo, Bitboard cells);
+
+#endif  /* End of header file */
@@ -0,0 +1,15 @@
+/* Define include guards. Ensures contents of this file does not get included more than once */
+#ifndef BOARD_CONFIG_H  /* Run the following if BOARD_CONFIG_H has not been defined */
+#define BOARD_CONFIG_H  /* Defines BOARD_CONFIG_H */
+
+/*
+ * Board limits shared by the GUI, game logic, engines and Q-learning.
+ * Kept free of raylib so engine code can be built on its own.
+ */
+#define MIN_BOARD_SIZE 3        /* Smallest board side */
+#define MAX_BOARD_SIZE 15       /* Largest board side the GUI stores, gomoku needs 15 */
+#define MAX_BITBOARD_SIZE 8     /* Largest k-in-a-row board side, every cell fits in one 64 bit bitboard */
+#define DEFAULT_BOARD_SIZE 3    /* Board side used until the player picks another */
+#define MIN_WIN_LENGTH 3        /* Shortest line that wins */
+
+#endif
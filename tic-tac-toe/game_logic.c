@@ -1,38 +1,87 @@
 /* Define preprocessor statements */
 #include "game_logic.h"
+#include "qubic.h"
 
 
+int boardSize = DEFAULT_BOARD_SIZE;    // Board side in cells, chosen in the menu
+int winLength = DEFAULT_BOARD_SIZE;    // Marks in a row needed to win
+bool qubicRules = false;               // Board holds the 4 layers of a 4x4x4 game
+bool ultimateRules = false;            // Board is 9 3x3 sub-boards, see check_ultimate_status
+int lastMoveRow = -1;                  // Cell of the last mark placed, -1 before the first
+int lastMoveCol = -1;
 int player1Score = 0;      // Track Player 1's score
 int player2Score = 0;      // Track Player 2's score
 int gameEnded = 0;         // Track if the game has ended, 0 means game has not end
 char winner = ' ';         // Store the winner symbol ('O' or 'X'), empty if no winner
 int scoreUpdated = 0;      // Track if the score has been updated for current game
 
+/********************************************************
+function: setBoardRules
+    sets the board size and win length for the next game,
+    keeping both within the supported range
+
+inputs: size - board side in cells
+        length - marks in a row needed to win
+********************************************************/
+void setBoardRules(int size, int length)
+{
+    if (size < MIN_BOARD_SIZE) size = MIN_BOARD_SIZE;
+    if (size > MAX_BITBOARD_SIZE) size = MAX_BITBOARD_SIZE;
+    if (length < MIN_WIN_LENGTH) length = MIN_WIN_LENGTH;
+    if (length > size) length = size;
+
+    boardSize = size;
+    winLength = length;
+}
+
+/********************************************************
+function: clearBoard
+    marks every cell of the board empty
+
+input: board - 2D character array
+********************************************************/
+void clearBoard(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE])
+{
+    for (int i = 0; i < MAX_BOARD_SIZE; i++)
+    {
+        for (int j = 0; j < MAX_BOARD_SIZE; j++)
+        {
+            board[i][j] = EMPTY;
+        }
+    }
+    lastMoveRow = -1;
+    lastMoveCol = -1;
+}
+
 /********************************************************
 function: print_board
     displays the tic tac toe board in console
 
-input: board - 3 by 3 2D character array
+input: board - 2D character array, boardSize x boardSize used
 ********************************************************/
-void print_board(char board[BOARD_SIZE][BOARD_SIZE]) {
+void print_board(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
     printf("\n\n");
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        printf("%c | %c | %c\n", board[i][0], board[i][1], board[i][2]);
+    for (int i = 0; i < boardSize; i++) {
+        for (int j = 0; j < boardSize; j++) {
+            printf((j == 0) ? "%c" : " | %c", board[i][j]);
+        }
+        printf("\n");
     }
     printf("\n\n");
 }
 
 /********************************************************
-function: check_board_status
-    check the board for a winner or loser
+function: check_3x3_status
+    check the classic 3 by 3, 3 in a row board for a
+    winner or loser
 
-input: board - 3 by 3 2D character array
+input: board - 2D character array
 
 return: status - integer 
 ********************************************************/
-int check_board_status(char board[BOARD_SIZE][BOARD_SIZE]) {
+static int check_3x3_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
     // Check rows and columns for win
-    for (int i = 0; i < BOARD_SIZE; i++) {
+    for (int i = 0; i < 3; i++) {
         if ((board[i][0] == board[i][1] && board[i][1] == board[i][2] && board[i][0] != EMPTY) ||
             (board[0][i] == board[1][i] && board[1][i] == board[2][i] && board[0][i] != EMPTY)) {
             winner = (board[i][i] == PLAYER1) ? PLAYER1 : PLAYER2;
@@ -48,8 +97,8 @@ int check_board_status(char board[BOARD_SIZE][BOARD_SIZE]) {
     }
 
     // Check for empty spaces
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
             if (board[i][j] == EMPTY) {
                 return STATE_PLAYING; // Game is still ongoing
             }
@@ -59,20 +108,205 @@ int check_board_status(char board[BOARD_SIZE][BOARD_SIZE]) {
     return STATE_DRAW; // No empty spaces, it's a draw
 }
 
+/********************************************************
+function: check_lines_status
+    check a size by size board for length marks in a row.
+    Inlined with a constant size by check_board_status so
+    each common size gets its own unrolled copy
+
+input: board - 2D character array
+       size - board side in cells
+       length - marks in a row needed to win
+
+return: status - integer 
+********************************************************/
+static inline int check_lines_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], const int size, const int length) {
+    // Row, column, diagonal and anti-diagonal directions
+    const int stepRow[4] = {0, 1, 1, 1};
+    const int stepCol[4] = {1, 0, 1, -1};
+    int emptyFound = 0;
+
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            char mark = board[i][j];
+            if (mark == EMPTY) {
+                emptyFound = 1;
+                continue;
+            }
+
+            // Check each line of length starting at this cell
+            for (int d = 0; d < 4; d++) {
+                int endRow = i + stepRow[d] * (length - 1);
+                int endCol = j + stepCol[d] * (length - 1);
+                if (endRow >= size || endCol < 0 || endCol >= size) continue;
+
+                int count = 1;
+                while (count < length && board[i + stepRow[d] * count][j + stepCol[d] * count] == mark) {
+                    count++;
+                }
+                if (count == length) {
+                    winner = mark;
+                    return STATE_WIN;
+                }
+            }
+        }
+    }
+
+    return emptyFound ? STATE_PLAYING : STATE_DRAW;
+}
+
+/********************************************************
+function: check_qubic_status
+    check the 4 layers of a 4x4x4 board for 4 in a row
+    along any of its 76 lines
+
+input: board - 2D character array, layers placed as in
+               QUBIC_ROW and QUBIC_COL
+
+return: status - integer 
+********************************************************/
+static int check_qubic_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    Bitboard marks[2] = {0, 0};     // PLAYER1 then PLAYER2 cells
+
+    for (int cell = 0; cell < QUBIC_CELLS; cell++) {
+        char mark = board[QUBIC_ROW(cell)][QUBIC_COL(cell)];
+        if (mark == PLAYER1) marks[0] |= BB_CELL(cell);
+        if (mark == PLAYER2) marks[1] |= BB_CELL(cell);
+    }
+
+    if (qubicHasWon(marks[0]) || qubicHasWon(marks[1])) {
+        winner = qubicHasWon(marks[0]) ? PLAYER1 : PLAYER2;
+        return STATE_WIN;
+    }
+    return (BB_COUNT(marks[0] | marks[1]) == QUBIC_CELLS) ? STATE_DRAW : STATE_PLAYING;
+}
+
+/********************************************************
+function: ultimate_sub_board_status
+    check one 3x3 sub-board of the ultimate board with the
+    classic 3x3 rules
+
+input: board - 2D character array, 9 x 9 used
+       index - sub-board, (row / 3) * 3 + col / 3
+       owner - set to the sub-board's winner when it is won
+
+return: status - integer 
+********************************************************/
+int ultimate_sub_board_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int index, char *owner) {
+    char sub[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
+    char savedWinner = winner;      // Only the meta-board decides the game's winner
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            sub[i][j] = board[(index / 3) * 3 + i][(index % 3) * 3 + j];
+        }
+    }
+
+    int status = check_3x3_status(sub);
+    *owner = winner;
+    winner = savedWinner;
+    return status;
+}
+
+/********************************************************
+function: check_ultimate_status
+    check the ultimate board: each won sub-board claims its
+    cell of the 3x3 meta-board, and 3 claimed in a row win.
+    Drawn sub-boards belong to nobody
+
+input: board - 2D character array, 9 x 9 used
+
+return: status - integer 
+********************************************************/
+static int check_ultimate_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    char meta[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
+    int open = 0;
+
+    for (int index = 0; index < 9; index++) {
+        char owner;
+        int status = ultimate_sub_board_status(board, index, &owner);
+        meta[index / 3][index % 3] = (status == STATE_WIN) ? owner : EMPTY;
+        if (status == STATE_PLAYING) open = 1;
+    }
+
+    if (check_3x3_status(meta) == STATE_WIN) {
+        return STATE_WIN;
+    }
+    return open ? STATE_PLAYING : STATE_DRAW;
+}
+
+/********************************************************
+function: ultimate_move_allowed
+    check a cell may be marked on the ultimate board: the
+    last move's place in its sub-board picks the sub-board
+    to play in, any open one if that is already decided
+
+input: board - 2D character array, 9 x 9 used
+       row - integer row of the cell
+       col - integer column of the cell
+
+return: boolean value - can the cell be marked
+********************************************************/
+bool ultimate_move_allowed(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int row, int col) {
+    char owner;
+    int index = (row / 3) * 3 + col / 3;
+
+    if (board[row][col] != EMPTY || ultimate_sub_board_status(board, index, &owner) != STATE_PLAYING) {
+        return false;
+    }
+    if (lastMoveRow < 0) {
+        return true;
+    }
+
+    int target = (lastMoveRow % 3) * 3 + lastMoveCol % 3;
+    return index == target || ultimate_sub_board_status(board, target, &owner) != STATE_PLAYING;
+}
+
+/********************************************************
+function: check_board_status
+    check the board for a winner or loser
+
+input: board - 2D character array, boardSize x boardSize used
+
+return: status - integer 
+********************************************************/
+int check_board_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    if (qubicRules) {
+        return check_qubic_status(board);
+    }
+    if (ultimateRules) {
+        return check_ultimate_status(board);
+    }
+
+    // Fast paths for the common board sizes
+    switch (boardSize) {
+        case 3:
+            return (winLength == 3) ? check_3x3_status(board) : check_lines_status(board, 3, winLength);
+        case 4:
+            return check_lines_status(board, 4, winLength);
+        case 5:
+            return check_lines_status(board, 5, winLength);
+        default:
+            return check_lines_status(board, boardSize, winLength);
+    }
+}
+
 /********************************************************
 function: update_board
     updates the tic tac toe game board
 
-inputs: board - 3 by 3 2D character array
+inputs: board - 2D character array
         row - integer row to be updated
         col - integer column to be updated
         curr_player - player to be updated
 ********************************************************/
-void update_board(char board[BOARD_SIZE][BOARD_SIZE], int row, int col, char curr_player)
+void update_board(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int row, int col, char curr_player)
 {
     if (board[row][col] == EMPTY)
     {
         board[row][col] = curr_player;
+        lastMoveRow = row;
+        lastMoveCol = col;
     }
 }
 
@@ -82,20 +316,14 @@ function: restartBoard
 
 inputs: board
 ********************************************************/
-void restartBoard(char board[BOARD_SIZE][BOARD_SIZE]) 
+void restartBoard(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) 
 {
     int gameState;
     gameState = check_board_status(board);
 
     if (gameState == STATE_WIN || gameState == STATE_DRAW) 
     {
-        for (int i = 0; i < BOARD_SIZE; i++) 
-        {
-            for (int j = 0; j < BOARD_SIZE; j++) 
-            {
-                board[i][j] = '-';
-            }
-        }
+        clearBoard(board);
         gameEnded = 0;
         scoreUpdated = 0; /*Reset scoreUpdated for the new game*/
         winner = ' ';
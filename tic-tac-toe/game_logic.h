@@ -5,12 +5,19 @@
 #define GAME_LOGIC_H    /* Defines GAME_LOGIC_H*/
 
 #include <stdio.h>
+#include <stdbool.h>
+#include "board_config.h"
 #include "gui.h"
 #define PLAYER1 'O'
 #define PLAYER2 'X'
 #define EMPTY '-'
-#define BOARD_SIZE 3
 
+extern int boardSize;
+extern int winLength;
+extern bool qubicRules;
+extern bool ultimateRules;
+extern int lastMoveRow;
+extern int lastMoveCol;
 extern int player1Score;
 extern int player2Score;
 extern int gameEnded;
@@ -18,10 +25,14 @@ extern char winner;
 extern char player;
 extern double time_spent;
 
-void print_board(char board[BOARD_SIZE][BOARD_SIZE]);
-int check_board_status(char board[BOARD_SIZE][BOARD_SIZE]);
-void update_board(char board[BOARD_SIZE][BOARD_SIZE], int row, int col, char curr_player);
-void restartBoard(char board[BOARD_SIZE][BOARD_SIZE]);
+void setBoardRules(int size, int length);
+void clearBoard(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+void print_board(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+int check_board_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+int ultimate_sub_board_status(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int index, char *owner);
+bool ultimate_move_allowed(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int row, int col);
+void update_board(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int row, int col, char curr_player);
+void restartBoard(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
 void scoreBoard();
 
 
@@ -0,0 +1,484 @@
+/* Define preprocessor statements */
+#include "gomoku.h"
+#include "gui.h"
+#include "search_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+double gomokuTimeBudget = 0.09;         // Clock reads and the move list fit in the rest of 100 ms
+int gomokuMaxDepth = GOMOKU_MAX_DEPTH;
+bool gomokuStatsDump = false;
+
+#define GOMOKU_WIN 1000000                          // Score of five made at the root
+#define GOMOKU_INFINITY 2000000
+#define GOMOKU_WIN_BOUND (GOMOKU_WIN - 1000)        // Scores past this are wins or losses
+#define GOMOKU_IS_WIN_SCORE(s) SEARCH_IS_WIN_SCORE(s, GOMOKU_WIN_BOUND)
+#define CELL_WINDOWS 20                             // Most windows through one cell, 5 per direction
+#define NEAR_CELLS 24                               // Cells within GOMOKU_NEAR of a cell
+#define STOP_POLL_NODES 256                         // Nodes between clock reads, about a millisecond
+#define NO_STONE -1
+
+// Transposition table bounds
+#define GOMOKU_EXACT 0
+#define GOMOKU_LOWER 1
+#define GOMOKU_UPPER 2
+
+// Moves generated at a node
+#define GEN_ALL 0       // Every cell near a stone
+#define GEN_BLOCKS 1    // Cells that stop the other side's five
+#define GEN_FOURS 2     // Cells that make a four, the threat-space extension
+
+typedef struct {
+    uint64_t key;
+    int32_t score;          // Win scores relative to the stored position
+    int8_t depth;           // Plies searched below the position
+    uint8_t flag;           // GOMOKU_EXACT, GOMOKU_LOWER or GOMOKU_UPPER
+    uint8_t move;           // Best cell found
+} GomokuEntry;
+
+// Value of a window holding n stones of one side and none of the other
+static const int weight[GOMOKU_WIN_LENGTH + 1] = {0, 1, 8, 64, 512, 512};
+
+// Board shape, built once
+static int windowCells[GOMOKU_WINDOWS][GOMOKU_WIN_LENGTH];
+static int cellWindows[GOMOKU_CELLS][CELL_WINDOWS];
+static int cellWindowCount[GOMOKU_CELLS];
+static int nearCells[GOMOKU_CELLS][NEAR_CELLS];
+static int nearCellCount[GOMOKU_CELLS];
+static uint64_t zobrist[2][GOMOKU_CELLS];
+static bool shapeReady = false;
+
+// Position being searched, kept up to date by placeStone() and removeStone().
+// Side 0 is the computer, side 1 the player
+static signed char stones[GOMOKU_CELLS];        // Side on each cell, NO_STONE if empty
+static unsigned char counts[GOMOKU_WINDOWS][2]; // Stones of each side in each window
+static unsigned char near[GOMOKU_CELLS];        // Stones within GOMOKU_NEAR of each cell
+static int score;                               // Sum of window values, computer's view
+static int fours[2];                            // Windows one stone short of five, per side
+static int fives[2];                            // Completed windows, per side
+static int stoneCount;
+static uint64_t key;                            // Zobrist key of the stones, low bit flipped when the player moves
+
+static GomokuEntry *table = NULL;
+static long nodes;
+static double deadline;                         // Monotonic seconds, 0 = no deadline
+static bool stopped;
+
+/*******************************************************************
+function: initShape
+    builds every window of 5 cells along rows, columns and both
+    diagonals, the windows through each cell, the cells near
+    each cell and the hash keys
+********************************************************************/
+static void initShape(void) {
+    const int stepRow[4] = {0, 1, 1, 1};
+    const int stepCol[4] = {1, 0, 1, -1};
+    int count = 0;
+
+    for(int d = 0; d < 4; d++) {
+        for(int row = 0; row < GOMOKU_SIZE; row++) {
+            for(int col = 0; col < GOMOKU_SIZE; col++) {
+                int endRow = row + stepRow[d] * (GOMOKU_WIN_LENGTH - 1);
+                int endCol = col + stepCol[d] * (GOMOKU_WIN_LENGTH - 1);
+                if(endRow >= GOMOKU_SIZE || endCol < 0 || endCol >= GOMOKU_SIZE) continue;
+
+                for(int i = 0; i < GOMOKU_WIN_LENGTH; i++) {
+                    int cell = (row + stepRow[d] * i) * GOMOKU_SIZE + col + stepCol[d] * i;
+                    windowCells[count][i] = cell;
+                    cellWindows[cell][cellWindowCount[cell]++] = count;
+                }
+                count++;
+            }
+        }
+    }
+
+    for(int cell = 0; cell < GOMOKU_CELLS; cell++) {
+        int row = cell / GOMOKU_SIZE;
+        int col = cell % GOMOKU_SIZE;
+        for(int r = row - GOMOKU_NEAR; r <= row + GOMOKU_NEAR; r++) {
+            for(int c = col - GOMOKU_NEAR; c <= col + GOMOKU_NEAR; c++) {
+                if(r < 0 || r >= GOMOKU_SIZE || c < 0 || c >= GOMOKU_SIZE || (r == row && c == col)) continue;
+                nearCells[cell][nearCellCount[cell]++] = r * GOMOKU_SIZE + c;
+            }
+        }
+    }
+
+    uint64_t seed = ZOBRIST_SEED;
+    zobristFill(&zobrist[0][0], 2 * GOMOKU_CELLS, &seed);
+    shapeReady = true;
+}
+
+/*******************************************************************
+function: tally
+    adds (sign 1) or takes away (sign -1) what one window
+    contributes to the score and the four and five counts
+********************************************************************/
+static inline void tally(int window, int sign) {
+    int own = counts[window][0];
+    int other = counts[window][1];
+
+    if(!other) {
+        score += sign * weight[own];
+        if(own == GOMOKU_WIN_LENGTH - 1) fours[0] += sign;
+        if(own == GOMOKU_WIN_LENGTH) fives[0] += sign;
+    }
+    if(!own) {
+        score -= sign * weight[other];
+        if(other == GOMOKU_WIN_LENGTH - 1) fours[1] += sign;
+        if(other == GOMOKU_WIN_LENGTH) fives[1] += sign;
+    }
+}
+
+/*******************************************************************
+function: placeStone / removeStone
+    puts a stone on or takes it off the board. Only the windows
+    through the cell and the cells near it are updated, the
+    board is never scanned again. The low bit of the key flips
+    with the side to move
+
+    Input:
+    cell - cell index
+    side - 0 computer, 1 player
+********************************************************************/
+static void placeStone(int cell, int side) {
+    for(int i = 0; i < cellWindowCount[cell]; i++) {
+        int window = cellWindows[cell][i];
+        tally(window, -1);
+        counts[window][side]++;
+        tally(window, 1);
+    }
+    for(int i = 0; i < nearCellCount[cell]; i++) near[nearCells[cell][i]]++;
+
+    stones[cell] = side;
+    key ^= zobrist[side][cell] ^ 1;
+    stoneCount++;
+}
+
+static void removeStone(int cell, int side) {
+    for(int i = 0; i < cellWindowCount[cell]; i++) {
+        int window = cellWindows[cell][i];
+        tally(window, -1);
+        counts[window][side]--;
+        tally(window, 1);
+    }
+    for(int i = 0; i < nearCellCount[cell]; i++) near[nearCells[cell][i]]--;
+
+    stones[cell] = NO_STONE;
+    key ^= zobrist[side][cell] ^ 1;
+    stoneCount--;
+}
+
+/*******************************************************************
+function: generateMoves
+    empty cells near a stone, best first by how much the move
+    changes the score for the side playing it: lines it builds
+    plus lines it spoils for the other side. Only the best
+    beam moves are kept
+
+    Input:
+    side - side to move
+    mode - GEN_ALL, GEN_BLOCKS or GEN_FOURS
+    first - cell to put first, -1 for none
+    beam - most moves returned
+    moves - receives the cells in search order
+
+    Return:
+    number of moves
+********************************************************************/
+static int generateMoves(int side, int mode, int first, int beam, int moves[GOMOKU_CELLS]) {
+    int keys[GOMOKU_CELLS];
+    int count = 0;
+
+    for(int cell = 0; cell < GOMOKU_CELLS; cell++) {
+        if(stones[cell] != NO_STONE || !near[cell]) continue;
+
+        int gain = 0;
+        bool makesFour = false;
+        bool blocksFive = false;
+        for(int i = 0; i < cellWindowCount[cell]; i++) {
+            int window = cellWindows[cell][i];
+            int own = counts[window][side];
+            int other = counts[window][!side];
+
+            if(!other) gain += weight[own + 1] - weight[own];
+            else if(!own) gain += weight[other];
+            makesFour |= (!other && own == GOMOKU_WIN_LENGTH - 2);
+            blocksFive |= (!own && other == GOMOKU_WIN_LENGTH - 1);
+        }
+        if(mode == GEN_BLOCKS && !blocksFive) continue;
+        if(mode == GEN_FOURS && !makesFour) continue;
+
+        // Keep the beam best, highest key first
+        int sortKey = (cell == first) ? INT_MAX : gain;
+        if(count < beam) count++;
+        else if(sortKey <= keys[beam - 1]) continue;
+
+        int i = count - 1;
+        for(; i > 0 && keys[i - 1] < sortKey; i--) {
+            keys[i] = keys[i - 1];
+            moves[i] = moves[i - 1];
+        }
+        keys[i] = sortKey;
+        moves[i] = cell;
+    }
+    return count;
+}
+
+/*******************************************************************
+function: negamax
+    alpha-beta search with principal variation windows and a
+    transposition table over the moves near the stones. A four
+    wins on the next move, so a side facing one may only block
+    it, without using up depth. Past the depth limit the side to
+    move may stop at the heuristic score or keep making fours
+    (threat-space search) for up to GOMOKU_THREAT_PLIES plies
+
+    Input:
+    side - side to move, 0 computer, 1 player
+    depth - plies left before the threat-space search
+    alpha, beta - search window
+    ply - plies from the root
+
+    Return:
+    score for the side to move
+********************************************************************/
+static int negamax(int side, int depth, int alpha, int beta, int ply) {
+    if((++nodes & (STOP_POLL_NODES - 1)) == 0 && deadline > 0 && nowSeconds() > deadline) stopped = true;
+    if(stopped) return 0;
+
+    // Last move made five, or the side to move has a four to finish
+    if(fives[!side]) return -(GOMOKU_WIN - ply);
+    if(fours[side]) return GOMOKU_WIN - ply - 1;
+    if(stoneCount == GOMOKU_CELLS) return 0;
+
+    bool forced = fours[!side] > 0;
+    int bestScore = -GOMOKU_INFINITY;
+    if(depth <= 0 && !forced) {
+        // Standing pat, the side to move need not make a threat
+        bestScore = (side == 0) ? score : -score;
+        if(bestScore >= beta || depth <= -GOMOKU_THREAT_PLIES) return bestScore;
+        if(bestScore > alpha) alpha = bestScore;
+    }
+
+    if(mateWindow(&alpha, &beta, GOMOKU_WIN, ply)) return alpha;
+
+    GomokuEntry *entry = &table[key & (GOMOKU_TT_ENTRIES - 1)];
+    int hashMove = -1;
+    if(depth > 0 && entry->key == key) {
+        hashMove = entry->move;
+        if(entry->depth >= depth) {
+            int stored = scoreFromTT(entry->score, ply, GOMOKU_WIN_BOUND);
+            if(entry->flag == GOMOKU_EXACT) return stored;
+            if(entry->flag == GOMOKU_LOWER && stored > alpha) alpha = stored;
+            if(entry->flag == GOMOKU_UPPER && stored < beta) beta = stored;
+            if(alpha >= beta) return stored;
+        }
+    }
+
+    int moves[GOMOKU_CELLS];
+    int mode = forced ? GEN_BLOCKS : (depth <= 0) ? GEN_FOURS : GEN_ALL;
+    int count = generateMoves(side, mode, hashMove, forced ? GOMOKU_CELLS : GOMOKU_BEAM, moves);
+    if(count == 0) return (bestScore > -GOMOKU_INFINITY) ? bestScore : ((side == 0) ? score : -score);
+
+    int alphaOrig = alpha;
+    int bestCell = moves[0];
+    int childDepth = forced ? depth : depth - 1;
+
+    for(int i = 0; i < count; i++) {
+        int cell = moves[i];
+        int value;
+
+        placeStone(cell, side);
+        if(i == 0) {
+            value = -negamax(!side, childDepth, -beta, -alpha, ply + 1);
+        }
+        else {
+            value = -negamax(!side, childDepth, -alpha - 1, -alpha, ply + 1);
+            if(value > alpha && value < beta) value = -negamax(!side, childDepth, -beta, -alpha, ply + 1);
+        }
+        removeStone(cell, side);
+        if(stopped) return 0;
+
+        if(value > bestScore) {
+            bestScore = value;
+            bestCell = cell;
+        }
+        if(value > alpha) alpha = value;
+        if(alpha >= beta) break;
+    }
+
+    // Threat-space results depend on the extension left, only full-width nodes are stored
+    if(depth > 0) {
+        entry->key = key;
+        entry->score = scoreToTT(bestScore, ply, GOMOKU_WIN_BOUND);
+        entry->depth = depth;
+        entry->flag = (bestScore <= alphaOrig) ? GOMOKU_UPPER : (bestScore >= beta) ? GOMOKU_LOWER : GOMOKU_EXACT;
+        entry->move = bestCell;
+    }
+    return bestScore;
+}
+
+/*******************************************************************
+function: searchRoot
+    one iteration of the search at the root, the best move of
+    the last iteration goes first. With no move from an earlier
+    iteration the first move ignores the deadline, so there is
+    always a move to play
+
+    Input:
+    depth - plies to search
+    best - best cell so far, replaced by this iteration's
+
+    Return:
+    score of the best move, meaningless if the search stopped
+********************************************************************/
+static int searchRoot(int depth, int *best) {
+    int moves[GOMOKU_CELLS];
+    bool forced = fours[1] > 0;
+    int count = generateMoves(0, forced ? GEN_BLOCKS : GEN_ALL, *best, forced ? GOMOKU_CELLS : GOMOKU_ROOT_BEAM, moves);
+    int alpha = -GOMOKU_INFINITY;
+    int bestCell = moves[0];
+
+    for(int i = 0; i < count; i++) {
+        int cell = moves[i];
+        int value;
+        double limit = deadline;
+        if(i == 0 && *best < 0) deadline = 0;
+
+        placeStone(cell, 0);
+        if(i == 0) {
+            value = -negamax(1, depth - 1, -GOMOKU_INFINITY, -alpha, 1);
+        }
+        else {
+            value = -negamax(1, depth - 1, -alpha - 1, -alpha, 1);
+            if(value > alpha) value = -negamax(1, depth - 1, -GOMOKU_INFINITY, -alpha, 1);
+        }
+        removeStone(cell, 0);
+        deadline = limit;
+        if(stopped) break;
+
+        if(value > alpha) {
+            alpha = value;
+            bestCell = cell;
+        }
+    }
+
+    // Root moves finished before the deadline still count
+    if(alpha > -GOMOKU_INFINITY) *best = bestCell;
+    return alpha;
+}
+
+/*******************************************************************
+function: loadPosition
+    rebuilds the window counts from the GUI board, X is the
+    computer
+
+    Input:
+    board - game board, GOMOKU_SIZE x GOMOKU_SIZE cells are used
+********************************************************************/
+static void loadPosition(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    memset(stones, NO_STONE, sizeof(stones));
+    memset(counts, 0, sizeof(counts));
+    memset(near, 0, sizeof(near));
+    score = 0;
+    fours[0] = fours[1] = 0;
+    fives[0] = fives[1] = 0;
+    stoneCount = 0;
+    key = 0;
+
+    for(int cell = 0; cell < GOMOKU_CELLS; cell++) {
+        char mark = board[cell / GOMOKU_SIZE][cell % GOMOKU_SIZE];
+        if(mark == X_PLAYER) placeStone(cell, 0);
+        if(mark == O_PLAYER) placeStone(cell, 1);
+    }
+    // The computer moves at the root whoever started the game
+    if(stoneCount & 1) key ^= 1;
+}
+
+/*******************************************************************
+function: gomokuSearch
+    iterative deepening search of the computer's (X) move on the
+    15x15 board, stopping after gomokuTimeBudget seconds, at
+    gomokuMaxDepth or once the game is decided
+
+    Input:
+    board - game board, GOMOKU_SIZE x GOMOKU_SIZE cells are used
+
+    Return:
+    cell index (row * GOMOKU_SIZE + col) of the best move, -1 if
+    the board is full
+********************************************************************/
+int gomokuSearch(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    if(!shapeReady) initShape();
+    if(!table) {
+        table = calloc(GOMOKU_TT_ENTRIES, sizeof(GomokuEntry));
+        if(!table) {
+            fprintf(stderr, "Failed to allocate gomoku transposition table\n");
+            return -1;
+        }
+    }
+
+    loadPosition(board);
+    if(stoneCount == GOMOKU_CELLS) return -1;
+    // Nothing to search on an empty board, take the centre
+    if(stoneCount == 0) return GOMOKU_CELLS / 2;
+
+    // Finish a four at once
+    if(fours[0]) {
+        for(int window = 0; window < GOMOKU_WINDOWS; window++) {
+            if(counts[window][0] != GOMOKU_WIN_LENGTH - 1 || counts[window][1]) continue;
+            for(int i = 0; i < GOMOKU_WIN_LENGTH; i++) {
+                if(stones[windowCells[window][i]] == NO_STONE) return windowCells[window][i];
+            }
+        }
+    }
+
+    nodes = 0;
+    stopped = false;
+
+    double begin = nowSeconds();
+    int maxDepth = (gomokuMaxDepth < 1) ? 1 : (gomokuMaxDepth > GOMOKU_MAX_DEPTH) ? GOMOKU_MAX_DEPTH : gomokuMaxDepth;
+    int best = -1;
+    int result = 0;
+    int depth = 0;
+
+    for(int d = 1; d <= maxDepth && d <= GOMOKU_CELLS - stoneCount; d++) {
+        // The budget bounds every iteration, searchRoot() keeps one move
+        deadline = (gomokuTimeBudget > 0) ? begin + gomokuTimeBudget : 0;
+        int found = searchRoot(d, &best);
+        if(stopped) break;
+
+        result = found;
+        depth = d;
+        if(GOMOKU_IS_WIN_SCORE(result)) break;
+    }
+
+    double elapsed = nowSeconds() - begin;
+    if(gomokuStatsDump) fprintf(stderr, "gomoku: depth %d, %ld nodes, %.3fs, %.0f nodes/s, score %d\n",
+        depth, nodes, elapsed, (elapsed > 0) ? nodes / elapsed : 0.0, result);
+    return best;
+}
+
+/*******************************************************************
+function: gomokuAi
+    searches the computer's move and marks it on the board
+
+    Input:
+    board - game board, GOMOKU_SIZE x GOMOKU_SIZE cells are used
+********************************************************************/
+void gomokuAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    int cell = gomokuSearch(board);
+    if(cell >= 0) board[cell / GOMOKU_SIZE][cell % GOMOKU_SIZE] = X_PLAYER;
+}
+
+/*******************************************************************
+function: gomokuFree
+    releases the transposition table, the next search allocates
+    it again
+********************************************************************/
+void gomokuFree(void) {
+    free(table);
+    table = NULL;
+}
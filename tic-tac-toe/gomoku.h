@@ -0,0 +1,29 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef GOMOKU_H  /* Run the following if GOMOKU_H has not been defined */
+#define GOMOKU_H  /* Defines GOMOKU_H */
+
+#include <stdbool.h>
+#include "board_config.h"
+
+// 15x15 board, five in a row wins, cell (row * 15 + col)
+#define GOMOKU_SIZE 15
+#define GOMOKU_WIN_LENGTH 5
+#define GOMOKU_CELLS (GOMOKU_SIZE * GOMOKU_SIZE)
+#define GOMOKU_WINDOWS 572                  // Runs of 5 cells: 2 * 15 * 11 straight, 2 * 11 * 11 diagonal
+#define GOMOKU_TT_ENTRIES (1 << 20)         // Transposition table slots, allocated on first search
+#define GOMOKU_MAX_DEPTH 32
+
+#define GOMOKU_NEAR 2                       // Moves are only tried this close to a stone
+#define GOMOKU_BEAM 10                      // Best ordered moves searched below the root
+#define GOMOKU_ROOT_BEAM 20                 // Best ordered moves searched at the root
+#define GOMOKU_THREAT_PLIES 8               // Own fours searched past the depth limit
+
+extern double gomokuTimeBudget;     // Seconds per move, 0 = no limit
+extern int gomokuMaxDepth;          // Deepest iteration, 1 to GOMOKU_MAX_DEPTH
+extern bool gomokuStatsDump;         // Print the counters of every computer move to stderr
+
+int gomokuSearch(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+void gomokuAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+void gomokuFree(void);
+
+#endif  /* End of header file */
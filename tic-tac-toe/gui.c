@@ -5,7 +5,7 @@
 char player = O_PLAYER;         /* Initialise player as O. O always starts first */
 int gameMode = PVP;             /* Initialise game mode as PVP */
 int gameState = STATE_MENU;     /* Initialise game state as main menu - GUI shows main menu first*/
-char board[3][3] = {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY};       /* Initialise empty board */
+char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE];    /* Game board, cleared when a game mode is picked */
 int num_wins = 0;               /* Initialise number of wins + draws for CPU */
 int previousNumWins = -1;  // Track the previous number of wins
 int difficulty = 100;      // Initialise difficulty
@@ -14,6 +14,7 @@ int num_moves = 0;         // Number of moves that the AI makes
 double total_time = 0;      
 double avg_time = 0;
 double time_spent=0.0;      // time taken for AI to make a move
+double aiBegin = 0.0;       // when the running minimax search started
 
 /********************************************************
 function: getBoundary
@@ -23,7 +24,7 @@ return: int
 ********************************************************/
 int getBoundary()
 {
-    return SCREEN_WIDTH - GRID_OFFSET;
+    return GRID_OFFSET + getCellSize() * boardSize;
 }
 
 /********************************************************
@@ -34,7 +35,7 @@ return: int
 ********************************************************/
 int getCellSize()
 {
-    return (SCREEN_WIDTH - GRID_OFFSET * 2) / 3;
+    return (SCREEN_WIDTH - GRID_OFFSET * 2) / boardSize;
 }
 
 /********************************************************
@@ -60,6 +61,7 @@ void game_start()
         if (gameState == STATE_WIN || gameState == STATE_DRAW)      /* Game over state */
         {
             scoreBoard();       /* call scoreBoard function */
+            aiCancel();         /* stop pondering, no reply is needed */
             if (gameMode == PVC && (gameState == STATE_DRAW || player == O_PLAYER))
             {
                 // Increment num_wins if CPU wins or Draws
@@ -78,13 +80,16 @@ void game_start()
         else if (gameState == STATE_PLAYING && gameMode != PVP && player == X_PLAYER){
             if (gameMode == PVC) {              /* gameMode is PVC and CPU turn */
 
-                clock_t begin =clock();     /*start timing*/
-                
-                // Call minimax algorithm
-                ai(board, num_wins, difficulty);
+                // Call minimax algorithm on a background thread, the window keeps drawing meanwhile
+                if (aiStart(board, num_wins, difficulty)) {
+                    aiBegin = GetTime();        /*start timing*/
+                }
+                // Wait for later frames until the computer has moved
+                if (!aiPoll(board)) {
+                    return;
+                }
                 
-                clock_t end = clock();      /*end timing*/
-                time_spent = (double)(end-begin)/CLOCKS_PER_SEC;
+                time_spent = GetTime() - aiBegin;       /*end timing, wall time across frames*/
                 // printf("\n Time for CPU to make a move is %f seconds\n",time_spent);
                 avgCalc("Minimax");
 
@@ -100,6 +105,49 @@ void game_start()
                 time_spent = (double)(end-begin)/CLOCKS_PER_SEC;
                 avgCalc("Q-learning");
                 
+            } else if (gameMode == PVMCTS) {    /* gameMode is PVMCTS and CPU turn*/
+
+                double begin = GetTime();   /*start timing, wall time as playouts run on several threads*/
+
+                // Search the move with Monte Carlo tree search and update the board
+                mctsAi(board);
+
+                time_spent = GetTime() - begin;     /*end timing*/
+                avgCalc("MCTS");
+
+            } else if (gameMode == PVQUBIC) {   /* gameMode is PVQUBIC and CPU turn*/
+
+                clock_t begin =clock();     /*start timing*/
+
+                // Search the move with the 4x4x4 alpha-beta engine and update the board
+                qubicAi(board);
+
+                clock_t end = clock();      /*end timing*/
+                time_spent = (double)(end-begin)/CLOCKS_PER_SEC;
+                avgCalc("Qubic");
+
+            } else if (gameMode == PVGOMOKU) {  /* gameMode is PVGOMOKU and CPU turn*/
+
+                clock_t begin =clock();     /*start timing*/
+
+                // Search the move with the gomoku threat search and update the board
+                gomokuAi(board);
+
+                clock_t end = clock();      /*end timing*/
+                time_spent = (double)(end-begin)/CLOCKS_PER_SEC;
+                avgCalc("Gomoku");
+
+            } else if (gameMode == PVULTIMATE) {    /* gameMode is PVULTIMATE and CPU turn*/
+
+                clock_t begin =clock();     /*start timing*/
+
+                // Search the move with the ultimate engine and update the board
+                ultimateAi(board);
+
+                clock_t end = clock();      /*end timing*/
+                time_spent = (double)(end-begin)/CLOCKS_PER_SEC;
+                avgCalc("Ultimate");
+
             }
             // Switch player
             player = (player == X_PLAYER) ? O_PLAYER : X_PLAYER; 
@@ -108,6 +156,10 @@ void game_start()
         }
         else                                                        /* Game ongoing */                                 
         {
+            if (gameMode == PVC) {
+                // Search the computer's replies while the player thinks
+                aiPonderStart(board, num_wins, difficulty);
+            }
             CheckMouseInput();      /* call CheckMouseInput function */
 
         }
@@ -153,46 +205,65 @@ void draw_menu()
     DrawText("TIC TAC TOE", 150, 200, 100, WHITE);              /* Draw game title */
     DrawText("Choose a game mode:", 280, 350, 40, WHITE);       /* Draw game mode prompt */
 
-   // Initialise respective buttons coordinates and size
-    Rectangle buttons[3] = {
-        {215, 450, 550, 70},
-        {215, 600, 550, 70},
-        {215, 750, 550, 70}
-    };
-
-    // Available game mode
-    const int mode[3] = {
+    // Available game modes and the text shown on their buttons, top to bottom
+    const int mode[MENU_BUTTONS] = {
         PVP,
         PVC,
-        PVML
+        PVML,
+        PVMCTS,
+        PVQUBIC,
+        PVGOMOKU,
+        PVULTIMATE
     };
-    // Initialise buttons text to be shown
-    const char *labels[3] = {
+    const char *labels[MENU_BUTTONS] = {
         "Player vs Player",
         "Play with Computer 1",
-        "Play with Computer 2"
-    };
-
-    // Initialise text offset for buttons labels to be shown at the center of the button
-    const int textOffset[3] = {
-        85,
-        45,
-        45
+        "Play with Computer 2",
+        "Play with Computer 3",
+        "4x4x4 vs Computer",
+        "Gomoku vs Computer",
+        "Ultimate vs Computer"
     };
+    Rectangle buttons[MENU_BUTTONS];
 
-    // Initialise respective buttons and draw them
-    for (int i = 0; i < 3; i++) {
+    // Initialise buttons one under another and draw them, labels centred
+    for (int i = 0; i < MENU_BUTTONS; i++) {
+        buttons[i] = (Rectangle){215, 405 + i * 64, 550, 56};
         DrawRectangleRec(buttons[i], WHITE);
-        DrawText(labels[i], buttons[i].x + textOffset[i], buttons[i].y + 15, 45, BLACK);
+        DrawText(labels[i], buttons[i].x + (buttons[i].width - MeasureText(labels[i], 40)) / 2, buttons[i].y + 8, 40, BLACK);
     }
 
+    draw_rule_selectors();
+
     // Checks if any button was pressed
     if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
         Vector2 mousePos = GetMousePosition();
 
-        for (int i = 0; i < 3; i++) {
+        for (int i = 0; i < MENU_BUTTONS; i++) {
             if (CheckCollisionPointRec(mousePos, buttons[i])) {
                 gameMode = mode[i]; // Set respective game mode
+                // Q-learning model was trained on the 3x3 board only
+                if (gameMode == PVML) {
+                    setBoardRules(3, 3);
+                }
+                // 4x4x4 layers are drawn side by side as one 8x8 board, see QUBIC_ROW
+                qubicRules = (gameMode == PVQUBIC);
+                if (qubicRules) {
+                    setBoardRules(2 * QUBIC_SIZE, QUBIC_SIZE);
+                }
+                // Gomoku is past the bitboard limit of the size pickers, set it directly
+                if (gameMode == PVGOMOKU) {
+                    boardSize = GOMOKU_SIZE;
+                    winLength = GOMOKU_WIN_LENGTH;
+                }
+                // Ultimate is 9 classic 3x3 boards drawn as one 9x9 grid
+                ultimateRules = (gameMode == PVULTIMATE);
+                if (ultimateRules) {
+                    boardSize = ULTIMATE_SIZE;
+                    winLength = 3;
+                }
+                aiCancel(); // Stop any minimax search still running
+                clearBoard(board);
                 gameState = STATE_PLAYING; // Set game state to playing
                 break;
             }
@@ -200,6 +271,45 @@ void draw_menu()
     }
 }
 
+/********************************************************
+function: draw_rule_selectors
+    draws the board size and win length pickers under the
+    game mode buttons. Each has a - and + button
+********************************************************/
+void draw_rule_selectors()
+{
+    // Initialise - and + buttons for board size then win length
+    Rectangle pickers[4] = {
+        {215, 860, 50, 50},
+        {440, 860, 50, 50},
+        {495, 860, 50, 50},
+        {715, 860, 50, 50}
+    };
+    const char *signs[4] = {"-", "+", "-", "+"};
+    char sizeText[20];
+    char lengthText[20];
+
+    sprintf(sizeText, "%dx%d", boardSize, boardSize);
+    sprintf(lengthText, "%d in a row", winLength);
+
+    for (int i = 0; i < 4; i++) {
+        DrawRectangleRec(pickers[i], WHITE);
+        DrawText(signs[i], pickers[i].x + 17, pickers[i].y + 8, 40, BLACK);
+    }
+    DrawText(sizeText, 300, 870, 30, WHITE);
+    DrawText(lengthText, 555, 870, 30, WHITE);
+
+    // Change board size or win length when a picker is pressed
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        Vector2 mousePos = GetMousePosition();
+
+        if (CheckCollisionPointRec(mousePos, pickers[0])) setBoardRules(boardSize - 1, winLength);
+        if (CheckCollisionPointRec(mousePos, pickers[1])) setBoardRules(boardSize + 1, winLength);
+        if (CheckCollisionPointRec(mousePos, pickers[2])) setBoardRules(boardSize, winLength - 1);
+        if (CheckCollisionPointRec(mousePos, pickers[3])) setBoardRules(boardSize, winLength + 1);
+    }
+}
+
 
 /********************************************************
 function: draw_grid
@@ -209,11 +319,63 @@ void draw_grid()
 {
     int cellSize = getCellSize();       /* initiates cellSize to output of getCellSize function */
 
+    int boundary = getBoundary();       /* initiates boundary to output of getBoundary function */
+
     /* Draw tic tac toe grid */
-    for (int i = 1; i < 3; i++)         /* Iterates twice for each of the two vertical and horizontal lines  */
+    for (int i = 1; i < boardSize; i++)     /* Iterates once for each of the inner vertical and horizontal lines  */
+    {
+        DrawLine(GRID_OFFSET + i * cellSize, GRID_OFFSET, GRID_OFFSET + i * cellSize, boundary, WHITE);      /* Draws the i-th vertical line  */
+        DrawLine(GRID_OFFSET, (GRID_OFFSET + i * cellSize), boundary, GRID_OFFSET + i * cellSize, WHITE);     /* Draws the i-th horizontal line */
+    }
+
+    if (qubicRules)     /* 4x4x4 board, separate and name its 4 layers */
     {
-        DrawLine(GRID_OFFSET + i * cellSize, GRID_OFFSET, GRID_OFFSET + i * cellSize, SCREEN_HEIGHT - GRID_OFFSET, WHITE);      /* Draws the i-th vertical line  */
-        DrawLine(GRID_OFFSET, (GRID_OFFSET + i * cellSize), SCREEN_WIDTH - GRID_OFFSET, GRID_OFFSET + i * cellSize, WHITE);     /* Draws the i-th horizontal line */
+        int middle = GRID_OFFSET + QUBIC_SIZE * cellSize;
+        DrawRectangle(middle - 3, GRID_OFFSET, 6, boundary - GRID_OFFSET, WHITE);       /* Draws the line between left and right layers */
+        DrawRectangle(GRID_OFFSET, middle - 3, boundary - GRID_OFFSET, 6, WHITE);       /* Draws the line between top and bottom layers */
+
+        for (int layer = 0; layer < QUBIC_SIZE; layer++)
+        {
+            char label[10];
+            int x = GRID_OFFSET + (layer % 2) * QUBIC_SIZE * cellSize;
+            int y = (layer < 2) ? GRID_OFFSET - 25 : boundary + 5;        /* Top layers named above the grid, bottom layers below */
+            sprintf(label, "Layer %d", layer + 1);
+            DrawText(label, x, y, 20, RAYWHITE);
+        }
+    }
+
+    if (ultimateRules)  /* Ultimate board, separate the sub-boards and shade them */
+    {
+        int subSize = 3 * cellSize;
+
+        for (int index = 0; index < 9; index++)
+        {
+            char owner;
+            int x = GRID_OFFSET + (index % 3) * subSize;
+            int y = GRID_OFFSET + (index / 3) * subSize;
+            int status = ultimate_sub_board_status(board, index, &owner);
+            bool allowed = false;
+
+            for (int cell = 0; cell < 9 && !allowed; cell++)
+            {
+                allowed = ultimate_move_allowed(board, (index / 3) * 3 + cell / 3, (index % 3) * 3 + cell % 3);
+            }
+
+            if (status == STATE_WIN)        /* Won sub-boards take the winner's colour */
+            {
+                DrawRectangle(x, y, subSize, subSize, (owner == O_PLAYER) ? (Color){102, 191, 255, 90} : (Color){230, 41, 55, 90});
+            }
+            else if (allowed)               /* Sub-boards the next move may go in are lit */
+            {
+                DrawRectangle(x, y, subSize, subSize, (Color){255, 255, 255, 40});
+            }
+        }
+
+        for (int i = 1; i < 3; i++)
+        {
+            DrawRectangle(GRID_OFFSET + i * subSize - 3, GRID_OFFSET, 6, boundary - GRID_OFFSET, WHITE);     /* Draws the i-th line between sub-board columns */
+            DrawRectangle(GRID_OFFSET, GRID_OFFSET + i * subSize - 3, boundary - GRID_OFFSET, 6, WHITE);     /* Draws the i-th line between sub-board rows */
+        }
     }
 
 }
@@ -235,6 +397,10 @@ void CheckMouseInput()
             int cellSize = getCellSize();                           /* calls getCellSize function */
             int row = (mousePos.y - GRID_OFFSET) / cellSize;        /* gets the row of the tic tac toe cell selected */
             int col = (mousePos.x - GRID_OFFSET) / cellSize;        /* gets the column of the tic tac toe cell selected */
+            if (ultimateRules && !ultimate_move_allowed(board, row, col))   /* ultimate moves must go in the sub-board sent to */
+            {
+                return;
+            }
             while (board[row][col] == EMPTY)                          /* checks board if selected tic tac toe cell is */
             {
                 update_board(board, row, col, player);      /* calls update_board function from game_logic.c */
@@ -253,9 +419,9 @@ function: draw_makers
 ********************************************************/
 void draw_markers()
 {
-    for (int i = 0; i < 3; i++)         /* Iterates through rows of board */
+    for (int i = 0; i < boardSize; i++)         /* Iterates through rows of board */
     {
-        for (int j = 0; j < 3; j++)     /* Iterates through columns of board */
+        for (int j = 0; j < boardSize; j++)     /* Iterates through columns of board */
         {
             if (board[i][j] != EMPTY)     /* Cell is not empty */
             {
@@ -278,9 +444,11 @@ void draw_o(int row, int col)
     int y = (cellSize * row + cellSize / 2) + GRID_OFFSET;      /* initiates y, the centre of grid */
     int x = (cellSize * col + cellSize / 2) + GRID_OFFSET;      /* initiates x, the centre of grid */
 
+    int radius = GRID_OFFSET * 3 / (2 * boardSize);             /* initiates radius, scaled down for bigger boards */
+
     /* Draw O */
-    DrawCircle(x, y, GRID_OFFSET / 2, WHITE);
-    DrawCircle(x, y, GRID_OFFSET / 2 - 1, DARKBLUE);
+    DrawCircle(x, y, radius, WHITE);
+    DrawCircle(x, y, radius - 1, DARKBLUE);
 }
 
 /********************************************************
@@ -293,12 +461,13 @@ inputs: row - integer row in which X is to be drawn
 void draw_x(int row, int col)
 {
     int cellSize = getCellSize();                           /* initiates cellSize to output of getCellSize function */
+    int margin = GRID_OFFSET / boardSize;                   /* initiates margin between X and cell edges */
     
     /* Initialise corners of X markers */
-    int y1 = cellSize * row + GRID_OFFSET + 50;
-    int y2 = cellSize * (row + 1) + GRID_OFFSET - 50;
-    int x1 = cellSize * col + GRID_OFFSET + 50;
-    int x2 = cellSize * (col + 1) + GRID_OFFSET - 50;
+    int y1 = cellSize * row + GRID_OFFSET + margin;
+    int y2 = cellSize * (row + 1) + GRID_OFFSET - margin;
+    int x1 = cellSize * col + GRID_OFFSET + margin;
+    int x2 = cellSize * (col + 1) + GRID_OFFSET - margin;
 
     /* Draw X */
     DrawLine(x1, y1, x2, y2, WHITE);
@@ -330,6 +499,7 @@ void restartButton()
                 printf("\nDifficulty is %d%%", difficulty);
             }
 
+            aiCancel();                     /* stop any minimax search still running */
             restartBoard(board);            /* call restartBoard function from game_logic.c */
             gameState = STATE_PLAYING;      /* set gameState to STATE_PLAYING */
             increment = true;  // Reset increment flag
@@ -8,6 +8,10 @@
 #include "game_logic.h"     /* Include game_logic header file */
 #include "minimax.h"
 #include "q_learning.h"     // Include Q learning header file
+#include "mcts.h"           // Include Monte Carlo tree search header file
+#include "qubic.h"          // Include 4x4x4 engine header file
+#include "gomoku.h"         // Include 15x15 five in a row engine header file
+#include "ultimate.h"       // Include ultimate tic tac toe engine header file
 #include <time.h>           // For seed randoming & time calculation
 
 /* Initialise constants used */
@@ -17,6 +21,11 @@
 #define PVP 1                   /* Initialise game mode 1 as Player vs Player */         
 #define PVC 2                   /* Initialise game mode 2 as Player vs Computer (Minimax algo) */ 
 #define PVML 3                  /* Initialise game mode 3 as Player vs Computer (Machine learning algo) */
+#define PVMCTS 4                /* Initialise game mode 4 as Player vs Computer (Monte Carlo tree search) */
+#define PVQUBIC 5               /* Initialise game mode 5 as Player vs Computer on the 4x4x4 (Qubic) board */
+#define PVGOMOKU 6              /* Initialise game mode 6 as Player vs Computer on the 15x15 five in a row (gomoku) board */
+#define PVULTIMATE 7            /* Initialise game mode 7 as Player vs Computer on the 9x9 ultimate board */
+#define MENU_BUTTONS 7          /* Initialise number of game mode buttons in the main menu */
 #define STATE_MENU 0            /* Initialise game state 0 as main menu  */
 #define STATE_PLAYING 1         /* Initialise game state 1 as ongoing game */
 #define STATE_WIN 2             /* Initialise game state 2 as game end with winner */
@@ -27,6 +36,7 @@ extern int gameState;
 
 /* Initialise functions in gui.c */
 void draw_menu();       
+void draw_rule_selectors();
 void game_start();
 void draw_grid();
 int getBoundary();
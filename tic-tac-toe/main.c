@@ -1,6 +1,9 @@
 /* Define preprocessor statements */
 
 #include "gui.h"    /* Include gui header file */
+#include "retro_db.h"   /* Include 4x4 solved positions header file */
+#include "threadpool.h" /* Include worker pool header file */
+#include "transposition.h"  /* Include minimax transposition table header file */
 
 /* Main program - program starts here */
 int main()
@@ -10,6 +13,19 @@ int main()
 
     SetTargetFPS(30);                                           /* Set GUI target FPS*/
 
+    retroLoad();                                                /* Map solved 4x4 positions, if generated */
+    qModelPreload();                                            /* Load the Q-learning model in the background */
+    mmStatsDump = (getenv("MM_STATS") != NULL);                 /* MM_STATS set: print minimax search counters to stderr */
+    mctsStatsDump = (getenv("MCTS_STATS") != NULL);             /* MCTS_STATS set: print Monte Carlo tree search counters to stderr */
+    qubicStatsDump = (getenv("QUBIC_STATS") != NULL);           /* QUBIC_STATS set: print 4x4x4 search counters to stderr */
+    gomokuStatsDump = (getenv("GOMOKU_STATS") != NULL);         /* GOMOKU_STATS set: print gomoku search counters to stderr */
+    ultimateStatsDump = (getenv("ULTIMATE_STATS") != NULL);     /* ULTIMATE_STATS set: print ultimate tic tac toe search counters to stderr */
+    if(getenv("MM_THREADS")) mmSetThreads(atoi(getenv("MM_THREADS")));     /* MM_THREADS: threads searching minimax root moves, 0 = one per processor */
+    if(getenv("MM_Q_ORDER")) mmSetQOrdering(true);              /* MM_Q_ORDER set: search 3x3 with Q-value move ordering instead of the perfect table */
+    if(getenv("MCTS_TIME")) mctsTimeBudget = atof(getenv("MCTS_TIME"));     /* MCTS_TIME: seconds per MCTS move, 0 = no limit */
+    if(getenv("MCTS_PLAYOUTS")) mctsPlayouts = atoi(getenv("MCTS_PLAYOUTS"));   /* MCTS_PLAYOUTS: playouts per MCTS move, 0 = no limit */
+    if(getenv("MCTS_THREADS")) mctsThreads = atoi(getenv("MCTS_THREADS"));  /* MCTS_THREADS: threads running playouts, 0 = one per processor */
+
     while (!WindowShouldClose())                                /* Run the code below while user has not requested to close window */
         {
             BeginDrawing();                 /* Start drawing in GUI */
@@ -18,7 +34,15 @@ int main()
             EndDrawing();                   /* End drawing in GUI */
         }
     
+    aiCancel();                                                 /* Stop a computer move still being searched */
+    poolStop();                                                 /* Join the worker threads */
+    ttFree();                                                   /* Release the minimax transposition table */
     CloseWindow();                                              /* Close window */
+    retroUnload();                                              /* Release solved 4x4 positions */
+    qModelRelease();                                            /* Release the Q-learning model */
+    qubicFree();                                                /* Release the 4x4x4 transposition table */
+    gomokuFree();                                               /* Release the gomoku transposition table */
+    ultimateFree();                                             /* Release the ultimate transposition table */
 
     return 0;                                                   /* Exit program, program has executed successfully. */
 }
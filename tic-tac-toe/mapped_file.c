@@ -0,0 +1,87 @@
+/* Define preprocessor statements */
+#include "mapped_file.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*******************************************************************
+function: mapFile
+    maps a whole file read-only into memory
+
+    Input:
+    map - Pointer to the MappedFile filled in
+    path - file to map
+
+    Return:
+    boolean value - was the file mapped, map->data is NULL if not
+********************************************************************/
+bool mapFile(MappedFile *map, const char *path) {
+    map->data = NULL;
+    map->size = 0;
+
+#ifdef _WIN32
+    map->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    map->mapping = NULL;
+    if(map->file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(map->file, &size) || size.QuadPart == 0) {
+        CloseHandle(map->file);
+        return false;
+    }
+
+    map->mapping = CreateFileMappingA(map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(map->mapping) map->data = MapViewOfFile(map->mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!map->data) {
+        if(map->mapping) CloseHandle(map->mapping);
+        CloseHandle(map->file);
+        return false;
+    }
+    map->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return false;
+
+    struct stat info;
+    if(fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file open by itself
+    close(fd);
+    if(data == MAP_FAILED) return false;
+
+    map->data = data;
+    map->size = info.st_size;
+#endif
+    return true;
+}
+
+/*******************************************************************
+function: unmapFile
+    releases a mapping made by mapFile(), does nothing if the
+    file is not mapped
+
+    Input:
+    map - Pointer to the MappedFile
+********************************************************************/
+void unmapFile(MappedFile *map) {
+    if(!map->data) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(map->data);
+    CloseHandle(map->mapping);
+    CloseHandle(map->file);
+#else
+    munmap((void *)map->data, map->size);
+#endif
+    map->data = NULL;
+    map->size = 0;
+}
@@ -0,0 +1,21 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef MAPPED_FILE_H  /* Run the following if MAPPED_FILE_H has not been defined */
+#define MAPPED_FILE_H  /* Defines MAPPED_FILE_H */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Read-only view of a whole file, pages are loaded by the OS on first access
+typedef struct {
+    const unsigned char *data;  // Start of the file, NULL when not mapped
+    size_t size;                // Bytes mapped
+#ifdef _WIN32
+    void *file;                 // Handles kept until unmapFile()
+    void *mapping;
+#endif
+} MappedFile;
+
+bool mapFile(MappedFile* map, const char* path);
+void unmapFile(MappedFile* map);
+
+#endif  /* End of header file */
@@ -0,0 +1,349 @@
+/* Define preprocessor statements */
+#include "mcts.h"
+#include "gui.h"
+#include "threadpool.h"
+#include "search_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdatomic.h>
+
+int mctsPlayouts = 0;           // Time budget alone decides by default
+double mctsTimeBudget = 1.0;
+int mctsThreads = 0;
+bool mctsStatsDump = false;
+
+// Node states, a node's children are only read once it is MCTS_EXPANDED
+#define MCTS_LEAF 0
+#define MCTS_EXPANDING 1
+#define MCTS_EXPANDED 2
+
+// Search tree node. Visits are counted on the way down, before the playout
+// result is known, so threads see a virtual loss and spread over the tree
+typedef struct {
+    atomic_int visits;          // Playouts through the node, finished or not
+    atomic_int score;           // Half points won by the side that moved into the node
+    atomic_int state;           // MCTS_LEAF, MCTS_EXPANDING or MCTS_EXPANDED
+    int firstChild;             // Pool index of the first child, children are consecutive
+    unsigned char childCount;
+    unsigned char cell;         // Move that leads to the node
+} MctsNode;
+
+// Position and limits of the running search, read by every thread
+typedef struct {
+    const BoardGeometry *geo;
+    Bitboard pieces[2];         // pieces[0] = computer, pieces[1] = player, computer to move
+    double deadline;            // Monotonic seconds, 0 = no deadline
+    int playouts;               // Playouts wanted, 0 = no limit
+    atomic_int started;         // Playouts started so far
+} MctsSearch;
+
+static MctsNode *nodePool = NULL;
+static atomic_int nodesUsed;
+
+// Random generator state of each thread
+static _Thread_local uint64_t randomState = 0;
+
+/********************************************************
+function: nextRandom
+    xorshift64* generator, one per thread so playouts
+    never share state
+
+    Return:
+    64 random bits
+********************************************************/
+static inline uint64_t nextRandom(void) {
+    // Seed from the thread's own address and the clock the first time
+    if(randomState == 0) randomState = ((uint64_t)(uintptr_t)&randomState ^ (uint64_t)(nowSeconds() * 1e9)) | 1;
+
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState * 0x2545F4914F6CDD1DULL;
+}
+
+/********************************************************
+function: randomCell
+    picks one cell of a bitboard uniformly
+
+    Input:
+    cells - cells to pick from, must not be 0
+
+    Return:
+    cell index
+********************************************************/
+static inline int randomCell(Bitboard cells) {
+    int skip = (int)(nextRandom() % BB_COUNT(cells));
+
+    while(skip-- > 0) cells &= cells - 1;
+    return BB_FIRST(cells);
+}
+
+/*******************************************************************
+function: newNodes
+    takes consecutive nodes from the pool
+
+    Input:
+    count - nodes wanted
+
+    Return:
+    pool index of the first node, -1 once the pool is used up
+********************************************************************/
+static int newNodes(int count) {
+    int first = atomic_fetch_add(&nodesUsed, count);
+
+    if(first + count > MCTS_POOL_NODES) return -1;
+    return first;
+}
+
+/*******************************************************************
+function: expand
+    gives a leaf one child per empty cell. One thread wins the
+    right to expand, the others keep treating it as a leaf
+
+    Input:
+    node - leaf to expand
+    empty - empty cells of the leaf's position
+********************************************************************/
+static void expand(MctsNode *node, Bitboard empty) {
+    int expected = MCTS_LEAF;
+    if(!atomic_compare_exchange_strong(&node->state, &expected, MCTS_EXPANDING)) return;
+
+    int first = newNodes(BB_COUNT(empty));
+    // Pool is full, the node stays a leaf for the rest of the move
+    if(first < 0) return;
+
+    int count = 0;
+    for(; empty; empty &= empty - 1) {
+        MctsNode *child = &nodePool[first + count++];
+        atomic_init(&child->visits, 0);
+        atomic_init(&child->score, 0);
+        atomic_init(&child->state, MCTS_LEAF);
+        child->firstChild = -1;
+        child->childCount = 0;
+        child->cell = BB_FIRST(empty);
+    }
+    node->firstChild = first;
+    node->childCount = count;
+    atomic_store_explicit(&node->state, MCTS_EXPANDED, memory_order_release);
+}
+
+/*******************************************************************
+function: selectChild
+    UCT: the child with the best average score plus an
+    exploration bonus that shrinks as it is visited more.
+    Unvisited children come first
+
+    Input:
+    node - expanded node
+
+    Return:
+    Pointer to the chosen child
+********************************************************************/
+static MctsNode *selectChild(MctsNode *node) {
+    MctsNode *best = NULL;
+    double bestValue = -1;
+    double logVisits = log(atomic_load_explicit(&node->visits, memory_order_relaxed) + 1);
+
+    for(int i = 0; i < node->childCount; i++) {
+        MctsNode *child = &nodePool[node->firstChild + i];
+        int visits = atomic_load_explicit(&child->visits, memory_order_relaxed);
+        if(visits == 0) return child;
+
+        double average = atomic_load_explicit(&child->score, memory_order_relaxed) / (2.0 * visits);
+        double value = average + MCTS_EXPLORATION * sqrt(logVisits / visits);
+        if(value > bestValue) {
+            bestValue = value;
+            best = child;
+        }
+    }
+    return best;
+}
+
+/*******************************************************************
+function: rollout
+    plays random moves to the end of the game
+
+    Input:
+    geo - board geometry
+    pieces - position, changed by the playout
+    side - side to move, 0 = computer, 1 = player
+
+    Return:
+    side that won, -1 for a draw
+********************************************************************/
+static int rollout(const BoardGeometry *geo, Bitboard pieces[2], int side) {
+    Bitboard empty = geo->full & ~(pieces[0] | pieces[1]);
+
+    while(empty) {
+        int cell = randomCell(empty);
+        pieces[side] |= BB_CELL(cell);
+        empty &= ~BB_CELL(cell);
+        if(bbHasWon(geo, pieces[side])) return side;
+        side = !side;
+    }
+    return -1;
+}
+
+/*******************************************************************
+function: playout
+    one MCTS iteration: select down the tree with UCT, expand,
+    play randomly to the end and add the result to every node
+    on the path
+
+    Input:
+    search - Pointer to the running search
+********************************************************************/
+static void playout(MctsSearch *search) {
+    MctsNode *path[MAX_CELLS + 1];
+    int length = 0;
+    Bitboard pieces[2] = {search->pieces[0], search->pieces[1]};
+    int side = 0;       // Side to move at the current node
+    int winner = -2;    // -2 = not decided yet, -1 = draw
+
+    MctsNode *node = &nodePool[0];
+    atomic_fetch_add_explicit(&node->visits, 1, memory_order_relaxed);
+    path[length++] = node;
+
+    while(winner == -2) {
+        Bitboard empty = search->geo->full & ~(pieces[0] | pieces[1]);
+
+        if(atomic_load_explicit(&node->state, memory_order_acquire) != MCTS_EXPANDED) {
+            if(atomic_load_explicit(&node->visits, memory_order_relaxed) >= MCTS_EXPAND_VISITS) expand(node, empty);
+            if(atomic_load_explicit(&node->state, memory_order_acquire) != MCTS_EXPANDED) {
+                winner = rollout(search->geo, pieces, side);
+                break;
+            }
+        }
+
+        // Descend, the visit counts as a loss until the result is added
+        node = selectChild(node);
+        atomic_fetch_add_explicit(&node->visits, 1, memory_order_relaxed);
+        path[length++] = node;
+
+        pieces[side] |= BB_CELL(node->cell);
+        if(bbHasWon(search->geo, pieces[side])) winner = side;
+        else if(!(search->geo->full & ~(pieces[0] | pieces[1]))) winner = -1;
+        side = !side;
+    }
+
+    // Node i was moved into by the side opposite the one to move there
+    for(int i = length - 1, mover = !side; i >= 0; i--, mover = !mover) {
+        int points = (winner == -1) ? 1 : (winner == mover) ? 2 : 0;
+        if(points) atomic_fetch_add_explicit(&path[i]->score, points, memory_order_relaxed);
+    }
+}
+
+/*******************************************************************
+function: searchTask
+    runs playouts on one thread until a budget runs out
+
+    Input:
+    arg - Pointer to the MctsSearch
+********************************************************************/
+static void searchTask(void *arg) {
+    MctsSearch *search = arg;
+
+    for(long done = 0; ; done++) {
+        if(search->playouts > 0 && atomic_fetch_add(&search->started, 1) >= search->playouts) break;
+        // Checking the clock every playout would cost more than the playout
+        if(search->deadline > 0 && (done & 63) == 0 && nowSeconds() > search->deadline) break;
+        playout(search);
+    }
+}
+
+/*******************************************************************
+function: mctsSearch
+    Monte Carlo tree search for the computer's move. Threads of
+    the thread pool share one tree, stopping once mctsPlayouts
+    playouts are done or mctsTimeBudget seconds have passed
+
+    Input:
+    geo - board geometry
+    computer - cells marked by the computer
+    player - cells marked by the player
+
+    Return:
+    cell index of the most visited move, -1 if the board is full
+********************************************************************/
+int mctsSearch(const BoardGeometry *geo, Bitboard computer, Bitboard player) {
+    Bitboard empty = geo->full & ~(computer | player);
+    if(!empty) return -1;
+    // Only one move, nothing to search
+    if(BB_COUNT(empty) == 1) return BB_FIRST(empty);
+
+    if(!nodePool) {
+        nodePool = malloc(sizeof(MctsNode) * MCTS_POOL_NODES);
+        if(!nodePool) {
+            fprintf(stderr, "Failed to allocate MCTS node pool\n");
+            return BB_FIRST(empty);
+        }
+    }
+
+    MctsSearch search = {.geo = geo, .pieces = {computer, player}};
+    search.playouts = mctsPlayouts;
+    search.deadline = (mctsTimeBudget > 0) ? nowSeconds() + mctsTimeBudget : 0;
+    if(search.playouts <= 0 && search.deadline == 0) search.playouts = MCTS_DEFAULT_PLAYOUTS;
+    atomic_init(&search.started, 0);
+
+    // Root sits at index 0 and is expanded up front
+    atomic_init(&nodesUsed, 1);
+    atomic_init(&nodePool[0].visits, 0);
+    atomic_init(&nodePool[0].score, 0);
+    atomic_init(&nodePool[0].state, MCTS_LEAF);
+    expand(&nodePool[0], empty);
+
+    // One task per pool thread, all sharing the tree
+    int threads = (mctsThreads > 0) ? mctsThreads : poolCpuCount();
+    if(threads > 1 && poolSize() < threads) poolStart(threads);
+    int tasks = (poolSize() < threads) ? poolSize() : threads;
+    if(tasks < 1) tasks = 1;
+
+    double begin = nowSeconds();
+    PoolGroup group = {0};
+    for(int i = 0; i < tasks; i++) poolSubmit(&group, searchTask, &search);
+    poolWait(&group);
+
+    // Most visited move is the most reliable, lower cell first on ties
+    MctsNode *root = &nodePool[0];
+    MctsNode *best = &nodePool[root->firstChild];
+    for(int i = 1; i < root->childCount; i++) {
+        MctsNode *child = &nodePool[root->firstChild + i];
+        if(atomic_load(&child->visits) > atomic_load(&best->visits)) best = child;
+    }
+
+    int visits = atomic_load(&best->visits);
+    if(mctsStatsDump) fprintf(stderr, "mcts: %d playouts on %d threads, %d nodes, %.3fs, best move wins %.1f%%\n",
+        atomic_load(&root->visits), tasks, atomic_load(&nodesUsed), nowSeconds() - begin,
+        visits ? 50.0 * atomic_load(&best->score) / visits : 0.0);
+    return best->cell;
+}
+
+/********************************************************************************
+function: mctsAi
+    converts the GUI board to bitboards, searches the computer's
+    move and marks it on the board
+
+    Input:
+    board - game board, boardSize x boardSize cells are used
+********************************************************************************/
+void mctsAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    static BoardGeometry geometry;
+    Bitboard computer = 0;
+    Bitboard player = 0;
+
+    // Lines only change with the rules
+    if(geometry.size != boardSize || geometry.winLength != winLength) {
+        bbGeometryInit(&geometry, boardSize, winLength);
+    }
+
+    for(int i = 0; i < boardSize; i++) {
+        for(int j = 0; j < boardSize; j++) {
+            if(board[i][j] == X_PLAYER) computer |= BB_CELL(i * boardSize + j);
+            if(board[i][j] == O_PLAYER) player |= BB_CELL(i * boardSize + j);
+        }
+    }
+
+    int cell = mctsSearch(&geometry, computer, player);
+    if(cell >= 0) board[cell / boardSize][cell % boardSize] = X_PLAYER;
+}
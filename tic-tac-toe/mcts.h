@@ -0,0 +1,21 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef MCTS_H  /* Run the following if MCTS_H has not been defined */
+#define MCTS_H  /* Defines MCTS_H */
+
+#include <stdbool.h>
+#include "bitboard.h"
+
+#define MCTS_POOL_NODES (1 << 20)           // Tree nodes allocated once and reused every move
+#define MCTS_DEFAULT_PLAYOUTS 100000        // Playouts per move when neither budget is set
+#define MCTS_EXPAND_VISITS 2                // Visits before a leaf gets its children
+#define MCTS_EXPLORATION 1.4                // UCT exploration constant
+
+extern int mctsPlayouts;        // Playouts per move, 0 = no limit
+extern double mctsTimeBudget;   // Seconds per move, 0 = no limit
+extern int mctsThreads;         // Threads running playouts, 0 = one per processor
+extern bool mctsStatsDump;      // Print the counters of every computer move to stderr
+
+int mctsSearch(const BoardGeometry* geo, Bitboard computer, Bitboard player);
+void mctsAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+
+#endif  /* End of header file */
@@ -1,5 +1,304 @@
 /* Define preprocessor statements */
 #include "minimax.h"
+#include "transposition.h"
+#include "symmetry.h"
+#include "perfect_table.h"
+#include "retro_db.h"
+#include "threadpool.h"
+#include "search_common.h"
+#include "q_learning.h"
+#include <stdatomic.h>
+#include <pthread.h>
+
+bool usePerfectTable = true;    // Look up generated scores before falling back to search
+int mmThreads = 1;              // Serial root search until mmSetThreads() is called
+int mmSearchDepth = 0;          // Set by mmSetRules() for the board size
+double mmTimeBudget = 1.0;      // Seconds per computer move, 0 = no limit
+bool mmUseQOrdering = false;    // Hybrid mode off, moves ordered by history
+bool mmStatsDump = false;       // Computer moves print nothing until MM_STATS sets this
+BoardGeometry mmGeometry;       // Set by mmSetRules(), 3x3 until then
+
+static bool rulesReady = false;
+
+// Default plies searched for each board side, 0 = to the end of the game
+static const int defaultSearchDepth[MAX_BITBOARD_SIZE + 1] = {0, 0, 0, 0, 0, 6, 5, 4, 4};
+
+// Heuristic value of an open line holding n marks of one side and none of the other
+static const int lineWeight[MAX_BITBOARD_SIZE + 1] = {0, 1, 4, 16, 48, 96, 160, 240, 320};
+
+// History scores are halved once one passes this, keeps recent cutoffs ahead
+#define HISTORY_LIMIT (1 << 20)
+
+// Winning lines through each cell, static move ordering. Set by mmSetRules()
+static int linesThrough[MAX_CELLS];
+
+// Q-values of every 3x3 afterstate, chance X wins after the move. Index is
+// the base-3 number with digit 1 for X and 2 for O at cell (row * 3 + col)
+static float qOrderValue[QTABLE_STATES];    // 0.5 for states the Q-table never saw
+static int qOrderBase3[1 << 9];             // Base-3 weight of every set of 3x3 cells
+static bool qOrderReady = false;            // Set once mmLoadQOrdering() found values
+static bool qOrderTried = false;            // Q-table is only read once
+
+// Move ordering state, private to each searching thread
+static _Thread_local int killers[MAX_CELLS + 1][2];    // Last two cutoff moves at each ply
+static _Thread_local int history[2][MAX_CELLS];         // Cutoffs per side and cell, weighted by depth
+
+// Search counters of one thread, summed into MmSearchStats by searchRootMoves()
+typedef struct {
+    long nodes;
+    long cutoffs;
+    long cutoffsAt[MM_CUTOFF_SLOTS];    // By index of the move tried
+    long ttHits;
+    long ttMisses;
+    int maxPly;
+} SearchCounters;
+
+static _Thread_local SearchCounters searchCount;
+
+// Deadline and cancellation are checked once every this many nodes (power of 2)
+#define STOP_POLL_NODES 1024
+
+// Control of the running search, set by mmSearchTimed()
+static int searchDepthLimit = 0;        // Plies of the current iteration, 0 = to the end
+static atomic_bool searchStopped;       // Set once the deadline passes or the token is cancelled
+static MmCancelToken *searchToken;      // Token of the running search, NULL if none
+static double searchDeadline = 0;       // Monotonic seconds, 0 = no deadline
+
+// Highest exact root scores found so far. A move stands for all its
+// mirror images, so its score is counted once per mirror cell
+typedef struct {
+    int lines;                  // Scores wanted, n of mmSearchRoot()
+    int count;                  // Scores kept, at most lines
+    int top[MAX_CELLS];         // Highest first
+} RootRanking;
+
+// State shared by the threads of one root search
+typedef struct {
+    atomic_int floor;           // Lowest score still in the ranking, shared alpha bound
+    pthread_mutex_t lock;       // Guards ranking
+    RootRanking ranking;
+    struct RootTask *tasks;     // Root moves of the search
+    int count;                  // Root moves in tasks
+    atomic_int next;            // Next root move for a worker to take
+} RootShared;
+
+// One root move searched on a worker thread
+typedef struct RootTask {
+    RootShared *shared;
+    GameState game;             // Private copy of the position
+    int cell;                   // Root move searched
+    int mirrors;                // Empty cells the move stands for, itself included
+    int score;                  // Result, exact when exact is set
+    bool exact;                 // Otherwise score is an upper bound below the final floor
+    SearchCounters counters;    // Search counters of the task
+    double seconds;             // Thread time the task took
+} RootTask;
+
+// Computer move searched on a background thread, see aiStart()
+static struct {
+    pthread_t thread;
+    bool running;               // Started and not yet collected or cancelled
+    bool joinable;              // thread was created, false if the move was made inline
+    atomic_bool done;           // Move made, ready for aiPoll()
+    MmCancelToken token;
+    int difficulty;
+    GameState game;             // Private copy of the board, searched by the thread
+} aiJob;
+
+// Computer replies searched while the player thinks, see aiPonderStart()
+static struct {
+    pthread_t thread;
+    bool running;               // Started and not yet stopped
+    bool joinable;              // thread was created
+    MmCancelToken token;
+    int difficulty;
+    int size;                   // Rules the replies were searched under
+    int winLength;
+    GameState game;             // Position with the player to move
+    bool ready[MAX_CELLS];      // Reply to the player marking this cell is stored
+    int count[MAX_CELLS];       // Moves ranked for the reply
+    RootMove ranked[MAX_CELLS][2];
+} ponder;
+
+// Counters of the last computer move, see mmLastStats()
+static MmSearchStats lastSearch;
+
+static void chooseMove(GameState *game, int difficulty, MmCancelToken *token, MmSearchStats *stats);
+static void ponderStop(void);
+static int ponderLookup(const GameState *game, RootMove ranked[2]);
+static int orderMoves(GameState *game, Bitboard candidates, int side, int depth, int hashMove, int moves[MAX_CELLS]);
+static void resetSearchHeuristics(void);
+
+/********************************************************
+function: searchShouldStop
+    polls the deadline and cancellation token every
+    STOP_POLL_NODES nodes of the calling thread, other
+    threads see the result through searchStopped
+********************************************************/
+static inline bool searchShouldStop(void) {
+    if(atomic_load_explicit(&searchStopped, memory_order_relaxed)) return true;
+    if(searchCount.nodes & (STOP_POLL_NODES - 1)) return false;
+
+    if((searchToken && atomic_load(&searchToken->cancelled)) ||
+       (searchDeadline > 0 && nowSeconds() > searchDeadline)) {
+        atomic_store(&searchStopped, true);
+        return true;
+    }
+    return false;
+}
+
+/********************************************************
+function: emptyCells
+    bitmask of every unmarked cell
+
+    Input:
+    game - Pointer to access all variables in GameState
+********************************************************/
+static inline Bitboard emptyCells(const GameState *game) {
+    return ~(game->pieces[SIDE_X] | game->pieces[SIDE_O]) & mmGeometry.full;
+}
+
+/********************************************************
+function: toggleCell
+    marks or unmarks a cell and updates the Zobrist hash
+
+    Input:
+    game - Pointer to access all variables in GameState
+    side - SIDE_X or SIDE_O
+    cell - cell index (row * size + col)
+********************************************************/
+static inline void toggleCell(GameState *game, int side, int cell) {
+    game->pieces[side] ^= BB_CELL(cell);
+    for(int s = 0; s < NUM_SYMMETRIES; s++) {
+        game->hash[s] ^= zobristKeys[side][symPerm[s][cell]];
+    }
+}
+
+/********************************************************
+function: canonicalKey
+    all 8 symmetric versions of a position share one table
+    entry: the smallest of their hashes
+
+    Input:
+    game - Pointer to access all variables in GameState
+    sym - set to the symmetry giving the canonical position
+
+    Return:
+    canonical hash (side to move is not included)
+********************************************************/
+static inline uint64_t canonicalKey(const GameState *game, int *sym) {
+    *sym = SYM_IDENTITY;
+    for(int s = 1; s < NUM_SYMMETRIES; s++) {
+        if(game->hash[s] < game->hash[*sym]) *sym = s;
+    }
+    return game->hash[*sym];
+}
+
+/********************************************************
+function: perfectTableScores
+    finds the generated move scores of a position
+
+    Input:
+    game - Pointer to access all variables in GameState
+
+    Return:
+    score of every cell for X, NULL if position not stored
+    or the board is not the 3x3 one the table was made for
+********************************************************/
+static const int8_t *perfectTableScores(const GameState *game) {
+    if(mmGeometry.size != 3 || mmGeometry.winLength != 3) return NULL;
+
+    int key = perfectBase3[game->pieces[SIDE_X]] + 2 * perfectBase3[game->pieces[SIDE_O]];
+    int row = perfectIndex[key];
+    return row ? perfectScores[row] : NULL;
+}
+
+/********************************************************
+function: retroScores
+    scores every move of a 4x4 position from the
+    retrograde database, on the minimax() scale
+
+    Input:
+    game - Pointer to access all variables in GameState
+    scores - filled in for every empty cell
+
+    Return:
+    boolean value - were all moves found in the database
+********************************************************/
+static bool retroScores(const GameState *game, int scores[MAX_CELLS]) {
+    if(mmGeometry.size != RETRO_SIZE) return false;
+    const uint8_t *entries = retroEntries(mmGeometry.winLength);
+    // Entries only hold positions the player (O) started
+    if(!entries || BB_COUNT(game->pieces[SIDE_O]) != BB_COUNT(game->pieces[SIDE_X]) + 1) return false;
+
+    for(Bitboard moves = emptyCells(game); moves; moves &= moves - 1) {
+        int cell = BB_FIRST(moves);
+        uint8_t entry = entries[retroIndex(game->pieces[SIDE_X] | BB_CELL(cell), game->pieces[SIDE_O])];
+        int distance = RETRO_DISTANCE(entry);
+
+        // Entry is for the player, who moves next
+        switch(RETRO_RESULT(entry)) {
+            case RETRO_LOSS: scores[cell] = MM_WIN_SCORE - distance; break;
+            case RETRO_WIN: scores[cell] = -MM_WIN_SCORE + distance; break;
+            case RETRO_DRAW: scores[cell] = 0; break;
+            default: return false;
+        }
+    }
+    return true;
+}
+
+/********************************************************
+function: perfectScore
+    converts a generated table score (10 - plies for a win)
+    to the MM_WIN_SCORE scale used by the search
+********************************************************/
+static inline int perfectScore(int tableScore) {
+    if(tableScore > 0) return tableScore + MM_WIN_SCORE - 10;
+    if(tableScore < 0) return tableScore - MM_WIN_SCORE + 10;
+    return 0;
+}
+
+/********************************************************************************
+function: loadBoard
+    converts the GUI board to GameState format, computer to move
+
+    Input:
+    game - Pointer to the GameState filled in
+    board - game board, boardSize x boardSize cells are used
+    num_wins - number of wins and draws for ai
+********************************************************************************/
+static void loadBoard(GameState *game, char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins) {
+    game->wins = num_wins;
+    game->currentPlayer = PLAYER_X;  // CPU is X
+    game->gameOver = false;          // game ongoing
+    game->pieces[SIDE_X] = 0;
+    game->pieces[SIDE_O] = 0;
+
+    // Copy GUI board into the bitboards
+    for(int i = 0; i < mmGeometry.size; i++) {
+        for(int j = 0; j < mmGeometry.size; j++) {
+            if(board[i][j] == PLAYER_X) game->pieces[SIDE_X] |= CELL_BIT(i, j);
+            if(board[i][j] == PLAYER_O) game->pieces[SIDE_O] |= CELL_BIT(i, j);
+        }
+    }
+    zobristHash(game);
+}
+
+/********************************************************************************
+function: storeBoard
+    copies the GameState back to the GUI board
+
+    Input:
+    game - Pointer to access all variables in GameState
+    board - game board, boardSize x boardSize cells are written
+********************************************************************************/
+static void storeBoard(GameState *game, char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    for(int i = 0; i < mmGeometry.size; i++) {
+        for(int j = 0; j < mmGeometry.size; j++) {
+            board[i][j] = getCell(game, i, j);
+        }
+    }
+}
 
 /********************************************************************************
 function: ai  
@@ -7,33 +306,222 @@ function: ai
     copy duplicated board content back to actual board once computer made a move
 
     Input:
-    board[3][3] - game board
+    board - game board, boardSize x boardSize cells are used
     num_wins - number of wins and draws for ai
     difficulty - difficulty level of ai
 ********************************************************************************/
-void ai(char board[3][3], int num_wins, int difficulty) {
+void ai(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins, int difficulty) {
+    // Search and pondering share the engine, one at a time
+    ponderStop();
+    // Set up engine for the board being played
+    mmSetRules(boardSize, winLength);
+
     // Convert the char board to GameState format
     GameState gameState;
-    gameState.wins = num_wins;
-    gameState.currentPlayer = PLAYER_X;  // CPU is X
-    gameState.gameOver = false;          // game ongoing
-
-    // Copy GUI board to gameState board
-    for(int i = 0; i < BOARD_SIZE; i++) {
-        for(int j = 0; j < BOARD_SIZE; j++) {
-            gameState.board[i][j] = board[i][j];
-        }
-    }
+    loadBoard(&gameState, board, num_wins);
     
-    mmMove(&gameState);
+    chooseMove(&gameState, difficulty, NULL, NULL);
 
     // Copy board back to GUI board
-    for(int i = 0; i < BOARD_SIZE; i++) {
-        for(int j = 0; j < BOARD_SIZE; j++) {
-            board[i][j] = gameState.board[i][j];
-        }
+    storeBoard(&gameState, board);
+}
+
+/********************************************************************************
+function: aiThread
+    background thread of aiStart(), searches and makes the computer's move
+********************************************************************************/
+static void *aiThread(void *arg) {
+    (void)arg;
+    chooseMove(&aiJob.game, aiJob.difficulty, &aiJob.token, NULL);
+    atomic_store(&aiJob.done, true);
+    return NULL;
+}
+
+/********************************************************************************
+function: aiStart
+    starts searching the computer's move on a background thread so
+    the GUI keeps drawing. Collect the move with aiPoll()
+
+    Input:
+    board - game board, boardSize x boardSize cells are used
+    num_wins - number of wins and draws for ai
+    difficulty - difficulty level of ai
+
+    Return:
+    boolean value - was a new search started, false while one is running
+********************************************************************************/
+bool aiStart(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins, int difficulty) {
+    if(aiJob.running) return false;
+
+    // Search and pondering share the engine, one at a time
+    ponderStop();
+
+    // Set up engine for the board being played
+    mmSetRules(boardSize, winLength);
+    loadBoard(&aiJob.game, board, num_wins);
+    aiJob.difficulty = difficulty;
+    atomic_store(&aiJob.token.cancelled, false);
+    atomic_store(&aiJob.done, false);
+
+    aiJob.running = true;
+    aiJob.joinable = (pthread_create(&aiJob.thread, NULL, aiThread, NULL) == 0);
+    // No thread available, search on this one instead
+    if(!aiJob.joinable) aiThread(NULL);
+    return true;
+}
+
+/********************************************************************************
+function: aiPoll
+    checks whether the search started by aiStart() has made its move
+
+    Input:
+    board - game board, receives the computer's move once ready
+
+    Return:
+    boolean value - has the move been copied to board
+********************************************************************************/
+bool aiPoll(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    if(!aiJob.running || !atomic_load(&aiJob.done)) return false;
+
+    if(aiJob.joinable) pthread_join(aiJob.thread, NULL);
+    aiJob.running = false;
+    storeBoard(&aiJob.game, board);
+    return true;
+}
+
+/********************************************************************************
+function: ponderStop
+    stops pondering and waits for its thread. Replies already
+    stored stay available to ponderLookup()
+********************************************************************************/
+static void ponderStop(void) {
+    if(!ponder.running) return;
+
+    atomic_store(&ponder.token.cancelled, true);
+    if(ponder.joinable) pthread_join(ponder.thread, NULL);
+    ponder.running = false;
+}
+
+/********************************************************************************
+function: ponderLookup
+    finds the reply pondered for a position, the player's
+    move must be the only change since pondering started
+
+    Input:
+    game - Pointer to the position, computer to move
+    ranked - receives the stored best moves
+
+    Return:
+    number of moves stored in ranked, -1 if the reply was not pondered
+********************************************************************************/
+static int ponderLookup(const GameState *game, RootMove ranked[2]) {
+    // Replies belong to the rules and position pondering started from
+    if(ponder.size != mmGeometry.size || ponder.winLength != mmGeometry.winLength) return -1;
+    if(game->pieces[SIDE_X] != ponder.game.pieces[SIDE_X]) return -1;
+
+    Bitboard added = game->pieces[SIDE_O] & ~ponder.game.pieces[SIDE_O];
+    if((game->pieces[SIDE_O] & ponder.game.pieces[SIDE_O]) != ponder.game.pieces[SIDE_O]) return -1;
+    if(BB_COUNT(added) != 1 || !ponder.ready[BB_FIRST(added)]) return -1;
+
+    int cell = BB_FIRST(added);
+    for(int i = 0; i < ponder.count[cell]; i++) ranked[i] = ponder.ranked[cell][i];
+    return ponder.count[cell];
+}
+
+/********************************************************************************
+function: ponderThread
+    background thread of aiPonderStart(), searches the computer's
+    reply to every move the player can make, likely moves first
+********************************************************************************/
+static void *ponderThread(void *arg) {
+    (void)arg;
+    int moves[MAX_CELLS];
+    // Full difficulty always plays the best move, no need to rank the second
+    int lines = (ponder.difficulty >= 100) ? 1 : 2;
+
+    resetSearchHeuristics();
+    int count = orderMoves(&ponder.game, emptyCells(&ponder.game), SIDE_O, 0, -1, moves);
+
+    for(int i = 0; i < count && !atomic_load(&ponder.token.cancelled); i++) {
+        int cell = moves[i];
+        GameState reply = ponder.game;
+
+        // Simulate player move
+        toggleCell(&reply, SIDE_O, cell);
+        // Game over after the player's move, nothing to reply
+        if(checkWin(&reply, PLAYER_O) || isBoardFull(&reply)) continue;
+
+        int found = mmSearchTimed(&reply, ponder.ranked[cell], lines, mmTimeBudget, &ponder.token, NULL);
+        if(atomic_load(&ponder.token.cancelled)) break;
+
+        ponder.count[cell] = found;
+        ponder.ready[cell] = true;
     }
+    return NULL;
+}
+
+/********************************************************************************
+function: aiPonderStart
+    starts searching the computer's replies on a background thread
+    while the player chooses a move. aiStart() and ai() then play
+    the stored reply without searching
+
+    Input:
+    board - game board with the player to move
+    num_wins - number of wins and draws for ai
+    difficulty - difficulty level of ai
+********************************************************************************/
+void aiPonderStart(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins, int difficulty) {
+    if(ponder.running || aiJob.running) return;
+
+    // Set up engine for the board being played
+    mmSetRules(boardSize, winLength);
+    loadBoard(&ponder.game, board, num_wins);
+    ponder.difficulty = difficulty;
+    ponder.size = mmGeometry.size;
+    ponder.winLength = mmGeometry.winLength;
+    for(int cell = 0; cell < MAX_CELLS; cell++) ponder.ready[cell] = false;
+    atomic_store(&ponder.token.cancelled, false);
+
+    ponder.running = true;
+    ponder.joinable = (pthread_create(&ponder.thread, NULL, ponderThread, NULL) == 0);
+    // Pondering is only worth it in the background
+    if(!ponder.joinable) ponder.running = false;
+}
+
+/********************************************************************************
+function: aiCancel
+    stops the search started by aiStart() and pondering, and waits
+    for their threads. The move is dropped, the board is left untouched
+********************************************************************************/
+void aiCancel(void) {
+    ponderStop();
+    // Stored replies belong to the game being left
+    for(int cell = 0; cell < MAX_CELLS; cell++) ponder.ready[cell] = false;
+
+    if(!aiJob.running) return;
+
+    atomic_store(&aiJob.token.cancelled, true);
+    if(aiJob.joinable) pthread_join(aiJob.thread, NULL);
+    aiJob.running = false;
+}
 
+/********************************************************
+function: getCell
+    reads the symbol of a cell from the bitboards
+
+    Input:
+    game - Pointer to access all variables in GameState
+    row - row of cell
+    col - column of cell
+
+    Return:
+    PLAYER_X, PLAYER_O or EMPTY
+********************************************************/
+unsigned char getCell(GameState *game, int row, int col) {
+    if(game->pieces[SIDE_X] & CELL_BIT(row, col)) return PLAYER_X;
+    if(game->pieces[SIDE_O] & CELL_BIT(row, col)) return PLAYER_O;
+    return EMPTY;
 }
 
 /********************************************************
@@ -48,21 +536,25 @@ function: displayBoard
 ********************************************************/
 void displayBoard(GameState *game) {
     printf("\n");
-    printf("\n   +---+---+---+\n");
+    printf("\n   +");
+    for(int j = 0; j < mmGeometry.size; j++) printf("---+");
+    printf("\n");
     // Check every cell content
-    for(int i = 0; i < BOARD_SIZE; i++) {
+    for(int i = 0; i < mmGeometry.size; i++) {
         printf("   |");
-        for(int j = 0; j < BOARD_SIZE; j++) {
+        for(int j = 0; j < mmGeometry.size; j++) {
             // If cell is empty
             char symbol = ' ';
             // If cell marked by computer
-            if(game->board[i][j] == PLAYER_X) symbol = 'X';
+            if(getCell(game, i, j) == PLAYER_X) symbol = 'X';
             // If cell marked by player
-            if(game->board[i][j] == PLAYER_O) symbol = 'O';
+            if(getCell(game, i, j) == PLAYER_O) symbol = 'O';
             printf(" %c |", symbol);
         }
         printf("\n");
-        printf("   +---+---+---+\n");
+        printf("   +");
+        for(int j = 0; j < mmGeometry.size; j++) printf("---+");
+        printf("\n");
     }
     printf("\n");
 }
@@ -82,9 +574,9 @@ function: mmMove
 ********************************************************/
 bool makeMove(GameState *game, int row, int col) {
     // Check if selected cell is valid move
-    if (game->board[row][col] == EMPTY && !game->gameOver) {
+    if ((emptyCells(game) & CELL_BIT(row, col)) && !game->gameOver) {
         // Mark cell with current player's symbol
-        game->board[row][col] = game->currentPlayer;
+        toggleCell(game, SIDE_OF(game->currentPlayer), row * mmGeometry.size + col);
 
         // Display board after move
         displayBoard(game);
@@ -120,59 +612,256 @@ function: checkWin
     boolean value - has winning conditions been met
 ********************************************************/
 bool checkWin(GameState *game, unsigned char player) {
-    // Check rows = current player symbol
-    for(int i = 0; i < BOARD_SIZE; i++) {
-        if(game->board[i][0] == player &&
-           game->board[i][1] == player &&
-           game->board[i][2] == player) {
-            return true;
-        }
+    // Check every row, column and diagonal for k marks in a row
+    return bbHasWon(&mmGeometry, game->pieces[SIDE_OF(player)]);
+}
+
+/*******************************************************************
+function: isBoardFull
+    check for empty cells
+
+    Input:
+    game - Pointer to access all variables in GameState
+
+    Return:
+    boolean value - if cell is empty
+********************************************************************/
+bool isBoardFull(GameState *game) {
+    // Board is full once every cell is marked by either side
+    return BB_COUNT(game->pieces[SIDE_X] | game->pieces[SIDE_O]) == mmGeometry.cells;
+}
+
+/*******************************************************************
+function: evaluate
+    estimates an unfinished position when the search stops
+    before the end of the game. Every line still open for one
+    side counts for that side, more so the fuller it is
+
+    Input:
+    game - Pointer to access all variables in GameState
+
+    Return:
+    score for computer, within +/- MM_EVAL_LIMIT
+********************************************************************/
+int evaluate(GameState *game) {
+    int score = 0;
+
+    for(int i = 0; i < mmGeometry.lineCount; i++) {
+        Bitboard line = mmGeometry.lines[i];
+        int computer = BB_COUNT(game->pieces[SIDE_X] & line);
+        int player = BB_COUNT(game->pieces[SIDE_O] & line);
+
+        // Lines holding both marks can no longer be won
+        if(computer && !player) score += lineWeight[computer];
+        if(player && !computer) score -= lineWeight[player];
     }
 
-    // Check columns = current player symbol
-    for(int i = 0; i < BOARD_SIZE; i++) {
-        if(game->board[0][i] == player &&
-           game->board[1][i] == player &&
-           game->board[2][i] == player) {
-            return true;
+    if(score > MM_EVAL_LIMIT) score = MM_EVAL_LIMIT;
+    if(score < -MM_EVAL_LIMIT) score = -MM_EVAL_LIMIT;
+    return score;
+}
+
+/*******************************************************************
+function: orderMoves
+    sorts candidate moves so the likely best come first:
+    the table's best move, then the killer moves of this ply,
+    then by history score, then by how many winning lines pass
+    through the cell (centre and corners first). In the hybrid
+    mode the trained Q-value of the position after the move
+    takes the place of the history score on the 3x3 board
+
+    Input:
+    game - Pointer to the position the moves are made from
+    candidates - moves to order
+    side - SIDE_X or SIDE_O, side to move
+    depth - ply, selects the killer moves
+    hashMove - best move stored in the table, -1 if none
+    moves - filled with the cells in search order
+
+    Return:
+    number of moves
+********************************************************************/
+static int orderMoves(GameState *game, Bitboard candidates, int side, int depth, int hashMove, int moves[MAX_CELLS]) {
+    int keys[MAX_CELLS];
+    int count = 0;
+
+    bool learned = qOrderReady && mmUseQOrdering && mmGeometry.size == 3 && mmGeometry.winLength == 3;
+    int position = learned ? qOrderBase3[game->pieces[SIDE_X]] + 2 * qOrderBase3[game->pieces[SIDE_O]] : 0;
+
+    for(; candidates; candidates &= candidates - 1) {
+        int cell = BB_FIRST(candidates);
+        int key = history[side][cell] * MAX_WIN_LINES + linesThrough[cell];
+
+        if(learned) {
+            // Chance the side to move wins after the move, in thousandths
+            float value = qOrderValue[position + Q_DIGIT((side == SIDE_X) ? CPU : HUMAN) * Q_POW3[cell]];
+            if(side == SIDE_O) value = 1.0f - value;
+            value = (value < 0.0f) ? 0.0f : (value > 1.0f) ? 1.0f : value;
+            key = (int)(value * 1000) * MAX_WIN_LINES + linesThrough[cell];
         }
-    }
 
-    // Check diagonals = current player symbol
-    if(game->board[0][0] == player &&
-       game->board[1][1] == player &&
-       game->board[2][2] == player) {
-        return true;
+        if(cell == hashMove) key = INT32_MAX;
+        else if(cell == killers[depth][0]) key = INT32_MAX - 2;
+        else if(cell == killers[depth][1]) key = INT32_MAX - 3;
+
+        // Insertion sort, highest key first, lower cell first on ties
+        int i = count++;
+        while(i > 0 && keys[i - 1] < key) {
+            keys[i] = keys[i - 1];
+            moves[i] = moves[i - 1];
+            i--;
+        }
+        keys[i] = key;
+        moves[i] = cell;
     }
+    return count;
+}
 
-    if(game->board[0][2] == player &&
-       game->board[1][1] == player &&
-       game->board[2][0] == player) {
-        return true;
+/*******************************************************************
+function: rememberCutoff
+    records a move that caused a beta cutoff so it is tried
+    early in sibling positions (killer) and elsewhere (history)
+
+    Input:
+    side - SIDE_X or SIDE_O, side that played the move
+    depth - ply of the move
+    remaining - plies searched below the move
+    cell - cell index of the move
+********************************************************************/
+static void rememberCutoff(int side, int depth, int remaining, int cell) {
+    if(killers[depth][0] != cell) {
+        killers[depth][1] = killers[depth][0];
+        killers[depth][0] = cell;
     }
 
-    return false;
+    history[side][cell] += remaining * remaining;
+    // Age every entry once one gets large so old cutoffs fade
+    if(history[side][cell] > HISTORY_LIMIT) {
+        for(int s = 0; s < 2; s++) {
+            for(int c = 0; c < MAX_CELLS; c++) history[s][c] /= 2;
+        }
+    }
 }
 
 /*******************************************************************
-function: isBoardFull
-    check for empty cells
+function: negamax
+    principal variation search from the side to move's point
+    of view: first move with the full window, every other move
+    with a null window, searched again only if it beats alpha
 
     Input:
     game - Pointer to access all variables in GameState
+    depth - turns in a game
+    alpha - lower bound for the side to move
+    beta - upper bound for the side to move
+    side - SIDE_X or SIDE_O, side to move
 
     Return:
-    boolean value - if cell is empty
+    bestScore - score for the side to move
 ********************************************************************/
-bool isBoardFull(GameState *game) {
-    for(int i = 0; i < BOARD_SIZE; i++) {
-        for(int j = 0; j < BOARD_SIZE; j++) {
-            if(game->board[i][j] == EMPTY) {
-                return false;
+static int negamax(GameState *game, int depth, int alpha, int beta, int side) {
+    searchCount.nodes++;
+    // Root moves are ply 1, so this node is one ply deeper than depth
+    if(depth + 1 > searchCount.maxPly) searchCount.maxPly = depth + 1;
+    // Stopped searches are thrown away, any score will do
+    if(searchShouldStop()) return 0;
+
+    // Check if either side has won, the side that just moved first
+    if(bbHasWon(&mmGeometry, game->pieces[!side])) return -MM_WIN_SCORE + depth;
+    if(bbHasWon(&mmGeometry, game->pieces[side])) return MM_WIN_SCORE - depth;
+    // Check if no empty cells, draw
+    if(isBoardFull(game)) return 0;
+
+    // Plies left to search below this position
+    int remaining = BB_COUNT(emptyCells(game));
+    if(searchDepthLimit > 0 && searchDepthLimit - 1 - depth < remaining) {
+        remaining = searchDepthLimit - 1 - depth;
+    }
+    // Out of depth, estimate the position instead
+    if(remaining <= 0) return (side == SIDE_X) ? evaluate(game) : -evaluate(game);
+
+    // Mate distance pruning: nothing here beats winning next ply
+    // or loses sooner than the ply after
+    int bestPossible = MM_WIN_SCORE - depth - 1;
+    int worstPossible = -MM_WIN_SCORE + depth + 2;
+    if(alpha < worstPossible) alpha = worstPossible;
+    if(beta > bestPossible) beta = bestPossible;
+    if(alpha >= beta) return alpha;
+
+    // Look up canonical position, side to move is part of the key
+    int sym;
+    uint64_t key = canonicalKey(game, &sym) ^ (side == SIDE_X ? 0 : zobristSide);
+    TTEntry entry;
+    int hashMove = -1;
+    bool found = ttProbe(key, &entry);
+    if(found) searchCount.ttHits++;
+    else searchCount.ttMisses++;
+    if(found) {
+        // Stored move is in the canonical orientation, map it back
+        if(entry.bestMove >= 0) hashMove = symPerm[symInverse[sym]][entry.bestMove];
+        if(entry.depth >= remaining) {
+            int stored = scoreFromTT(entry.score, depth, MM_WIN_BOUND);
+            if(entry.flag == TT_EXACT) return stored;
+            if(entry.flag == TT_LOWER && stored > alpha) alpha = stored;
+            if(entry.flag == TT_UPPER && stored < beta) beta = stored;
+            if(beta <= alpha) return stored;
+        }
+    }
+
+    // Window actually searched, decides the bound stored below
+    int alphaOrig = alpha;
+    int bestCell = -1;
+    int bestScore = -MM_INFINITY;
+
+    // Skip moves that mirror an earlier move in a symmetric position
+    Bitboard candidates = emptyCells(game);
+    candidates &= ~symRedundantMoves(candidates, symStabilizers(game));
+
+    int moves[MAX_CELLS];
+    int count = orderMoves(game, candidates, side, depth, hashMove, moves);
+
+    for(int i = 0; i < count; i++) {
+        int cell = moves[i];
+        int score;
+
+        // Simulate move
+        toggleCell(game, side, cell);
+        if(i == 0) {
+            score = -negamax(game, depth + 1, -beta, -alpha, !side);
+        }
+        else {
+            // Prove the move is no better than alpha, search properly if not
+            score = -negamax(game, depth + 1, -alpha - 1, -alpha, !side);
+            if(score > alpha && score < beta) {
+                score = -negamax(game, depth + 1, -beta, -alpha, !side);
             }
         }
+        // Undo simulated move
+        toggleCell(game, side, cell);
+        // Scores below a stopped search are meaningless, keep them out of the table
+        if(atomic_load_explicit(&searchStopped, memory_order_relaxed)) return 0;
+
+        //Evaluate best score
+        if(score > bestScore) {
+            bestScore = score;
+            bestCell = cell;
+        }
+        if(bestScore > alpha) alpha = bestScore;
+
+        // Alpha-beta pruning
+        if(alpha >= beta) {
+            searchCount.cutoffs++;
+            searchCount.cutoffsAt[(i < MM_CUTOFF_SLOTS) ? i : MM_CUTOFF_SLOTS - 1]++;
+            if(cell != hashMove) rememberCutoff(side, depth, remaining, cell);
+            break;
+        }
     }
-    return true;
+
+    // Remember result for later searches and later mmMove() calls
+    int flag = (bestScore <= alphaOrig) ? TT_UPPER : (bestScore >= beta) ? TT_LOWER : TT_EXACT;
+    ttStore(key, scoreToTT(bestScore, depth, MM_WIN_BOUND), remaining, flag, (bestCell < 0) ? -1 : symPerm[sym][bestCell]);
+
+    return bestScore;
 }
 
 /*******************************************************************
@@ -187,135 +876,563 @@ function: minimax
     isMaximizing - tell minimax() to simulate for computer or player
 
     Return:
-    bestScore - highest score from all possible moves
+    bestScore - score for computer of the position
 ********************************************************************/
 int minimax(GameState* game, int depth, int alpha, int beta, bool isMaximizing) {
-    // Check if player wins
-    if(checkWin(game, PLAYER_O)) return -10 + depth;
-    // Check if computer wins
-    if(checkWin(game, PLAYER_X)) return 10 - depth;
-    // Check if no empty cells, draw
-    if(isBoardFull(game)) return 0;
+    // Search runs from the side to move's point of view, computer is maximising
+    if(isMaximizing) return negamax(game, depth, alpha, beta, SIDE_X);
+    return -negamax(game, depth, -beta, -alpha, SIDE_O);
+}
 
-    // Maximise score for computer
-    if(isMaximizing) {
-        int bestScore = -1000; 
-        // Check every empty cell on board
-        for(int i = 0; i < BOARD_SIZE; i++) {
-            for(int j = 0; j < BOARD_SIZE; j++) {
-                if(game->board[i][j] == EMPTY) {
-                    // Simulate computer moves
-                    game->board[i][j] = PLAYER_X;
-                    // Recursively call minimax until game concludes
-                    int score = minimax(game, depth + 1, alpha, beta, false);
-                    // Undo simulated moves
-                    game->board[i][j] = EMPTY;
-                    //Evaluate best score
-                    bestScore = (score > bestScore) ? score : bestScore;
-                    alpha = (alpha > bestScore) ? alpha : bestScore;
-                    
-                    // Alpha-beta pruning
-                    if(beta <= alpha) {
-                        break;
-                    }
-                }
-            }
+/*******************************************************************
+function: resetSearchHeuristics
+    forgets killer moves and history of the calling thread
+********************************************************************/
+static void resetSearchHeuristics(void) {
+    memset(killers, -1, sizeof(killers));
+    memset(history, 0, sizeof(history));
+}
+
+
+/*******************************************************************
+function: mmSetRules
+    sets up the engine for a board size and win length.
+    Tables depend on both, so stored searches are forgotten
+    when either changes
+
+    Input:
+    size - board side, MIN_BOARD_SIZE to MAX_BITBOARD_SIZE
+    winLength - marks in a row needed, MIN_WIN_LENGTH to size
+********************************************************************/
+void mmSetRules(int size, int winLength) {
+    if(size < MIN_BOARD_SIZE) size = MIN_BOARD_SIZE;
+    if(size > MAX_BITBOARD_SIZE) size = MAX_BITBOARD_SIZE;
+    if(winLength > size) winLength = size;
+    if(winLength < MIN_WIN_LENGTH) winLength = MIN_WIN_LENGTH;
+
+    // Q-table is read the first time the hybrid mode is wanted
+    if(mmUseQOrdering && !qOrderTried) {
+        qOrderTried = true;
+        mmLoadQOrdering();
+    }
+
+    if(rulesReady && mmGeometry.size == size && mmGeometry.winLength == winLength) return;
+
+    bbGeometryInit(&mmGeometry, size, winLength);
+    symInit(size);
+    zobristInit();
+    ttClear();
+    mmSearchDepth = defaultSearchDepth[size];
+    searchDepthLimit = mmSearchDepth;
+
+    for(int cell = 0; cell < MAX_CELLS; cell++) {
+        linesThrough[cell] = 0;
+        for(int line = 0; line < mmGeometry.lineCount; line++) {
+            if(mmGeometry.lines[line] & BB_CELL(cell)) linesThrough[cell]++;
+        }
+    }
+    rulesReady = true;
+}
+
+/*******************************************************************
+function: mmLoadQOrdering
+    takes the move ordering values from the trained model
+    played in Q-learning mode, see qModel()
+
+    Return:
+    boolean value - were any Q-values found
+********************************************************************/
+bool mmLoadQOrdering(void) {
+    qOrderTried = true;
+    const QTable *table = qModel();
+    int known = 0;
+
+    // A missing or rejected model leaves every board unknown
+    if(!table) {
+        fprintf(stderr, "Q-learning model unavailable, moves keep the usual order\n");
+        return false;
+    }
+
+    // Same base-3 board index as the Q-table, boards it never saw score 0.5
+    for(int i = 0; i < QTABLE_STATES; i++) {
+        qOrderValue[i] = table->known[i] ? table->val[i] : 0.5f;
+        if(table->known[i] && i > 0) known++;
+    }
+
+    for(int cells = 1; cells < (1 << 9); cells++) {
+        qOrderBase3[cells] = qOrderBase3[cells & (cells - 1)] + Q_POW3[BB_FIRST(cells)];
+    }
+
+    qOrderReady = (known > 0);
+    if(!qOrderReady) fprintf(stderr, "Q-learning model has no learned boards, moves keep the usual order\n");
+    return qOrderReady;
+}
+
+/*******************************************************************
+function: mmSetThreads
+    sets how many threads search root moves in mmMove()
+
+    Input:
+    threads - threads to use, 0 for one per processor, 1 for serial search
+********************************************************************/
+void mmSetThreads(int threads) {
+    if(threads == 0) threads = poolCpuCount();
+    if(threads < 1) threads = 1;
+
+    // The pool is shared with MCTS, only ever grow it here
+    if(threads > 1 && poolSize() < threads && !poolStart(threads)) threads = 1;
+    mmThreads = threads;
+}
+
+/*******************************************************************
+function: mmSetQOrdering
+    turns the hybrid mode on or off. The 3x3 perfect play table
+    and the 4x4 database answer without searching, so they are
+    bypassed while the mode is on and the Q-values get used
+
+    Input:
+    on - order 3x3 moves by the trained Q-values
+********************************************************************/
+void mmSetQOrdering(bool on) {
+    mmUseQOrdering = on;
+    usePerfectTable = !on;
+}
+
+/*******************************************************************
+function: rankingFloor
+    score a root move must reach to enter the ranking
+
+    Input:
+    ranking - Pointer to the ranking
+
+    Return:
+    lowest ranked score, -MM_INFINITY while the ranking is not full
+********************************************************************/
+static int rankingFloor(const RootRanking *ranking) {
+    return (ranking->count < ranking->lines) ? -MM_INFINITY : ranking->top[ranking->lines - 1];
+}
+
+/*******************************************************************
+function: rankingInsert
+    adds an exact root score, once per mirror cell
+
+    Input:
+    ranking - Pointer to the ranking
+    score - exact score of the move
+    mirrors - empty cells the move stands for
+********************************************************************/
+static void rankingInsert(RootRanking *ranking, int score, int mirrors) {
+    for(int m = 0; m < mirrors; m++) {
+        int i = (ranking->count < ranking->lines) ? ranking->count++ : ranking->lines;
+        // Shift lower scores down, dropping the last when full
+        while(i > 0 && ranking->top[i - 1] < score) {
+            if(i < ranking->lines) ranking->top[i] = ranking->top[i - 1];
+            i--;
         }
-        return bestScore;
+        if(i < ranking->lines) ranking->top[i] = score;
+    }
+}
+
+/*******************************************************************
+function: rootTask
+    searches one root move. A null window at the ranking floor
+    first tests whether the move can be ranked at all, only
+    moves that reach the floor are searched again for their
+    exact score. Scores equal to the floor are made exact too,
+    ties are broken by cell index
+
+    Input:
+    arg - Pointer to the RootTask
+********************************************************************/
+static void rootTask(void *arg) {
+    RootTask *task = arg;
+    RootShared *shared = task->shared;
+    int floor = atomic_load_explicit(&shared->floor, memory_order_relaxed);
+
+    // Worker threads keep ordering state from earlier tasks, start afresh
+    resetSearchHeuristics();
+    searchCount = (SearchCounters){0};
+    double start = nowSeconds();
+
+    toggleCell(&task->game, SIDE_X, task->cell);
+    if(floor == -MM_INFINITY) {
+        task->score = minimax(&task->game, 0, -MM_INFINITY, MM_INFINITY, false);
     }
-    // Minimise score for player
     else {
-        int bestScore = 1000;
-        // Check every empty cell on board
-        for(int i = 0; i < BOARD_SIZE; i++) {
-            for(int j = 0; j < BOARD_SIZE; j++) {
-                if(game->board[i][j] == EMPTY) {
-                    // Simulate player moves
-                    game->board[i][j] = PLAYER_O;
-                    // Recursively call minimax until game concludes
-                    int score = minimax(game, depth + 1, alpha, beta, true);
-                    // Undo simulated moves
-                    game->board[i][j] = EMPTY;
-                    //Evaluate best score
-                    bestScore = (score < bestScore) ? score : bestScore;
-                    beta = (beta < bestScore) ? beta : bestScore;
-                    
-                    // Alpha-beta pruning
-                    if(beta <= alpha) {
-                        break;
-                    }
-                }
-            }
+        task->score = minimax(&task->game, 0, floor - 1, floor, false);
+        if(task->score >= floor) {
+            task->score = minimax(&task->game, 0, floor - 1, MM_INFINITY, false);
         }
-        return bestScore;
     }
+    task->exact = (floor == -MM_INFINITY) || task->score >= floor;
+
+    task->counters = searchCount;
+    task->seconds = nowSeconds() - start;
+
+    // Failing low leaves an upper bound below the floor, never ranked.
+    // A stopped search is thrown away whole
+    if(!task->exact || atomic_load(&searchStopped)) return;
+
+    pthread_mutex_lock(&shared->lock);
+    rankingInsert(&shared->ranking, task->score, task->mirrors);
+    atomic_store_explicit(&shared->floor, rankingFloor(&shared->ranking), memory_order_relaxed);
+    pthread_mutex_unlock(&shared->lock);
 }
 
+/*******************************************************************
+function: rootWorker
+    searches root moves in order until none are left,
+    so at most one move per worker runs at a time
+
+    Input:
+    arg - Pointer to the RootShared of the search
+********************************************************************/
+static void rootWorker(void *arg) {
+    RootShared *shared = arg;
+
+    for(int i = atomic_fetch_add(&shared->next, 1); i < shared->count; i = atomic_fetch_add(&shared->next, 1)) {
+        rootTask(&shared->tasks[i]);
+    }
+}
 
 /*******************************************************************
-function: mmMove
-    simulates all possible moves
-    find best and second-best moves
-    decide which move to use
+function: searchRootMoves
+    scores the computer's moves to the current depth limit.
+    Only moves that can enter the top n are scored exactly,
+    the rest are refuted with null windows. Root moves run
+    on up to mmThreads pool workers, or on the calling thread
 
     Input:
     game - Pointer to access all variables in GameState
+    stabilizers - symmetries of the position
+    n - moves needing exact scores
+    scores - filled in for every move searched
+    exact - set for every move whose score is exact
+    stats - counters and root move times are added here
 ********************************************************************/
-void mmMove(GameState *game) {
-    // Seed random number generator once at the start
-    srand(time(0));  
+static void searchRootMoves(GameState *game, unsigned stabilizers, int n, int scores[MAX_CELLS], bool exact[MAX_CELLS], MmSearchStats *stats) {
+    RootTask tasks[MAX_CELLS];
+    RootShared shared = {.ranking = {.lines = n}, .tasks = tasks};
+    PoolGroup group = {0};
+    int moves[MAX_CELLS];
 
-    int bestScore = -1000;
-    int secondBestScore = -1000;    
-    int bestRow = -1;
-    int bestCol = -1;
-    int secondBestRow = -1;
-    int secondBestCol = -1;
-
-    // Check every empty cell on board
-    for(int i = 0; i < BOARD_SIZE; i++) {
-        for(int j = 0; j < BOARD_SIZE; j++) {
-            if(game->board[i][j] == EMPTY) {
-                // Simulate computer moves
-                game->board[i][j] = PLAYER_X;
-                // Recursively call minimax until game concludes
-                int score = minimax(game, 0, -1000, 1000, false);
-                // Undo simulated move
-                game->board[i][j] = EMPTY;
-
-                // if score is the highest
-                if(score > bestScore) {
-                    // second-best becomes the lesser scoring move
-                    secondBestScore = bestScore;
-                    secondBestRow = bestRow;
-                    secondBestCol = bestCol;
-
-                    // best becomes the higher scoring move
-                    bestScore = score;
-                    bestRow = i;
-                    bestCol = j;
-                }
-                
-                // if score is second highest
-                else if (score > secondBestScore) {
-                    // setting score to be second best move
-                    secondBestScore = score;
-                    secondBestRow = i;
-                    secondBestCol = j;
-                }
-            }
+    atomic_init(&shared.floor, -MM_INFINITY);
+    atomic_init(&shared.next, 0);
+    pthread_mutex_init(&shared.lock, NULL);
+
+    // Moves worth searching, mirror images reuse the score of their original
+    Bitboard searched = emptyCells(game) & ~symRedundantMoves(emptyCells(game), stabilizers);
+    // Likely good moves first so the floor rises early
+    resetSearchHeuristics();
+    int count = orderMoves(game, searched, SIDE_X, 0, -1, moves);
+
+    for(int i = 0; i < count; i++) {
+        tasks[i] = (RootTask){.shared = &shared, .game = *game, .cell = moves[i]};
+        for(Bitboard cells = emptyCells(game); cells; cells &= cells - 1) {
+            if(symRepresentative(BB_FIRST(cells), stabilizers) == moves[i]) tasks[i].mirrors++;
         }
     }
-    
+    shared.count = count;
+
+    // The pool may have been sized by another engine, use no more than mmThreads of it
+    int workers = (mmThreads < poolSize()) ? mmThreads : poolSize();
+    if(workers > count) workers = count;
+    if(workers <= 1) rootWorker(&shared);
+    else {
+        for(int i = 0; i < workers; i++) poolSubmit(&group, rootWorker, &shared);
+        poolWait(&group);
+    }
+
+    for(int i = 0; i < count; i++) {
+        scores[tasks[i].cell] = tasks[i].score;
+        exact[tasks[i].cell] = tasks[i].exact;
+
+        const SearchCounters *counters = &tasks[i].counters;
+        stats->nodes += counters->nodes;
+        stats->cutoffs += counters->cutoffs;
+        for(int slot = 0; slot < MM_CUTOFF_SLOTS; slot++) stats->cutoffsAt[slot] += counters->cutoffsAt[slot];
+        stats->ttHits += counters->ttHits;
+        stats->ttMisses += counters->ttMisses;
+        if(counters->maxPly > stats->maxPly) stats->maxPly = counters->maxPly;
+
+        // Same root moves come back every iteration, add to the cell's time
+        int slot = 0;
+        while(slot < stats->rootCount && stats->rootCell[slot] != tasks[i].cell) slot++;
+        if(slot == stats->rootCount) {
+            stats->rootCell[slot] = tasks[i].cell;
+            stats->rootSeconds[slot] = 0;
+            stats->rootCount++;
+        }
+        stats->rootSeconds[slot] += tasks[i].seconds;
+    }
+    pthread_mutex_destroy(&shared.lock);
+}
+
+/*******************************************************************
+function: rankRootMoves
+    orders every empty cell with an exact score
+
+    Input:
+    game - Pointer to access all variables in GameState
+    stabilizers - symmetries of the position
+    scores - score of every representative move
+    exact - set for every representative move with an exact score
+    out - filled with the best moves, highest score first,
+          lower cell index first on equal scores
+    n - moves wanted
+
+    Return:
+    number of moves written to out
+********************************************************************/
+static int rankRootMoves(GameState *game, unsigned stabilizers, const int scores[MAX_CELLS], const bool exact[MAX_CELLS], RootMove out[], int n) {
+    int ranked = 0;
+
+    // Lowest bit first (row-major order)
+    for(Bitboard moves = emptyCells(game); moves; moves &= moves - 1) {
+        int cell = BB_FIRST(moves);
+        int rep = symRepresentative(cell, stabilizers);
+        if(!exact[rep]) continue;
+
+        // Insert after every move with an equal or higher score
+        int i = (ranked < n) ? ranked++ : n;
+        while(i > 0 && out[i - 1].score < scores[rep]) {
+            if(i < n) out[i] = out[i - 1];
+            i--;
+        }
+        if(i < n) out[i] = (RootMove){.cell = cell, .score = scores[rep]};
+    }
+    return ranked;
+}
+
+/*******************************************************************
+function: mmSearchTimed
+    ranks the computer's moves by exact score. With a time
+    budget or a cancellation token the search deepens one
+    ply at a time up to mmSearchDepth, and the ranking of
+    the deepest finished iteration is returned. The first
+    iteration always finishes unless cancelled
+
+    Input:
+    game - Pointer to access all variables in GameState
+    out - filled with the best moves, highest score first,
+          lower cell index first on equal scores
+    n - moves wanted, at most MAX_CELLS
+    budget - seconds to search, 0 = no limit
+    token - cancels the search from another thread, can be NULL
+    stats - filled with the counters of the search, can be NULL
+
+    Return:
+    number of moves written to out, fewer than n when the
+    board has fewer empty cells, 0 when cancelled before
+    the first iteration finished
+********************************************************************/
+int mmSearchTimed(GameState *game, RootMove out[], int n, double budget, MmCancelToken *token, MmSearchStats *stats) {
+    if(!rulesReady) mmSetRules(DEFAULT_BOARD_SIZE, DEFAULT_BOARD_SIZE);
+    if(n > MAX_CELLS) n = MAX_CELLS;
+    if(n < 1) return 0;
+
+    int scores[MAX_CELLS];
+    bool exact[MAX_CELLS] = {false};
+    unsigned stabilizers = symStabilizers(game);
+    // Perfect play table (3x3) or retrograde database (4x4) replaces the search when the position is stored
+    const int8_t *tableScores = usePerfectTable ? perfectTableScores(game) : NULL;
+
+    if(tableScores || (usePerfectTable && retroScores(game, scores))) {
+        for(Bitboard moves = emptyCells(game); moves; moves &= moves - 1) {
+            if(tableScores) scores[BB_FIRST(moves)] = perfectScore(tableScores[BB_FIRST(moves)]);
+            exact[BB_FIRST(moves)] = true;
+        }
+        if(stats) *stats = (MmSearchStats){.fromTable = true};
+        return rankRootMoves(game, stabilizers, scores, exact, out, n);
+    }
+
+    // Plies to the end of the game, or to the search depth when that is nearer
+    int empties = BB_COUNT(emptyCells(game));
+    int maxDepth = (mmSearchDepth > 0 && mmSearchDepth < empties) ? mmSearchDepth : empties;
+    // Searches that cannot be stopped go straight to full depth
+    int depth = (budget > 0 || token) ? 1 : maxDepth;
+    double start = nowSeconds();
+    MmSearchStats counters = {0};
+    int ranked = 0;
+    int reached = 0;
+
+    ttEnsure();
+    atomic_store(&searchStopped, false);
+    searchToken = token;
+    searchDeadline = 0;
+
+    for(; depth <= maxDepth; depth++) {
+        RootMove iteration[MAX_CELLS];
+        searchDepthLimit = depth;
+        for(int cell = 0; cell < MAX_CELLS; cell++) exact[cell] = false;
+
+        searchRootMoves(game, stabilizers, n, scores, exact, &counters);
+        if(atomic_load(&searchStopped)) break;
+
+        ranked = rankRootMoves(game, stabilizers, scores, exact, iteration, n);
+        for(int i = 0; i < ranked; i++) out[i] = iteration[i];
+        reached = depth;
+
+        // Deeper iterations may be cut short from here on
+        if(budget > 0) {
+            searchDeadline = start + budget;
+            if(nowSeconds() >= searchDeadline) break;
+        }
+    }
+
+    searchToken = NULL;
+    searchDeadline = 0;
+    searchDepthLimit = mmSearchDepth;
+
+    counters.depth = reached;
+    counters.seconds = nowSeconds() - start;
+    if(stats) *stats = counters;
+    return ranked;
+}
+
+/*******************************************************************
+function: mmSearchRoot
+    ranks the computer's moves by exact score in one search
+    within mmTimeBudget, see mmSearchTimed()
+
+    Input:
+    game - Pointer to access all variables in GameState
+    out - filled with the best moves, highest score first
+    n - moves wanted, at most MAX_CELLS
+
+    Return:
+    number of moves written to out
+********************************************************************/
+int mmSearchRoot(GameState *game, RootMove out[], int n) {
+    return mmSearchTimed(game, out, n, mmTimeBudget, NULL, NULL);
+}
+
+/*******************************************************************
+function: playRanked
+    decide between the best and second-best move by
+    difficulty and make it
+
+    Input:
+    game - Pointer to access all variables in GameState
+    ranked - best moves, highest score first
+    count - moves in ranked
+    difficulty - chance in percent of playing the best move
+********************************************************************/
+static void playRanked(GameState *game, const RootMove ranked[], int count, int difficulty) {
+    // Seed random number generator once at the start
+    srand(time(0));  
+
+    int pick = 0;
+
     // Decide to use best or second-best move
-    if (rand() % 100 >= difficulty && secondBestScore != -1000) { 
-        bestRow = secondBestRow;
-        bestCol = secondBestCol;
+    if (rand() % 100 >= difficulty && count > 1) { 
+        pick = 1;
     }
 
     // Make the decided move
-    if(bestRow != -1 && bestCol != -1) {
-        makeMove(game, bestRow, bestCol);
+    if(count > 0) {
+        makeMove(game, ranked[pick].cell / mmGeometry.size, ranked[pick].cell % mmGeometry.size);
     }
+}
 
-}
\ No newline at end of file
+/*******************************************************************
+function: chooseMove
+    ranks the best moves, two when the difficulty may
+    pick the second-best, and makes one of them.
+    Replies found while pondering are used without searching.
+    A cancelled search makes no move
+
+    Input:
+    game - Pointer to access all variables in GameState
+    difficulty - chance in percent of playing the best move
+    token - cancels the search from another thread, can be NULL
+    stats - filled with the counters of the search, can be NULL
+********************************************************************/
+static void chooseMove(GameState *game, int difficulty, MmCancelToken *token, MmSearchStats *stats) {
+    RootMove ranked[2];
+    MmSearchStats counters = {0};
+    int count = ponderLookup(game, ranked);
+
+    if(count >= 0) {
+        if(mmStatsDump) fprintf(stderr, "minimax: pondered reply\n");
+    }
+    else {
+        // Full difficulty always plays the best move, no need to rank the second
+        count = mmSearchTimed(game, ranked, (difficulty >= 100) ? 1 : 2, mmTimeBudget, token, &counters);
+        if(token && atomic_load(&token->cancelled)) return;
+
+        if(mmStatsDump) mmPrintStats(stderr, &counters);
+    }
+
+    lastSearch = counters;
+    if(stats) *stats = counters;
+    playRanked(game, ranked, count, difficulty);
+}
+
+/*******************************************************************
+function: mmMove
+    searches and makes the computer's move at the current difficulty
+
+    Input:
+    game - Pointer to access all variables in GameState
+********************************************************************/
+void mmMove(GameState *game) {
+    chooseMove(game, difficulty, NULL, NULL);
+}
+
+/*******************************************************************
+function: mmMoveStats
+    mmMove() that also hands back the counters of its search.
+    A pondered reply or a table lookup leaves them at 0
+
+    Input:
+    game - Pointer to access all variables in GameState
+    stats - filled with the counters of the search
+********************************************************************/
+void mmMoveStats(GameState *game, MmSearchStats *stats) {
+    chooseMove(game, difficulty, NULL, stats);
+}
+
+/*******************************************************************
+function: mmLastStats
+    counters of the last computer move made through ai(),
+    aiStart() or mmMove()
+
+    Input:
+    stats - filled with the counters
+********************************************************************/
+void mmLastStats(MmSearchStats *stats) {
+    *stats = lastSearch;
+}
+
+/*******************************************************************
+function: mmPrintStats
+    writes every counter of a search, one topic per line
+
+    Input:
+    out - stream to write to, usually stderr
+    stats - counters of the search
+********************************************************************/
+void mmPrintStats(FILE *out, const MmSearchStats *stats) {
+    if(stats->fromTable) {
+        fprintf(out, "minimax stats: scores read from table\n");
+        return;
+    }
+    long probes = stats->ttHits + stats->ttMisses;
+
+    fprintf(out, "minimax stats: depth %d, max ply %d, %ld nodes in %.3f s (%.0f nodes/s)\n", stats->depth, stats->maxPly,
+        stats->nodes, stats->seconds, stats->seconds > 0 ? stats->nodes / stats->seconds : 0.0);
+    fprintf(out, "  table: %ld hits, %ld misses (%.1f%% hit rate)\n", stats->ttHits, stats->ttMisses,
+        probes ? 100.0 * stats->ttHits / probes : 0.0);
+
+    fprintf(out, "  cutoffs: %ld, by move index:", stats->cutoffs);
+    for(int slot = 0; slot < MM_CUTOFF_SLOTS; slot++) {
+        fprintf(out, " %s%d:%ld", (slot == MM_CUTOFF_SLOTS - 1) ? ">=" : "", slot + 1, stats->cutoffsAt[slot]);
+    }
+    fprintf(out, "\n  root moves:");
+    for(int i = 0; i < stats->rootCount; i++) {
+        fprintf(out, " (%d,%d) %.3f s", stats->rootCell[i] / mmGeometry.size, stats->rootCell[i] % mmGeometry.size,
+            stats->rootSeconds[i]);
+    }
+    fprintf(out, "\n");
+}
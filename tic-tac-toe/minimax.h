@@ -5,32 +5,101 @@
 #include <stdio.h>
 #include <stdlib.h> // For rand()
 #include <stdbool.h>
+#include <stdint.h> // For fixed width bitboards
+#include <stdatomic.h>
 #include "game_logic.h"
 #include "gui.h"
+#include "bitboard.h"
 
 
-#define BOARD_SIZE 3
 #define EMPTY '-'
 #define PLAYER_O 'O'
 #define PLAYER_X 'X'
 
+#define NUM_SYMMETRIES 8                        // 4 rotations and 4 reflections of the board
+#define SIDE_X 0                                // Bitboard index of computer
+#define SIDE_O 1                                // Bitboard index of player
+#define SIDE_OF(player) ((player) == PLAYER_X ? SIDE_X : SIDE_O)
+#define CELL_BIT(row, col) BB_CELL((row) * mmGeometry.size + (col))
+
+// Scores: a win is MM_WIN_SCORE minus the plies it takes, heuristic scores of
+// unfinished positions stay within MM_EVAL_LIMIT so they never look like a win
+#define MM_WIN_SCORE 1000
+#define MM_EVAL_LIMIT 500
+#define MM_INFINITY 10000
+#define MM_WIN_BOUND (MM_WIN_SCORE - MAX_CELLS - 1)     // Scores past this are wins or losses
+#define MM_IS_WIN_SCORE(score) ((score) > MM_WIN_BOUND || (score) < -MM_WIN_BOUND)
+
+#define MM_CUTOFF_SLOTS 8               // Cutoffs counted by move index, the last slot takes every later index
+
 extern int previousNumWins;
 extern int difficulty;
+extern bool usePerfectTable;    // mmMove() reads scores from perfect_table.c or the 4x4 database instead of searching
+extern int mmThreads;           // Threads searching root moves in mmMove(), 1 = serial
+extern int mmSearchDepth;       // Plies searched from the computer's move, 0 = to the end of the game
+extern double mmTimeBudget;     // Seconds per computer move, 0 = no limit
+extern bool mmUseQOrdering;     // Order 3x3 moves by the trained Q-values, see mmSetQOrdering()
+extern bool mmStatsDump;        // Print the MmSearchStats of every computer move to stderr
+extern BoardGeometry mmGeometry;    // Board the engine is set up for, see mmSetRules()
 
 typedef struct {
-    unsigned char board[BOARD_SIZE][BOARD_SIZE];
+    Bitboard pieces[2];   // pieces[SIDE_X] = computer's cells, pieces[SIDE_O] = player's cells
+    uint64_t hash[NUM_SYMMETRIES];  // Zobrist hash of the marked cells under every symmetry,
+                                    // hash[0] is the board as is. Updated on every move
     unsigned char currentPlayer;
     bool gameOver;
     unsigned char winner; // If winner = 0, draw, if winner = player --> player wins
     int wins;
 } GameState;
 
+// A root move ranked by mmSearchRoot()
+typedef struct {
+    int cell;       // row * board size + col
+    int score;      // Exact score for the computer
+} RootMove;
+
+// Counters of one mmSearchTimed() call, summed over every iteration and thread
+typedef struct {
+    int depth;                          // Deepest finished iteration
+    int maxPly;                         // Deepest ply a node was visited at, root moves are ply 1
+    bool fromTable;                     // Scores came from the perfect table or 4x4 database, nothing searched
+    long nodes;
+    long cutoffs;
+    long cutoffsAt[MM_CUTOFF_SLOTS];    // cutoffsAt[i] = cutoffs by the (i + 1)th move tried
+    long ttHits;                        // Probes that found the position
+    long ttMisses;
+    double seconds;                     // Wall clock time of the whole search
+    int rootCount;                      // Root moves searched, mirror images excluded
+    int rootCell[MAX_CELLS];            // row * board size + col
+    double rootSeconds[MAX_CELLS];      // Thread time spent on rootCell[i], every iteration
+} MmSearchStats;
+
+// Stops a running search from another thread, see mmSearchTimed()
+typedef struct {
+    atomic_bool cancelled;
+} MmCancelToken;
+
 void displayBoard(GameState* game);
+unsigned char getCell(GameState* game, int row, int col);
 bool checkWin(GameState* game, unsigned char player);
 bool isBoardFull(GameState* game);
 bool makeMove(GameState* game, int row, int col);
 int minimax(GameState* game, int depth, int alpha, int beta, bool isMaximizing);
 void mmMove(GameState* game);
-void ai(char board[3][3], int num_wins, int difficulty);
+int mmSearchRoot(GameState* game, RootMove out[], int n);
+int mmSearchTimed(GameState* game, RootMove out[], int n, double budget, MmCancelToken* token, MmSearchStats* stats);
+void mmMoveStats(GameState* game, MmSearchStats* stats);
+void mmLastStats(MmSearchStats* stats);
+void mmPrintStats(FILE* out, const MmSearchStats* stats);
+void mmSetThreads(int threads);
+void mmSetQOrdering(bool on);
+void mmSetRules(int size, int winLength);
+bool mmLoadQOrdering(void);
+int evaluate(GameState* game);
+void ai(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins, int difficulty);
+bool aiStart(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins, int difficulty);
+bool aiPoll(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+void aiPonderStart(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int num_wins, int difficulty);
+void aiCancel(void);
 
 #endif  /* End of header file */
\ No newline at end of file
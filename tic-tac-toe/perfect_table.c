@@ -0,0 +1,5795 @@
+/* Generated by tools/gen_perfect_table.c - do not edit by hand */
+#include "perfect_table.h"
+
+const uint16_t perfectBase3[1 << PERFECT_TABLE_CELLS] = {
+    0, 1, 3, 4, 9, 10, 12, 13, 27, 28, 30, 31, 36, 37, 39, 40,
+    81, 82, 84, 85, 90, 91, 93, 94, 108, 109, 111, 112, 117, 118, 120, 121,
+    243, 244, 246, 247, 252, 253, 255, 256, 270, 271, 273, 274, 279, 280, 282, 283,
+    324, 325, 327, 328, 333, 334, 336, 337, 351, 352, 354, 355, 360, 361, 363, 364,
+    729, 730, 732, 733, 738, 739, 741, 742, 756, 757, 759, 760, 765, 766, 768, 769,
+    810, 811, 813, 814, 819, 820, 822, 823, 837, 838, 840, 841, 846, 847, 849, 850,
+    972, 973, 975, 976, 981, 982, 984, 985, 999, 1000, 1002, 1003, 1008, 1009, 1011, 1012,
+    1053, 1054, 1056, 1057, 1062, 1063, 1065, 1066, 1080, 1081, 1083, 1084, 1089, 1090, 1092, 1093,
+    2187, 2188, 2190, 2191, 2196, 2197, 2199, 2200, 2214, 2215, 2217, 2218, 2223, 2224, 2226, 2227,
+    2268, 2269, 2271, 2272, 2277, 2278, 2280, 2281, 2295, 2296, 2298, 2299, 2304, 2305, 2307, 2308,
+    2430, 2431, 2433, 2434, 2439, 2440, 2442, 2443, 2457, 2458, 2460, 2461, 2466, 2467, 2469, 2470,
+    2511, 2512, 2514, 2515, 2520, 2521, 2523, 2524, 2538, 2539, 2541, 2542, 2547, 2548, 2550, 2551,
+    2916, 2917, 2919, 2920, 2925, 2926, 2928, 2929, 2943, 2944, 2946, 2947, 2952, 2953, 2955, 2956,
+    2997, 2998, 3000, 3001, 3006, 3007, 3009, 3010, 3024, 3025, 3027, 3028, 3033, 3034, 3036, 3037,
+    3159, 3160, 3162, 3163, 3168, 3169, 3171, 3172, 3186, 3187, 3189, 3190, 3195, 3196, 3198, 3199,
+    3240, 3241, 3243, 3244, 3249, 3250, 3252, 3253, 3267, 3268, 3270, 3271, 3276, 3277, 3279, 3280,
+    6561, 6562, 6564, 6565, 6570, 6571, 6573, 6574, 6588, 6589, 6591, 6592, 6597, 6598, 6600, 6601,
+    6642, 6643, 6645, 6646, 6651, 6652, 6654, 6655, 6669, 6670, 6672, 6673, 6678, 6679, 6681, 6682,
+    6804, 6805, 6807, 6808, 6813, 6814, 6816, 6817, 6831, 6832, 6834, 6835, 6840, 6841, 6843, 6844,
+    6885, 6886, 6888, 6889, 6894, 6895, 6897, 6898, 6912, 6913, 6915, 6916, 6921, 6922, 6924, 6925,
+    7290, 7291, 7293, 7294, 7299, 7300, 7302, 7303, 7317, 7318, 7320, 7321, 7326, 7327, 7329, 7330,
+    7371, 7372, 7374, 7375, 7380, 7381, 7383, 7384, 7398, 7399, 7401, 7402, 7407, 7408, 7410, 7411,
+    7533, 7534, 7536, 7537, 7542, 7543, 7545, 7546, 7560, 7561, 7563, 7564, 7569, 7570, 7572, 7573,
+    7614, 7615, 7617, 7618, 7623, 7624, 7626, 7627, 7641, 7642, 7644, 7645, 7650, 7651, 7653, 7654,
+    8748, 8749, 8751, 8752, 8757, 8758, 8760, 8761, 8775, 8776, 8778, 8779, 8784, 8785, 8787, 8788,
+    8829, 8830, 8832, 8833, 8838, 8839, 8841, 8842, 8856, 8857, 8859, 8860, 8865, 8866, 8868, 8869,
+    8991, 8992, 8994, 8995, 9000, 9001, 9003, 9004, 9018, 9019, 9021, 9022, 9027, 9028, 9030, 9031,
+    9072, 9073, 9075, 9076, 9081, 9082, 9084, 9085, 9099, 9100, 9102, 9103, 9108, 9109, 9111, 9112,
+    9477, 9478, 9480, 9481, 9486, 9487, 9489, 9490, 9504, 9505, 9507, 9508, 9513, 9514, 9516, 9517,
+    9558, 9559, 9561, 9562, 9567, 9568, 9570, 9571, 9585, 9586, 9588, 9589, 9594, 9595, 9597, 9598,
+    9720, 9721, 9723, 9724, 9729, 9730, 9732, 9733, 9747, 9748, 9750, 9751, 9756, 9757, 9759, 9760,
+    9801, 9802, 9804, 9805, 9810, 9811, 9813, 9814, 9828, 9829, 9831, 9832, 9837, 9838, 9840, 9841
+};
+
+const uint16_t perfectIndex[PERFECT_TABLE_KEYS] = {
+    1, 0, 2, 0, 0, 3, 4, 5, 0, 0, 0, 6, 0, 0, 0, 7,
+    0, 8, 9, 10, 0, 11, 0, 12, 0, 13, 0, 0, 0, 14, 0, 0,
+    0, 15, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 17, 18, 0, 19,
+    0, 0, 20, 21, 22, 0, 23, 24, 0, 25, 0, 26, 0, 27, 0, 28,
+    0, 29, 0, 0, 30, 31, 32, 0, 0, 33, 0, 34, 35, 0, 0, 0,
+    0, 0, 0, 36, 0, 0, 0, 37, 0, 38, 0, 0, 0, 0, 0, 0,
+    0, 0, 39, 40, 0, 41, 0, 0, 42, 43, 44, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    46, 0, 0, 0, 47, 0, 0, 48, 0, 49, 0, 0, 50, 51, 52, 0,
+    0, 0, 53, 0, 0, 0, 54, 0, 55, 56, 57, 0, 58, 0, 59, 0,
+    60, 0, 61, 62, 0, 63, 0, 64, 0, 65, 0, 66, 0, 67, 0, 0,
+    68, 69, 70, 0, 0, 71, 0, 72, 73, 0, 0, 0, 0, 74, 0, 75,
+    0, 0, 76, 77, 78, 0, 0, 0, 79, 0, 0, 0, 80, 0, 81, 82,
+    83, 0, 84, 0, 85, 0, 86, 0, 0, 87, 0, 88, 89, 0, 0, 0,
+    0, 90, 91, 0, 92, 0, 93, 0, 94, 0, 0, 0, 0, 0, 95, 0,
+    0, 0, 0, 0, 0, 96, 0, 0, 0, 97, 0, 98, 0, 0, 0, 0,
+    0, 0, 0, 0, 99, 100, 0, 101, 0, 0, 102, 103, 104, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 106, 0, 0, 0, 107, 0, 0, 108, 0, 109, 0, 0, 110, 111,
+    112, 0, 0, 0, 113, 0, 0, 0, 114, 0, 115, 116, 117, 0, 118, 0,
+    119, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 123, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0,
+    125, 0, 126, 0, 0, 0, 0, 0, 0, 0, 0, 127, 128, 0, 129, 0,
+    0, 130, 131, 132, 0, 133, 0, 134, 0, 0, 135, 136, 137, 0, 0, 0,
+    138, 0, 0, 0, 139, 0, 140, 141, 142, 0, 143, 0, 144, 0, 145, 0,
+    0, 0, 146, 0, 0, 0, 147, 0, 148, 0, 0, 0, 0, 0, 0, 0,
+    0, 149, 150, 0, 151, 0, 0, 152, 153, 154, 0, 155, 156, 0, 157, 0,
+    158, 0, 159, 0, 160, 0, 161, 0, 0, 162, 163, 164, 0, 0, 165, 0,
+    166, 167, 0, 0, 0, 0, 168, 169, 0, 170, 0, 171, 0, 172, 0, 173,
+    0, 174, 0, 0, 175, 176, 177, 0, 0, 178, 0, 179, 180, 0, 0, 0,
+    0, 181, 0, 182, 0, 0, 183, 184, 185, 0, 0, 0, 186, 0, 0, 0,
+    187, 0, 188, 189, 190, 0, 191, 0, 192, 0, 193, 0, 0, 194, 0, 195,
+    196, 0, 0, 0, 0, 197, 198, 0, 199, 0, 200, 0, 201, 0, 0, 0,
+    0, 0, 202, 0, 0, 0, 0, 203, 0, 204, 0, 0, 205, 206, 207, 0,
+    0, 0, 208, 0, 0, 0, 209, 0, 210, 211, 212, 0, 213, 0, 214, 0,
+    215, 0, 0, 0, 216, 0, 0, 0, 217, 0, 218, 0, 0, 0, 0, 0,
+    0, 0, 0, 219, 220, 0, 221, 0, 0, 222, 223, 224, 0, 225, 226, 0,
+    227, 0, 228, 0, 229, 0, 230, 0, 231, 0, 0, 232, 233, 234, 0, 0,
+    235, 0, 236, 237, 0, 0, 0, 0, 0, 238, 0, 239, 240, 0, 0, 0,
+    0, 241, 242, 0, 243, 0, 244, 0, 245, 0, 0, 0, 0, 0, 246, 0,
+    0, 0, 0, 247, 248, 0, 249, 0, 250, 0, 251, 0, 252, 0, 253, 0,
+    0, 254, 255, 256, 0, 0, 257, 0, 258, 259, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 260, 0, 0, 0, 261,
+    0, 262, 0, 0, 0, 0, 0, 0, 0, 0, 263, 264, 0, 265, 0, 0,
+    266, 267, 268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 269, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 270, 0, 0, 0, 271, 0, 0, 272,
+    0, 273, 0, 0, 274, 275, 276, 0, 0, 0, 277, 0, 0, 0, 278, 0,
+    279, 280, 281, 0, 282, 0, 283, 0, 284, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 286, 0,
+    0, 0, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 288, 0, 0, 0, 289, 0, 290, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 291, 0, 292, 0, 0, 293, 294, 295, 0, 296, 0, 297, 0, 0,
+    298, 299, 300, 0, 0, 0, 301, 0, 0, 0, 302, 0, 303, 304, 305, 0,
+    306, 0, 307, 0, 308, 0, 0, 0, 309, 0, 0, 0, 310, 0, 311, 0,
+    0, 0, 0, 0, 0, 0, 0, 312, 313, 0, 314, 0, 0, 315, 316, 0,
+    0, 317, 318, 0, 319, 0, 320, 0, 321, 0, 322, 0, 323, 0, 0, 324,
+    325, 326, 0, 0, 327, 0, 328, 329, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 333, 0, 0, 0, 334, 0, 335, 0, 0, 0, 0, 0,
+    0, 0, 0, 336, 337, 0, 338, 0, 0, 339, 340, 341, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 342, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 343, 0, 0, 0, 344, 0, 0, 0, 0,
+    345, 0, 0, 0, 346, 0, 347, 0, 0, 0, 0, 0, 0, 0, 0, 348,
+    349, 0, 350, 0, 0, 351, 352, 353, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0, 0,
+    0, 356, 0, 0, 357, 0, 358, 0, 0, 359, 360, 361, 0, 0, 0, 362,
+    0, 0, 0, 363, 0, 364, 365, 366, 0, 367, 0, 368, 0, 369, 0, 370,
+    0, 371, 0, 0, 372, 373, 374, 0, 0, 0, 375, 0, 0, 0, 376, 0,
+    377, 378, 379, 0, 380, 0, 381, 0, 382, 0, 0, 0, 383, 0, 0, 0,
+    384, 0, 385, 0, 0, 0, 0, 0, 0, 0, 0, 386, 387, 0, 388, 0,
+    0, 389, 390, 0, 0, 391, 392, 0, 393, 0, 394, 0, 395, 0, 396, 0,
+    397, 0, 0, 398, 399, 400, 0, 0, 401, 0, 402, 403, 0, 0, 0, 0,
+    0, 0, 404, 0, 0, 0, 405, 0, 406, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 407, 0, 408, 0, 0, 409, 410, 411, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413,
+    0, 0, 0, 414, 0, 0, 415, 0, 416, 0, 0, 417, 418, 419, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 420, 421, 0, 422, 0, 423, 0, 424,
+    0, 425, 426, 0, 427, 0, 428, 0, 429, 0, 430, 0, 431, 0, 0, 432,
+    433, 434, 0, 0, 435, 0, 436, 437, 0, 0, 0, 0, 438, 0, 439, 0,
+    0, 440, 441, 0, 0, 0, 0, 442, 0, 0, 0, 443, 0, 444, 445, 0,
+    0, 446, 0, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 448, 449, 0, 450, 0, 451, 0, 452, 0, 453, 0, 454, 0, 0,
+    455, 456, 457, 0, 0, 458, 0, 459, 460, 0, 0, 0, 0, 461, 0, 462,
+    0, 0, 463, 464, 465, 0, 0, 0, 466, 0, 0, 0, 467, 0, 468, 469,
+    470, 0, 471, 0, 472, 0, 473, 0, 0, 474, 0, 475, 476, 0, 0, 0,
+    0, 477, 478, 0, 479, 0, 0, 0, 480, 0, 0, 0, 0, 0, 481, 0,
+    0, 0, 0, 482, 0, 483, 0, 0, 484, 485, 486, 0, 0, 0, 487, 0,
+    0, 0, 488, 0, 489, 490, 491, 0, 492, 0, 493, 0, 494, 0, 0, 0,
+    495, 0, 0, 0, 496, 0, 497, 0, 0, 0, 0, 0, 0, 0, 0, 498,
+    499, 0, 500, 0, 0, 501, 502, 503, 0, 504, 505, 0, 506, 0, 0, 0,
+    507, 0, 508, 0, 0, 0, 0, 0, 509, 510, 0, 0, 511, 0, 512, 513,
+    0, 0, 0, 0, 0, 514, 0, 515, 516, 0, 0, 0, 0, 517, 518, 0,
+    519, 0, 520, 0, 521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 522,
+    523, 0, 524, 0, 525, 0, 526, 0, 527, 0, 528, 0, 0, 529, 530, 531,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 532, 0,
+    0, 0, 0, 0, 533, 0, 534, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 535, 0, 536, 0, 0, 537, 538, 539, 0, 0, 0,
+    540, 0, 0, 0, 541, 0, 542, 543, 544, 0, 545, 0, 546, 0, 547, 0,
+    0, 0, 548, 0, 0, 0, 549, 0, 550, 0, 0, 0, 0, 0, 0, 0,
+    0, 551, 552, 0, 553, 0, 0, 554, 555, 556, 0, 557, 558, 0, 559, 0,
+    0, 0, 560, 0, 561, 0, 0, 0, 0, 0, 562, 563, 0, 0, 564, 0,
+    565, 566, 0, 0, 0, 0, 0, 0, 567, 0, 0, 0, 568, 0, 569, 0,
+    0, 0, 0, 0, 0, 0, 0, 570, 571, 0, 572, 0, 0, 573, 574, 575,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 576, 0, 0, 0,
+    0, 0, 577, 578, 0, 0, 0, 0, 0, 0, 0, 579, 0, 0, 580, 581,
+    0, 582, 0, 0, 0, 583, 0, 584, 585, 0, 586, 0, 587, 0, 588, 0,
+    589, 0, 590, 0, 0, 591, 592, 593, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 594, 0, 595, 0, 0, 596, 597, 598, 0, 0, 0, 599, 0, 0,
+    0, 600, 0, 601, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 602, 0,
+    603, 604, 0, 0, 0, 0, 605, 606, 0, 607, 0, 0, 0, 608, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 609, 0, 610, 611, 0, 0, 0,
+    0, 612, 613, 0, 614, 0, 615, 0, 616, 0, 0, 0, 0, 0, 617, 0,
+    0, 0, 0, 618, 619, 0, 620, 0, 621, 0, 622, 0, 623, 0, 624, 0,
+    0, 625, 626, 627, 0, 0, 628, 0, 629, 630, 0, 0, 0, 0, 0, 0,
+    0, 0, 631, 0, 0, 0, 0, 0, 632, 0, 633, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 634, 635, 0, 636, 0, 637, 0,
+    638, 0, 639, 0, 640, 0, 0, 641, 642, 643, 0, 0, 644, 0, 645, 646,
+    0, 0, 0, 0, 647, 0, 648, 0, 0, 649, 650, 651, 0, 0, 0, 652,
+    0, 0, 0, 653, 0, 654, 655, 656, 0, 657, 0, 658, 0, 659, 0, 0,
+    660, 0, 661, 662, 0, 0, 0, 0, 663, 664, 0, 665, 0, 0, 0, 666,
+    0, 0, 0, 0, 0, 667, 0, 0, 0, 0, 0, 0, 0, 0, 668, 0,
+    0, 0, 0, 0, 669, 0, 670, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 671, 0, 672, 673, 0, 0, 0, 0, 674, 675,
+    0, 676, 0, 677, 0, 678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 679, 0, 0,
+    0, 680, 0, 681, 0, 0, 0, 0, 0, 0, 0, 0, 682, 683, 0, 684,
+    0, 0, 685, 686, 687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0, 690, 0,
+    0, 691, 0, 692, 0, 0, 693, 694, 695, 0, 0, 0, 696, 0, 0, 0,
+    697, 0, 698, 699, 700, 0, 701, 0, 702, 0, 703, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    705, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 707, 0, 0, 0, 708, 0, 709, 0, 0, 0, 0, 0,
+    0, 0, 0, 710, 711, 0, 712, 0, 0, 0, 713, 714, 0, 715, 0, 716,
+    0, 0, 717, 718, 719, 0, 0, 0, 720, 0, 0, 0, 721, 0, 722, 723,
+    724, 0, 725, 0, 726, 0, 727, 0, 0, 0, 728, 0, 0, 0, 729, 0,
+    730, 0, 0, 0, 0, 0, 0, 0, 0, 731, 732, 0, 733, 0, 0, 734,
+    735, 736, 0, 737, 738, 0, 739, 0, 740, 0, 741, 0, 742, 0, 743, 0,
+    0, 744, 745, 746, 0, 0, 747, 0, 748, 749, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 751, 0, 0, 0, 752, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 753, 0, 0, 0, 754, 0, 755, 0, 0, 0,
+    0, 0, 0, 0, 0, 756, 757, 0, 758, 0, 0, 759, 760, 761, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 762, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 763, 0, 0, 0, 764, 0, 0,
+    0, 0, 765, 0, 0, 0, 766, 0, 767, 0, 0, 0, 0, 0, 0, 0,
+    0, 768, 769, 0, 770, 0, 0, 771, 772, 773, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 775,
+    0, 0, 0, 776, 0, 0, 777, 0, 778, 0, 0, 779, 780, 781, 0, 0,
+    0, 782, 0, 0, 0, 783, 0, 784, 785, 786, 0, 787, 0, 788, 0, 789,
+    0, 790, 0, 791, 0, 0, 792, 793, 794, 0, 0, 0, 795, 0, 0, 0,
+    796, 0, 797, 798, 799, 0, 800, 0, 801, 0, 802, 0, 0, 0, 803, 0,
+    0, 0, 804, 0, 805, 0, 0, 0, 0, 0, 0, 0, 0, 806, 807, 0,
+    808, 0, 0, 809, 810, 811, 0, 812, 813, 0, 814, 0, 815, 0, 816, 0,
+    817, 0, 818, 0, 0, 819, 820, 821, 0, 0, 822, 0, 823, 824, 0, 0,
+    0, 0, 0, 0, 825, 0, 0, 0, 826, 0, 827, 0, 0, 0, 0, 0,
+    0, 0, 0, 828, 829, 0, 830, 0, 0, 0, 831, 832, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 833, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 834, 0, 0, 0, 835, 0, 0, 836, 0, 837, 0, 0, 0, 838, 839,
+    0, 0, 0, 840, 0, 0, 0, 841, 0, 842, 843, 844, 0, 0, 0, 0,
+    0, 845, 0, 846, 847, 0, 848, 0, 849, 0, 850, 0, 851, 0, 852, 0,
+    0, 853, 854, 855, 0, 0, 856, 0, 857, 858, 0, 0, 0, 0, 859, 0,
+    860, 0, 0, 861, 862, 863, 0, 0, 0, 864, 0, 0, 0, 865, 0, 866,
+    867, 868, 0, 869, 0, 870, 0, 871, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 872, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 873, 0, 0, 0, 874, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 875, 0, 0, 0,
+    876, 0, 877, 0, 0, 0, 0, 0, 0, 0, 0, 878, 879, 0, 880, 0,
+    0, 881, 882, 883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 884, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 885,
+    0, 0, 0, 886, 0, 0, 0, 0, 887, 0, 0, 0, 888, 0, 889, 0,
+    0, 0, 0, 0, 0, 0, 0, 890, 891, 0, 892, 0, 0, 893, 894, 895,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 896, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 897, 0, 0, 0, 898, 0, 0, 899, 0, 900, 0,
+    0, 901, 902, 903, 0, 0, 0, 904, 0, 0, 0, 905, 0, 906, 907, 908,
+    0, 909, 0, 910, 0, 911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 913, 0, 0, 0, 914, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 916, 0, 0,
+    0, 917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 918, 0, 0, 0, 919, 0, 920, 0, 0, 0, 0, 0, 0, 0, 0,
+    921, 922, 0, 923, 0, 0, 924, 925, 926, 0, 0, 0, 927, 0, 0, 0,
+    928, 0, 929, 0, 0, 0, 0, 0, 0, 0, 0, 930, 931, 0, 932, 0,
+    0, 933, 934, 935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 936, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 937, 0, 0, 0, 938, 0, 0,
+    939, 0, 940, 0, 0, 941, 942, 943, 0, 0, 0, 944, 0, 0, 0, 945,
+    0, 946, 947, 948, 0, 949, 0, 950, 0, 951, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 953,
+    0, 0, 0, 954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 955, 0, 0, 0, 956, 0, 957, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 958, 0, 959, 0, 0, 0, 960, 961, 0, 962, 0, 963, 0,
+    0, 964, 965, 966, 0, 0, 0, 967, 0, 0, 0, 968, 0, 969, 970, 971,
+    0, 972, 0, 973, 0, 974, 0, 0, 0, 975, 0, 0, 0, 976, 0, 977,
+    0, 0, 0, 0, 0, 0, 0, 0, 978, 979, 0, 980, 0, 0, 981, 982,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 983, 0, 984,
+    0, 0, 985, 986, 987, 0, 0, 0, 988, 0, 0, 0, 989, 0, 990, 991,
+    992, 0, 993, 0, 994, 0, 995, 0, 0, 0, 996, 0, 0, 0, 997, 0,
+    998, 0, 0, 0, 0, 0, 0, 0, 0, 999, 1000, 0, 1001, 0, 0, 1002,
+    1003, 1004, 0, 1005, 1006, 0, 1007, 0, 0, 0, 1008, 0, 1009, 0, 0, 0,
+    0, 0, 1010, 1011, 0, 0, 1012, 0, 1013, 1014, 0, 0, 0, 0, 0, 0,
+    1015, 0, 0, 0, 1016, 0, 1017, 0, 0, 0, 0, 0, 0, 0, 0, 1018,
+    1019, 0, 1020, 0, 0, 0, 1021, 1022, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0,
+    0, 1025, 0, 0, 1026, 0, 0, 0, 0, 0, 1027, 1028, 0, 0, 0, 0,
+    0, 0, 0, 1029, 0, 0, 1030, 1031, 0, 0, 0, 0, 0, 1032, 0, 1033,
+    1034, 0, 1035, 0, 1036, 0, 1037, 0, 1038, 0, 1039, 0, 0, 1040, 1041, 1042,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1043, 0, 1044, 0, 0, 1045,
+    1046, 1047, 0, 0, 0, 1048, 0, 0, 0, 1049, 0, 1050, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1051, 0, 1052, 1053, 0, 0, 0, 0, 1054, 1055,
+    0, 1056, 0, 0, 0, 1057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1058, 0, 0, 0, 1059, 0, 1060, 0, 0, 0, 0, 0, 0, 0,
+    0, 1061, 1062, 0, 1063, 0, 0, 1064, 1065, 1066, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1067, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1068,
+    0, 0, 0, 1069, 0, 0, 1070, 0, 0, 0, 0, 0, 1071, 1072, 0, 0,
+    0, 0, 0, 0, 0, 1073, 0, 0, 1074, 1075, 0, 1076, 0, 0, 0, 1077,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1078, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1079, 0, 0, 0, 1080, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1081, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1082, 0, 0, 0, 0, 0, 1083,
+    1084, 0, 1085, 0, 1086, 0, 0, 1087, 1088, 1089, 0, 0, 0, 1090, 0, 0,
+    0, 1091, 0, 1092, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1093,
+    0, 0, 0, 1094, 0, 1095, 0, 0, 0, 0, 0, 0, 0, 0, 1096, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1097, 1098, 0, 1099, 0, 0, 0, 1100,
+    0, 1101, 0, 0, 0, 0, 0, 1102, 1103, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1104, 1105, 0, 1106, 0, 1107, 0, 1108, 0, 1109, 0, 1110, 0,
+    0, 1111, 1112, 1113, 0, 0, 1114, 0, 1115, 1116, 0, 0, 0, 0, 1117, 0,
+    1118, 0, 0, 1119, 1120, 1121, 0, 0, 0, 1122, 0, 0, 0, 1123, 0, 1124,
+    1125, 1126, 0, 1127, 0, 1128, 0, 1129, 0, 0, 1130, 0, 1131, 1132, 0, 0,
+    0, 0, 1133, 1134, 0, 1135, 0, 0, 0, 1136, 0, 0, 0, 0, 0, 1137,
+    0, 0, 0, 0, 1138, 0, 1139, 0, 0, 0, 1140, 1141, 0, 0, 0, 1142,
+    0, 0, 0, 1143, 0, 1144, 1145, 1146, 0, 0, 0, 0, 0, 1147, 0, 0,
+    0, 1148, 0, 0, 0, 1149, 0, 1150, 0, 0, 0, 0, 0, 0, 0, 0,
+    1151, 1152, 0, 1153, 0, 0, 0, 1154, 1155, 0, 1156, 1157, 0, 0, 0, 0,
+    0, 1158, 0, 1159, 0, 0, 0, 0, 0, 1160, 1161, 0, 0, 1162, 0, 0,
+    0, 0, 0, 0, 0, 0, 1163, 0, 1164, 1165, 0, 0, 0, 0, 1166, 1167,
+    0, 1168, 0, 1169, 0, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1171, 1172, 0, 1173, 0, 1174, 0, 1175, 0, 1176, 0, 1177, 0, 0, 1178, 1179,
+    1180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1181, 1182, 0, 1183, 0, 1184, 0, 1185, 0, 1186,
+    0, 1187, 0, 0, 1188, 1189, 1190, 0, 0, 1191, 0, 1192, 1193, 0, 0, 0,
+    0, 1194, 0, 1195, 0, 0, 1196, 1197, 1198, 0, 0, 0, 1199, 0, 0, 0,
+    1200, 0, 1201, 1202, 1203, 0, 1204, 0, 1205, 0, 1206, 0, 0, 1207, 0, 1208,
+    1209, 0, 0, 0, 0, 1210, 1211, 0, 1212, 0, 1213, 0, 1214, 0, 0, 0,
+    0, 0, 1215, 0, 0, 0, 0, 1216, 0, 1217, 0, 0, 1218, 1219, 1220, 0,
+    0, 0, 1221, 0, 0, 0, 1222, 0, 1223, 1224, 1225, 0, 1226, 0, 1227, 0,
+    1228, 0, 0, 0, 1229, 0, 0, 0, 1230, 0, 1231, 0, 0, 0, 0, 0,
+    0, 0, 0, 1232, 1233, 0, 1234, 0, 0, 1235, 1236, 1237, 0, 1238, 1239, 0,
+    1240, 0, 1241, 0, 1242, 0, 1243, 0, 1244, 0, 0, 1245, 1246, 1247, 0, 0,
+    1248, 0, 1249, 1250, 0, 0, 0, 0, 0, 1251, 0, 1252, 1253, 0, 0, 0,
+    0, 1254, 1255, 0, 1256, 0, 1257, 0, 0, 0, 0, 0, 0, 0, 1258, 0,
+    0, 0, 0, 1259, 1260, 0, 1261, 0, 1262, 0, 0, 0, 1263, 0, 1264, 0,
+    0, 1265, 0, 0, 0, 0, 1266, 0, 1267, 1268, 0, 0, 0, 0, 0, 0,
+    0, 0, 1269, 0, 0, 0, 0, 0, 1270, 0, 1271, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1272, 0, 1273, 0, 0, 1274, 1275,
+    1276, 0, 0, 0, 1277, 0, 0, 0, 1278, 0, 1279, 1280, 1281, 0, 1282, 0,
+    1283, 0, 1284, 0, 0, 0, 1285, 0, 0, 0, 1286, 0, 1287, 0, 0, 0,
+    0, 0, 0, 0, 0, 1288, 1289, 0, 1290, 0, 0, 1291, 1292, 1293, 0, 1294,
+    1295, 0, 1296, 0, 1297, 0, 1298, 0, 1299, 0, 1300, 0, 0, 1301, 1302, 1303,
+    0, 0, 1304, 0, 1305, 1306, 0, 0, 0, 0, 0, 0, 1307, 0, 0, 0,
+    1308, 0, 1309, 0, 0, 0, 0, 0, 0, 0, 0, 1310, 1311, 0, 1312, 0,
+    0, 1313, 1314, 1315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1316, 0, 1317, 0, 0, 1318, 1319, 1320, 0, 0, 0, 1321, 0, 0, 0, 1322,
+    0, 1323, 1324, 1325, 0, 1326, 0, 1327, 0, 1328, 0, 1329, 1330, 0, 1331, 0,
+    1332, 0, 0, 0, 1333, 0, 1334, 0, 0, 1335, 0, 0, 0, 0, 1336, 0,
+    1337, 1338, 0, 0, 0, 0, 1339, 0, 1340, 0, 0, 1341, 0, 0, 0, 0,
+    0, 1342, 0, 0, 0, 0, 0, 0, 1343, 1344, 0, 1345, 0, 1346, 0, 0,
+    0, 0, 1347, 0, 1348, 1349, 0, 0, 0, 0, 1350, 1351, 0, 1352, 0, 1353,
+    0, 0, 0, 0, 0, 0, 0, 1354, 0, 0, 0, 0, 0, 1355, 0, 1356,
+    1357, 0, 0, 0, 0, 1358, 1359, 0, 1360, 0, 1361, 0, 1362, 0, 0, 0,
+    0, 0, 1363, 0, 0, 0, 0, 1364, 1365, 0, 1366, 0, 1367, 0, 1368, 0,
+    1369, 0, 1370, 0, 0, 1371, 1372, 1373, 0, 0, 1374, 0, 1375, 1376, 0, 0,
+    0, 0, 0, 0, 0, 0, 1377, 0, 0, 0, 0, 0, 1378, 0, 1379, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1380, 1381, 0,
+    1382, 0, 1383, 0, 1384, 0, 1385, 0, 1386, 0, 0, 1387, 1388, 1389, 0, 0,
+    1390, 0, 1391, 1392, 0, 0, 0, 0, 1393, 0, 1394, 0, 0, 1395, 1396, 1397,
+    0, 0, 0, 1398, 0, 0, 0, 1399, 0, 1400, 1401, 1402, 0, 1403, 0, 1404,
+    0, 1405, 0, 0, 1406, 0, 1407, 1408, 0, 0, 0, 0, 1409, 1410, 0, 1411,
+    0, 1412, 0, 1413, 0, 0, 0, 0, 0, 1414, 0, 0, 0, 0, 0, 0,
+    0, 0, 1415, 0, 0, 0, 0, 0, 1416, 0, 1417, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1418, 0, 1419, 1420, 0, 0,
+    0, 0, 1421, 1422, 0, 1423, 0, 1424, 0, 0, 0, 0, 0, 0, 0, 1425,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1426,
+    0, 1427, 0, 0, 1428, 1429, 1430, 0, 0, 0, 1431, 0, 0, 0, 1432, 0,
+    1433, 1434, 1435, 0, 1436, 0, 1437, 0, 1438, 0, 0, 0, 1439, 0, 0, 0,
+    1440, 0, 1441, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 1443, 0, 1444, 0,
+    0, 1445, 1446, 0, 0, 1447, 1448, 0, 1449, 0, 1450, 0, 1451, 0, 1452, 0,
+    1453, 0, 0, 1454, 1455, 1456, 0, 0, 1457, 0, 1458, 1459, 0, 0, 0, 0,
+    0, 0, 1460, 0, 0, 0, 1461, 0, 1462, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1463, 0, 1464, 0, 0, 1465, 1466, 1467, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1469,
+    0, 0, 0, 1470, 0, 0, 1471, 0, 1472, 0, 0, 1473, 1474, 1475, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1476, 1477, 0, 1478, 0, 1479, 0, 1480,
+    0, 1481, 1482, 0, 1483, 0, 1484, 0, 0, 0, 1485, 0, 1486, 0, 0, 1487,
+    0, 0, 0, 0, 1488, 0, 1489, 1490, 0, 0, 0, 0, 1491, 0, 1492, 0,
+    0, 1493, 0, 0, 0, 0, 0, 1494, 0, 0, 0, 0, 0, 0, 1495, 0,
+    0, 1496, 0, 1497, 0, 0, 0, 0, 1498, 0, 1499, 1500, 0, 0, 0, 0,
+    1501, 1502, 0, 1503, 0, 1504, 0, 0, 0, 0, 0, 0, 0, 1505, 0, 0,
+    0, 0, 0, 0, 1506, 0, 0, 0, 1507, 0, 1508, 0, 0, 0, 0, 0,
+    0, 0, 0, 1509, 1510, 0, 1511, 0, 0, 1512, 1513, 1514, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1515, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1516, 0, 0, 0, 1517, 0, 0, 1518, 0, 1519, 0, 0, 1520, 1521, 1522,
+    0, 0, 0, 1523, 0, 0, 0, 1524, 0, 1525, 1526, 1527, 0, 1528, 0, 1529,
+    0, 1530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1531, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1532, 0, 0, 0, 1533, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1534, 0, 0, 0, 1535,
+    0, 1536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1537, 0, 1538, 0, 0,
+    1539, 1540, 1541, 0, 1542, 0, 1543, 0, 0, 1544, 0, 0, 0, 0, 0, 1545,
+    0, 0, 0, 0, 0, 0, 1546, 1547, 0, 1548, 0, 1549, 0, 0, 0, 0,
+    0, 1550, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1551, 0, 1552, 0, 0, 1553, 0, 0, 0, 1554, 1555, 0, 1556, 0, 1557,
+    0, 0, 0, 1558, 0, 1559, 0, 0, 1560, 0, 0, 0, 0, 1561, 0, 1562,
+    1563, 0, 0, 0, 0, 1564, 1565, 0, 1566, 0, 1567, 0, 1568, 0, 1569, 0,
+    1570, 0, 0, 1571, 1572, 1573, 0, 0, 1574, 0, 1575, 1576, 0, 0, 0, 0,
+    1577, 0, 1578, 0, 0, 1579, 1580, 0, 0, 0, 0, 1581, 0, 0, 0, 1582,
+    0, 1583, 1584, 0, 0, 1585, 0, 1586, 0, 0, 0, 0, 1587, 0, 1588, 1589,
+    0, 0, 0, 0, 1590, 1591, 0, 1592, 0, 1593, 0, 1594, 0, 0, 0, 0,
+    0, 1595, 0, 0, 0, 0, 1596, 0, 1597, 0, 0, 1598, 1599, 1600, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1601, 1602, 0, 1603, 0, 1604, 0, 1605,
+    0, 0, 0, 1606, 0, 0, 0, 1607, 0, 1608, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1609, 0, 1610, 0, 0, 1611, 1612, 0, 0, 1613, 1614, 0, 1615,
+    0, 1616, 0, 1617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1618,
+    0, 1619, 1620, 0, 0, 0, 0, 0, 1621, 0, 1622, 1623, 0, 0, 0, 0,
+    1624, 1625, 0, 1626, 0, 1627, 0, 0, 0, 0, 0, 0, 0, 1628, 0, 0,
+    0, 0, 1629, 0, 0, 1630, 0, 1631, 0, 0, 0, 1632, 0, 1633, 0, 0,
+    1634, 0, 0, 0, 0, 0, 0, 1635, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1636, 0, 1637, 1638, 0, 0, 0,
+    0, 1639, 1640, 0, 1641, 0, 1642, 0, 1643, 0, 0, 0, 0, 0, 1644, 0,
+    0, 0, 0, 1645, 1646, 0, 1647, 0, 1648, 0, 1649, 0, 1650, 0, 1651, 0,
+    0, 1652, 1653, 1654, 0, 0, 1655, 0, 1656, 1657, 0, 0, 0, 0, 0, 0,
+    0, 0, 1658, 0, 0, 0, 0, 0, 1659, 0, 1660, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1661, 1662, 0, 1663, 0, 1664, 0,
+    1665, 0, 1666, 0, 1667, 0, 0, 1668, 1669, 1670, 0, 0, 1671, 0, 1672, 1673,
+    0, 0, 0, 0, 1674, 0, 1675, 0, 0, 1676, 1677, 1678, 0, 0, 0, 1679,
+    0, 0, 0, 1680, 0, 1681, 1682, 1683, 0, 1684, 0, 1685, 0, 1686, 0, 0,
+    1687, 0, 1688, 1689, 0, 0, 0, 0, 1690, 1691, 0, 1692, 0, 0, 0, 1693,
+    0, 0, 0, 0, 0, 1694, 0, 0, 0, 0, 0, 0, 0, 0, 1695, 0,
+    0, 0, 0, 0, 1696, 0, 1697, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1698, 0, 1699, 1700, 0, 0, 0, 0, 1701, 1702,
+    0, 1703, 0, 1704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1705, 1706, 0, 1707, 0,
+    1708, 0, 1709, 0, 1710, 0, 1711, 0, 0, 1712, 1713, 1714, 0, 0, 1715, 0,
+    1716, 1717, 0, 0, 0, 0, 1718, 0, 1719, 0, 0, 1720, 1721, 1722, 0, 0,
+    0, 1723, 0, 0, 0, 1724, 0, 1725, 1726, 1727, 0, 1728, 0, 1729, 0, 1730,
+    0, 0, 1731, 0, 1732, 1733, 0, 0, 0, 0, 1734, 1735, 0, 1736, 0, 0,
+    0, 1737, 0, 0, 0, 0, 0, 1738, 0, 0, 0, 0, 1739, 0, 1740, 0,
+    0, 1741, 1742, 1743, 0, 0, 0, 1744, 0, 0, 0, 1745, 0, 1746, 1747, 1748,
+    0, 1749, 0, 1750, 0, 1751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1752, 1753, 0, 1754, 0, 0, 0, 1755, 0, 1756, 0, 0, 0, 0,
+    0, 1757, 1758, 0, 0, 1759, 0, 1760, 1761, 0, 0, 0, 0, 0, 1762, 0,
+    1763, 1764, 0, 0, 0, 0, 1765, 1766, 0, 1767, 0, 1768, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1769, 1770, 0, 1771, 0, 1772, 0, 0,
+    0, 1773, 0, 1774, 0, 0, 1775, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1776, 0, 0, 0, 0, 0, 1777, 0, 1778,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1779, 0, 0, 0, 0, 0, 1780, 0, 1781, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1782, 0, 1783, 1784, 0, 0,
+    0, 0, 1785, 1786, 0, 1787, 0, 1788, 0, 1789, 0, 0, 0, 0, 0, 1790,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1791, 0, 1792, 1793, 0, 0, 0, 0, 1794, 1795, 0, 1796, 0, 1797, 0, 1798,
+    0, 0, 0, 0, 0, 1799, 0, 0, 0, 0, 1800, 1801, 0, 1802, 0, 1803,
+    0, 1804, 0, 1805, 0, 1806, 0, 0, 1807, 1808, 1809, 0, 0, 1810, 0, 1811,
+    1812, 0, 0, 0, 0, 0, 0, 0, 0, 1813, 0, 0, 0, 0, 0, 1814,
+    0, 1815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1816,
+    0, 0, 0, 0, 0, 1817, 0, 1818, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1819, 0, 0, 0, 1820, 0, 1821, 0, 0, 0, 0, 0, 0,
+    0, 0, 1822, 1823, 0, 1824, 0, 0, 1825, 1826, 1827, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1828, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1829, 0, 0, 0, 1830, 0, 0, 1831, 0, 1832, 0, 0, 1833, 1834, 1835, 0,
+    0, 0, 1836, 0, 0, 0, 1837, 0, 1838, 1839, 1840, 0, 1841, 0, 1842, 0,
+    1843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1844, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1845, 0, 0, 0, 1846, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1847, 0, 0, 0, 1848, 0,
+    1849, 0, 0, 0, 0, 0, 0, 0, 0, 1850, 1851, 0, 1852, 0, 0, 1853,
+    1854, 0, 0, 1855, 0, 1856, 0, 0, 1857, 1858, 1859, 0, 0, 0, 1860, 0,
+    0, 0, 1861, 0, 1862, 1863, 1864, 0, 1865, 0, 1866, 0, 1867, 0, 0, 0,
+    1868, 0, 0, 0, 1869, 0, 1870, 0, 0, 0, 0, 0, 0, 0, 0, 1871,
+    1872, 0, 1873, 0, 0, 1874, 1875, 1876, 0, 1877, 1878, 0, 1879, 0, 1880, 0,
+    1881, 0, 1882, 0, 1883, 0, 0, 1884, 1885, 1886, 0, 0, 1887, 0, 1888, 1889,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1890, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1891, 0, 0, 0, 1892, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1893, 0, 0, 0,
+    1894, 0, 1895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1896, 0, 1897, 0,
+    0, 1898, 1899, 1900, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1902,
+    0, 0, 0, 1903, 0, 0, 0, 0, 1904, 0, 0, 0, 1905, 0, 1906, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1907, 0, 1908, 0, 0, 1909, 1910, 1911,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1912, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1913, 0, 0, 0, 1914, 0, 0, 1915, 0, 1916, 0,
+    0, 1917, 1918, 1919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1920, 1921,
+    0, 1922, 0, 1923, 0, 1924, 0, 1925, 0, 1926, 0, 0, 1927, 1928, 1929, 0,
+    0, 0, 1930, 0, 0, 0, 1931, 0, 1932, 1933, 1934, 0, 1935, 0, 1936, 0,
+    1937, 0, 0, 0, 1938, 0, 0, 0, 1939, 0, 1940, 0, 0, 0, 0, 0,
+    0, 0, 0, 1941, 1942, 0, 1943, 0, 0, 1944, 1945, 1946, 0, 1947, 1948, 0,
+    1949, 0, 1950, 0, 1951, 0, 1952, 0, 1953, 0, 0, 1954, 1955, 1956, 0, 0,
+    1957, 0, 1958, 1959, 0, 0, 0, 0, 0, 0, 1960, 0, 0, 0, 1961, 0,
+    1962, 0, 0, 0, 0, 0, 0, 0, 0, 1963, 1964, 0, 1965, 0, 0, 1966,
+    1967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1968, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1969, 0, 0, 0, 1970, 0, 0, 1971, 0,
+    1972, 0, 0, 1973, 1974, 0, 0, 0, 0, 1975, 0, 0, 0, 1976, 0, 1977,
+    1978, 0, 0, 1979, 0, 1980, 0, 0, 0, 1981, 1982, 0, 1983, 0, 1984, 0,
+    1985, 0, 1986, 0, 1987, 0, 0, 1988, 1989, 1990, 0, 0, 1991, 0, 1992, 1993,
+    0, 0, 0, 0, 1994, 0, 1995, 0, 0, 1996, 1997, 1998, 0, 0, 0, 1999,
+    0, 0, 0, 2000, 0, 2001, 2002, 2003, 0, 2004, 0, 2005, 0, 2006, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2008, 0,
+    0, 0, 2009, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2010, 0, 0, 0, 2011, 0, 2012, 0, 0, 0, 0, 0, 0, 0,
+    0, 2013, 2014, 0, 2015, 0, 0, 2016, 2017, 2018, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2019, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2020, 0, 0, 0, 2021, 0, 0, 0, 0, 2022, 0,
+    0, 0, 2023, 0, 2024, 0, 0, 0, 0, 0, 0, 0, 0, 2025, 2026, 0,
+    2027, 0, 0, 2028, 2029, 2030, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2031,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2032, 0, 0, 0, 2033,
+    0, 0, 2034, 0, 2035, 0, 0, 2036, 2037, 2038, 0, 0, 0, 2039, 0, 0,
+    0, 2040, 0, 2041, 2042, 2043, 0, 2044, 0, 2045, 0, 2046, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2048, 0, 0, 0, 2049, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2050, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2051, 0, 0, 0, 2052, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2053, 0, 0, 0, 2054, 0, 2055, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2056, 0, 2057, 0, 0, 2058, 2059, 2060, 0,
+    0, 0, 2061, 0, 0, 0, 2062, 0, 2063, 0, 0, 0, 0, 0, 0, 0,
+    0, 2064, 2065, 0, 2066, 0, 0, 2067, 2068, 2069, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2071,
+    0, 0, 0, 2072, 0, 0, 2073, 0, 2074, 0, 0, 2075, 2076, 2077, 0, 0,
+    0, 2078, 0, 0, 0, 2079, 0, 2080, 2081, 2082, 0, 2083, 0, 2084, 0, 2085,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2086, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2087, 0, 0, 0, 2088, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2089, 0, 0, 0, 2090, 0, 2091,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2092, 0, 2093, 0, 0, 2094, 2095,
+    0, 0, 2096, 0, 2097, 0, 0, 2098, 2099, 2100, 0, 0, 0, 2101, 0, 0,
+    0, 2102, 0, 2103, 2104, 2105, 0, 2106, 0, 2107, 0, 2108, 0, 0, 0, 2109,
+    0, 0, 0, 2110, 0, 2111, 0, 0, 0, 0, 0, 0, 0, 0, 2112, 2113,
+    0, 2114, 0, 0, 2115, 2116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2117, 0, 2118, 0, 0, 2119, 2120, 2121, 0, 0, 0, 2122, 0,
+    0, 0, 2123, 0, 2124, 2125, 2126, 0, 2127, 0, 2128, 0, 2129, 0, 0, 0,
+    2130, 0, 0, 0, 2131, 0, 2132, 0, 0, 0, 0, 0, 0, 0, 0, 2133,
+    2134, 0, 2135, 0, 0, 2136, 2137, 2138, 0, 2139, 2140, 0, 2141, 0, 0, 0,
+    2142, 0, 2143, 0, 0, 0, 0, 0, 2144, 2145, 0, 0, 2146, 0, 2147, 2148,
+    0, 0, 0, 0, 0, 0, 2149, 0, 0, 0, 2150, 0, 2151, 0, 0, 0,
+    0, 0, 0, 0, 0, 2152, 2153, 0, 2154, 0, 0, 2155, 2156, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2157, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2158, 0, 0, 0, 2159, 0, 0, 2160, 0, 0, 0, 0, 0,
+    2161, 0, 0, 0, 0, 0, 0, 0, 0, 2162, 0, 0, 2163, 0, 0, 2164,
+    0, 0, 0, 0, 0, 2165, 2166, 0, 2167, 0, 2168, 0, 2169, 0, 2170, 0,
+    2171, 0, 0, 2172, 2173, 2174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2175, 0, 2176, 0, 0, 2177, 2178, 2179, 0, 0, 0, 2180, 0, 0, 0, 2181,
+    0, 2182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2183, 0, 2184, 2185,
+    0, 0, 0, 0, 2186, 2187, 0, 2188, 0, 0, 0, 2189, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2190, 0, 0, 0, 2191, 0, 2192, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2193, 0, 2194, 0, 0, 2195, 2196, 2197,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2198, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2199, 0, 0, 0, 2200, 0, 0, 2201, 0, 0, 0,
+    0, 0, 2202, 2203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2204, 2205,
+    0, 2206, 0, 0, 0, 2207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2208,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2209, 0, 0, 0, 2210,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2212,
+    0, 0, 0, 0, 0, 2213, 0, 0, 2214, 0, 2215, 0, 0, 2216, 2217, 2218,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2219, 0, 0, 0, 2220, 0, 2221, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2222, 2223,
+    0, 2224, 0, 0, 0, 2225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2226, 2227, 0, 2228, 0, 2229, 0,
+    2230, 0, 2231, 0, 2232, 0, 0, 2233, 2234, 2235, 0, 0, 2236, 0, 2237, 2238,
+    0, 0, 0, 0, 2239, 0, 2240, 0, 0, 2241, 2242, 2243, 0, 0, 0, 2244,
+    0, 0, 0, 2245, 0, 2246, 2247, 2248, 0, 2249, 0, 2250, 0, 2251, 0, 0,
+    2252, 0, 2253, 2254, 0, 0, 0, 0, 2255, 2256, 0, 2257, 0, 0, 0, 2258,
+    0, 0, 0, 0, 0, 2259, 0, 0, 0, 0, 2260, 0, 2261, 0, 0, 2262,
+    2263, 0, 0, 0, 0, 2264, 0, 0, 0, 2265, 0, 2266, 2267, 0, 0, 2268,
+    0, 2269, 0, 0, 0, 0, 0, 2270, 0, 0, 0, 2271, 0, 2272, 0, 0,
+    0, 0, 0, 0, 0, 0, 2273, 2274, 0, 2275, 0, 0, 2276, 2277, 0, 0,
+    2278, 0, 0, 2279, 0, 0, 0, 0, 0, 2280, 0, 0, 0, 0, 0, 2281,
+    0, 0, 0, 0, 0, 2282, 0, 0, 0, 0, 0, 0, 2283, 0, 2284, 2285,
+    0, 0, 0, 0, 2286, 2287, 0, 2288, 0, 2289, 0, 2290, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2291, 2292, 0, 2293, 0, 2294, 0, 2295, 0, 2296,
+    0, 2297, 0, 0, 2298, 2299, 2300, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2301, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2302, 0, 0, 0, 2303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2304, 0, 0, 0, 2305, 0, 2306, 0, 0, 0, 0, 0,
+    0, 0, 0, 2307, 2308, 0, 2309, 0, 0, 2310, 2311, 2312, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2313, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2314, 0, 0, 0, 2315, 0, 0, 0, 0,
+    2316, 0, 0, 0, 2317, 0, 2318, 0, 0, 0, 0, 0, 0, 0, 0, 2319,
+    2320, 0, 2321, 0, 0, 2322, 2323, 2324, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2325, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2326, 0, 0,
+    0, 2327, 0, 0, 2328, 0, 2329, 0, 0, 2330, 2331, 2332, 0, 0, 0, 2333,
+    0, 0, 0, 2334, 0, 2335, 2336, 2337, 0, 2338, 0, 2339, 0, 2340, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2341, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2342, 0, 0, 0, 2343, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2344, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2345, 0, 0, 0, 2346, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2347, 0, 0, 0, 2348, 0, 2349,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2350, 0, 2351, 0, 0, 2352, 2353,
+    2354, 0, 0, 0, 2355, 0, 0, 0, 2356, 0, 2357, 0, 0, 0, 0, 0,
+    0, 0, 0, 2358, 2359, 0, 2360, 0, 0, 2361, 2362, 2363, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2365, 0, 0, 0, 2366, 0, 0, 2367, 0, 2368, 0, 0, 2369, 2370, 2371,
+    0, 0, 0, 2372, 0, 0, 0, 2373, 0, 2374, 2375, 2376, 0, 2377, 0, 2378,
+    0, 2379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2380, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2381, 0, 0, 0, 2382, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2383, 0, 0, 0, 2384,
+    0, 2385, 0, 0, 0, 0, 0, 0, 0, 0, 2386, 2387, 0, 2388, 0, 0,
+    0, 2389, 0, 0, 2390, 0, 2391, 0, 0, 2392, 2393, 2394, 0, 0, 0, 2395,
+    0, 0, 0, 2396, 0, 2397, 2398, 2399, 0, 2400, 0, 2401, 0, 2402, 0, 0,
+    0, 2403, 0, 0, 0, 2404, 0, 2405, 0, 0, 0, 0, 0, 0, 0, 0,
+    2406, 2407, 0, 2408, 0, 0, 2409, 2410, 2411, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2412, 0, 0, 0, 2413, 0, 2414, 0, 0, 0, 0, 0, 0, 0, 0, 2415,
+    2416, 0, 2417, 0, 0, 2418, 2419, 2420, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2422, 0, 0,
+    0, 2423, 0, 0, 2424, 0, 0, 0, 0, 0, 2425, 2426, 0, 0, 0, 0,
+    0, 0, 0, 2427, 0, 0, 2428, 2429, 0, 2430, 0, 0, 0, 2431, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2432, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2433, 0, 0, 0, 2434, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2435, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2436, 0, 0, 0, 0, 0, 2437, 0, 0,
+    2438, 0, 2439, 0, 0, 2440, 2441, 2442, 0, 0, 0, 2443, 0, 0, 0, 2444,
+    0, 2445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2446, 0, 0,
+    0, 2447, 0, 2448, 0, 0, 0, 0, 0, 0, 0, 0, 2449, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2450, 2451, 0, 2452, 0, 0, 0, 2453, 0, 2454,
+    0, 0, 0, 0, 0, 2455, 2456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2458, 0, 0, 0, 2459, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2460, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2461, 0, 0, 0, 0, 0, 2462,
+    2463, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2464, 0, 0, 0, 0, 2465, 0, 0, 0, 2466, 0, 2467, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2468, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2469, 0, 0, 0, 0, 0, 2470,
+    2471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2472, 0, 2473, 0, 0, 2474, 2475, 2476, 0, 0, 0, 2477,
+    0, 0, 0, 2478, 0, 2479, 2480, 2481, 0, 2482, 0, 2483, 0, 2484, 0, 0,
+    0, 2485, 0, 0, 0, 2486, 0, 2487, 0, 0, 0, 0, 0, 0, 0, 0,
+    2488, 2489, 0, 2490, 0, 0, 2491, 2492, 2493, 0, 2494, 2495, 0, 2496, 0, 0,
+    0, 2497, 0, 2498, 0, 0, 0, 0, 0, 2499, 2500, 0, 0, 2501, 0, 2502,
+    2503, 0, 0, 0, 0, 0, 0, 2504, 0, 0, 0, 2505, 0, 2506, 0, 0,
+    0, 0, 0, 0, 0, 0, 2507, 2508, 0, 2509, 0, 0, 0, 2510, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2511, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2512, 0, 0, 0, 2513, 0, 0, 2514, 0, 0, 0, 0,
+    0, 2515, 0, 0, 0, 0, 0, 0, 0, 0, 2516, 0, 0, 2517, 0, 0,
+    0, 0, 0, 0, 0, 0, 2518, 2519, 0, 2520, 0, 2521, 0, 2522, 0, 2523,
+    0, 2524, 0, 0, 2525, 2526, 2527, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2528, 0, 2529, 0, 0, 2530, 2531, 2532, 0, 0, 0, 2533, 0, 0, 0,
+    2534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2535, 0, 2536, 0, 0, 2537, 2538, 2539, 0,
+    0, 0, 2540, 0, 0, 0, 2541, 0, 2542, 2543, 2544, 0, 2545, 0, 2546, 0,
+    2547, 0, 0, 0, 2548, 0, 0, 0, 2549, 0, 2550, 0, 0, 0, 0, 0,
+    0, 0, 0, 2551, 2552, 0, 2553, 0, 0, 2554, 2555, 2556, 0, 2557, 2558, 0,
+    2559, 0, 2560, 0, 2561, 0, 2562, 0, 2563, 0, 0, 2564, 2565, 2566, 0, 0,
+    2567, 0, 2568, 2569, 0, 0, 0, 0, 0, 0, 2570, 0, 0, 0, 2571, 0,
+    2572, 0, 0, 0, 0, 0, 0, 0, 0, 2573, 2574, 0, 2575, 0, 0, 2576,
+    2577, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2578, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2579, 0, 0, 0, 2580, 0, 0, 2581, 0,
+    2582, 0, 0, 2583, 2584, 0, 0, 0, 0, 2585, 0, 0, 0, 2586, 0, 2587,
+    2588, 0, 0, 2589, 0, 2590, 0, 0, 0, 2591, 2592, 0, 2593, 0, 2594, 0,
+    0, 0, 2595, 0, 2596, 0, 0, 2597, 0, 0, 0, 0, 2598, 0, 2599, 2600,
+    0, 0, 0, 0, 2601, 0, 2602, 0, 0, 2603, 0, 0, 0, 0, 0, 2604,
+    0, 0, 0, 0, 0, 0, 2605, 2606, 0, 2607, 0, 2608, 0, 0, 0, 0,
+    2609, 0, 2610, 2611, 0, 0, 0, 0, 2612, 2613, 0, 2614, 0, 2615, 0, 0,
+    0, 0, 0, 0, 0, 2616, 0, 0, 0, 0, 0, 0, 2617, 0, 0, 0,
+    2618, 0, 2619, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2620, 0, 2621, 0,
+    0, 2622, 2623, 2624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2625, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2626, 0, 0, 0, 2627, 0, 0,
+    2628, 0, 2629, 0, 0, 2630, 2631, 2632, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2633, 2634, 0, 2635, 0, 2636, 0, 2637, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2639,
+    0, 0, 0, 2640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2641, 0, 0, 0, 2642, 0, 2643, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2644, 0, 2645, 0, 0, 2646, 2647, 0, 0, 2648, 0, 2649, 0,
+    0, 2650, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2651, 2652,
+    0, 2653, 0, 2654, 0, 0, 0, 0, 0, 2655, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2656, 0, 2657, 0, 0, 2658, 0,
+    0, 0, 2659, 2660, 0, 2661, 0, 2662, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2663, 0, 2664, 2665, 0, 0, 0, 0, 2666, 2667, 0,
+    2668, 0, 2669, 0, 2670, 0, 2671, 0, 2672, 0, 0, 2673, 2674, 2675, 0, 0,
+    2676, 0, 2677, 2678, 0, 0, 0, 0, 2679, 0, 2680, 0, 0, 2681, 2682, 2683,
+    0, 0, 0, 2684, 0, 0, 0, 2685, 0, 2686, 2687, 2688, 0, 2689, 0, 2690,
+    0, 2691, 0, 0, 2692, 0, 2693, 2694, 0, 0, 0, 0, 2695, 2696, 0, 2697,
+    0, 2698, 0, 2699, 0, 0, 0, 0, 0, 2700, 0, 0, 0, 0, 2701, 0,
+    2702, 0, 0, 2703, 2704, 0, 0, 0, 0, 2705, 0, 0, 0, 2706, 0, 2707,
+    2708, 0, 0, 2709, 0, 2710, 0, 0, 0, 0, 0, 2711, 0, 0, 0, 2712,
+    0, 2713, 0, 0, 0, 0, 0, 0, 0, 0, 2714, 2715, 0, 2716, 0, 0,
+    2717, 2718, 0, 0, 2719, 0, 0, 2720, 0, 2721, 0, 0, 0, 2722, 0, 2723,
+    0, 0, 2724, 2725, 0, 0, 0, 0, 0, 2726, 0, 0, 0, 0, 0, 0,
+    2727, 0, 2728, 2729, 0, 0, 0, 0, 2730, 2731, 0, 2732, 0, 2733, 0, 0,
+    0, 0, 0, 0, 0, 2734, 0, 0, 0, 0, 2735, 2736, 0, 2737, 0, 2738,
+    0, 0, 0, 2739, 0, 2740, 0, 0, 2741, 0, 0, 0, 0, 2742, 0, 2743,
+    2744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2745, 0, 0, 0, 2746, 0, 2747, 0, 0, 0, 0, 0, 0, 0,
+    0, 2748, 2749, 0, 2750, 0, 0, 2751, 2752, 2753, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2755,
+    0, 0, 0, 2756, 0, 0, 2757, 0, 2758, 0, 0, 2759, 2760, 2761, 0, 0,
+    0, 2762, 0, 0, 0, 2763, 0, 2764, 2765, 2766, 0, 2767, 0, 2768, 0, 2769,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2770, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2771, 0, 0, 0, 2772, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2773, 0, 0, 0, 2774, 0, 2775,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2776, 0, 2777, 0, 0, 2778, 2779,
+    0, 0, 2780, 0, 2781, 0, 0, 2782, 0, 0, 0, 0, 0, 2783, 0, 0,
+    0, 0, 0, 0, 2784, 2785, 0, 2786, 0, 2787, 0, 0, 0, 0, 0, 2788,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2789,
+    0, 2790, 0, 0, 2791, 0, 0, 0, 2792, 2793, 0, 2794, 0, 2795, 0, 0,
+    0, 2796, 0, 2797, 0, 0, 2798, 0, 0, 0, 0, 2799, 0, 2800, 2801, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2802, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2803, 0, 0, 0, 2804, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2805, 0, 0, 0, 2806,
+    0, 2807, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2808, 0, 2809, 0, 0,
+    2810, 2811, 2812, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2814, 0,
+    0, 0, 2815, 0, 0, 0, 0, 2816, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2817, 0, 2818, 0, 0, 2819, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2820, 0, 0, 0, 0, 0, 0, 2821, 0, 2822, 0, 0,
+    2823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2824, 2825, 0,
+    2826, 0, 0, 0, 0, 0, 2827, 0, 2828, 0, 0, 2829, 2830, 2831, 0, 0,
+    0, 2832, 0, 0, 0, 2833, 0, 2834, 2835, 2836, 0, 2837, 0, 2838, 0, 2839,
+    0, 0, 0, 2840, 0, 0, 0, 2841, 0, 2842, 0, 0, 0, 0, 0, 0,
+    0, 0, 2843, 2844, 0, 2845, 0, 0, 2846, 2847, 0, 0, 2848, 2849, 0, 2850,
+    0, 2851, 0, 2852, 0, 2853, 0, 2854, 0, 0, 2855, 2856, 2857, 0, 0, 2858,
+    0, 2859, 2860, 0, 0, 0, 0, 0, 0, 2861, 0, 0, 0, 2862, 0, 2863,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2864, 0, 2865, 0, 0, 2866, 2867,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2868, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2869, 0, 0, 0, 2870, 0, 0, 2871, 0, 2872,
+    0, 0, 2873, 2874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2875,
+    0, 0, 2876, 0, 0, 0, 0, 0, 2877, 2878, 0, 2879, 0, 2880, 0, 0,
+    0, 2881, 0, 2882, 0, 0, 2883, 0, 0, 0, 0, 2884, 0, 2885, 2886, 0,
+    0, 0, 0, 2887, 0, 2888, 0, 0, 2889, 0, 0, 0, 0, 0, 2890, 0,
+    0, 0, 0, 0, 0, 2891, 0, 0, 2892, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2893, 2894, 0, 2895, 0, 2896, 0,
+    2897, 0, 2898, 0, 2899, 0, 0, 2900, 2901, 2902, 0, 0, 2903, 0, 2904, 2905,
+    0, 0, 0, 0, 2906, 0, 2907, 0, 0, 2908, 2909, 2910, 0, 0, 0, 2911,
+    0, 0, 0, 2912, 0, 2913, 2914, 2915, 0, 2916, 0, 2917, 0, 2918, 0, 0,
+    2919, 0, 2920, 2921, 0, 0, 0, 0, 2922, 2923, 0, 2924, 0, 0, 0, 2925,
+    0, 0, 0, 0, 0, 2926, 0, 0, 0, 0, 2927, 0, 2928, 0, 0, 2929,
+    2930, 0, 0, 0, 0, 2931, 0, 0, 0, 2932, 0, 2933, 2934, 0, 0, 2935,
+    0, 2936, 0, 0, 0, 0, 0, 2937, 0, 0, 0, 2938, 0, 2939, 0, 0,
+    0, 0, 0, 0, 0, 0, 2940, 2941, 0, 2942, 0, 0, 2943, 2944, 0, 0,
+    2945, 0, 0, 2946, 0, 0, 0, 0, 0, 2947, 0, 0, 0, 0, 0, 2948,
+    0, 0, 0, 0, 0, 2949, 0, 0, 0, 0, 0, 0, 2950, 0, 2951, 2952,
+    0, 0, 0, 0, 2953, 2954, 0, 2955, 0, 2956, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2957, 2958, 0, 2959, 0, 2960, 0, 0, 0, 2961,
+    0, 2962, 0, 0, 2963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2964, 0, 0, 0, 0, 0, 2965, 0, 2966, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2967, 0, 2968, 0,
+    0, 2969, 2970, 2971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2972, 2973,
+    0, 2974, 0, 2975, 0, 2976, 0, 0, 0, 2977, 0, 0, 0, 2978, 0, 2979,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2980, 0, 2981, 0, 0, 2982, 2983,
+    2984, 0, 2985, 2986, 0, 2987, 0, 0, 0, 2988, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2989, 0, 2990, 2991, 0, 0, 0, 0, 0, 0, 2992,
+    0, 0, 0, 2993, 0, 2994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2995,
+    0, 2996, 0, 0, 2997, 2998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2999, 0, 0, 0, 0, 0, 3000, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3001, 0, 0, 3002, 0, 0, 0, 0, 0, 3003, 3004,
+    0, 3005, 0, 3006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3007, 0, 3008, 0, 0, 3009, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3010, 0, 3011, 3012, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3013, 0, 3014, 3015, 0, 0, 0, 0, 3016, 3017, 0, 3018, 0, 3019, 0, 3020,
+    0, 0, 0, 0, 0, 3021, 0, 0, 0, 0, 3022, 3023, 0, 3024, 0, 3025,
+    0, 3026, 0, 3027, 0, 3028, 0, 0, 3029, 3030, 3031, 0, 0, 3032, 0, 3033,
+    3034, 0, 0, 0, 0, 0, 0, 0, 0, 3035, 0, 0, 0, 0, 0, 3036,
+    0, 3037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3038, 0, 0, 3039, 0, 3040, 0, 0, 0, 3041, 0, 3042, 0, 0, 3043, 3044,
+    0, 0, 0, 0, 0, 3045, 0, 0, 0, 0, 0, 3046, 0, 3047, 0, 0,
+    3048, 3049, 0, 0, 0, 0, 3050, 0, 0, 0, 3051, 0, 0, 3052, 0, 0,
+    3053, 0, 0, 0, 0, 0, 0, 0, 0, 3054, 0, 0, 0, 0, 0, 3055,
+    0, 0, 3056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3057, 0, 0, 0, 0, 0, 3058, 0, 3059, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3060, 0, 3061,
+    3062, 0, 0, 0, 0, 3063, 3064, 0, 3065, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3066, 3067, 0, 3068, 0, 3069, 0, 3070, 0, 3071, 0, 3072, 0, 0,
+    3073, 3074, 3075, 0, 0, 3076, 0, 3077, 3078, 0, 0, 0, 0, 3079, 0, 3080,
+    0, 0, 3081, 3082, 3083, 0, 0, 0, 3084, 0, 0, 0, 3085, 0, 3086, 3087,
+    3088, 0, 3089, 0, 3090, 0, 3091, 0, 0, 3092, 0, 3093, 3094, 0, 0, 0,
+    0, 3095, 3096, 0, 3097, 0, 3098, 0, 3099, 0, 0, 0, 0, 0, 3100, 0,
+    0, 0, 0, 3101, 0, 3102, 0, 0, 3103, 3104, 3105, 0, 0, 0, 3106, 0,
+    0, 0, 3107, 0, 3108, 3109, 3110, 0, 3111, 0, 3112, 0, 3113, 0, 0, 0,
+    3114, 0, 0, 0, 3115, 0, 3116, 0, 0, 0, 0, 0, 0, 0, 0, 3117,
+    3118, 0, 3119, 0, 0, 3120, 3121, 3122, 0, 3123, 3124, 0, 3125, 0, 3126, 0,
+    3127, 0, 3128, 0, 3129, 0, 0, 3130, 3131, 3132, 0, 0, 3133, 0, 3134, 3135,
+    0, 0, 0, 0, 0, 3136, 0, 3137, 3138, 0, 0, 0, 0, 3139, 3140, 0,
+    3141, 0, 0, 0, 3142, 0, 0, 0, 0, 0, 3143, 0, 0, 0, 0, 3144,
+    3145, 0, 3146, 0, 0, 0, 3147, 0, 3148, 0, 0, 0, 0, 0, 3149, 3150,
+    0, 0, 3151, 0, 3152, 3153, 0, 0, 0, 0, 0, 0, 0, 0, 3154, 0,
+    0, 0, 0, 0, 3155, 0, 3156, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3157, 0, 3158, 0, 0, 3159, 3160, 3161, 0, 0, 0,
+    3162, 0, 0, 0, 3163, 0, 3164, 3165, 3166, 0, 3167, 0, 3168, 0, 3169, 0,
+    0, 0, 3170, 0, 0, 0, 3171, 0, 3172, 0, 0, 0, 0, 0, 0, 0,
+    0, 3173, 3174, 0, 3175, 0, 0, 3176, 3177, 3178, 0, 3179, 3180, 0, 3181, 0,
+    3182, 0, 3183, 0, 3184, 0, 3185, 0, 0, 3186, 3187, 3188, 0, 0, 3189, 0,
+    3190, 3191, 0, 0, 0, 0, 0, 0, 3192, 0, 0, 0, 3193, 0, 3194, 0,
+    0, 0, 0, 0, 0, 0, 0, 3195, 3196, 0, 3197, 0, 0, 3198, 3199, 3200,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3201, 0, 3202, 0,
+    0, 3203, 3204, 3205, 0, 0, 0, 3206, 0, 0, 0, 3207, 0, 3208, 3209, 3210,
+    0, 3211, 0, 3212, 0, 3213, 0, 3214, 3215, 0, 3216, 0, 0, 0, 3217, 0,
+    3218, 0, 0, 0, 0, 0, 3219, 3220, 0, 0, 3221, 0, 3222, 3223, 0, 0,
+    0, 0, 3224, 0, 0, 0, 0, 0, 3225, 3226, 0, 0, 0, 0, 0, 0,
+    0, 3227, 0, 0, 3228, 3229, 0, 3230, 0, 0, 0, 3231, 0, 0, 3232, 0,
+    3233, 3234, 0, 0, 0, 0, 3235, 3236, 0, 3237, 0, 0, 0, 3238, 0, 0,
+    0, 0, 0, 3239, 0, 0, 0, 0, 0, 3240, 0, 3241, 3242, 0, 0, 0,
+    0, 3243, 3244, 0, 3245, 0, 3246, 0, 3247, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3248, 3249, 0, 3250, 0, 3251, 0, 3252, 0, 3253, 0, 3254, 0,
+    0, 3255, 3256, 3257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3258, 0, 0, 0, 0, 0, 3259, 0, 3260, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3261, 3262, 0, 3263, 0, 3264, 0,
+    3265, 0, 3266, 0, 3267, 0, 0, 3268, 3269, 3270, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3271, 0, 3272, 0, 0, 3273, 3274, 3275, 0, 0, 0, 3276,
+    0, 0, 0, 3277, 0, 3278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3279, 0, 3280, 3281, 0, 0, 0, 0, 3282, 3283, 0, 3284, 0, 3285, 0, 3286,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3287, 0,
+    0, 0, 0, 0, 3288, 0, 3289, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3290, 0, 3291, 3292, 0, 0, 0, 0, 3293, 3294,
+    0, 3295, 0, 0, 0, 3296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3297, 0, 3298, 0, 0,
+    3299, 3300, 3301, 0, 0, 0, 3302, 0, 0, 0, 3303, 0, 3304, 3305, 3306, 0,
+    3307, 0, 3308, 0, 3309, 0, 0, 0, 3310, 0, 0, 0, 3311, 0, 3312, 0,
+    0, 0, 0, 0, 0, 0, 0, 3313, 3314, 0, 3315, 0, 0, 3316, 3317, 0,
+    0, 3318, 3319, 0, 3320, 0, 3321, 0, 3322, 0, 3323, 0, 3324, 0, 0, 3325,
+    3326, 3327, 0, 0, 3328, 0, 3329, 3330, 0, 0, 0, 0, 0, 0, 3331, 0,
+    0, 0, 3332, 0, 3333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3334, 0,
+    3335, 0, 0, 3336, 3337, 3338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3339,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3340, 0, 0, 0, 3341,
+    0, 0, 3342, 0, 3343, 0, 0, 3344, 3345, 3346, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3347, 3348, 0, 3349, 0, 3350, 0, 3351, 0, 3352, 3353, 0,
+    3354, 0, 0, 0, 3355, 0, 3356, 0, 0, 0, 0, 0, 3357, 3358, 0, 0,
+    3359, 0, 3360, 3361, 0, 0, 0, 0, 3362, 0, 0, 0, 0, 0, 3363, 0,
+    0, 0, 0, 0, 0, 0, 0, 3364, 0, 0, 3365, 0, 0, 3366, 0, 0,
+    0, 0, 0, 0, 3367, 0, 3368, 3369, 0, 0, 0, 0, 3370, 3371, 0, 3372,
+    0, 0, 0, 3373, 0, 0, 0, 0, 0, 3374, 0, 0, 0, 0, 0, 0,
+    3375, 0, 0, 0, 3376, 0, 3377, 0, 0, 0, 0, 0, 0, 0, 0, 3378,
+    3379, 0, 3380, 0, 0, 3381, 3382, 3383, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3385, 0, 0,
+    0, 3386, 0, 0, 3387, 0, 3388, 0, 0, 3389, 3390, 3391, 0, 0, 0, 3392,
+    0, 0, 0, 3393, 0, 3394, 3395, 3396, 0, 3397, 0, 3398, 0, 3399, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3400, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3401, 0, 0, 0, 3402, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3403, 0, 0, 0, 3404, 0, 3405, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3406, 0, 3407, 0, 0, 3408, 3409, 3410, 0,
+    3411, 0, 0, 0, 0, 0, 3412, 3413, 0, 0, 0, 0, 0, 0, 0, 3414,
+    0, 0, 3415, 3416, 0, 3417, 0, 0, 0, 3418, 0, 0, 0, 0, 0, 0,
+    0, 3419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3420, 0, 0,
+    0, 0, 0, 3421, 0, 0, 3422, 3423, 0, 3424, 0, 0, 0, 3425, 0, 3426,
+    0, 0, 0, 0, 0, 3427, 3428, 0, 0, 3429, 0, 3430, 3431, 0, 0, 0,
+    0, 3432, 3433, 0, 3434, 0, 3435, 0, 3436, 0, 3437, 0, 3438, 0, 0, 3439,
+    3440, 3441, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3442, 0, 3443, 0,
+    0, 3444, 3445, 0, 0, 0, 0, 3446, 0, 0, 0, 3447, 0, 3448, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3449, 0, 3450, 3451, 0, 0, 0, 0,
+    3452, 3453, 0, 3454, 0, 3455, 0, 3456, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3457, 0, 3458, 0, 0, 3459, 3460, 3461, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3462,
+    0, 0, 0, 3463, 0, 3464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3465, 3466, 0, 3467, 0, 3468, 0, 3469,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3470, 0, 3471, 3472, 0, 0, 0, 0, 3473, 3474, 0, 3475,
+    0, 0, 0, 3476, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3477, 0,
+    0, 3478, 0, 0, 0, 0, 0, 3479, 0, 0, 0, 0, 0, 3480, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3481, 0, 3482, 3483, 0, 0, 0, 0, 3484, 3485, 0,
+    3486, 0, 3487, 0, 3488, 0, 0, 0, 0, 0, 3489, 0, 0, 0, 0, 3490,
+    3491, 0, 3492, 0, 3493, 0, 3494, 0, 3495, 0, 3496, 0, 0, 3497, 3498, 3499,
+    0, 0, 3500, 0, 3501, 3502, 0, 0, 0, 0, 0, 0, 0, 0, 3503, 0,
+    0, 0, 0, 0, 3504, 0, 3505, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3506, 3507, 0, 3508, 0, 3509, 0, 3510, 0, 3511, 0,
+    3512, 0, 0, 3513, 3514, 3515, 0, 0, 3516, 0, 3517, 3518, 0, 0, 0, 0,
+    3519, 0, 3520, 0, 0, 3521, 3522, 3523, 0, 0, 0, 3524, 0, 0, 0, 3525,
+    0, 3526, 3527, 3528, 0, 3529, 0, 3530, 0, 3531, 0, 0, 3532, 0, 3533, 3534,
+    0, 0, 0, 0, 3535, 3536, 0, 3537, 0, 0, 0, 3538, 0, 0, 0, 0,
+    0, 3539, 0, 0, 0, 0, 0, 0, 0, 0, 3540, 0, 0, 0, 0, 0,
+    3541, 0, 3542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3543, 0, 3544, 3545, 0, 0, 0, 0, 3546, 3547, 0, 3548, 0, 0,
+    0, 3549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3550, 3551, 0, 3552, 0, 3553, 0, 3554, 0,
+    3555, 0, 3556, 0, 0, 3557, 3558, 3559, 0, 0, 3560, 0, 3561, 3562, 0, 0,
+    0, 0, 3563, 0, 3564, 0, 0, 3565, 3566, 3567, 0, 0, 0, 3568, 0, 0,
+    0, 3569, 0, 3570, 3571, 3572, 0, 3573, 0, 3574, 0, 3575, 0, 0, 3576, 0,
+    3577, 3578, 0, 0, 0, 0, 3579, 3580, 0, 3581, 0, 0, 0, 3582, 0, 0,
+    0, 0, 0, 3583, 0, 0, 0, 0, 3584, 0, 3585, 0, 0, 3586, 3587, 3588,
+    0, 0, 0, 3589, 0, 0, 0, 3590, 0, 3591, 3592, 3593, 0, 3594, 0, 3595,
+    0, 3596, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3597, 3598,
+    0, 3599, 0, 0, 0, 3600, 0, 3601, 0, 0, 0, 0, 0, 3602, 3603, 0,
+    0, 3604, 0, 3605, 3606, 0, 0, 0, 0, 0, 3607, 0, 3608, 3609, 0, 0,
+    0, 0, 3610, 3611, 0, 3612, 0, 0, 0, 3613, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3614, 3615, 0, 3616, 0, 0, 0, 3617, 0, 3618, 0, 0,
+    0, 0, 0, 3619, 3620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3621, 0, 0, 0, 0, 0, 3622, 0, 3623, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3624, 0,
+    0, 0, 0, 0, 3625, 0, 3626, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3627, 0, 3628, 3629, 0, 0, 0, 0, 3630, 3631,
+    0, 3632, 0, 3633, 0, 3634, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3635, 0, 3636, 3637,
+    0, 0, 0, 0, 3638, 3639, 0, 3640, 0, 3641, 0, 3642, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3643, 3644, 0, 3645, 0, 3646, 0, 3647, 0, 3648,
+    0, 3649, 0, 0, 3650, 3651, 3652, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3653, 0, 0, 0, 0, 0, 3654, 0, 3655, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3656, 0, 0, 0, 0,
+    0, 3657, 0, 3658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3659, 0, 3660,
+    0, 0, 3661, 3662, 3663, 0, 0, 0, 3664, 0, 0, 0, 3665, 0, 3666, 3667,
+    3668, 0, 3669, 0, 3670, 0, 3671, 0, 0, 0, 3672, 0, 0, 0, 3673, 0,
+    3674, 0, 0, 0, 0, 0, 0, 0, 0, 3675, 3676, 0, 3677, 0, 0, 3678,
+    3679, 3680, 0, 3681, 3682, 0, 3683, 0, 3684, 0, 3685, 0, 3686, 0, 3687, 0,
+    0, 3688, 3689, 3690, 0, 0, 3691, 0, 3692, 3693, 0, 0, 0, 0, 0, 0,
+    3694, 0, 0, 0, 3695, 0, 3696, 0, 0, 0, 0, 0, 0, 0, 0, 3697,
+    3698, 0, 3699, 0, 0, 0, 3700, 3701, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3703, 0, 0,
+    0, 3704, 0, 0, 3705, 0, 3706, 0, 0, 0, 3707, 3708, 0, 0, 0, 3709,
+    0, 0, 0, 3710, 0, 3711, 3712, 3713, 0, 0, 0, 0, 0, 3714, 0, 3715,
+    3716, 0, 3717, 0, 0, 0, 3718, 0, 3719, 0, 0, 0, 0, 0, 3720, 3721,
+    0, 0, 3722, 0, 3723, 3724, 0, 0, 0, 0, 3725, 0, 0, 0, 0, 0,
+    3726, 3727, 0, 0, 0, 0, 0, 0, 0, 3728, 0, 0, 3729, 3730, 0, 3731,
+    0, 0, 0, 3732, 0, 0, 3733, 0, 3734, 3735, 0, 0, 0, 0, 3736, 3737,
+    0, 3738, 0, 0, 0, 3739, 0, 0, 0, 0, 0, 3740, 0, 0, 0, 0,
+    0, 0, 3741, 0, 0, 0, 3742, 0, 3743, 0, 0, 0, 0, 0, 0, 0,
+    0, 3744, 3745, 0, 3746, 0, 0, 3747, 3748, 3749, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3751,
+    0, 0, 0, 3752, 0, 0, 3753, 0, 3754, 0, 0, 3755, 3756, 3757, 0, 0,
+    0, 3758, 0, 0, 0, 3759, 0, 3760, 3761, 3762, 0, 3763, 0, 3764, 0, 3765,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3766, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3767, 0, 0, 0, 3768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3769, 0, 0, 0, 3770, 0, 3771,
+    0, 0, 0, 0, 0, 0, 0, 0, 3772, 3773, 0, 3774, 0, 0, 0, 3775,
+    3776, 0, 3777, 0, 0, 0, 0, 0, 3778, 3779, 0, 0, 0, 0, 0, 0,
+    0, 3780, 0, 0, 3781, 3782, 0, 3783, 0, 0, 0, 3784, 0, 0, 0, 0,
+    0, 0, 0, 3785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3786,
+    0, 0, 0, 0, 0, 3787, 3788, 0, 3789, 3790, 0, 3791, 0, 0, 0, 3792,
+    0, 3793, 0, 0, 0, 0, 0, 3794, 3795, 0, 0, 3796, 0, 3797, 3798, 0,
+    0, 0, 0, 3799, 3800, 0, 3801, 0, 3802, 0, 3803, 0, 3804, 0, 3805, 0,
+    0, 3806, 3807, 3808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3809, 0,
+    3810, 0, 0, 3811, 3812, 3813, 0, 0, 0, 3814, 0, 0, 0, 3815, 0, 3816,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3817, 0, 3818, 3819, 0, 0,
+    0, 0, 3820, 3821, 0, 3822, 0, 3823, 0, 3824, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3825, 0, 3826, 0, 0, 0, 3827, 3828, 0, 0, 0, 3829,
+    0, 0, 0, 3830, 0, 3831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3832, 0, 0, 0, 3833, 0, 3834, 0, 0, 0, 0, 0, 0, 0, 0,
+    3835, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3836, 3837, 0, 0, 0, 0,
+    0, 3838, 0, 3839, 0, 3840, 0, 0, 0, 3841, 3842, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3843, 0, 3844, 3845, 0, 0, 0, 0, 3846, 3847,
+    0, 3848, 0, 0, 0, 3849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3850, 3851, 0, 3852, 0, 0, 0, 3853, 0, 3854, 0, 0, 0, 0, 0, 3855,
+    3856, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3857, 0, 0, 0, 3858, 0, 3859, 0,
+    0, 0, 0, 0, 0, 0, 0, 3860, 3861, 0, 3862, 0, 0, 3863, 3864, 3865,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3866, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3867, 0, 0, 0, 3868, 0, 0, 3869, 0, 3870, 0,
+    0, 3871, 3872, 3873, 0, 0, 0, 3874, 0, 0, 0, 3875, 0, 3876, 3877, 3878,
+    0, 3879, 0, 3880, 0, 3881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3882,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3883, 0, 0, 0, 3884,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3885,
+    0, 0, 0, 3886, 0, 3887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3888,
+    0, 3889, 0, 0, 0, 3890, 3891, 0, 3892, 0, 0, 0, 0, 0, 3893, 3894,
+    0, 0, 0, 0, 0, 0, 0, 3895, 0, 0, 3896, 3897, 0, 3898, 0, 0,
+    0, 3899, 0, 0, 0, 0, 0, 0, 0, 3900, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3901, 0, 0, 0, 0, 0, 3902, 0, 0, 3903, 3904,
+    0, 3905, 0, 0, 0, 3906, 0, 3907, 0, 0, 0, 0, 0, 3908, 3909, 0,
+    0, 3910, 0, 3911, 3912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3914, 0, 0,
+    0, 3915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3916, 0, 0, 0, 3917, 0, 3918, 0, 0, 0, 0, 0, 0, 0, 0,
+    3919, 3920, 0, 3921, 0, 0, 3922, 3923, 3924, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3925, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3926, 0, 0, 0, 3927, 0, 0, 0, 0, 0, 0, 0,
+    0, 3928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3929, 0, 0,
+    0, 0, 0, 3930, 3931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3932, 0,
+    0, 3933, 0, 0, 0, 0, 0, 3934, 3935, 0, 0, 0, 0, 0, 0, 0,
+    3936, 0, 0, 3937, 3938, 0, 3939, 0, 0, 0, 0, 0, 3940, 0, 3941, 0,
+    0, 3942, 3943, 3944, 0, 0, 0, 3945, 0, 0, 0, 3946, 0, 3947, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3948, 0, 0, 0, 3949, 0, 3950,
+    0, 0, 0, 0, 0, 0, 0, 0, 3951, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3952, 3953, 0, 3954, 0, 3955, 0, 3956, 0, 3957, 0, 3958, 0, 0,
+    3959, 3960, 3961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3962,
+    0, 0, 0, 3963, 0, 3964, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3966, 0, 3967, 0, 0, 0, 3968, 3969, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3970, 3971,
+    0, 3972, 0, 0, 0, 3973, 0, 3974, 0, 0, 0, 0, 0, 3975, 3976, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3977, 0, 0, 0, 0, 0, 3978,
+    0, 0, 0, 0, 0, 0, 0, 0, 3979, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3980,
+    3981, 0, 3982, 0, 3983, 0, 3984, 0, 3985, 0, 3986, 0, 0, 3987, 3988, 3989,
+    0, 0, 3990, 0, 3991, 3992, 0, 0, 0, 0, 3993, 0, 3994, 0, 0, 3995,
+    3996, 3997, 0, 0, 0, 3998, 0, 0, 0, 3999, 0, 4000, 4001, 4002, 0, 4003,
+    0, 4004, 0, 4005, 0, 0, 4006, 0, 4007, 4008, 0, 0, 0, 0, 4009, 4010,
+    0, 4011, 0, 0, 0, 4012, 0, 0, 0, 0, 0, 4013, 0, 0, 0, 0,
+    4014, 0, 4015, 0, 0, 0, 4016, 4017, 0, 0, 0, 4018, 0, 0, 0, 4019,
+    0, 4020, 4021, 4022, 0, 0, 0, 0, 0, 4023, 0, 0, 0, 4024, 0, 0,
+    0, 4025, 0, 4026, 0, 0, 0, 0, 0, 0, 0, 0, 4027, 4028, 0, 4029,
+    0, 0, 0, 4030, 4031, 0, 4032, 4033, 0, 0, 0, 0, 0, 4034, 0, 4035,
+    0, 0, 0, 0, 0, 4036, 4037, 0, 0, 4038, 0, 0, 0, 0, 0, 0,
+    0, 0, 4039, 0, 4040, 4041, 0, 0, 0, 0, 4042, 4043, 0, 4044, 0, 0,
+    0, 4045, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4046, 4047, 0, 4048,
+    0, 0, 0, 4049, 0, 4050, 0, 0, 0, 0, 0, 4051, 4052, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4053, 0, 0, 0, 0,
+    0, 4054, 0, 4055, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4056, 0, 4057, 0, 0, 4058, 4059, 4060, 0, 0, 0, 4061, 0, 0,
+    0, 4062, 0, 4063, 4064, 4065, 0, 4066, 0, 4067, 0, 4068, 0, 0, 0, 4069,
+    0, 0, 0, 4070, 0, 4071, 0, 0, 0, 0, 0, 0, 0, 0, 4072, 4073,
+    0, 4074, 0, 0, 4075, 4076, 4077, 0, 4078, 4079, 0, 4080, 0, 0, 0, 4081,
+    0, 4082, 0, 0, 0, 0, 0, 4083, 4084, 0, 0, 4085, 0, 4086, 4087, 0,
+    0, 0, 0, 0, 0, 4088, 0, 0, 0, 4089, 0, 4090, 0, 0, 0, 0,
+    0, 0, 0, 0, 4091, 4092, 0, 4093, 0, 0, 0, 4094, 4095, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 0, 4097,
+    4098, 0, 0, 0, 0, 0, 0, 0, 4099, 0, 0, 4100, 4101, 0, 0, 0,
+    0, 0, 0, 0, 4102, 4103, 0, 4104, 0, 0, 0, 4105, 0, 4106, 0, 0,
+    0, 0, 0, 4107, 4108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4109,
+    0, 0, 0, 0, 0, 4110, 4111, 0, 0, 0, 0, 0, 0, 0, 4112, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4113, 0, 4114, 4115, 0,
+    0, 0, 0, 4116, 4117, 0, 4118, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4119, 0, 4120, 4121, 0, 0, 0, 0, 4122, 4123,
+    0, 4124, 0, 4125, 0, 4126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4127, 4128, 0, 4129, 0, 4130, 0, 4131, 0, 4132, 0, 4133, 0, 0, 4134, 4135,
+    4136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4137,
+    0, 0, 0, 0, 0, 4138, 0, 4139, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4140, 4141, 0, 0, 0, 0, 0, 4142, 0, 4143,
+    0, 4144, 0, 0, 0, 4145, 4146, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4147, 0, 4148, 0, 0, 0, 4149, 4150, 0, 0, 0, 4151, 0, 0, 0,
+    4152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4153, 0, 0,
+    0, 0, 0, 0, 0, 4154, 4155, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4156, 0, 0, 0, 0,
+    0, 4157, 0, 4158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4159, 0, 4160, 4161, 0, 0, 0, 0, 4162, 4163, 0, 4164, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4165, 0, 4166, 4167, 0, 0, 0,
+    0, 4168, 4169, 0, 4170, 0, 4171, 0, 4172, 0, 0, 0, 0, 0, 4173, 0,
+    0, 0, 0, 4174, 4175, 0, 4176, 0, 4177, 0, 4178, 0, 4179, 0, 4180, 0,
+    0, 4181, 4182, 4183, 0, 0, 4184, 0, 4185, 4186, 0, 0, 0, 0, 0, 0,
+    0, 0, 4187, 0, 0, 0, 0, 0, 4188, 0, 4189, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4190, 4191, 0, 4192, 0, 4193, 0,
+    4194, 0, 4195, 0, 4196, 0, 0, 4197, 4198, 4199, 0, 0, 4200, 0, 4201, 4202,
+    0, 0, 0, 0, 4203, 0, 4204, 0, 0, 4205, 4206, 4207, 0, 0, 0, 4208,
+    0, 0, 0, 4209, 0, 4210, 4211, 4212, 0, 4213, 0, 4214, 0, 4215, 0, 0,
+    4216, 0, 4217, 4218, 0, 0, 0, 0, 4219, 4220, 0, 4221, 0, 4222, 0, 4223,
+    0, 0, 0, 0, 0, 4224, 0, 0, 0, 0, 0, 0, 0, 0, 4225, 0,
+    0, 0, 0, 0, 4226, 0, 4227, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4228, 0, 4229, 4230, 0, 0, 0, 0, 4231, 4232,
+    0, 4233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4234, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4235, 4236, 0, 4237, 0,
+    4238, 0, 4239, 0, 4240, 0, 4241, 0, 0, 4242, 4243, 4244, 0, 0, 4245, 0,
+    4246, 4247, 0, 0, 0, 0, 4248, 0, 4249, 0, 0, 4250, 4251, 4252, 0, 0,
+    0, 4253, 0, 0, 0, 4254, 0, 4255, 4256, 4257, 0, 4258, 0, 4259, 0, 4260,
+    0, 0, 4261, 0, 4262, 4263, 0, 0, 0, 0, 4264, 4265, 0, 4266, 0, 4267,
+    0, 4268, 0, 0, 0, 0, 0, 4269, 0, 0, 0, 0, 4270, 0, 4271, 0,
+    0, 4272, 4273, 4274, 0, 0, 0, 4275, 0, 0, 0, 4276, 0, 4277, 4278, 4279,
+    0, 4280, 0, 4281, 0, 4282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4283, 4284, 0, 4285, 0, 4286, 0, 4287, 0, 4288, 0, 4289, 0, 0,
+    4290, 4291, 4292, 0, 0, 4293, 0, 4294, 4295, 0, 0, 0, 0, 0, 4296, 0,
+    4297, 4298, 0, 0, 0, 0, 4299, 4300, 0, 4301, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4302, 0, 0, 0, 0, 4303, 4304, 0, 4305, 0, 0, 0, 0,
+    0, 4306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4307, 0, 4308, 4309, 0,
+    0, 0, 0, 0, 0, 0, 0, 4310, 0, 0, 0, 0, 0, 4311, 0, 4312,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4313, 0, 0, 0, 0, 0, 4314, 0, 4315, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4316, 0, 4317, 4318, 0, 0,
+    0, 0, 4319, 4320, 0, 4321, 0, 4322, 0, 4323, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4324, 0, 4325, 4326, 0, 0, 0, 0, 4327, 4328, 0, 4329, 0, 4330, 0, 4331,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4332, 4333, 0, 4334, 0, 4335,
+    0, 4336, 0, 4337, 0, 4338, 0, 0, 4339, 4340, 4341, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4342, 0, 0, 0, 0, 0, 4343,
+    0, 4344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4345,
+    0, 0, 0, 0, 0, 4346, 0, 4347, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4348, 4349, 0, 4350, 0, 4351, 0, 4352, 0, 4353, 0, 4354, 0, 0, 4355,
+    4356, 4357, 0, 0, 4358, 0, 4359, 4360, 0, 0, 0, 0, 4361, 0, 4362, 0,
+    0, 4363, 4364, 0, 0, 0, 0, 4365, 0, 0, 0, 4366, 0, 4367, 4368, 0,
+    0, 4369, 0, 4370, 0, 0, 0, 0, 4371, 0, 4372, 4373, 0, 0, 0, 0,
+    4374, 4375, 0, 4376, 0, 4377, 0, 4378, 0, 0, 0, 0, 0, 4379, 0, 0,
+    0, 0, 4380, 0, 4381, 0, 0, 4382, 4383, 4384, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4385, 4386, 0, 4387, 0, 4388, 0, 4389, 0, 0, 0, 4390,
+    0, 0, 0, 4391, 0, 4392, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4393,
+    0, 4394, 0, 0, 4395, 4396, 0, 0, 4397, 4398, 0, 4399, 0, 4400, 0, 4401,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4402, 0, 4403, 4404, 0,
+    0, 0, 0, 0, 4405, 0, 4406, 4407, 0, 0, 0, 0, 4408, 4409, 0, 4410,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4411, 0, 0, 0, 0, 4412, 0,
+    0, 4413, 0, 0, 0, 0, 0, 4414, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4416, 0, 0,
+    0, 0, 0, 4417, 0, 4418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4419, 0, 4420, 0, 0, 4421, 4422, 4423, 0, 0, 0, 4424,
+    0, 0, 0, 4425, 0, 4426, 4427, 4428, 0, 4429, 0, 4430, 0, 4431, 0, 0,
+    0, 4432, 0, 0, 0, 4433, 0, 4434, 0, 0, 0, 0, 0, 0, 0, 0,
+    4435, 4436, 0, 4437, 0, 0, 4438, 4439, 0, 0, 4440, 4441, 0, 4442, 0, 4443,
+    0, 4444, 0, 4445, 0, 4446, 0, 0, 4447, 4448, 4449, 0, 0, 4450, 0, 4451,
+    4452, 0, 0, 0, 0, 0, 0, 4453, 0, 0, 0, 4454, 0, 4455, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4456, 0, 4457, 0, 0, 4458, 4459, 4460, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4461, 0, 4462, 0, 0,
+    4463, 4464, 4465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4466, 4467, 0,
+    4468, 0, 0, 0, 0, 0, 4469, 4470, 0, 4471, 0, 0, 0, 0, 0, 4472,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4473, 0, 4474, 4475, 0, 0, 0,
+    0, 4476, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4477, 0, 0, 4478, 0, 0, 0, 0, 0, 0, 4479, 0, 4480,
+    4481, 0, 0, 0, 0, 4482, 4483, 0, 4484, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4485, 0, 4486, 4487, 0, 0, 0, 0,
+    4488, 4489, 0, 4490, 0, 4491, 0, 4492, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4493, 0, 0, 4494, 0, 4495, 0, 0, 0, 4496, 0, 4497, 0, 0,
+    4498, 4499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4500, 0, 0, 0, 0, 0, 4501, 0, 4502, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4503, 4504, 0, 4505, 0, 4506, 0, 4507,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4508, 0, 4509, 0, 0, 4510, 4511, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4512,
+    0, 4513, 4514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4515, 0, 0,
+    0, 0, 0, 4516, 0, 4517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4518, 0, 0, 0, 0, 0, 4519, 0, 0,
+    4520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0
+};
+
+const int8_t perfectScores[][PERFECT_TABLE_CELLS] = {
+    {-128, -128, -128, -128, -128, -128, -128, -128, -128},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-128, -5, -5, -5, 0, -5, -5, -5, -5},
+    {-128, -128, -5, 0, 0, -5, 0, -5, 0},
+    {0, -128, 0, -5, 0, -5, -5, 0, -5},
+    {-128, -128, 0, 6, 6, 0, 6, 0, 0},
+    {-128, -5, -128, 0, 0, 6, 6, 0, 6},
+    {0, -128, -128, 0, 6, 6, 0, 0, 6},
+    {-128, -128, -128, -7, 0, 6, -7, 0, 6},
+    {-5, -5, -128, -5, 0, -5, -5, -5, -5},
+    {-128, -5, -128, 6, 0, 0, 6, 0, 6},
+    {-5, -128, -128, -5, 0, 0, 0, -5, 0},
+    {-128, -128, -128, -7, 0, -7, -7, -7, -7},
+    {-128, -128, -128, 6, 0, -7, 6, 0, -7},
+    {-128, 0, 0, -128, 0, -5, -5, -5, 0},
+    {6, -128, 0, -128, 6, -5, -5, 0, 0},
+    {-128, -128, -7, -128, -9, -9, -9, -9, -9},
+    {-128, -128, -128, -128, 8, 8, -7, 6, 6},
+    {6, -5, -128, -128, 0, -5, -5, -5, 0},
+    {-128, -7, -128, -128, -9, -9, -9, -9, -9},
+    {-128, -128, -128, -128, 8, -7, -7, -7, 0},
+    {6, -128, -128, -128, -9, -9, -9, -9, -9},
+    {-128, -128, -128, -128, 8, 8, 10, 6, 8},
+    {0, -5, -5, -128, 0, 0, 0, -5, -5},
+    {-128, 6, 6, -128, 6, 0, 0, 0, 0},
+    {6, -128, -5, -128, 6, 0, 0, -5, 0},
+    {-128, -128, -9, -128, -9, -9, -7, -9, -9},
+    {-128, -128, -7, -128, 0, 0, -7, 0, -7},
+    {6, -5, -128, -128, 6, 0, 0, 0, 6},
+    {-128, -9, -128, -128, -9, -9, -7, -9, -9},
+    {-128, -128, -128, -128, -9, -9, -7, -9, -9},
+    {-7, -128, -128, -128, 0, -5, -7, 0, 6},
+    {-128, -128, -128, -128, 8, 0, -7, 0, 8},
+    {-128, -7, -128, -128, 0, 0, -7, -7, -7},
+    {-7, -128, -128, -128, 0, -7, -7, -7, -7},
+    {-128, -128, -128, -128, 8, 0, -7, -7, -7},
+    {-128, 0, 0, 0, -128, 0, 0, 0, 0},
+    {6, -128, 6, 6, -128, 6, 6, 0, 6},
+    {-128, -128, 0, -9, -128, -9, -9, -9, -9},
+    {-128, -128, -128, 8, -128, 8, 10, 0, 8},
+    {0, 0, -128, 0, -128, 0, 0, 0, 0},
+    {-128, 0, -128, -9, -128, -9, -9, -9, -9},
+    {-128, -128, -128, 8, -128, 8, 0, 10, 0},
+    {0, -128, -128, -9, -128, -9, -9, -9, -9},
+    {-128, -128, -128, 8, -128, 8, 8, 0, 10},
+    {-128, -128, 8, -128, -128, 10, -9, -9, -9},
+    {-128, 8, -128, -128, -128, 10, -9, -9, -9},
+    {8, -128, -128, -128, -128, 10, -9, -9, -9},
+    {6, 6, 6, -128, -128, 0, 6, 6, 6},
+    {-128, -9, -9, -128, -128, -9, 0, -9, -9},
+    {-128, -128, -9, -128, -128, -9, 8, 10, -9},
+    {0, -128, 0, -128, -128, -7, 0, -7, -7},
+    {-128, -128, 8, -128, -128, 0, 8, 0, 10},
+    {-128, -9, -128, -128, -128, -9, 10, -9, -9},
+    {8, -128, -128, -128, -128, 8, 10, 0, 8},
+    {-128, -128, -128, -128, -128, -9, 10, -9, -9},
+    {0, 0, -128, -128, -128, -7, 0, 0, -7},
+    {-128, 8, -128, -128, -128, 0, 0, 8, 10},
+    {8, -128, -128, -128, -128, 0, 0, 10, 8},
+    {-128, -128, -128, -128, -128, -9, 0, 10, -9},
+    {-128, -128, -128, -128, -128, 0, 0, 0, 10},
+    {0, -5, 0, -5, -128, -5, 0, -5, 0},
+    {-128, 0, 0, 0, -128, 0, 0, 0, 0},
+    {0, -128, 0, 0, -128, 0, 0, -5, 0},
+    {-128, -128, -9, -9, -128, -9, -9, -9, -7},
+    {-128, -128, -9, -9, -128, -9, -9, 0, -9},
+    {0, 0, -128, 0, -128, 0, 0, 0, 0},
+    {-128, -9, -128, -9, -128, -9, -9, -9, 0},
+    {-128, -128, -128, -9, -128, -9, -9, -9, 0},
+    {-9, -128, -128, -9, -128, -9, -9, 0, -9},
+    {-128, -128, -128, -9, -128, -9, -9, 0, -9},
+    {-128, -9, -128, -9, -128, -9, 0, -9, -9},
+    {-9, -128, -128, -9, -128, -9, -7, -9, -9},
+    {-128, -128, -128, -9, -128, -9, 0, -9, -9},
+    {0, 0, 0, -128, -128, -5, 0, 0, 0},
+    {-128, -9, -9, -128, -128, -9, -9, -9, -7},
+    {-128, -128, -9, -128, -128, -9, -9, -9, 0},
+    {-9, -128, -9, -128, -128, -9, -9, -7, -9},
+    {-128, -128, -9, -128, -128, -9, 10, 0, -9},
+    {-128, -9, -128, -128, -128, -9, -9, -9, 0},
+    {-9, -128, -128, -128, -128, -9, -9, 0, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -9, -9},
+    {-9, -9, -128, -128, -128, -9, -7, -9, -9},
+    {-128, -9, -128, -128, -128, -9, 10, -9, -9},
+    {-9, -128, -128, -128, -128, -9, 0, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -9, 10, -9, -9},
+    {-128, -9, -9, -128, -128, 0, -9, -9, -9},
+    {-9, -128, -9, -128, -128, -7, -9, -9, -9},
+    {-128, -128, 10, -128, -128, 0, -9, -9, -9},
+    {-9, -9, -128, -128, -128, 0, -9, -9, -9},
+    {-128, 10, -128, -128, -128, 8, -9, -9, -9},
+    {10, -128, -128, -128, -128, 8, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -9, -9},
+    {-128, -5, 6, -5, 0, -128, 0, -5, -5},
+    {0, -128, 6, -5, 6, -128, 0, 0, -5},
+    {-128, -128, 6, -9, -9, -128, -9, -9, -9},
+    {-128, -128, -128, 8, 8, -128, 8, 6, 10},
+    {0, 0, -128, -5, 0, -128, 0, -5, -5},
+    {-128, -7, -128, -9, -9, -128, -9, -9, -9},
+    {-128, -128, -128, -7, 8, -128, 0, -7, -7},
+    {-7, -128, -128, -9, -9, -128, -9, -9, -9},
+    {-128, -128, -128, 8, 8, -128, 6, 6, -7},
+    {-128, -128, 8, -128, 10, -128, -9, -9, -9},
+    {-128, -7, -128, -128, 10, -128, -9, -9, -9},
+    {8, -128, -128, -128, 10, -128, -9, -9, -9},
+    {0, 0, 0, -128, 0, -128, 0, 0, 0},
+    {-128, -9, -9, -128, -9, -128, 0, -9, -9},
+    {-128, -128, -9, -128, -9, -128, 6, -9, -9},
+    {0, -128, -5, -128, -7, -128, 0, -7, -5},
+    {-128, -128, 0, -128, 0, -128, 0, 0, 8},
+    {-128, -9, -128, -128, -9, -128, 8, -9, 10},
+    {0, -128, -128, -128, 8, -128, 8, 0, 10},
+    {-128, -128, -128, -128, -9, -128, 8, -9, 10},
+    {0, -7, -128, -128, -7, -128, 0, -7, -7},
+    {-128, 0, -128, -128, 0, -128, 0, 0, 0},
+    {0, -128, -128, -128, 0, -128, 0, 0, -7},
+    {-128, -128, -128, -128, -9, -128, 0, -9, -9},
+    {-128, -128, -128, -128, 0, -128, 0, 0, -7},
+    {-128, -128, 8, 10, -128, -128, -9, -9, -9},
+    {-128, 8, -128, 10, -128, -128, -9, -9, -9},
+    {8, -128, -128, 10, -128, -128, -9, -9, -9},
+    {-128, -9, -9, -128, -128, -128, 0, -9, -9},
+    {0, -128, 8, -128, -128, -128, 0, -7, 8},
+    {-128, -128, -9, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 10, -9, 10},
+    {0, 0, -128, -128, -128, -128, 0, 0, -7},
+    {-128, -9, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 0, 10, -9},
+    {0, -128, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 0, 0, 10},
+    {0, 0, 0, -5, -128, -128, 0, 0, 0},
+    {-128, -9, -9, -9, -128, -128, -9, -9, -7},
+    {-128, -128, -9, -9, -128, -128, -9, -9, 0},
+    {-9, -128, -9, -9, -128, -128, -9, -7, -9},
+    {-128, -128, -9, -9, -128, -128, -9, 0, -9},
+    {-128, -9, -128, -9, -128, -128, -9, -9, 10},
+    {-9, -128, -128, -9, -128, -128, -9, 0, 10},
+    {-128, -128, -128, -9, -128, -128, -9, -9, 10},
+    {-9, -9, -128, -9, -128, -128, -7, -9, -9},
+    {-128, -9, -128, -9, -128, -128, 0, -9, -9},
+    {-9, -128, -128, -9, -128, -128, 0, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -9},
+    {-128, -9, -9, -128, -128, -128, -9, -9, -7},
+    {-9, -128, -9, -128, -128, -128, -9, -7, -9},
+    {-128, -128, -9, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, -9, -9, 10},
+    {-9, -9, -128, -128, -128, -128, -7, -9, -9},
+    {-128, -9, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, -9, -9, -9},
+    {-9, -128, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 10, -9, -9},
+    {0, -7, 0, -128, -128, -128, 0, -7, 0},
+    {-128, 0, 8, -128, -128, -128, 0, 0, 0},
+    {0, -128, 8, -128, -128, -128, 0, -7, 0},
+    {-128, -128, -9, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -9, -128, -128, -128, -9, 0, -9},
+    {8, 8, -128, -128, -128, -128, 0, 0, 10},
+    {-128, -9, -128, -128, -128, -128, -9, -9, 10},
+    {-128, -128, -128, -128, -128, -128, -9, -9, 10},
+    {-9, -128, -128, -128, -128, -128, -9, 0, 10},
+    {-128, -128, -128, -128, -128, -128, -9, 0, 10},
+    {-128, -9, -128, -128, -128, -128, 0, -9, -9},
+    {-9, -128, -128, -128, -128, -128, 0, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 0, -9, -9},
+    {-5, -5, 0, 0, 0, -128, -5, -5, 0},
+    {-128, -5, 6, 0, 6, -128, 6, 0, 0},
+    {-5, -128, 6, 0, 6, -128, 0, -5, 0},
+    {-128, -128, -7, -7, 0, -128, -7, -7, -7},
+    {-128, -128, -7, -5, 0, -128, 6, 0, -7},
+    {6, 6, -128, 0, 6, -128, 0, 0, 0},
+    {-128, -7, -128, 0, 0, -128, -7, -7, -7},
+    {-128, -128, -128, 0, 8, -128, -7, -7, -7},
+    {-7, -128, -128, 0, 0, -128, -7, 0, -7},
+    {-128, -128, -128, 0, 8, -128, 8, 0, -7},
+    {-128, -9, -128, -9, -9, -128, -9, -9, -7},
+    {-9, -128, -128, -9, -9, -128, -9, -9, -7},
+    {-128, -128, -128, -9, -9, -128, -9, -9, -7},
+    {0, 0, 0, -128, 0, -128, 0, 0, 0},
+    {-128, -7, 0, -128, -7, -128, -7, -7, 0},
+    {-128, -128, 0, -128, 0, -128, -7, 0, 0},
+    {-5, -128, 0, -128, -7, -128, -5, -7, 0},
+    {-128, -128, 0, -128, 8, -128, 10, 0, 8},
+    {-128, 0, -128, -128, 0, -128, 0, 0, 0},
+    {0, -128, -128, -128, 0, -128, 8, 0, 0},
+    {-128, -128, -128, -128, 0, -128, -7, 0, 0},
+    {-9, -9, -128, -128, -9, -128, -9, -9, 0},
+    {-128, -9, -128, -128, -9, -128, 10, -9, 8},
+    {-9, -128, -128, -128, -9, -128, -9, -9, 6},
+    {-128, -128, -128, -128, -9, -128, -9, -9, 0},
+    {-128, -128, -128, -128, -9, -128, 10, -9, 8},
+    {-128, -9, -9, -128, 6, -128, -9, -9, -9},
+    {-9, -128, -9, -128, 6, -128, -9, -9, -9},
+    {-128, -128, 10, -128, 8, -128, -9, -9, -9},
+    {-9, -9, -128, -128, 6, -128, -9, -9, -9},
+    {-128, 10, -128, -128, 8, -128, -9, -9, -9},
+    {10, -128, -128, -128, 8, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -9, -128, -9, -9, -9},
+    {-128, -128, -128, -128, 8, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -9, -128, -9, -9, -9},
+    {6, 6, 6, 0, -128, -128, 6, 6, 6},
+    {-128, 0, 0, -7, -128, -128, -7, 0, 0},
+    {-128, -128, 8, 0, -128, -128, 8, 10, 0},
+    {0, -128, 0, -7, -128, -128, -7, -7, 0},
+    {-128, -128, 8, 8, -128, -128, 8, 0, 10},
+    {-128, 8, -128, 0, -128, -128, 10, 8, 0},
+    {8, -128, -128, 0, -128, -128, 10, 0, 8},
+    {-128, -128, -128, 0, -128, -128, 10, 0, 0},
+    {-9, -9, -128, -9, -128, -128, -9, -9, 0},
+    {-128, -9, -128, -9, -128, -128, -9, -9, 10},
+    {-9, -128, -128, -9, -128, -128, -9, 10, 8},
+    {-128, -128, -128, -9, -128, -128, -9, 10, 0},
+    {-128, -128, -128, -9, -128, -128, -9, -9, 10},
+    {-128, 0, 0, -128, -128, -128, -7, 0, 0},
+    {8, -128, 0, -128, -128, -128, 8, -7, 0},
+    {-128, -128, 0, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 10, 0, 0},
+    {-9, -9, -128, -128, -128, -128, -9, -9, 0},
+    {-128, -9, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, -9, 10, 0},
+    {-9, -128, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 10, -9, 10},
+    {6, 6, 6, -128, -128, -128, 6, 6, 6},
+    {-128, 8, 8, -128, -128, -128, 8, 8, 10},
+    {8, -128, 8, -128, -128, -128, 8, 10, 8},
+    {-128, -128, -9, -128, -128, -128, 8, 10, -9},
+    {-128, -128, 8, -128, -128, -128, 8, 0, 10},
+    {8, 8, -128, -128, -128, -128, 10, 8, 8},
+    {-128, -9, -128, -128, -128, -128, 10, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 10, 10, -9},
+    {8, -128, -128, -128, -128, -128, 10, 0, 8},
+    {-128, -128, -128, -128, -128, -128, 10, 8, 10},
+    {-128, -9, -128, -128, -128, -128, -9, -9, 10},
+    {-9, -128, -128, -128, -128, -128, -9, 10, 8},
+    {-128, -128, -128, -128, -128, -128, -9, 10, 10},
+    {-128, -9, -9, 0, -128, -128, -9, -9, -9},
+    {-9, -128, -9, -7, -128, -128, -9, -9, -9},
+    {-128, -128, 10, 8, -128, -128, -9, -9, -9},
+    {-9, -9, -128, 0, -128, -128, -9, -9, -9},
+    {-128, 10, -128, 8, -128, -128, -9, -9, -9},
+    {10, -128, -128, 0, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -9},
+    {0, -7, 0, -128, -128, -128, 0, -7, 0},
+    {-128, 8, 8, -128, -128, -128, 10, 0, 0},
+    {8, -128, 0, -128, -128, -128, 0, -7, 0},
+    {-128, -128, -9, -128, -128, -128, -9, -9, 0},
+    {-128, -128, -9, -128, -128, -128, 10, 0, -9},
+    {8, 0, -128, -128, -128, -128, 0, 0, 0},
+    {-128, -9, -128, -128, -128, -128, -9, -9, 0},
+    {-128, -128, -128, -128, -128, -128, -9, -9, 0},
+    {-9, -128, -128, -128, -128, -128, -9, 0, -9},
+    {-128, -128, -128, -128, -128, -128, 10, 0, -9},
+    {-128, -9, -128, -128, -128, -128, 10, -9, -9},
+    {-9, -128, -128, -128, -128, -128, -9, -9, -9},
+    {-128, -128, -128, -128, -128, -128, 10, -9, -9},
+    {-128, 0, 6, -5, 0, 0, -128, 6, 6},
+    {6, -128, 0, -5, 6, 0, -128, 0, 6},
+    {-128, -128, -7, -9, -9, -9, -128, -9, -9},
+    {-128, -128, -128, -7, 10, 8, -128, 8, 8},
+    {6, 0, -128, -5, 0, 0, -128, -5, 6},
+    {-128, -7, -128, -9, -9, -9, -128, -9, -9},
+    {-128, -128, -128, -7, 0, 0, -128, 8, 0},
+    {6, -128, -128, -9, -9, -9, -128, -9, -9},
+    {-128, -128, -128, 10, 8, 6, -128, 8, 8},
+    {-128, -128, -7, -128, -9, -9, -128, -9, -9},
+    {-128, -7, -128, -128, -9, -9, -128, -9, -9},
+    {10, -128, -128, -128, -9, -9, -128, -9, -9},
+    {0, 0, 0, -128, 6, 0, -128, 6, 6},
+    {-128, -7, -7, -128, 0, 0, -128, 6, 6},
+    {-128, -128, -7, -128, 8, 6, -128, 8, 6},
+    {-7, -128, -7, -128, 0, 0, -128, -5, 6},
+    {-128, -128, -7, -128, 8, 0, -128, 0, 8},
+    {-128, -7, -128, -128, 10, 8, -128, 8, 8},
+    {-7, -128, -128, -128, 10, 8, -128, 8, 8},
+    {-128, -128, -128, -128, 10, 8, -128, 8, 8},
+    {-7, -7, -128, -128, 0, 0, -128, -5, 0},
+    {-128, -7, -128, -128, 0, 0, -128, 0, 8},
+    {-7, -128, -128, -128, 0, 0, -128, 8, 0},
+    {-128, -128, -128, -128, 0, 0, -128, 8, 0},
+    {-128, -128, -128, -128, 0, 0, -128, 0, 8},
+    {-128, -128, 10, -9, -128, -9, -128, -9, -9},
+    {-128, 0, -128, -9, -128, -9, -128, -9, -9},
+    {8, -128, -128, -9, -128, -9, -128, -9, -9},
+    {-128, 8, 10, -128, -128, 0, -128, 8, 8},
+    {8, -128, 10, -128, -128, 0, -128, 8, 8},
+    {-128, -128, 10, -128, -128, -9, -128, -9, -9},
+    {0, 0, -128, -128, -128, 0, -128, 8, 8},
+    {-128, 0, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 0, -128, 10, 0},
+    {0, -128, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 0, -128, 0, 10},
+    {0, 0, 0, 0, -128, 0, -128, 0, 0},
+    {-128, -9, -9, -9, -128, -9, -128, -9, 0},
+    {-128, -128, -9, -9, -128, -9, -128, -9, 0},
+    {-9, -128, -9, -9, -128, -9, -128, 0, -9},
+    {-128, -128, -9, 10, -128, -9, -128, 8, -9},
+    {-128, -9, -128, -9, -128, -9, -128, -9, 8},
+    {-9, -128, -128, -9, -128, -9, -128, 0, -9},
+    {-128, -128, -128, -9, -128, -9, -128, -9, -9},
+    {0, -7, -128, -7, -128, -7, -128, -7, 0},
+    {-128, 0, -128, 10, -128, 0, -128, 8, 8},
+    {0, -128, -128, 0, -128, 0, -128, -7, 0},
+    {-128, -128, -128, -9, -128, -9, -128, -9, 0},
+    {-128, -128, -128, 10, -128, -9, -128, 8, -9},
+    {-128, -9, -9, -128, -128, -9, -128, -9, 0},
+    {10, -128, -9, -128, -128, -9, -128, 8, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -128, -9, -9},
+    {10, 0, -128, -128, -128, -7, -128, 8, 8},
+    {-128, -9, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -128, -9, 0},
+    {10, -128, -128, -128, -128, -9, -128, -9, -9},
+    {-9, -9, -9, -128, -128, 0, -128, -9, -9},
+    {-128, -9, -9, -128, -128, 0, -128, -9, -9},
+    {-9, -128, -9, -128, -128, 0, -128, -9, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -9, -9},
+    {-9, -9, -128, -128, -128, 0, -128, -9, -9},
+    {-128, -9, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -128, -9, -9},
+    {-9, -128, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -9, -128, -128, -128, 0, -128, -9, -9},
+    {-9, -128, -128, -128, -128, 0, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 0, -128, -9, -9},
+    {-128, -128, 8, -9, -9, -128, -128, -9, -9},
+    {-128, 0, -128, -9, -9, -128, -128, -9, -9},
+    {6, -128, -128, -9, -9, -128, -128, -9, -9},
+    {-128, 6, 8, -128, 0, -128, -128, 6, 8},
+    {0, -128, 8, -128, 0, -128, -128, 0, 8},
+    {-128, -128, 8, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, 8, 10},
+    {0, 0, -128, -128, 0, -128, -128, 0, 0},
+    {-128, 0, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 0, -128, -128, 8, 0},
+    {0, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 0, -128, -128, 0, 8},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -9},
+    {-128, 0, -128, -128, -128, -128, -128, -9, -9},
+    {0, -128, -128, -128, -128, -128, -128, -9, -9},
+    {-128, -9, -9, -9, -128, -128, -128, -9, 8},
+    {-9, -128, -9, -9, -128, -128, -128, 0, -9},
+    {-128, -128, -9, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -128, -9, 10},
+    {0, 0, -128, -7, -128, -128, -128, 0, 0},
+    {-128, -9, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -128, -9, 0},
+    {-9, -128, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, 8, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -9, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -9, -9},
+    {10, -128, -128, -128, -128, -128, -128, -9, -9},
+    {0, 0, 0, -128, -128, -128, -128, 0, 8},
+    {-128, -9, -9, -128, -128, -128, -128, -9, 8},
+    {-128, -128, -9, -128, -128, -128, -128, -9, 8},
+    {-9, -128, -9, -128, -128, -128, -128, 0, -9},
+    {-128, -128, -9, -128, -128, -128, -128, 0, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -9, 10},
+    {-9, -128, -128, -128, -128, -128, -128, 0, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 10},
+    {0, 0, -128, -128, -128, -128, -128, 0, 0},
+    {-128, 0, -128, -128, -128, -128, -128, 0, 0},
+    {0, -128, -128, -128, -128, -128, -128, 0, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 0},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -9},
+    {6, 0, 0, 0, 6, -128, -128, -5, 6},
+    {-128, -7, -7, -7, -7, -128, -128, -7, 0},
+    {-128, -128, -7, -7, 8, -128, -128, 8, 0},
+    {6, -128, -7, -5, -7, -128, -128, -5, 6},
+    {-128, -128, 8, 10, 8, -128, -128, 8, 8},
+    {-128, -7, -128, 0, 10, -128, -128, 8, 8},
+    {8, -128, -128, 8, 10, -128, -128, 8, 8},
+    {-128, -128, -128, -7, 10, -128, -128, 8, 8},
+    {-9, -9, -128, -9, -9, -128, -128, -9, 6},
+    {-128, -9, -128, 10, -9, -128, -128, -9, 8},
+    {-9, -128, -128, -9, -9, -128, -128, -9, 6},
+    {-128, -128, -128, -9, -9, -128, -128, -9, 0},
+    {-128, -128, -128, 10, -9, -128, -128, -9, 8},
+    {-128, -7, 0, -128, -7, -128, -128, -7, 0},
+    {10, -128, 8, -128, 8, -128, -128, 8, 8},
+    {-128, -128, -7, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, 8, 8},
+    {10, -9, -128, -128, -9, -128, -128, -9, 8},
+    {-128, -9, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, -9, -128, -128, -9, 0},
+    {10, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-9, -9, -9, -128, 6, -128, -128, -9, -9},
+    {-128, -9, -9, -128, 8, -128, -128, -9, -9},
+    {-9, -128, -9, -128, 8, -128, -128, -9, -9},
+    {-128, -128, -9, -128, 8, -128, -128, -9, -9},
+    {-128, -128, -9, -128, 8, -128, -128, -9, -9},
+    {-9, -9, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -9},
+    {-9, -128, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -9, -128, -128, -9, -128, -128, -9, -9},
+    {-9, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-128, 8, 10, -7, -128, -128, -128, 8, 8},
+    {8, -128, 10, 8, -128, -128, -128, 8, 8},
+    {-128, -128, 10, -9, -128, -128, -128, -9, -9},
+    {-9, -9, -128, -9, -128, -128, -128, -9, 8},
+    {-128, -9, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -128, 10, 0},
+    {-9, -128, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, -9, 10},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -9, -9},
+    {10, -128, -128, -128, -128, -128, -128, -9, -9},
+    {8, 8, 10, -128, -128, -128, -128, 8, 8},
+    {-128, 8, 10, -128, -128, -128, -128, 8, 8},
+    {-128, -128, 10, -128, -128, -128, -128, 10, 8},
+    {8, -128, 10, -128, -128, -128, -128, 8, 8},
+    {-128, -128, 10, -128, -128, -128, -128, 8, 10},
+    {-9, -9, -128, -128, -128, -128, -128, -9, 8},
+    {-128, -9, -128, -128, -128, -128, -128, -9, 10},
+    {-9, -128, -128, -128, -128, -128, -128, 10, 8},
+    {-128, -128, -128, -128, -128, -128, -128, 10, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 10},
+    {-9, -9, -9, 0, -128, -128, -128, -9, -9},
+    {-128, -9, -9, 10, -128, -128, -128, -9, -9},
+    {-9, -128, -9, 0, -128, -128, -128, -9, -9},
+    {-128, -128, -9, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -9, 10, -128, -128, -128, -9, -9},
+    {-9, -9, -128, 0, -128, -128, -128, -9, -9},
+    {-128, -9, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, -9, -128, -128, -128, -9, -9},
+    {-9, -128, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, -9, -9},
+    {-128, -9, -128, 10, -128, -128, -128, -9, -9},
+    {-9, -128, -128, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, -9, -9},
+    {10, 0, 0, -128, -128, -128, -128, 8, 8},
+    {-128, -9, -9, -128, -128, -128, -128, -9, 0},
+    {-128, -128, -9, -128, -128, -128, -128, -9, 0},
+    {10, -128, -9, -128, -128, -128, -128, 8, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -9, 0},
+    {10, -128, -128, -128, -128, -128, -128, 8, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -9, -9},
+    {10, -9, -128, -128, -128, -128, -128, -9, 8},
+    {10, -128, -128, -128, -128, -128, -128, -9, 8},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 0},
+    {-5, -5, -5, -5, 0, -5, -128, -5, -5},
+    {-128, 6, 6, -5, 0, 0, -128, 0, 6},
+    {6, -128, -5, -5, 0, -5, -128, -5, 0},
+    {-128, -128, -9, -7, -9, -9, -128, -9, -9},
+    {-128, -128, -7, -7, 0, -7, -128, 0, -7},
+    {6, -5, -128, 0, 0, -5, -128, 0, 6},
+    {-128, -9, -128, -7, -9, -9, -128, -9, -9},
+    {-128, -128, -128, -7, -9, -9, -128, -9, -9},
+    {-7, -128, -128, -7, 0, -5, -128, 0, 0},
+    {-128, -128, -128, -7, 0, 0, -128, 0, 8},
+    {-128, -9, -128, -9, -7, -9, -128, -9, -9},
+    {-9, -128, -128, -9, 0, -9, -128, -9, -9},
+    {-128, -128, -128, -9, 8, -9, -128, -9, -9},
+    {-5, -5, 0, -128, 0, -5, -128, 0, 0},
+    {-128, -7, -7, -128, 0, -7, -128, -7, -7},
+    {-128, -128, -7, -128, 8, -7, -128, -7, 0},
+    {-7, -128, -7, -128, 0, -7, -128, -7, -7},
+    {-128, -128, -7, -128, 8, -7, -128, 0, -7},
+    {-128, -7, -128, -128, 0, 8, -128, 0, 0},
+    {-7, -128, -128, -128, 0, 8, -128, 0, 0},
+    {-128, -128, -128, -128, 0, 8, -128, 0, 0},
+    {-9, -9, -128, -128, 0, -9, -128, -9, -9},
+    {-128, -9, -128, -128, 8, -9, -128, -9, -9},
+    {-9, -128, -128, -128, 8, -9, -128, -9, -9},
+    {-128, -128, -128, -128, 8, -9, -128, -9, -9},
+    {-128, -128, -128, -128, 8, -9, -128, -9, -9},
+    {-128, 6, 6, -128, 0, 0, -128, -7, -7},
+    {6, -128, -9, -128, -9, -9, -128, -9, -9},
+    {-128, -128, 10, -128, 8, 6, -128, 8, 8},
+    {6, -9, -128, -128, -9, -9, -128, -9, -9},
+    {-128, 10, -128, -128, 8, 8, -128, 6, 8},
+    {10, -128, -128, -128, -9, -9, -128, -9, -9},
+    {-128, -128, -128, -128, 0, 0, -128, 0, 8},
+    {-128, -128, -128, -128, 8, -9, -128, -9, -9},
+    {0, 0, 0, 0, -128, 0, -128, 0, 0},
+    {-128, -9, -9, 0, -128, -9, -128, -9, -9},
+    {-128, -128, -9, 8, -128, -9, -128, 10, -9},
+    {0, -128, 0, 0, -128, 0, -128, -7, -7},
+    {-128, -128, 0, 8, -128, 8, -128, 0, 10},
+    {-128, -9, -128, 0, -128, -9, -128, -9, -9},
+    {0, -128, -128, 0, -128, 8, -128, 0, 8},
+    {-128, -128, -128, 0, -128, -9, -128, -9, -9},
+    {-7, 0, -128, 0, -128, 0, -128, 0, -7},
+    {-128, 8, -128, 8, -128, 8, -128, 8, 10},
+    {8, -128, -128, 8, -128, 8, -128, 10, 8},
+    {-128, -128, -128, 8, -128, -9, -128, 10, -9},
+    {-128, -128, -128, 8, -128, 8, -128, 0, 10},
+    {-128, 8, 0, -128, -128, 10, -128, 8, 0},
+    {8, -128, 0, -128, -128, 10, -128, 0, 8},
+    {-128, -128, 0, -128, -128, 10, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 10, -128, 0, 0},
+    {8, 8, -128, -128, -128, 10, -128, 8, 8},
+    {-128, 8, -128, -128, -128, 10, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 10, -128, 10, 8},
+    {8, -128, -128, -128, -128, 10, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 10, -128, 8, 10},
+    {0, -9, -9, -128, -128, -9, -128, -9, -9},
+    {-128, 8, 8, -128, -128, 0, -128, 8, 10},
+    {8, -128, -9, -128, -128, -9, -128, 10, -9},
+    {-128, -128, 0, -128, -128, 0, -128, 0, 10},
+    {8, -9, -128, -128, -128, -9, -128, -9, -9},
+    {0, -128, -128, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -128, -128, 0, -128, 0, 10},
+    {-128, 8, -128, -128, -128, 0, -128, 8, 10},
+    {8, -128, -128, -128, -128, -9, -128, 10, -9},
+    {-128, -128, -128, -128, -128, 8, -128, 10, 10},
+    {-128, -9, 0, -9, -128, -9, -128, -9, -9},
+    {-9, -128, -7, -9, -128, -9, -128, -9, -9},
+    {-128, -128, 10, -9, -128, -9, -128, -9, -9},
+    {0, -7, -128, -7, -128, -7, -128, -7, 0},
+    {-128, 10, -128, 0, -128, 8, -128, 0, 8},
+    {10, -128, -128, 0, -128, 8, -128, -7, 8},
+    {-128, -128, -128, -9, -128, -9, -128, -9, -9},
+    {-128, -128, -128, -9, -128, -9, -128, 0, -9},
+    {-9, -9, -7, -128, -128, -9, -128, -9, -9},
+    {-128, -9, 0, -128, -128, -9, -128, -9, -9},
+    {-9, -128, 0, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -9, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -9, -9},
+    {0, 0, -128, -128, -128, -7, -128, 0, 0},
+    {-128, -9, -128, -128, -128, -9, -128, -9, 0},
+    {-128, -128, -128, -128, -128, -9, -128, -9, 0},
+    {-9, -128, -128, -128, -128, -9, -128, 0, -9},
+    {-128, -128, -128, -128, -128, -9, -128, 0, -9},
+    {-128, -128, 10, -128, -128, -9, -128, -9, -9},
+    {-128, 10, -128, -128, -128, 8, -128, -9, -9},
+    {10, -128, -128, -128, -128, -9, -128, -9, -9},
+    {0, -5, -5, -5, 0, -128, -128, -5, 6},
+    {-128, -9, -9, -7, -9, -128, -128, -9, -9},
+    {-128, -128, -9, -7, -9, -128, -128, -9, -9},
+    {-7, -128, -5, -7, 0, -128, -128, -7, -7},
+    {-128, -128, 0, -7, 8, -128, -128, 0, 8},
+    {-128, -9, -128, 8, -9, -128, -128, -9, 10},
+    {0, -128, -128, 8, 8, -128, -128, 0, 10},
+    {-128, -128, -128, 8, -9, -128, -128, -9, 10},
+    {-9, -9, -128, -9, 0, -128, -128, -9, -9},
+    {-128, -9, -128, -9, 8, -128, -128, -9, -9},
+    {-9, -128, -128, -9, 8, -128, -128, -9, -9},
+    {-128, -128, -128, -9, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -9, 8, -128, -128, -9, -9},
+    {-128, -7, 8, -128, 10, -128, -128, -7, 8},
+    {-7, -128, 8, -128, 10, -128, -128, 0, 8},
+    {-128, -128, 8, -128, 10, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, 8, 10},
+    {-9, -9, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -9},
+    {-9, -128, -128, -128, 10, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -9},
+    {0, -9, -9, -128, -9, -128, -128, -9, -9},
+    {-128, 6, 8, -128, 0, -128, -128, 6, 8},
+    {6, -128, -9, -128, -9, -128, -128, -9, -9},
+    {-128, -128, 0, -128, 0, -128, -128, 0, 8},
+    {8, -9, -128, -128, -9, -128, -128, -9, 10},
+    {0, -128, -128, -128, -9, -128, -128, -9, 10},
+    {-128, -128, -128, -128, 0, -128, -128, 0, 10},
+    {-128, -9, -128, -128, 0, -128, -128, -9, -9},
+    {-9, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, 8, -128, -128, -9, -9},
+    {-128, -9, -9, 10, -128, -128, -128, -9, -9},
+    {8, -128, 8, 10, -128, -128, -128, 0, 8},
+    {-128, -128, -9, 10, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, -9, 10},
+    {8, 8, -128, 10, -128, -128, -128, 8, 8},
+    {-128, -9, -128, 10, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, 10, -9},
+    {8, -128, -128, 10, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 10, -128, -128, -128, 8, 10},
+    {0, -9, -9, -128, -128, -128, -128, -9, -9},
+    {0, -128, -9, -128, -128, -128, -128, -9, -9},
+    {-128, -128, 0, -128, -128, -128, -128, 0, 10},
+    {0, -128, -128, -128, -128, -128, -128, -9, 10},
+    {0, -9, -128, -128, -128, -128, -128, -9, -9},
+    {-128, 8, -128, -128, -128, -128, -128, 8, 10},
+    {8, -128, -128, -128, -128, -128, -128, 10, -9},
+    {-128, -128, -128, -128, -128, -128, -128, 0, 10},
+    {-9, -9, -7, -9, -128, -128, -128, -9, -9},
+    {-128, -9, 8, -9, -128, -128, -128, -9, -9},
+    {-9, -128, 8, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -9, -9, -128, -128, -128, -9, -9},
+    {-128, -128, -9, -9, -128, -128, -128, -9, -9},
+    {8, 8, -128, -7, -128, -128, -128, 0, 10},
+    {-128, -9, -128, -9, -128, -128, -128, -9, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -9, 10},
+    {-9, -128, -128, -9, -128, -128, -128, 0, 10},
+    {-128, -128, -128, -9, -128, -128, -128, 0, 10},
+    {-9, -9, -7, -128, -128, -128, -128, -9, -9},
+    {-128, -9, -9, -128, -128, -128, -128, -9, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -9, -9},
+    {-9, -128, -9, -128, -128, -128, -128, -9, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -9, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -9, 10},
+    {-9, -128, -128, -128, -128, -128, -128, 0, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 10},
+    {-128, -9, 8, -128, -128, -128, -128, -9, -9},
+    {-9, -128, -9, -128, -128, -128, -128, -9, -9},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -9},
+    {8, -9, -128, -128, -128, -128, -128, -9, 10},
+    {-128, 10, -128, -128, -128, -128, -128, 8, 10},
+    {10, -128, -128, -128, -128, -128, -128, -9, 10},
+    {-128, -128, -128, -128, -128, -128, -128, 0, 10},
+    {-128, -7, 0, -7, -7, -128, -128, -7, -7},
+    {-7, -128, -5, -7, 0, -128, -128, -7, -7},
+    {-128, -128, 10, -7, 8, -128, -128, 8, 8},
+    {0, -5, -128, 0, 0, -128, -128, -7, -7},
+    {-128, 10, -128, 0, 8, -128, -128, 0, 8},
+    {10, -128, -128, 0, 8, -128, -128, 8, 0},
+    {-128, -128, -128, -7, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -7, 0, -128, -128, 0, -7},
+    {-128, -128, -128, -9, -9, -128, -128, -9, -9},
+    {-7, -7, 0, -128, -7, -128, -128, -7, 0},
+    {-128, -7, 0, -128, -7, -128, -128, -7, 0},
+    {-7, -128, 0, -128, 0, -128, -128, 0, 0},
+    {-128, -128, -7, -128, 0, -128, -128, -7, 0},
+    {-128, -128, -7, -128, -7, -128, -128, -7, -7},
+    {0, 0, -128, -128, 0, -128, -128, 0, 0},
+    {-128, -7, -128, -128, 0, -128, -128, 0, 0},
+    {-128, -128, -128, -128, 0, -128, -128, 0, 0},
+    {-7, -128, -128, -128, 0, -128, -128, 0, 0},
+    {-128, -128, -128, -128, 0, -128, -128, 0, 0},
+    {-128, -9, -128, -128, -9, -128, -128, -9, -9},
+    {-9, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-128, -128, 10, -128, 8, -128, -128, -9, -9},
+    {-128, 10, -128, -128, 8, -128, -128, -9, -9},
+    {10, -128, -128, -128, -9, -128, -128, -9, -9},
+    {-7, 0, 0, -7, -128, -128, -128, 0, 0},
+    {-128, 8, 8, -7, -128, -128, -128, 8, 10},
+    {8, -128, 8, 0, -128, -128, -128, 10, 8},
+    {-128, -128, -9, 0, -128, -128, -128, 10, -9},
+    {-128, -128, 0, -7, -128, -128, -128, 0, 10},
+    {8, 8, -128, 0, -128, -128, -128, 0, 0},
+    {-128, -9, -128, 0, -128, -128, -128, -9, -9},
+    {-128, -128, -128, 0, -128, -128, -128, 10, -9},
+    {0, -128, -128, 0, -128, -128, -128, 0, 0},
+    {-128, -128, -128, 0, -128, -128, -128, 0, 10},
+    {-128, -9, -128, -9, -128, -128, -128, -9, 10},
+    {-9, -128, -128, -9, -128, -128, -128, 10, 8},
+    {-128, -128, -128, -9, -128, -128, -128, 10, 10},
+    {-7, 0, 0, -128, -128, -128, -128, 0, 0},
+    {-128, 0, 0, -128, -128, -128, -128, 0, 0},
+    {-128, -128, 0, -128, -128, -128, -128, 10, 0},
+    {-7, -128, 0, -128, -128, -128, -128, -7, 0},
+    {-128, -128, 0, -128, -128, -128, -128, 0, 10},
+    {-128, 0, -128, -128, -128, -128, -128, 0, 0},
+    {0, -128, -128, -128, -128, -128, -128, 0, 0},
+    {-128, -128, -128, -128, -128, -128, -128, 0, 0},
+    {-9, -9, -128, -128, -128, -128, -128, -9, 0},
+    {-128, -9, -128, -128, -128, -128, -128, -9, 10},
+    {-9, -128, -128, -128, -128, -128, -128, 10, 8},
+    {-128, -128, -128, -128, -128, -128, -128, 10, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 10},
+    {-128, 8, 8, -128, -128, -128, -128, 8, 10},
+    {8, -128, -9, -128, -128, -128, -128, 10, -9},
+    {-128, -128, 10, -128, -128, -128, -128, 10, 10},
+    {8, -9, -128, -128, -128, -128, -128, -9, -9},
+    {-128, 10, -128, -128, -128, -128, -128, 8, 10},
+    {10, -128, -128, -128, -128, -128, -128, 10, -9},
+    {-128, -128, -128, -128, -128, -128, -128, 0, 10},
+    {-128, -128, -128, -128, -128, -128, -128, 10, 10},
+    {-128, -128, 10, -9, -128, -128, -128, -9, -9},
+    {-128, 10, -128, 0, -128, -128, -128, -9, -9},
+    {10, -128, -128, 0, -128, -128, -128, -9, -9},
+    {-128, -9, 0, -128, -128, -128, -128, -9, -9},
+    {-9, -128, 0, -128, -128, -128, -128, -9, -9},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -9},
+    {0, 0, -128, -128, -128, -128, -128, 0, 0},
+    {-128, 10, -128, -128, -128, -128, -128, 0, 0},
+    {10, -128, -128, -128, -128, -128, -128, 0, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -9, 0},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -9},
+    {-128, -5, 0, -5, 0, -5, 6, -128, -5},
+    {0, -128, 0, 0, 0, 0, 0, -128, 0},
+    {-128, -128, 0, -9, -9, -9, -9, -128, -9},
+    {-128, -128, -128, 6, 0, 6, 8, -128, 8},
+    {0, -5, -128, -5, 0, -5, -5, -128, 6},
+    {-128, -7, -128, -9, -9, -9, -9, -128, -9},
+    {-128, -128, -128, -7, 10, -7, 8, -128, 8},
+    {0, -128, -128, -9, -9, -9, -9, -128, -9},
+    {-128, -128, -128, 6, 0, 6, 8, -128, 8},
+    {-128, -128, 6, -128, -9, -9, -9, -128, -9},
+    {-128, -7, -128, -128, -9, -9, -9, -128, -9},
+    {6, -128, -128, -128, -9, -9, -9, -128, -9},
+    {0, -5, 0, -128, 6, 0, 6, -128, -5},
+    {-128, -9, -9, -128, -9, -9, 6, -128, -9},
+    {-128, -128, -9, -128, 10, -9, 8, -128, -9},
+    {0, -128, 0, -128, -7, -7, -5, -128, -5},
+    {-128, -128, 0, -128, 0, 0, 0, -128, 8},
+    {-128, -9, -128, -128, -9, -9, 8, -128, -9},
+    {0, -128, -128, -128, 0, 0, 8, -128, 8},
+    {-128, -128, -128, -128, -9, -9, 8, -128, -9},
+    {-7, -7, -128, -128, 0, -7, -5, -128, -7},
+    {-128, -7, -128, -128, 8, 0, 0, -128, 8},
+    {-7, -128, -128, -128, 10, 0, 8, -128, 8},
+    {-128, -128, -128, -128, 10, -9, 8, -128, -9},
+    {-128, -128, -128, -128, 0, 0, 0, -128, 8},
+    {-128, -128, 0, -9, -128, -9, -9, -128, -9},
+    {-128, 10, -128, -9, -128, -9, -9, -128, -9},
+    {0, -128, -128, -9, -128, -9, -9, -128, -9},
+    {-128, 10, -9, -128, -128, -9, 8, -128, -9},
+    {0, -128, 0, -128, -128, -7, 8, -128, 8},
+    {-128, -128, -9, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -9},
+    {8, 10, -128, -128, -128, 0, 8, -128, 8},
+    {-128, 10, -128, -128, -128, -9, -9, -128, -9},
+    {0, -128, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, 0, 0, -128, 10},
+    {0, -5, 0, 0, -128, 0, 0, -128, 0},
+    {-128, -9, -9, -9, -128, -9, -9, -128, -7},
+    {-128, -128, -9, -9, -128, -9, -9, -128, -7},
+    {0, -128, 0, -7, -128, -7, 0, -128, 0},
+    {-128, -128, 0, 0, -128, 0, 8, -128, 0},
+    {-128, -9, -128, -9, -128, -9, -9, -128, 8},
+    {0, -128, -128, 0, -128, 0, 0, -128, 8},
+    {-128, -128, -128, -9, -128, -9, -9, -128, 8},
+    {-9, -9, -128, -9, -128, -9, -7, -128, -9},
+    {-128, -9, -128, -9, -128, -9, 8, -128, -9},
+    {-9, -128, -128, -9, -128, -9, -7, -128, -9},
+    {-128, -128, -128, -9, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -9, 8, -128, -9},
+    {-128, -9, -9, -128, -128, -9, -9, -128, 0},
+    {0, -128, 0, -128, -128, -7, 8, -128, 0},
+    {-128, -128, -9, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -128, 8},
+    {-9, -9, -128, -128, -128, -9, 8, -128, -9},
+    {-128, -9, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -128, -9},
+    {-9, -128, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -9},
+    {-9, -9, -9, -128, -128, -7, -9, -128, -9},
+    {-128, -9, -9, -128, -128, 0, -9, -128, -9},
+    {-9, -128, -9, -128, -128, -7, -9, -128, -9},
+    {-128, -128, -9, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -9, -128, -128, 0, -9, -128, -9},
+    {-9, -9, -128, -128, -128, 0, -9, -128, -9},
+    {-128, -9, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -128, -9},
+    {-9, -128, -128, -128, -128, 0, -9, -128, -9},
+    {-128, -128, -128, -128, -128, 0, -9, -128, -9},
+    {-128, -9, -128, -128, -128, -9, -9, -128, -9},
+    {-9, -128, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, 6, -9, -9, -128, -9, -128, -9},
+    {-128, -7, -128, -9, -9, -128, -9, -128, -9},
+    {6, -128, -128, -9, -9, -128, -9, -128, -9},
+    {-128, -9, -9, -128, -9, -128, 6, -128, -9},
+    {0, -128, 0, -128, -7, -128, 0, -128, 8},
+    {-128, -128, -9, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, -9, -128, 8, -128, 10},
+    {0, 0, -128, -128, 0, -128, 0, -128, -7},
+    {-128, -9, -128, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, 8, -128, -9},
+    {0, -128, -128, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 0, -128, 0, -128, 8},
+    {-128, -128, -9, -128, -128, -128, -9, -128, -9},
+    {-128, 10, -128, -128, -128, -128, -9, -128, -9},
+    {0, -128, -128, -128, -128, -128, -9, -128, -9},
+    {-128, -9, -9, -9, -128, -128, -9, -128, 8},
+    {0, -128, 0, -7, -128, -128, 0, -128, 8},
+    {-128, -128, -9, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -128, 10},
+    {-9, -9, -128, -9, -128, -128, 0, -128, -9},
+    {-128, -9, -128, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -128, -9},
+    {-9, -128, -128, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -128, 8, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -9, -128, -9},
+    {-128, -9, -128, -128, -128, -128, -9, -128, -9},
+    {-9, -128, -128, -128, -128, -128, -9, -128, -9},
+    {0, -7, 0, -128, -128, -128, 0, -128, 8},
+    {-128, -9, -9, -128, -128, -128, -9, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -9, -128, -9},
+    {0, -128, 0, -128, -128, -128, 0, -128, 8},
+    {-128, -128, 0, -128, -128, -128, 0, -128, 8},
+    {-128, -9, -128, -128, -128, -128, -9, -128, 10},
+    {0, -128, -128, -128, -128, -128, 0, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 10},
+    {-9, -9, -128, -128, -128, -128, 0, -128, -9},
+    {-128, -9, -128, -128, -128, -128, 0, -128, -9},
+    {-9, -128, -128, -128, -128, -128, 0, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -9},
+    {0, -5, 0, 0, 6, -128, -5, -128, 6},
+    {-128, -7, -7, -7, 0, -128, -7, -128, -5},
+    {-128, -128, -7, 0, 10, -128, 8, -128, 8},
+    {0, -128, 0, -7, -7, -128, -5, -128, -5},
+    {-128, -128, 0, 0, 0, -128, 8, -128, 8},
+    {-128, -7, -128, 0, 8, -128, 8, -128, 0},
+    {0, -128, -128, 0, 0, -128, 8, -128, 0},
+    {-128, -128, -128, 0, 0, -128, 8, -128, 0},
+    {-9, -9, -128, -9, -9, -128, -9, -128, 6},
+    {-128, -9, -128, -9, -9, -128, -9, -128, 8},
+    {-9, -128, -128, -9, 10, -128, -9, -128, 8},
+    {-128, -128, -128, -9, 10, -128, -9, -128, 8},
+    {-128, -128, -128, -9, -9, -128, -9, -128, 8},
+    {-128, 0, 0, -128, 0, -128, -7, -128, 0},
+    {0, -128, 0, -128, -7, -128, 8, -128, 0},
+    {-128, -128, 0, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 0, -128, 8, -128, 0},
+    {-9, -9, -128, -128, -9, -128, -9, -128, 6},
+    {-128, -9, -128, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -9, -128, 8},
+    {-9, -128, -128, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, -9, -128, 10, -128, 8},
+    {-9, -9, -9, -128, 6, -128, -9, -128, -9},
+    {-128, -9, -9, -128, 8, -128, -9, -128, -9},
+    {-9, -128, -9, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -9, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -9, -128, 0, -128, -9, -128, -9},
+    {-9, -9, -128, -128, 8, -128, -9, -128, -9},
+    {-128, -9, -128, -128, -9, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -9},
+    {-9, -128, -128, -128, 0, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 8, -128, -9, -128, -9},
+    {-128, -9, -128, -128, -9, -128, -9, -128, -9},
+    {-9, -128, -128, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -9},
+    {-128, 10, 8, 0, -128, -128, 8, -128, 8},
+    {0, -128, 0, -7, -128, -128, 8, -128, 8},
+    {-128, -128, 0, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, 0, -128, -128, 10, -128, 0},
+    {-9, 10, -128, -9, -128, -128, -9, -128, 8},
+    {-128, 10, -128, -9, -128, -128, -9, -128, -9},
+    {-9, -128, -128, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -128, 10},
+    {-128, -128, 0, -128, -128, -128, -9, -128, -9},
+    {-128, 10, -128, -128, -128, -128, -9, -128, -9},
+    {-9, -128, -128, -128, -128, -128, -9, -128, -9},
+    {8, 10, 8, -128, -128, -128, 8, -128, 8},
+    {-128, 10, -9, -128, -128, -128, 8, -128, -9},
+    {0, -128, 0, -128, -128, -128, 8, -128, 8},
+    {-128, -128, 8, -128, -128, -128, 8, -128, 10},
+    {-128, 10, -128, -128, -128, -128, 10, -128, -9},
+    {8, -128, -128, -128, -128, -128, 10, -128, 8},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -9},
+    {-9, 10, -128, -128, -128, -128, -9, -128, 8},
+    {-128, 10, -128, -128, -128, -128, -9, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 10},
+    {-9, -9, -9, -7, -128, -128, -9, -128, -9},
+    {-128, -9, -9, 0, -128, -128, -9, -128, -9},
+    {-9, -128, -9, -7, -128, -128, -9, -128, -9},
+    {-128, -128, -9, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -9, 0, -128, -128, -9, -128, -9},
+    {-9, -9, -128, 0, -128, -128, -9, -128, -9},
+    {-128, -9, -128, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -128, -9},
+    {-9, -128, -128, 0, -128, -128, -9, -128, -9},
+    {-128, -128, -128, 0, -128, -128, -9, -128, -9},
+    {-128, -9, -128, -9, -128, -128, -9, -128, -9},
+    {-9, -128, -128, -9, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -9, -128, -9},
+    {0, -7, 0, -128, -128, -128, 8, -128, 0},
+    {-128, -9, -9, -128, -128, -128, -9, -128, 0},
+    {-128, -128, -9, -128, -128, -128, -9, -128, 0},
+    {0, -128, 0, -128, -128, -128, 8, -128, 0},
+    {-128, -128, 0, -128, -128, -128, 10, -128, 0},
+    {-128, -9, -128, -128, -128, -128, -9, -128, 0},
+    {0, -128, -128, -128, -128, -128, 8, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 0},
+    {-9, -9, -128, -128, -128, -128, -9, -128, -9},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -9},
+    {-9, -128, -128, -128, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -9},
+    {-128, -128, 8, -9, -9, -9, -128, -128, 10},
+    {-128, 8, -128, -9, -9, -9, -128, -128, 10},
+    {8, -128, -128, -9, -9, -9, -128, -128, 10},
+    {-128, 8, 8, -128, 8, 6, -128, -128, 10},
+    {0, -128, 8, -128, 8, 0, -128, -128, 10},
+    {-128, -128, 8, -128, -9, -9, -128, -128, 10},
+    {-128, -128, -128, -128, 10, 8, -128, -128, 10},
+    {0, 8, -128, -128, 8, 0, -128, -128, 10},
+    {-128, 8, -128, -128, -9, -9, -128, -128, 10},
+    {-128, -128, -128, -128, 10, 8, -128, -128, 10},
+    {0, -128, -128, -128, -9, -9, -128, -128, 10},
+    {-128, -128, -128, -128, 0, 0, -128, -128, 10},
+    {-128, -128, 10, -128, -128, -9, -128, -128, 10},
+    {-128, 10, -128, -128, -128, -9, -128, -128, 10},
+    {0, -128, -128, -128, -128, -9, -128, -128, 10},
+    {-128, -9, -9, -9, -128, -9, -128, -128, 10},
+    {8, -128, 0, 8, -128, 0, -128, -128, 10},
+    {-128, -128, -9, -9, -128, -9, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -9, -128, -128, 10},
+    {8, -7, -128, 8, -128, 0, -128, -128, 10},
+    {-128, -9, -128, -9, -128, -9, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -9, -128, -128, 10},
+    {8, -128, -128, -9, -128, -9, -128, -128, 10},
+    {-128, -128, -128, 10, -128, 8, -128, -128, 10},
+    {-128, -128, -9, -128, -128, -9, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -9, -128, -128, 10},
+    {10, -128, -128, -128, -128, -9, -128, -128, 10},
+    {-9, -9, -9, -128, -128, 0, -128, -128, 10},
+    {-128, -9, -9, -128, -128, -9, -128, -128, 10},
+    {-128, -128, -9, -128, -128, -9, -128, -128, 10},
+    {-9, -128, -9, -128, -128, 0, -128, -128, 10},
+    {-128, -128, -9, -128, -128, 0, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -9, -128, -128, 10},
+    {-9, -128, -128, -128, -128, 0, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 10},
+    {-9, -9, -128, -128, -128, 0, -128, -128, 10},
+    {-128, -9, -128, -128, -128, 0, -128, -128, 10},
+    {-9, -128, -128, -128, -128, 0, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 10},
+    {-128, -128, -128, -128, -128, 0, -128, -128, 10},
+    {-128, -128, 8, -128, -9, -128, -128, -128, 10},
+    {-128, 8, -128, -128, -9, -128, -128, -128, 10},
+    {0, -128, -128, -128, -9, -128, -128, -128, 10},
+    {-128, -128, -9, -9, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -9, -128, -128, -128, -128, 10},
+    {8, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -9, -9, -128, -128, -128, -128, -128, 10},
+    {0, -128, 0, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {0, 0, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {0, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, 8, 8, -7, 8, -128, -128, -128, 10},
+    {8, -128, 8, 8, 8, -128, -128, -128, 10},
+    {-128, -128, 8, -9, -9, -128, -128, -128, 10},
+    {-128, -128, -128, 8, 10, -128, -128, -128, 10},
+    {-9, -9, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -9, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -128, -128, -9, 10, -128, -128, -128, 10},
+    {-9, -128, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -128, -128, 10, -9, -128, -128, -128, 10},
+    {-128, -128, 8, -128, -9, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -9, -128, -128, -128, 10},
+    {10, -128, -128, -128, -9, -128, -128, -128, 10},
+    {-9, -9, -9, -128, 8, -128, -128, -128, 10},
+    {-128, -9, -9, -128, 8, -128, -128, -128, 10},
+    {-128, -128, -9, -128, 10, -128, -128, -128, 10},
+    {-9, -128, -9, -128, 8, -128, -128, -128, 10},
+    {-128, -128, -9, -128, 8, -128, -128, -128, 10},
+    {-128, -9, -128, -128, 10, -128, -128, -128, 10},
+    {-9, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-128, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-9, -9, -128, -128, -9, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -9, -128, -128, -128, 10},
+    {-9, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-128, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -9, -128, -128, -128, 10},
+    {-128, -128, 10, -9, -128, -128, -128, -128, 10},
+    {-128, 10, -128, -9, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, 10, 10, -128, -128, -128, -128, -128, 10},
+    {8, -128, 10, -128, -128, -128, -128, -128, 10},
+    {-128, -128, 10, -128, -128, -128, -128, -128, 10},
+    {-9, 10, -128, -128, -128, -128, -128, -128, 10},
+    {-128, 10, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -9, -9, 8, -128, -128, -128, -128, 10},
+    {-128, -9, -9, -9, -128, -128, -128, -128, 10},
+    {-128, -128, -9, -9, -128, -128, -128, -128, 10},
+    {-9, -128, -9, 8, -128, -128, -128, -128, 10},
+    {-128, -128, -9, 10, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -9, -128, -128, -128, -128, 10},
+    {-9, -128, -128, 8, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-9, -9, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -9, -128, 10, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -128, -128, 10, -128, -128, -128, -128, 10},
+    {-128, -9, -9, -128, -128, -128, -128, -128, 10},
+    {10, -128, 8, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {10, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {10, -128, -128, -128, -128, -128, -128, -128, 10},
+    {0, -5, 0, 0, 0, -5, -128, -128, -5},
+    {-128, -9, -9, -7, -9, -9, -128, -128, -9},
+    {-128, -128, -9, -7, 10, -9, -128, -128, -9},
+    {0, -128, 0, -7, -7, -7, -128, -128, -7},
+    {-128, -128, 0, 0, 0, 0, -128, -128, 0},
+    {-128, -9, -128, 0, -9, -9, -128, -128, -9},
+    {0, -128, -128, 0, 0, 0, -128, -128, 0},
+    {-128, -128, -128, 0, -9, -9, -128, -128, -9},
+    {-9, -9, -128, -9, 0, -9, -128, -128, -9},
+    {-128, -9, -128, -9, 8, -9, -128, -128, -9},
+    {-9, -128, -128, -9, 10, -9, -128, -128, -9},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -9},
+    {-128, -128, -128, -9, 0, -9, -128, -128, -9},
+    {-128, -7, 0, -128, 8, -7, -128, -128, -7},
+    {0, -128, 0, -128, 0, 0, -128, -128, -7},
+    {-128, -128, 0, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 0, 8, -128, -128, 0},
+    {-9, -9, -128, -128, 8, -9, -128, -128, -9},
+    {-128, -9, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -9},
+    {-9, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 8, -9, -128, -128, -9},
+    {-7, -9, -9, -128, -9, -9, -128, -128, -9},
+    {-128, 8, 6, -128, 8, 6, -128, -128, -7},
+    {8, -128, -9, -128, 10, -9, -128, -128, -9},
+    {-128, -128, 0, -128, 0, 0, -128, -128, -7},
+    {6, -9, -128, -128, -9, -9, -128, -128, -9},
+    {0, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 0, 0, -128, -128, 8},
+    {-128, -9, -128, -128, 8, -9, -128, -128, -9},
+    {-9, -128, -128, -128, 10, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -9},
+    {-128, 10, -9, 8, -128, -9, -128, -128, -9},
+    {0, -128, 0, 0, -128, 0, -128, -128, -7},
+    {-128, -128, -9, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, 0, -128, -9, -128, -128, -9},
+    {8, 10, -128, 8, -128, 8, -128, -128, 8},
+    {-128, 10, -128, -9, -128, -9, -128, -128, -9},
+    {0, -128, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, 8, -128, 8, -128, -128, 10},
+    {-128, -128, 0, -128, -128, 10, -128, -128, -9},
+    {-128, 10, -128, -128, -128, 10, -128, -128, -9},
+    {8, -128, -128, -128, -128, 10, -128, -128, -9},
+    {8, 10, -9, -128, -128, -9, -128, -128, -9},
+    {0, -128, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -128, 0, -128, -128, 0, -128, -128, 10},
+    {0, -128, -128, -128, -128, -9, -128, -128, -9},
+    {8, 10, -128, -128, -128, -9, -128, -128, -9},
+    {-128, 10, -128, -128, -128, 8, -128, -128, 10},
+    {-128, -128, -128, -128, -128, 0, -128, -128, 10},
+    {-9, -9, -7, -9, -128, -9, -128, -128, -9},
+    {-128, -9, 0, -9, -128, -9, -128, -128, -9},
+    {-9, -128, -7, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -9, -9, -128, -9, -128, -128, -9},
+    {-128, -128, 0, -9, -128, -9, -128, -128, -9},
+    {0, -7, -128, 0, -128, 0, -128, -128, 0},
+    {-128, -9, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, -9, -128, -9, -128, -128, -9},
+    {0, -128, -128, 0, -128, 0, -128, -128, 0},
+    {-128, -128, -128, 0, -128, 0, -128, -128, 0},
+    {-9, -9, 0, -128, -128, -9, -128, -128, -9},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -128, -9},
+    {-9, -128, 0, -128, -128, -9, -128, -128, -9},
+    {-128, -128, 0, -128, -128, -9, -128, -128, -9},
+    {-128, -9, -128, -128, -128, -9, -128, -128, 0},
+    {0, -128, -128, -128, -128, 0, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 0},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -9},
+    {-9, -128, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -128, 10, -128, -128, -9, -128, -128, -9},
+    {-9, -9, -128, -128, -128, -9, -128, -128, -9},
+    {-128, 10, -128, -128, -128, 8, -128, -128, -9},
+    {10, -128, -128, -128, -128, -9, -128, -128, -9},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -9},
+    {-128, -9, -9, -7, -9, -128, -128, -128, -9},
+    {0, -128, 0, 0, 0, -128, -128, -128, -7},
+    {-128, -128, -9, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, 8, -9, -128, -128, -128, 10},
+    {-9, -9, -128, -9, 8, -128, -128, -128, -9},
+    {-128, -9, -128, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -9},
+    {-9, -128, -128, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, -9, 8, -128, -128, -128, -9},
+    {-128, -128, 8, -128, 10, -128, -128, -128, -9},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -9},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -9},
+    {6, -9, -9, -128, -9, -128, -128, -128, -9},
+    {0, -128, -9, -128, -9, -128, -128, -128, -9},
+    {-128, -128, 0, -128, 0, -128, -128, -128, 8},
+    {0, -128, -128, -128, -9, -128, -128, -128, 10},
+    {-9, -9, -128, -128, -9, -128, -128, -128, -9},
+    {-128, -9, -128, -128, 8, -128, -128, -128, -9},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -9},
+    {-128, -128, -9, 10, -128, -128, -128, -128, -9},
+    {-128, 10, -128, 10, -128, -128, -128, -128, -9},
+    {8, -128, -128, 10, -128, -128, -128, -128, -9},
+    {0, -128, -9, -128, -128, -128, -128, -128, -9},
+    {8, 10, -128, -128, -128, -128, -128, -128, -9},
+    {0, -128, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -9, 0, -9, -128, -128, -128, -128, -9},
+    {-128, -9, -9, -9, -128, -128, -128, -128, -9},
+    {-128, -128, -9, -9, -128, -128, -128, -128, -9},
+    {-9, -128, 0, -9, -128, -128, -128, -128, -9},
+    {-128, -128, 0, -9, -128, -128, -128, -128, -9},
+    {-128, -9, -128, -9, -128, -128, -128, -128, 10},
+    {0, -128, -128, 0, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -9, -9, -128, -128, -128, -128, -128, -9},
+    {-9, -128, 0, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -9, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -9, 8, -128, -128, -128, -128, -128, -9},
+    {-9, -128, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -9},
+    {8, -9, -128, -128, -128, -128, -128, -128, 10},
+    {0, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-7, -7, -7, -7, 0, -128, -128, -128, -7},
+    {-128, 8, 0, -7, 8, -128, -128, -128, -7},
+    {8, -128, 8, 0, 10, -128, -128, -128, -7},
+    {-128, -128, -9, -7, 10, -128, -128, -128, -9},
+    {-128, -128, 0, -7, 0, -128, -128, -128, -7},
+    {0, 8, -128, 0, 0, -128, -128, -128, -7},
+    {-128, -9, -128, 0, -9, -128, -128, -128, -9},
+    {-128, -128, -128, 0, 10, -128, -128, -128, -9},
+    {0, -128, -128, 0, 0, -128, -128, -128, -7},
+    {-128, -128, -128, 0, 0, -128, -128, -128, 0},
+    {-128, -9, -128, -9, -9, -128, -128, -128, -9},
+    {-9, -128, -128, -9, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -9},
+    {-7, 0, 0, -128, 0, -128, -128, -128, 0},
+    {-128, -7, 0, -128, 0, -128, -128, -128, -7},
+    {-128, -128, 0, -128, 10, -128, -128, -128, 0},
+    {-7, -128, 0, -128, -7, -128, -128, -128, -7},
+    {-128, -128, 0, -128, 0, -128, -128, -128, 0},
+    {-128, 0, -128, -128, 0, -128, -128, -128, 0},
+    {0, -128, -128, -128, 0, -128, -128, -128, 0},
+    {-128, -128, -128, -128, 0, -128, -128, -128, 0},
+    {-9, -9, -128, -128, -9, -128, -128, -128, -9},
+    {-128, -9, -128, -128, -9, -128, -128, -128, -9},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -9, -128, -128, -128, -9},
+    {-128, -9, -9, -128, 8, -128, -128, -128, -9},
+    {-9, -128, -9, -128, 10, -128, -128, -128, -9},
+    {-128, -128, 10, -128, 10, -128, -128, -128, -9},
+    {-9, -9, -128, -128, -9, -128, -128, -128, -9},
+    {-128, 10, -128, -128, 8, -128, -128, -128, -9},
+    {10, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {8, 10, 0, 0, -128, -128, -128, -128, 8},
+    {-128, 10, -9, 0, -128, -128, -128, -128, -9},
+    {0, -128, 0, -7, -128, -128, -128, -128, -7},
+    {-128, -128, 0, 0, -128, -128, -128, -128, 10},
+    {-128, 10, -128, 0, -128, -128, -128, -128, -9},
+    {0, -128, -128, 0, -128, -128, -128, -128, 0},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -9},
+    {-9, 10, -128, -9, -128, -128, -128, -128, 8},
+    {-128, 10, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, 10, 0, -128, -128, -128, -128, -128, 0},
+    {0, -128, 0, -128, -128, -128, -128, -128, 0},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-9, 10, -128, -128, -128, -128, -128, -128, 8},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -9},
+    {-9, -128, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {8, 10, -9, -128, -128, -128, -128, -128, -9},
+    {-128, 10, 8, -128, -128, -128, -128, -128, 10},
+    {-128, -128, 0, -128, -128, -128, -128, -128, 10},
+    {8, 10, -128, -128, -128, -128, -128, -128, -9},
+    {0, -128, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, 10, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -9, -9, -128, -128, -128, -128, -9},
+    {-9, -128, -9, -9, -128, -128, -128, -128, -9},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -9},
+    {-9, -9, -128, 0, -128, -128, -128, -128, -9},
+    {-128, 10, -128, 0, -128, -128, -128, -128, -9},
+    {10, -128, -128, 0, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -128, -128, -9},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -9},
+    {-9, -9, 0, -128, -128, -128, -128, -128, -9},
+    {-128, -9, 0, -128, -128, -128, -128, -128, -9},
+    {-9, -128, 0, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -9},
+    {0, 0, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {0, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-5, 0, -5, -5, 0, -5, 0, -128, 0},
+    {-128, 0, 6, -5, 6, 0, 6, -128, 0},
+    {0, -128, 0, 0, 0, 0, 0, -128, 0},
+    {-128, -128, -7, -7, -7, -7, 0, -128, 0},
+    {-128, -128, -9, -9, 6, -9, -9, -128, -9},
+    {6, 0, -128, 0, 6, -5, 0, -128, 6},
+    {-128, -7, -128, -7, -7, -7, -7, -128, 0},
+    {-128, -128, -128, -7, -7, -7, 0, -128, 0},
+    {-9, -128, -128, -9, 6, -9, -9, -128, -9},
+    {-128, -128, -128, -9, 8, -9, -9, -128, -9},
+    {-128, -7, -128, -7, -7, -7, 0, -128, -7},
+    {-7, -128, -128, -7, -7, -7, 0, -128, 0},
+    {-128, -128, -128, -7, -7, -7, 0, -128, 0},
+    {-5, 0, 0, -128, 6, -5, 6, -128, 0},
+    {-128, -7, -7, -128, 0, -7, -7, -128, -7},
+    {-128, -128, -7, -128, 0, 0, 0, -128, 0},
+    {-9, -128, -9, -128, 6, -9, -9, -128, -9},
+    {-128, -128, -9, -128, 8, -9, 10, -128, -9},
+    {-128, -7, -128, -128, 8, 8, -7, -128, 0},
+    {-9, -128, -128, -128, 8, -9, -9, -128, -9},
+    {-128, -128, -128, -128, 8, -9, -9, -128, -9},
+    {-7, -7, -128, -128, 0, -7, -5, -128, -7},
+    {-128, -7, -128, -128, 8, 8, 10, -128, 8},
+    {-7, -128, -128, -128, 0, 0, 0, -128, 0},
+    {-128, -128, -128, -128, 0, -7, -7, -128, 0},
+    {-128, -128, -128, -128, 8, -9, 10, -128, -9},
+    {-128, -5, 6, -128, 0, 0, -7, -128, -7},
+    {-5, -128, -5, -128, -7, -7, 0, -128, 0},
+    {-128, -128, 10, -128, 8, 0, 0, -128, 8},
+    {6, -5, -128, -128, -7, -5, -7, -128, 6},
+    {-128, 10, -128, -128, 8, 8, 8, -128, 8},
+    {10, -128, -128, -128, 8, 8, 8, -128, 8},
+    {-128, -128, -128, -128, -9, -9, -7, -128, -9},
+    {-128, -128, -128, -128, 8, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -7, -7, -7, -128, -7},
+    {6, 0, 6, 6, -128, 6, 6, -128, 6},
+    {-128, -7, -7, 0, -128, 0, 0, -128, 0},
+    {-128, -128, -7, 0, -128, 0, 0, -128, 0},
+    {6, -128, 6, 6, -128, 6, 6, -128, 6},
+    {-128, -128, 8, 8, -128, 8, 8, -128, 10},
+    {-128, -7, -128, 8, -128, 8, 10, -128, 8},
+    {8, -128, -128, 8, -128, 8, 10, -128, 8},
+    {-128, -128, -128, 8, -128, 8, 10, -128, 8},
+    {-7, -7, -128, 0, -128, 0, 0, -128, 0},
+    {-128, -7, -128, 8, -128, 8, 8, -128, 10},
+    {-7, -128, -128, 0, -128, 0, 0, -128, 0},
+    {-128, -128, -128, 0, -128, 0, 0, -128, 0},
+    {-128, -128, -128, 8, -128, 8, 8, -128, 10},
+    {-128, 0, 8, -128, -128, 10, 8, -128, 0},
+    {8, -128, 8, -128, -128, 10, 8, -128, 8},
+    {-128, -128, 8, -128, -128, 10, -9, -128, -9},
+    {-128, -128, -128, -128, -128, 10, 10, -128, 8},
+    {8, 0, -128, -128, -128, 10, 8, -128, 8},
+    {-128, 0, -128, -128, -128, 10, -9, -128, -9},
+    {-128, -128, -128, -128, -128, 10, 0, -128, 0},
+    {8, -128, -128, -128, -128, 10, -9, -128, -9},
+    {-128, -128, -128, -128, -128, 10, 10, -128, 10},
+    {0, -7, -7, -128, -128, -7, 0, -128, 0},
+    {-128, 8, 8, -128, -128, 0, 8, -128, 10},
+    {8, -128, 8, -128, -128, -7, 0, -128, 0},
+    {-128, -128, -9, -128, -128, -9, 0, -128, -9},
+    {-128, -128, 8, -128, -128, 0, 8, -128, 10},
+    {8, 8, -128, -128, -128, 8, 10, -128, 8},
+    {-128, -9, -128, -128, -128, -9, 10, -128, -9},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -9},
+    {8, -128, -128, -128, -128, 8, 10, -128, 8},
+    {-128, -128, -128, -128, -128, 8, 10, -128, 10},
+    {-128, -7, -128, -128, -128, 0, 0, -128, 10},
+    {-7, -128, -128, -128, -128, -7, 0, -128, 0},
+    {-128, -128, -128, -128, -128, 0, 0, -128, 10},
+    {-128, 0, -9, -9, -128, -9, -9, -128, -9},
+    {0, -128, 0, -7, -128, -7, 0, -128, 0},
+    {-128, -128, 10, 8, -128, 0, 8, -128, 0},
+    {-9, 0, -128, -9, -128, -9, -9, -128, -9},
+    {-128, 10, -128, -9, -128, -9, -9, -128, -9},
+    {10, -128, -128, 0, -128, 8, 0, -128, 8},
+    {-128, -128, -128, -9, -128, -9, -9, -128, 0},
+    {-128, -128, -128, -9, -128, -9, 0, -128, -9},
+    {-9, -7, -9, -128, -128, -9, -9, -128, -9},
+    {-128, 8, -9, -128, -128, -9, 10, -128, -9},
+    {8, -128, 0, -128, -128, -7, 0, -128, 0},
+    {-128, -128, -9, -128, -128, -9, -9, -128, 0},
+    {-9, 0, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -9, -128, -128, -128, -9, -9, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -9, -128, 0},
+    {-128, -9, -128, -128, -128, -9, 10, -128, -9},
+    {-9, -128, -128, -128, -128, -9, 0, -128, -9},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -9},
+    {-128, -128, 10, -128, -128, 0, -9, -128, -9},
+    {-128, 10, -128, -128, -128, -9, -9, -128, -9},
+    {10, -128, -128, -128, -128, 8, -9, -128, -9},
+    {0, 0, -5, -5, 6, -128, 0, -128, 6},
+    {-128, -7, -7, -7, 0, -128, -7, -128, -5},
+    {-128, -128, -7, 0, 0, -128, 0, -128, 0},
+    {-9, -128, -9, -9, 6, -128, -9, -128, -9},
+    {-128, -128, -9, -9, 8, -128, -9, -128, -9},
+    {-128, -7, -128, 8, 8, -128, 8, -128, 10},
+    {-9, -128, -128, -9, 8, -128, -9, -128, 10},
+    {-128, -128, -128, -9, 8, -128, -9, -128, 10},
+    {-7, -7, -128, -7, 0, -128, -7, -128, -7},
+    {-128, -7, -128, 8, 8, -128, 0, -128, -7},
+    {-7, -128, -128, 0, 0, -128, 0, -128, 0},
+    {-128, -128, -128, -7, 0, -128, 0, -128, -7},
+    {-128, -128, -128, -9, 8, -128, -9, -128, -9},
+    {-128, 0, 8, -128, 10, -128, -7, -128, 8},
+    {-9, -128, -9, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -9, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -9, -128, 10},
+    {8, 0, -128, -128, 10, -128, 8, -128, -7},
+    {-128, -7, -128, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, 0, -128, 0},
+    {-9, -128, -128, -128, 10, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 10, -128, 10, -128, -9},
+    {0, -7, -5, -128, -7, -128, 0, -128, -5},
+    {-128, 0, 8, -128, 0, -128, 0, -128, 8},
+    {0, -128, 8, -128, -7, -128, 0, -128, 0},
+    {-128, -128, -9, -128, -9, -128, 0, -128, -9},
+    {-128, -128, -9, -128, 0, -128, -9, -128, -9},
+    {8, 8, -128, -128, 8, -128, 8, -128, 10},
+    {-128, -9, -128, -128, -9, -128, 8, -128, 10},
+    {-128, -128, -128, -128, -9, -128, 8, -128, 10},
+    {-9, -128, -128, -128, 8, -128, -9, -128, 10},
+    {-128, -128, -128, -128, 8, -128, -9, -128, 10},
+    {-128, -7, -128, -128, 0, -128, 0, -128, -7},
+    {-7, -128, -128, -128, -7, -128, 0, -128, -7},
+    {-128, -128, -128, -128, 0, -128, 0, -128, 0},
+    {-128, 0, 8, 10, -128, -128, 8, -128, 8},
+    {8, -128, 8, 10, -128, -128, 8, -128, 8},
+    {-128, -128, 8, 10, -128, -128, -9, -128, -9},
+    {-128, -128, -128, 10, -128, -128, 10, -128, 10},
+    {8, 0, -128, 10, -128, -128, 0, -128, 8},
+    {-128, 0, -128, 10, -128, -128, -9, -128, -9},
+    {-128, -128, -128, 10, -128, -128, 0, -128, 0},
+    {8, -128, -128, 10, -128, -128, -9, -128, -9},
+    {-128, -128, -128, 10, -128, -128, 8, -128, 10},
+    {0, -7, 8, -128, -128, -128, 0, -128, 8},
+    {-128, -9, -9, -128, -128, -128, 0, -128, -9},
+    {-128, -128, -9, -128, -128, -128, 0, -128, -9},
+    {0, -128, 8, -128, -128, -128, 0, -128, 8},
+    {-128, -128, 8, -128, -128, -128, 8, -128, 10},
+    {-128, -9, -128, -128, -128, -128, 10, -128, 10},
+    {8, -128, -128, -128, -128, -128, 10, -128, 10},
+    {-128, -128, -128, -128, -128, -128, 10, -128, 10},
+    {0, -7, -128, -128, -128, -128, 0, -128, -7},
+    {-128, 0, -128, -128, -128, -128, 0, -128, 10},
+    {0, -128, -128, -128, -128, -128, 0, -128, 0},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -9},
+    {-128, -128, -128, -128, -128, -128, 0, -128, 10},
+    {-9, -7, -9, -9, -128, -128, -9, -128, -9},
+    {-128, 0, -9, -9, -128, -128, -9, -128, -9},
+    {0, -128, 8, -7, -128, -128, 0, -128, 0},
+    {-128, -128, -9, -9, -128, -128, -9, -128, 0},
+    {-9, 8, -128, -9, -128, -128, -9, -128, 10},
+    {-128, -9, -128, -9, -128, -128, -9, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -9, -128, 10},
+    {-128, -9, -128, -9, -128, -128, -9, -128, -9},
+    {-9, -128, -128, -9, -128, -128, 0, -128, -9},
+    {-128, -128, -128, -9, -128, -128, 0, -128, -9},
+    {-9, -7, -9, -128, -128, -128, -9, -128, -9},
+    {-128, -9, -9, -128, -128, -128, -9, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -9, -128, 0},
+    {-128, -9, -128, -128, -128, -128, -9, -128, 10},
+    {-9, -9, -128, -128, -128, -128, -9, -128, -9},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -9},
+    {-9, -128, -128, -128, -128, -128, 0, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -9, -128, -9},
+    {-128, 0, -9, -128, -128, -128, -9, -128, -9},
+    {0, -128, 8, -128, -128, -128, 0, -128, 0},
+    {-128, -128, 10, -128, -128, -128, 0, -128, 0},
+    {-9, 8, -128, -128, -128, -128, -9, -128, 10},
+    {-128, 10, -128, -128, -128, -128, -9, -128, 10},
+    {10, -128, -128, -128, -128, -128, 8, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 10},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -9},
+    {-128, -5, 6, -5, -7, -128, 6, -128, -7},
+    {-5, -128, -5, -7, -7, -128, 0, -128, 0},
+    {-128, -128, 10, 8, 8, -128, 8, -128, 8},
+    {6, -5, -128, 0, 0, -128, -7, -128, -7},
+    {-128, 10, -128, 8, 8, -128, 8, -128, 8},
+    {10, -128, -128, 0, 8, -128, 8, -128, 0},
+    {-128, -128, -128, -7, -7, -128, -7, -128, -7},
+    {-128, -128, -128, -9, 8, -128, -9, -128, -9},
+    {-128, -128, -128, -9, -9, -128, -9, -128, -7},
+    {-5, -7, 0, -128, -7, -128, -5, -128, 0},
+    {-128, 8, 8, -128, 8, -128, 10, -128, 8},
+    {8, -128, 0, -128, -7, -128, 0, -128, 0},
+    {-128, -128, -7, -128, -7, -128, -7, -128, 0},
+    {-128, -128, -9, -128, 8, -128, 10, -128, -9},
+    {8, 0, -128, -128, 0, -128, 8, -128, 0},
+    {-128, -7, -128, -128, 0, -128, -7, -128, 0},
+    {-128, -128, -128, -128, 0, -128, 0, -128, 0},
+    {-9, -128, -128, -128, 0, -128, -9, -128, -9},
+    {-128, -128, -128, -128, 8, -128, 10, -128, -9},
+    {-128, -9, -128, -128, -9, -128, 10, -128, 8},
+    {-9, -128, -128, -128, -9, -128, -9, -128, 0},
+    {-128, -128, -128, -128, -9, -128, 10, -128, 8},
+    {-128, -128, 10, -128, 8, -128, -9, -128, -9},
+    {-128, 10, -128, -128, 8, -128, -9, -128, -9},
+    {10, -128, -128, -128, 8, -128, -9, -128, -9},
+    {-7, -7, 0, -7, -128, -128, 0, -128, 0},
+    {-128, 8, 8, 8, -128, -128, 8, -128, 10},
+    {8, -128, 8, -7, -128, -128, 0, -128, 0},
+    {-128, -128, -7, -7, -128, -128, 0, -128, 0},
+    {-128, -128, 8, 8, -128, -128, 8, -128, 10},
+    {8, 8, -128, 0, -128, -128, 10, -128, 8},
+    {-128, -7, -128, 0, -128, -128, 10, -128, 0},
+    {-128, -128, -128, 0, -128, -128, 10, -128, 0},
+    {8, -128, -128, 0, -128, -128, 10, -128, 8},
+    {-128, -128, -128, 8, -128, -128, 10, -128, 10},
+    {-128, -9, -128, -9, -128, -128, -9, -128, 10},
+    {-9, -128, -128, -9, -128, -128, -9, -128, 0},
+    {-128, -128, -128, -9, -128, -128, -9, -128, 10},
+    {8, -7, 0, -128, -128, -128, 8, -128, 0},
+    {-128, -7, 0, -128, -128, -128, -7, -128, 0},
+    {-128, -128, 0, -128, -128, -128, 0, -128, 0},
+    {8, -128, 0, -128, -128, -128, 8, -128, 0},
+    {-128, -128, 8, -128, -128, -128, 10, -128, 10},
+    {-128, 0, -128, -128, -128, -128, 10, -128, 0},
+    {8, -128, -128, -128, -128, -128, 10, -128, 8},
+    {-128, -128, -128, -128, -128, -128, 10, -128, 0},
+    {-9, -9, -128, -128, -128, -128, -9, -128, 0},
+    {-128, -9, -128, -128, -128, -128, 10, -128, 10},
+    {-9, -128, -128, -128, -128, -128, -9, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 0},
+    {-128, -128, -128, -128, -128, -128, 10, -128, 10},
+    {-128, 8, 8, -128, -128, -128, 8, -128, 10},
+    {8, -128, 8, -128, -128, -128, 0, -128, 0},
+    {-128, -128, 10, -128, -128, -128, 8, -128, 10},
+    {8, 8, -128, -128, -128, -128, 10, -128, 8},
+    {-128, 10, -128, -128, -128, -128, 10, -128, 10},
+    {10, -128, -128, -128, -128, -128, 10, -128, 8},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -9},
+    {-128, -128, -128, -128, -128, -128, 10, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 10},
+    {-128, -128, 10, 8, -128, -128, -9, -128, -9},
+    {-128, 10, -128, -9, -128, -128, -9, -128, -9},
+    {10, -128, -128, 0, -128, -128, -9, -128, -9},
+    {-128, 8, -9, -128, -128, -128, 10, -128, -9},
+    {8, -128, 0, -128, -128, -128, 0, -128, 0},
+    {-128, -128, 10, -128, -128, -128, 10, -128, 8},
+    {-9, 0, -128, -128, -128, -128, -9, -128, -9},
+    {-128, 10, -128, -128, -128, -128, 10, -128, -9},
+    {10, -128, -128, -128, -128, -128, 0, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -9, -128, 0},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -9},
+    {6, 0, 0, 6, 6, 0, -128, -128, 0},
+    {-128, 0, -7, -7, 0, -7, -128, -128, -7},
+    {-128, -128, 0, 0, 0, 0, -128, -128, 0},
+    {-9, -128, -9, -9, 6, -9, -128, -128, -9},
+    {-128, -128, -9, 10, 8, -9, -128, -128, -9},
+    {-128, 0, -128, -7, 10, 8, -128, -128, 8},
+    {-9, -128, -128, -9, 10, -9, -128, -128, -9},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -9},
+    {0, 0, -128, -5, 0, -7, -128, -128, -7},
+    {-128, 0, -128, 10, 8, 0, -128, -128, 8},
+    {0, -128, -128, 0, 0, 0, -128, -128, 0},
+    {-128, -128, -128, -7, 0, 0, -128, -128, 0},
+    {-128, -128, -128, 10, 8, -9, -128, -128, -9},
+    {-128, 0, -7, -128, 8, -7, -128, -128, -7},
+    {10, -128, -9, -128, 8, -9, -128, -128, -9},
+    {-128, -128, -9, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -9},
+    {10, 0, -128, -128, 8, 8, -128, -128, 0},
+    {-128, -7, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 0, 0, -128, -128, 0},
+    {10, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-7, 0, -7, -128, 0, 0, -128, -128, -7},
+    {-128, 0, 8, -128, 8, 0, -128, -128, -7},
+    {0, -128, 8, -128, 0, 0, -128, -128, 0},
+    {-128, -128, -7, -128, 0, 0, -128, -128, 0},
+    {-128, -128, -9, -128, 8, -9, -128, -128, -9},
+    {8, 8, -128, -128, 10, 8, -128, -128, 8},
+    {-128, -7, -128, -128, 10, 8, -128, -128, 8},
+    {-128, -128, -128, -128, 10, 8, -128, -128, 8},
+    {-9, -128, -128, -128, 10, -9, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -9},
+    {-128, -7, -128, -128, 0, 0, -128, -128, -7},
+    {-7, -128, -128, -128, 0, 0, -128, -128, 0},
+    {-128, -128, -128, -128, 0, 0, -128, -128, 0},
+    {-128, 0, 10, 8, -128, 8, -128, -128, 0},
+    {8, -128, 10, 8, -128, 8, -128, -128, 8},
+    {-128, -128, 10, -9, -128, -9, -128, -128, -9},
+    {8, 0, -128, 8, -128, 0, -128, -128, 0},
+    {-128, 0, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, 0, -128, 0, -128, -128, 0},
+    {8, -128, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, 10, -128, 8, -128, -128, 10},
+    {-128, -128, 10, -128, -128, 10, -128, -128, -9},
+    {-128, 0, -128, -128, -128, 10, -128, -128, -9},
+    {10, -128, -128, -128, -128, 10, -128, -128, -9},
+    {8, 0, 10, -128, -128, 0, -128, -128, 8},
+    {-128, 0, 10, -128, -128, 0, -128, -128, 0},
+    {-128, -128, 10, -128, -128, 0, -128, -128, 0},
+    {8, -128, 10, -128, -128, 0, -128, -128, 8},
+    {-128, -128, 10, -128, -128, 8, -128, -128, 10},
+    {0, 0, -128, -128, -128, 0, -128, -128, 0},
+    {-128, 0, -128, -128, -128, 0, -128, -128, 10},
+    {0, -128, -128, -128, -128, 0, -128, -128, 0},
+    {-128, -128, -128, -128, -128, 0, -128, -128, 0},
+    {-128, -128, -128, -128, -128, 0, -128, -128, 10},
+    {-9, 0, -9, -9, -128, -9, -128, -128, -9},
+    {-128, 8, -9, 10, -128, -9, -128, -128, -9},
+    {8, -128, 0, 0, -128, 0, -128, -128, 0},
+    {-128, -128, -9, -9, -128, -9, -128, -128, 0},
+    {-9, 0, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -9, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, -9, -128, -9, -128, -128, 0},
+    {-128, 0, -128, 10, -128, -9, -128, -128, -9},
+    {0, -128, -128, 0, -128, 0, -128, -128, 0},
+    {-128, -128, -128, 10, -128, 0, -128, -128, 0},
+    {10, 0, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -128, -9, -128, -128, -9, -128, -128, 0},
+    {-128, -9, -128, -128, -128, -9, -128, -128, -9},
+    {10, 0, -128, -128, -128, -9, -128, -128, -9},
+    {10, -128, -128, -128, -128, 0, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 0},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -9},
+    {-9, -128, -9, -128, -128, 0, -128, -128, -9},
+    {-128, -128, 10, -128, -128, 0, -128, -128, -9},
+    {-9, -9, -128, -128, -128, -9, -128, -128, -9},
+    {-128, 10, -128, -128, -128, -9, -128, -128, -9},
+    {10, -128, -128, -128, -128, 8, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -128, -128, -9},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -9},
+    {-128, 0, 8, -7, 8, -128, -128, -128, 0},
+    {-9, -128, -9, -9, 8, -128, -128, -128, -9},
+    {-128, -128, -9, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, -9, 10, -128, -128, -128, 10},
+    {0, 0, -128, 8, 0, -128, -128, -128, -7},
+    {-128, 0, -128, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, 0, 0, -128, -128, -128, 0},
+    {-9, -128, -128, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, 10, 8, -128, -128, -128, -9},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -9},
+    {-128, 0, -128, -128, 10, -128, -128, -128, -9},
+    {10, -128, -128, -128, 10, -128, -128, -128, -9},
+    {0, 0, 8, -128, 0, -128, -128, -128, 0},
+    {-128, 0, 8, -128, 0, -128, -128, -128, 0},
+    {-128, -128, 8, -128, 0, -128, -128, -128, 0},
+    {-9, -128, -9, -128, 0, -128, -128, -128, -9},
+    {-128, -128, -9, -128, 8, -128, -128, -128, -9},
+    {-128, 8, -128, -128, 10, -128, -128, -128, 10},
+    {-9, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-128, -128, -128, -128, 10, -128, -128, -128, 10},
+    {0, 0, -128, -128, 0, -128, -128, -128, -7},
+    {-128, 0, -128, -128, 0, -128, -128, -128, 0},
+    {0, -128, -128, -128, 0, -128, -128, -128, 0},
+    {-128, -128, -128, -128, 0, -128, -128, -128, 0},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -9},
+    {-128, -128, 10, 10, -128, -128, -128, -128, -9},
+    {-128, 0, -128, 10, -128, -128, -128, -128, -9},
+    {8, -128, -128, 10, -128, -128, -128, -128, -9},
+    {-128, 0, 10, -128, -128, -128, -128, -128, 0},
+    {8, -128, 10, -128, -128, -128, -128, -128, 8},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -9},
+    {0, 0, -128, -128, -128, -128, -128, -128, 0},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {0, -128, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-9, 0, -9, -9, -128, -128, -128, -128, -9},
+    {-128, -9, -9, -9, -128, -128, -128, -128, -9},
+    {-128, -128, -9, -9, -128, -128, -128, -128, 0},
+    {-128, -9, -128, -9, -128, -128, -128, -128, 10},
+    {-9, 0, -128, -9, -128, -128, -128, -128, -9},
+    {-128, 0, -128, 10, -128, -128, -128, -128, -9},
+    {0, -128, -128, 0, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 0},
+    {-128, -9, -9, -128, -128, -128, -128, -128, -9},
+    {10, 0, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-9, 0, -9, -128, -128, -128, -128, -128, -9},
+    {-128, 0, -9, -128, -128, -128, -128, -128, -9},
+    {0, -128, 8, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 0},
+    {-9, 8, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -9},
+    {0, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {6, 0, -7, -5, 0, -128, -128, -128, -7},
+    {-128, 8, 8, 10, 8, -128, -128, -128, 8},
+    {8, -128, 8, 0, 0, -128, -128, -128, 0},
+    {-128, -128, -7, -7, 0, -128, -128, -128, 0},
+    {-128, -128, -9, 10, 8, -128, -128, -128, -9},
+    {8, 8, -128, 8, 10, -128, -128, -128, -7},
+    {-128, -7, -128, -7, 10, -128, -128, -128, -7},
+    {-128, -128, -128, 0, 10, -128, -128, -128, 0},
+    {-9, -128, -128, -9, 10, -128, -128, -128, -9},
+    {-128, -128, -128, 10, 10, -128, -128, -128, -9},
+    {-128, -9, -128, 10, -9, -128, -128, -128, 8},
+    {-9, -128, -128, -9, -9, -128, -128, -128, 0},
+    {-128, -128, -128, 10, -9, -128, -128, -128, 8},
+    {10, 0, 8, -128, 8, -128, -128, -128, 0},
+    {-128, -7, -7, -128, -7, -128, -128, -128, -7},
+    {-128, -128, 0, -128, 0, -128, -128, -128, 0},
+    {10, -128, -9, -128, 8, -128, -128, -128, -9},
+    {-128, 0, -128, -128, 10, -128, -128, -128, 0},
+    {10, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {10, -9, -128, -128, -9, -128, -128, -128, 0},
+    {10, -128, -128, -128, -9, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -9, -128, -128, -128, 0},
+    {-128, -9, -9, -128, 8, -128, -128, -128, -9},
+    {-9, -128, -9, -128, 0, -128, -128, -128, -9},
+    {-128, -128, 10, -128, 8, -128, -128, -128, -9},
+    {-9, -9, -128, -128, 10, -128, -128, -128, -9},
+    {-128, 10, -128, -128, 10, -128, -128, -128, -9},
+    {10, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -9, -128, -128, -128, -9},
+    {8, 0, 10, 8, -128, -128, -128, -128, 8},
+    {-128, 0, 10, -7, -128, -128, -128, -128, 0},
+    {-128, -128, 10, 0, -128, -128, -128, -128, 0},
+    {8, -128, 10, 8, -128, -128, -128, -128, 8},
+    {-128, -128, 10, 10, -128, -128, -128, -128, 10},
+    {-9, -9, -128, -9, -128, -128, -128, -128, 0},
+    {-128, -9, -128, 10, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -9, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 0},
+    {-128, -128, -128, 10, -128, -128, -128, -128, 10},
+    {-128, 0, 10, -128, -128, -128, -128, -128, 0},
+    {10, -128, 10, -128, -128, -128, -128, -128, 8},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -9},
+    {10, -9, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -9, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {10, -128, -128, -128, -128, -128, -128, -128, -9},
+    {8, 0, 10, -128, -128, -128, -128, -128, 8},
+    {-128, 8, 10, -128, -128, -128, -128, -128, 10},
+    {8, -128, 10, -128, -128, -128, -128, -128, 8},
+    {-128, -128, 10, -128, -128, -128, -128, -128, 0},
+    {-128, -128, 10, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -9, 10, -128, -128, -128, -128, -9},
+    {-9, -128, -9, 0, -128, -128, -128, -128, -9},
+    {-128, -128, 10, 10, -128, -128, -128, -128, -9},
+    {-9, -9, -128, -9, -128, -128, -128, -128, -9},
+    {-128, 10, -128, 10, -128, -128, -128, -128, -9},
+    {10, -128, -128, 0, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -128, -128, -9},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -9},
+    {10, 0, -9, -128, -128, -128, -128, -128, -9},
+    {10, -128, 0, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 0},
+    {10, 0, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -9, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {10, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -9, -9, -9, -9, -9, -128, -128, -7},
+    {-9, -128, -9, -9, -9, -9, -128, -128, 0},
+    {-128, -128, 10, -9, -9, -9, -128, -128, 8},
+    {-9, -9, -128, -9, -9, -9, -128, -128, 6},
+    {-128, 10, -128, -9, -9, -9, -128, -128, 8},
+    {10, -128, -128, -9, -9, -9, -128, -128, 8},
+    {-128, -128, -128, -9, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -9, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -9, -9, -9, -128, -128, -9},
+    {-9, -9, -9, -128, -9, -9, -128, -128, -7},
+    {-128, -9, -9, -128, -9, -9, -128, -128, -7},
+    {-9, -128, -9, -128, -9, -9, -128, -128, 6},
+    {-128, -128, -9, -128, -9, -9, -128, -128, 0},
+    {-128, -128, -9, -128, -9, -9, -128, -128, -9},
+    {-9, -9, -128, -128, -9, -9, -128, -128, 6},
+    {-128, -9, -128, -128, -9, -9, -128, -128, 0},
+    {-128, -128, -128, -128, -9, -9, -128, -128, 0},
+    {-9, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -9, -128, -128, -9, -9, -128, -128, -9},
+    {-9, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-128, -128, 10, -128, -9, -9, -128, -128, 8},
+    {-128, 10, -128, -128, -9, -9, -128, -128, 8},
+    {10, -128, -128, -128, -9, -9, -128, -128, -9},
+    {-9, -9, -9, -9, -128, -9, -128, -128, 0},
+    {-128, -9, -9, -9, -128, -9, -128, -128, 10},
+    {-9, -128, -9, -9, -128, -9, -128, -128, 0},
+    {-128, -128, -9, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -9, -9, -128, -9, -128, -128, 10},
+    {-9, -9, -128, -9, -128, -9, -128, -128, 8},
+    {-128, -9, -128, -9, -128, -9, -128, -128, -9},
+    {-128, -128, -128, -9, -128, -9, -128, -128, -9},
+    {-9, -128, -128, -9, -128, -9, -128, -128, 8},
+    {-128, -128, -128, -9, -128, -9, -128, -128, 10},
+    {-128, -9, -128, -9, -128, -9, -128, -128, 10},
+    {-9, -128, -128, -9, -128, -9, -128, -128, 0},
+    {-128, -128, -128, -9, -128, -9, -128, -128, 10},
+    {-9, -9, -9, -128, -128, 10, -128, -128, 8},
+    {-128, -9, -9, -128, -128, 10, -128, -128, 0},
+    {-128, -128, -9, -128, -128, 10, -128, -128, 0},
+    {-9, -128, -9, -128, -128, 10, -128, -128, 8},
+    {-128, -128, -9, -128, -128, 10, -128, -128, 10},
+    {-128, -9, -128, -128, -128, 10, -128, -128, 0},
+    {-9, -128, -128, -128, -128, 10, -128, -128, 8},
+    {-128, -128, -128, -128, -128, 10, -128, -128, 0},
+    {-9, -9, -128, -128, -128, 10, -128, -128, 8},
+    {-128, -9, -128, -128, -128, 10, -128, -128, 10},
+    {-9, -128, -128, -128, -128, 10, -128, -128, 8},
+    {-128, -128, -128, -128, -128, 10, -128, -128, 0},
+    {-128, -128, -128, -128, -128, 10, -128, -128, 10},
+    {-128, -9, -9, -128, -128, -9, -128, -128, 10},
+    {-9, -128, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -128, 10, -128, -128, -9, -128, -128, 10},
+    {-9, -9, -128, -128, -128, -9, -128, -128, -9},
+    {-128, 10, -128, -128, -128, -9, -128, -128, 10},
+    {10, -128, -128, -128, -128, -9, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 10},
+    {-128, -128, 10, -9, -128, -9, -128, -128, -9},
+    {-128, 10, -128, -9, -128, -9, -128, -128, -9},
+    {10, -128, -128, -9, -128, -9, -128, -128, 8},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -9},
+    {-9, -128, -9, -128, -128, -9, -128, -128, -9},
+    {-128, -128, 10, -128, -128, -9, -128, -128, -9},
+    {-9, -9, -128, -128, -128, -9, -128, -128, -9},
+    {-128, 10, -128, -128, -128, -9, -128, -128, -9},
+    {10, -128, -128, -128, -128, -9, -128, -128, 8},
+    {-128, -128, -128, -128, -128, -9, -128, -128, 0},
+    {-9, -9, -9, -9, -9, -128, -128, -128, 6},
+    {-128, -9, -9, -9, -9, -128, -128, -128, 8},
+    {-9, -128, -9, -9, -9, -128, -128, -128, 6},
+    {-128, -128, -9, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -9, -9, -9, -128, -128, -128, -9},
+    {-9, -9, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -9, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -9, -128, -128, -128, 10},
+    {-9, -128, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -9, -128, -128, -128, 10},
+    {-128, -9, -128, -9, -9, -128, -128, -128, -9},
+    {-9, -128, -128, -9, -9, -128, -128, -128, -9},
+    {-128, -128, -128, -9, -9, -128, -128, -128, -9},
+    {-9, -9, -9, -128, 10, -128, -128, -128, 8},
+    {-128, -9, -9, -128, 10, -128, -128, -128, 8},
+    {-128, -128, -9, -128, 10, -128, -128, -128, 8},
+    {-9, -128, -9, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -9},
+    {-128, -9, -128, -128, 10, -128, -128, -128, 10},
+    {-9, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-128, -128, -128, -128, 10, -128, -128, -128, 10},
+    {-9, -9, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -9},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -9},
+    {-128, -9, -9, -128, -9, -128, -128, -128, 8},
+    {-9, -128, -9, -128, -9, -128, -128, -128, -9},
+    {-128, -128, 10, -128, -9, -128, -128, -128, 8},
+    {-9, -9, -128, -128, -9, -128, -128, -128, 10},
+    {-128, 10, -128, -128, -9, -128, -128, -128, 10},
+    {10, -128, -128, -128, -9, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -9, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -9, -128, -128, -128, -9},
+    {-9, -9, -9, 10, -128, -128, -128, -128, 8},
+    {-128, -9, -9, 10, -128, -128, -128, -128, -9},
+    {-128, -128, -9, 10, -128, -128, -128, -128, -9},
+    {-9, -128, -9, 10, -128, -128, -128, -128, 8},
+    {-128, -128, -9, 10, -128, -128, -128, -128, 10},
+    {-128, -9, -128, 10, -128, -128, -128, -128, 10},
+    {-9, -128, -128, 10, -128, -128, -128, -128, 10},
+    {-128, -128, -128, 10, -128, -128, -128, -128, 10},
+    {-9, -9, -128, 10, -128, -128, -128, -128, 8},
+    {-128, -9, -128, 10, -128, -128, -128, -128, 10},
+    {-9, -128, -128, 10, -128, -128, -128, -128, 8},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -9},
+    {-128, -128, -128, 10, -128, -128, -128, -128, 10},
+    {-9, -9, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -9, -9, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 10},
+    {-9, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -9, -9, -128, -128, -128, -128, -9},
+    {-9, -128, -9, -9, -128, -128, -128, -128, -9},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -9},
+    {-9, -9, -128, -9, -128, -128, -128, -128, 10},
+    {-128, 10, -128, -9, -128, -128, -128, -128, 10},
+    {10, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-9, -9, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -9, -9, -128, -128, -128, -128, -128, -9},
+    {-9, -128, -9, -128, -128, -128, -128, -128, -9},
+    {-128, -128, -9, -128, -128, -128, -128, -128, -9},
+    {-9, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -9},
+    {-128, 10, -128, -128, -128, -128, -128, -128, 10},
+    {10, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, 10, -9, -9, -128, -128, -128, 8},
+    {-128, 10, -128, -9, -9, -128, -128, -128, 8},
+    {10, -128, -128, -9, -9, -128, -128, -128, 0},
+    {-128, -9, -9, -128, -9, -128, -128, -128, -7},
+    {-9, -128, -9, -128, -9, -128, -128, -128, 0},
+    {-128, -128, 10, -128, -9, -128, -128, -128, 8},
+    {-9, -9, -128, -128, -9, -128, -128, -128, 0},
+    {-128, 10, -128, -128, -9, -128, -128, -128, 8},
+    {10, -128, -128, -128, -9, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -9, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -9, -128, -128, -128, -9},
+    {-128, -128, -128, -128, -9, -128, -128, -128, -9},
+    {-128, -9, -9, -9, -128, -128, -128, -128, 10},
+    {-9, -128, -9, -9, -128, -128, -128, -128, 0},
+    {-128, -128, 10, -9, -128, -128, -128, -128, 10},
+    {-9, -9, -128, -9, -128, -128, -128, -128, 0},
+    {-128, 10, -128, -9, -128, -128, -128, -128, 10},
+    {10, -128, -128, -9, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -9, -128, -128, -128, -128, -9},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-128, -128, -128, -9, -128, -128, -128, -128, 10},
+    {-9, -9, -9, -128, -128, -128, -128, -128, 0},
+    {-128, -9, -9, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -9, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -9, -128, -128, -128, -128, -128, 10},
+    {-9, -9, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-9, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -9, -128, -128, -128, -128, -128, -128, 10},
+    {-9, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, -128, -128, -128, -128, -128, -128, -128, 10},
+    {-128, -128, 10, -128, -128, -128, -128, -128, 10},
+    {-128, 10, -128, -128, -128, -128, -128, -128, 10},
+    {10, -128, -128, -128, -128, -128, -128, -128, -9},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -9},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -9},
+    {10, -128, -128, -128, -128, -128, -128, -128, 0},
+    {-128, 0, 6, 0, 0, -5, 6, -5, -128},
+    {0, -128, 6, 0, 6, -5, 6, 0, -128},
+    {-128, -128, 6, -9, -9, -9, -9, -9, -128},
+    {-128, -128, -128, 6, 8, 10, 8, 8, -128},
+    {6, 0, -128, 0, 0, -5, 6, 6, -128},
+    {-128, -7, -128, -9, -9, -9, -9, -9, -128},
+    {-128, -128, -128, 0, 0, -7, 0, 8, -128},
+    {-7, -128, -128, -9, -9, -9, -9, -9, -128},
+    {-128, -128, -128, 8, 10, -7, 8, 8, -128},
+    {-128, -128, 6, -128, -9, -9, -9, -9, -128},
+    {-128, 0, -128, -128, -9, -9, -9, -9, -128},
+    {8, -128, -128, -128, -9, -9, -9, -9, -128},
+    {0, 0, 6, -128, 6, 0, 6, -5, -128},
+    {-128, -9, -9, -128, -9, -9, 6, -9, -128},
+    {-128, -128, -9, -128, -9, -9, 6, -9, -128},
+    {-7, -128, 6, -128, -7, -5, 6, -5, -128},
+    {-128, -128, 8, -128, 10, 8, 8, 8, -128},
+    {-128, -9, -128, -128, -9, 10, 8, -9, -128},
+    {8, -128, -128, -128, 8, 10, 8, 8, -128},
+    {-128, -128, -128, -128, -9, 10, 8, -9, -128},
+    {-7, -7, -128, -128, -7, -7, 0, -7, -128},
+    {-128, -7, -128, -128, 10, 0, 8, 8, -128},
+    {-7, -128, -128, -128, 8, -7, 0, 8, -128},
+    {-128, -128, -128, -128, -9, -9, 0, -9, -128},
+    {-128, -128, -128, -128, 10, -7, 8, 8, -128},
+    {-128, -128, 8, -9, -128, -9, -9, -9, -128},
+    {-128, 0, -128, -9, -128, -9, -9, -9, -128},
+    {10, -128, -128, -9, -128, -9, -9, -9, -128},
+    {-128, -9, -9, -128, -128, -9, 8, -9, -128},
+    {10, -128, 8, -128, -128, 8, 8, 8, -128},
+    {-128, -128, -9, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, 10, -9, -128},
+    {10, 8, -128, -128, -128, -7, 8, 8, -128},
+    {-128, -9, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -9, 0, 10, -128},
+    {10, -128, -128, -128, -128, -9, -9, -9, -128},
+    {0, 0, 0, 0, -128, 0, 0, 0, -128},
+    {-128, -7, 0, -7, -128, -7, 0, -7, -128},
+    {-128, -128, 0, 0, -128, 0, 0, -7, -128},
+    {-9, -128, -9, -9, -128, -9, -9, 0, -128},
+    {-128, -128, -9, -9, -128, -9, -9, 0, -128},
+    {-128, 0, -128, 0, -128, 10, 8, 8, -128},
+    {-9, -128, -128, -9, -128, 10, -9, 8, -128},
+    {-128, -128, -128, -9, -128, 10, -9, 8, -128},
+    {-9, -9, -128, -9, -128, -9, 0, -9, -128},
+    {-128, -9, -128, -9, -128, -9, 8, -9, -128},
+    {-9, -128, -128, -9, -128, -9, 0, -9, -128},
+    {-128, -128, -128, -9, -128, -9, 0, -9, -128},
+    {-128, -128, -128, -9, -128, -9, -9, -9, -128},
+    {-128, 0, 0, -128, -128, -7, 0, 0, -128},
+    {-9, -128, -9, -128, -128, -9, -9, 0, -128},
+    {-128, -128, -9, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, -9, 8, -128},
+    {-9, -9, -128, -128, -128, -9, 8, -9, -128},
+    {-128, -9, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -9, 0, -9, -128},
+    {-9, -128, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -9, -128},
+    {-9, -9, -9, -128, -128, 0, -9, -9, -128},
+    {-128, -9, -9, -128, -128, 0, -9, -9, -128},
+    {-9, -128, -9, -128, -128, 0, -9, -9, -128},
+    {-128, -128, -9, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -9, -128, -128, -9, -9, -9, -128},
+    {-9, -9, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -9, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, -9, -9, -128},
+    {-9, -128, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -9, -128, -128, -128, -9, -9, -9, -128},
+    {-9, -128, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, 10, -9, -9, -128, -9, -9, -128},
+    {-128, -7, -128, -9, -9, -128, -9, -9, -128},
+    {-7, -128, -128, -9, -9, -128, -9, -9, -128},
+    {-128, -9, 10, -128, -9, -128, 8, -9, -128},
+    {8, -128, 10, -128, 8, -128, 8, 8, -128},
+    {-128, -128, 10, -128, -9, -128, -9, -9, -128},
+    {0, -7, -128, -128, -7, -128, 0, -7, -128},
+    {-128, -9, -128, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, -9, -128, 0, -9, -128},
+    {-7, -128, -128, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, 8, 8, -128},
+    {-128, -128, 10, -128, -128, -128, -9, -9, -128},
+    {-128, -9, -128, -128, -128, -128, -9, -9, -128},
+    {10, -128, -128, -128, -128, -128, -9, -9, -128},
+    {-128, 0, 10, -7, -128, -128, 8, 8, -128},
+    {-9, -128, 10, -9, -128, -128, -9, 8, -128},
+    {-128, -128, 10, -9, -128, -128, -9, -9, -128},
+    {-9, -9, -128, -9, -128, -128, 0, -9, -128},
+    {-128, -9, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -128, 0, -9, -128},
+    {-9, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, 10, -128, -128, -128, -9, -9, -128},
+    {-128, -9, -128, -128, -128, -128, -9, -9, -128},
+    {-9, -128, -128, -128, -128, -128, -9, -9, -128},
+    {0, 0, 10, -128, -128, -128, 8, 8, -128},
+    {-128, -9, 10, -128, -128, -128, 8, -9, -128},
+    {-128, -128, 10, -128, -128, -128, 8, -9, -128},
+    {-9, -128, 10, -128, -128, -128, -9, 8, -128},
+    {-128, -128, 10, -128, -128, -128, -9, 8, -128},
+    {-9, -9, -128, -128, -128, -128, 0, -9, -128},
+    {-128, -9, -128, -128, -128, -128, 0, -9, -128},
+    {-9, -128, -128, -128, -128, -128, 0, -9, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -9, -9, -128},
+    {0, 0, 0, 0, 6, -128, 6, 6, -128},
+    {-128, -7, -7, 0, 0, -128, 0, -5, -128},
+    {-128, -128, -7, 0, 0, -128, 0, 8, -128},
+    {-7, -128, -7, 0, 0, -128, 6, -5, -128},
+    {-128, -128, -7, 8, 10, -128, 8, 8, -128},
+    {-128, -7, -128, 0, 0, -128, 8, 0, -128},
+    {-7, -128, -128, 0, 8, -128, 8, 0, -128},
+    {-128, -128, -128, 0, 0, -128, 8, 0, -128},
+    {-7, -7, -128, 0, 0, -128, 6, 6, -128},
+    {-128, -7, -128, 8, 10, -128, 8, 8, -128},
+    {-7, -128, -128, 6, 8, -128, 6, 8, -128},
+    {-128, -128, -128, 0, 0, -128, 0, 8, -128},
+    {-128, -128, -128, 8, 10, -128, 8, 8, -128},
+    {-128, 0, 0, -128, 0, -128, 0, 0, -128},
+    {8, -128, 0, -128, 0, -128, 8, 0, -128},
+    {-128, -128, 0, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 0, -128, 8, 0, -128},
+    {8, 6, -128, -128, 0, -128, 8, 6, -128},
+    {-128, 0, -128, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 0, -128, 0, 8, -128},
+    {8, -128, -128, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, 10, 8, -128},
+    {-9, -9, -9, -128, 6, -128, -9, -9, -128},
+    {-128, -9, -9, -128, 10, -128, -9, -9, -128},
+    {-9, -128, -9, -128, 8, -128, -9, -9, -128},
+    {-128, -128, -9, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -9, -128, 10, -128, -9, -9, -128},
+    {-9, -9, -128, -128, 8, -128, -9, -9, -128},
+    {-128, -9, -128, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -9, -128},
+    {-9, -128, -128, -128, 8, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -9, -9, -128},
+    {-9, -128, -128, -128, 8, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -9, -128},
+    {-128, 0, 0, 0, -128, -128, 8, 8, -128},
+    {10, -128, 8, 0, -128, -128, 8, 8, -128},
+    {-128, -128, 0, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, 0, -128, -128, 10, 0, -128},
+    {10, 8, -128, 0, -128, -128, 8, 8, -128},
+    {-128, 0, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, 0, -128, -128, 0, 10, -128},
+    {10, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, 0, -128, -128, -128, -9, -9, -128},
+    {-128, 0, -128, -128, -128, -128, -9, -9, -128},
+    {10, -128, -128, -128, -128, -128, -9, -9, -128},
+    {10, 8, 8, -128, -128, -128, 8, 8, -128},
+    {-128, -9, -9, -128, -128, -128, 8, -9, -128},
+    {-128, -128, -9, -128, -128, -128, 8, 10, -128},
+    {10, -128, 8, -128, -128, -128, 8, 8, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -9, -128},
+    {10, -128, -128, -128, -128, -128, 10, 8, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -9, -128},
+    {10, 8, -128, -128, -128, -128, 8, 8, -128},
+    {10, -128, -128, -128, -128, -128, 8, 10, -128},
+    {-128, -128, -128, -128, -128, -128, 0, 10, -128},
+    {-9, -9, -9, 0, -128, -128, -9, -9, -128},
+    {-128, -9, -9, 0, -128, -128, -9, -9, -128},
+    {-9, -128, -9, 0, -128, -128, -9, -9, -128},
+    {-128, -128, -9, 0, -128, -128, -9, -9, -128},
+    {-128, -128, -9, -9, -128, -128, -9, -9, -128},
+    {-9, -9, -128, 0, -128, -128, -9, -9, -128},
+    {-128, -9, -128, 0, -128, -128, -9, -9, -128},
+    {-128, -128, -128, 0, -128, -128, -9, -9, -128},
+    {-9, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -9, -128, -9, -128, -128, -9, -9, -128},
+    {-9, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -128, -9, -9, -128},
+    {0, 0, 0, -128, -128, -128, 8, 0, -128},
+    {-128, 0, 0, -128, -128, -128, 0, 0, -128},
+    {-128, -128, 0, -128, -128, -128, 0, 0, -128},
+    {-9, -128, -9, -128, -128, -128, -9, 0, -128},
+    {-128, -128, -9, -128, -128, -128, 10, 0, -128},
+    {-128, 0, -128, -128, -128, -128, 0, 0, -128},
+    {-9, -128, -128, -128, -128, -128, -9, 0, -128},
+    {-128, -128, -128, -128, -128, -128, -9, 0, -128},
+    {-9, -9, -128, -128, -128, -128, 8, -9, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -9, -128},
+    {-9, -128, -128, -128, -128, -128, 8, -9, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -9, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -9, -128},
+    {-128, -128, 8, -9, -9, -9, -128, 10, -128},
+    {-128, 0, -128, -9, -9, -9, -128, 10, -128},
+    {8, -128, -128, -9, -9, -9, -128, 10, -128},
+    {-128, 6, 8, -128, 8, 8, -128, 10, -128},
+    {8, -128, 8, -128, 8, 8, -128, 10, -128},
+    {-128, -128, 8, -128, -9, -9, -128, 10, -128},
+    {-128, -128, -128, -128, 10, 10, -128, 10, -128},
+    {8, 0, -128, -128, 8, 0, -128, 10, -128},
+    {-128, 0, -128, -128, -9, -9, -128, 10, -128},
+    {-128, -128, -128, -128, 0, 0, -128, 10, -128},
+    {8, -128, -128, -128, -9, -9, -128, 10, -128},
+    {-128, -128, -128, -128, 10, 8, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -9, -128, 10, -128},
+    {-128, 0, -128, -128, -128, -9, -128, 10, -128},
+    {10, -128, -128, -128, -128, -9, -128, 10, -128},
+    {-128, 0, 8, 0, -128, 8, -128, 10, -128},
+    {-9, -128, -9, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -9, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -128, -9, -128, 10, -128, 10, -128},
+    {8, 0, -128, 8, -128, 0, -128, 10, -128},
+    {-128, 0, -128, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -128, 0, -128, 0, -128, 10, -128},
+    {-9, -128, -128, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -128, 10, -128, -9, -128, 10, -128},
+    {-128, -128, -9, -128, -128, -9, -128, 10, -128},
+    {-128, 0, -128, -128, -128, -9, -128, 10, -128},
+    {10, -128, -128, -128, -128, -9, -128, 10, -128},
+    {-9, -9, -9, -128, -128, 8, -128, 10, -128},
+    {-128, -9, -9, -128, -128, 8, -128, 10, -128},
+    {-128, -128, -9, -128, -128, 8, -128, 10, -128},
+    {-9, -128, -9, -128, -128, -9, -128, 10, -128},
+    {-128, -128, -9, -128, -128, -9, -128, 10, -128},
+    {-128, -9, -128, -128, -128, 10, -128, 10, -128},
+    {-9, -128, -128, -128, -128, 10, -128, 10, -128},
+    {-128, -128, -128, -128, -128, 10, -128, 10, -128},
+    {-9, -9, -128, -128, -128, 0, -128, 10, -128},
+    {-128, -9, -128, -128, -128, 0, -128, 10, -128},
+    {-9, -128, -128, -128, -128, 0, -128, 10, -128},
+    {-128, -128, -128, -128, -128, 0, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -9, -128, 10, -128},
+    {-128, -128, 10, -128, -9, -128, -128, 10, -128},
+    {-128, 0, -128, -128, -9, -128, -128, 10, -128},
+    {8, -128, -128, -128, -9, -128, -128, 10, -128},
+    {-128, -128, 10, -9, -128, -128, -128, 10, -128},
+    {-128, 0, -128, -9, -128, -128, -128, 10, -128},
+    {-9, -128, -128, -9, -128, -128, -128, 10, -128},
+    {-128, 8, 10, -128, -128, -128, -128, 10, -128},
+    {-9, -128, 10, -128, -128, -128, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -128, -128, 10, -128},
+    {0, 0, -128, -128, -128, -128, -128, 10, -128},
+    {-128, 0, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-9, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-128, 0, 8, 0, 8, -128, -128, 10, -128},
+    {8, -128, 8, 8, 8, -128, -128, 10, -128},
+    {-128, -128, 8, -9, -9, -128, -128, 10, -128},
+    {-128, -128, -128, 8, 10, -128, -128, 10, -128},
+    {8, 6, -128, 8, 8, -128, -128, 10, -128},
+    {-128, 0, -128, -9, -9, -128, -128, 10, -128},
+    {-128, -128, -128, 0, 0, -128, -128, 10, -128},
+    {8, -128, -128, -9, -9, -128, -128, 10, -128},
+    {-128, -128, -128, 10, 10, -128, -128, 10, -128},
+    {-128, -128, 8, -128, -9, -128, -128, 10, -128},
+    {-128, 0, -128, -128, -9, -128, -128, 10, -128},
+    {10, -128, -128, -128, -9, -128, -128, 10, -128},
+    {-9, -9, -9, -128, 8, -128, -128, 10, -128},
+    {-128, -9, -9, -128, 8, -128, -128, 10, -128},
+    {-128, -128, -9, -128, 8, -128, -128, 10, -128},
+    {-9, -128, -9, -128, 8, -128, -128, 10, -128},
+    {-128, -128, -9, -128, 10, -128, -128, 10, -128},
+    {-128, -9, -128, -128, 10, -128, -128, 10, -128},
+    {-9, -128, -128, -128, 10, -128, -128, 10, -128},
+    {-128, -128, -128, -128, 10, -128, -128, 10, -128},
+    {-9, -9, -128, -128, 8, -128, -128, 10, -128},
+    {-128, -9, -128, -128, 10, -128, -128, 10, -128},
+    {-9, -128, -128, -128, 8, -128, -128, 10, -128},
+    {-128, -128, -128, -128, 0, -128, -128, 10, -128},
+    {-128, -128, -128, -128, 10, -128, -128, 10, -128},
+    {-128, -128, 10, -9, -128, -128, -128, 10, -128},
+    {-128, 0, -128, -9, -128, -128, -128, 10, -128},
+    {10, -128, -128, -9, -128, -128, -128, 10, -128},
+    {-128, 8, 10, -128, -128, -128, -128, 10, -128},
+    {10, -128, 10, -128, -128, -128, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -128, -128, 10, -128},
+    {10, 8, -128, -128, -128, -128, -128, 10, -128},
+    {-128, 0, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {10, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-9, -9, -9, 8, -128, -128, -128, 10, -128},
+    {-128, -9, -9, 0, -128, -128, -128, 10, -128},
+    {-128, -128, -9, 0, -128, -128, -128, 10, -128},
+    {-9, -128, -9, -9, -128, -128, -128, 10, -128},
+    {-128, -128, -9, 10, -128, -128, -128, 10, -128},
+    {-128, -9, -128, 0, -128, -128, -128, 10, -128},
+    {-9, -128, -128, -9, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -9, -128, -128, -128, 10, -128},
+    {-9, -9, -128, 8, -128, -128, -128, 10, -128},
+    {-128, -9, -128, 10, -128, -128, -128, 10, -128},
+    {-9, -128, -128, 8, -128, -128, -128, 10, -128},
+    {-128, -128, -128, 0, -128, -128, -128, 10, -128},
+    {-128, -128, -128, 10, -128, -128, -128, 10, -128},
+    {-128, 0, 0, -128, -128, -128, -128, 10, -128},
+    {10, -128, -9, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -9, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {10, 8, -128, -128, -128, -128, -128, 10, -128},
+    {-128, 0, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {10, -128, -128, -128, -128, -128, -128, 10, -128},
+    {6, 0, 6, 0, 0, 6, -128, -5, -128},
+    {-128, -9, -9, -7, -9, -9, -128, -9, -128},
+    {-128, -128, -9, 0, -9, -9, -128, -9, -128},
+    {-7, -128, 0, -7, -7, -7, -128, -7, -128},
+    {-128, -128, 8, -7, 10, 8, -128, 0, -128},
+    {-128, -9, -128, 0, -9, 10, -128, -9, -128},
+    {8, -128, -128, 0, 8, 10, -128, 0, -128},
+    {-128, -128, -128, 0, -9, 10, -128, -9, -128},
+    {-9, -9, -128, -9, -7, -9, -128, -9, -128},
+    {-128, -9, -128, -9, 10, -9, -128, -9, -128},
+    {-9, -128, -128, -9, 8, -9, -128, -9, -128},
+    {-128, -128, -128, -9, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -9, -128},
+    {-128, 0, 0, -128, 0, 8, -128, -7, -128},
+    {-7, -128, 0, -128, 8, 8, -128, -7, -128},
+    {-128, -128, 0, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, 0, 10, -128, 0, -128},
+    {-9, -9, -128, -128, 8, -9, -128, -9, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, 8, -9, -128, -9, -128},
+    {-9, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -9, -128},
+    {-7, -9, -9, -128, -9, -9, -128, -9, -128},
+    {-128, 8, 8, -128, 10, 8, -128, -7, -128},
+    {8, -128, -9, -128, -9, -9, -128, -9, -128},
+    {-128, -128, 8, -128, 10, 8, -128, -7, -128},
+    {8, -9, -128, -128, -9, 10, -128, -9, -128},
+    {8, -128, -128, -128, -9, 10, -128, -9, -128},
+    {-128, -128, -128, -128, 10, 10, -128, 8, -128},
+    {-128, -9, -128, -128, 10, -9, -128, -9, -128},
+    {-9, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -9, -128},
+    {-128, -9, -9, 0, -128, -9, -128, -9, -128},
+    {10, -128, 8, 8, -128, 8, -128, -7, -128},
+    {-128, -128, -9, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, 0, -128, 10, -128, -9, -128},
+    {10, 8, -128, 8, -128, 8, -128, 8, -128},
+    {-128, -9, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, 8, -128, -9, -128, 10, -128},
+    {10, -128, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, 0, -128, -128, 10, -128, -9, -128},
+    {-128, 8, -128, -128, -128, 10, -128, -9, -128},
+    {10, -128, -128, -128, -128, 10, -128, -9, -128},
+    {10, -9, -9, -128, -128, -9, -128, -9, -128},
+    {10, -128, -9, -128, -128, -9, -128, -9, -128},
+    {10, -128, -128, -128, -128, 10, -128, -9, -128},
+    {10, -9, -128, -128, -128, -9, -128, -9, -128},
+    {10, -128, -128, -128, -128, -9, -128, 10, -128},
+    {-9, -9, 0, -9, -128, -9, -128, -9, -128},
+    {-128, -9, 8, -9, -128, -9, -128, -9, -128},
+    {-9, -128, 8, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -9, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -9, -9, -128, -9, -128, -9, -128},
+    {8, 8, -128, 0, -128, 10, -128, 0, -128},
+    {-128, -9, -128, 0, -128, 10, -128, -9, -128},
+    {-128, -128, -128, 0, -128, 10, -128, -9, -128},
+    {-9, -128, -128, -9, -128, 10, -128, 0, -128},
+    {-128, -128, -128, -9, -128, 10, -128, 0, -128},
+    {-9, -9, 0, -128, -128, -9, -128, -9, -128},
+    {-128, -9, 0, -128, -128, -9, -128, -9, -128},
+    {-128, -128, 0, -128, -128, -9, -128, -9, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -9, -128},
+    {-128, -128, -9, -128, -128, -9, -128, -9, -128},
+    {-128, 0, -128, -128, -128, 10, -128, 0, -128},
+    {-9, -128, -128, -128, -128, 10, -128, 0, -128},
+    {-128, -128, -128, -128, -128, 10, -128, 0, -128},
+    {-128, -9, -9, -128, -128, -9, -128, -9, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -9, -128},
+    {-128, -128, 10, -128, -128, -9, -128, -9, -128},
+    {-9, -9, -128, -128, -128, 10, -128, -9, -128},
+    {-128, 10, -128, -128, -128, 10, -128, -9, -128},
+    {10, -128, -128, -128, -128, 10, -128, -9, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -9, -128},
+    {-128, -9, 10, 8, -9, -128, -128, -9, -128},
+    {8, -128, 10, 8, 8, -128, -128, -7, -128},
+    {-128, -128, 10, -9, -9, -128, -128, -9, -128},
+    {-9, -9, -128, -9, 8, -128, -128, -9, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -9, -9, -128, -128, -9, -128},
+    {-9, -128, -128, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -9, -128},
+    {-128, -128, 10, -128, 10, -128, -128, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -9, -128},
+    {8, -9, 10, -128, -9, -128, -128, -9, -128},
+    {8, -128, 10, -128, -9, -128, -128, -9, -128},
+    {-128, -128, 10, -128, 10, -128, -128, 8, -128},
+    {-9, -9, -128, -128, -9, -128, -128, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -128, -128, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -9, -128},
+    {-128, -9, -128, 10, -128, -128, -128, -9, -128},
+    {10, -128, -128, 10, -128, -128, -128, -9, -128},
+    {10, -128, 10, -128, -128, -128, -128, -9, -128},
+    {10, -9, -128, -128, -128, -128, -128, -9, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-9, -9, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -9, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -9, -128},
+    {-9, -128, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -9, -128},
+    {-9, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-9, -9, 10, -128, -128, -128, -128, -9, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -9, -128},
+    {-9, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-7, -7, -7, 0, 0, -128, -128, -7, -128},
+    {-128, 8, 8, 0, 10, -128, -128, -7, -128},
+    {8, -128, 0, 0, 8, -128, -128, -7, -128},
+    {-128, -128, -9, 0, -9, -128, -128, -9, -128},
+    {-128, -128, -7, -7, 10, -128, -128, -7, -128},
+    {8, 0, -128, 0, 0, -128, -128, -7, -128},
+    {-128, -9, -128, 0, -9, -128, -128, -9, -128},
+    {-128, -128, -128, 0, -9, -128, -128, -9, -128},
+    {-7, -128, -128, 0, 0, -128, -128, -7, -128},
+    {-128, -128, -128, 0, 10, -128, -128, 0, -128},
+    {-128, -9, -128, -9, 10, -128, -128, -9, -128},
+    {-9, -128, -128, -9, 8, -128, -128, -9, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -9, -128},
+    {0, 0, 0, -128, 0, -128, -128, 0, -128},
+    {-128, 0, 0, -128, 0, -128, -128, -7, -128},
+    {-128, -128, 0, -128, 0, -128, -128, 0, -128},
+    {-7, -128, 0, -128, 0, -128, -128, -7, -128},
+    {-128, -128, 0, -128, 10, -128, -128, 0, -128},
+    {-128, 0, -128, -128, 0, -128, -128, 0, -128},
+    {0, -128, -128, -128, 0, -128, -128, 0, -128},
+    {-128, -128, -128, -128, 0, -128, -128, 0, -128},
+    {-9, -9, -128, -128, 0, -128, -128, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -128, -128, 8, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -9, -9, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -9, -128, -9, -128, -128, -9, -128},
+    {-128, -128, 10, -128, 10, -128, -128, -9, -128},
+    {-9, -9, -128, -128, -9, -128, -128, -9, -128},
+    {-128, 10, -128, -128, 10, -128, -128, -9, -128},
+    {10, -128, -128, -128, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {10, 8, 0, 0, -128, -128, -128, 8, -128},
+    {-128, -9, -9, 0, -128, -128, -128, -9, -128},
+    {-128, -128, -9, 0, -128, -128, -128, 10, -128},
+    {10, -128, 0, 0, -128, -128, -128, -7, -128},
+    {-128, -9, -128, 0, -128, -128, -128, -9, -128},
+    {10, -128, -128, 0, -128, -128, -128, 0, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -9, -128},
+    {10, 8, -128, 0, -128, -128, -128, 8, -128},
+    {10, -128, -128, 8, -128, -128, -128, 10, -128},
+    {-128, -128, -128, 0, -128, -128, -128, 10, -128},
+    {-128, 0, 0, -128, -128, -128, -128, 0, -128},
+    {10, -128, 0, -128, -128, -128, -128, 0, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {10, 8, -128, -128, -128, -128, -128, 8, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {10, -9, -9, -128, -128, -128, -128, -9, -128},
+    {10, -128, -9, -128, -128, -128, -128, 10, -128},
+    {10, -9, -128, -128, -128, -128, -128, -9, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {10, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -9, -9, -9, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -9, -128},
+    {-9, -9, -128, 0, -128, -128, -128, -9, -128},
+    {-128, 10, -128, 0, -128, -128, -128, -9, -128},
+    {10, -128, -128, 0, -128, -128, -128, -9, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -9, -128, -128, -128, -9, -128},
+    {-9, -9, 0, -128, -128, -128, -128, -9, -128},
+    {-128, -9, 0, -128, -128, -128, -128, -9, -128},
+    {-9, -128, 0, -128, -128, -128, -128, -9, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -9, -128, -128, -128, -128, -9, -128},
+    {0, 0, -128, -128, -128, -128, -128, 0, -128},
+    {-128, 0, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-9, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, 8, -9, -9, -9, 10, -128, -128},
+    {-128, 8, -128, -9, -9, -9, 10, -128, -128},
+    {8, -128, -128, -9, -9, -9, 10, -128, -128},
+    {-128, -9, -9, -128, -9, -9, 10, -128, -128},
+    {8, -128, 8, -128, 8, 8, 10, -128, -128},
+    {-128, -128, -9, -128, -9, -9, 10, -128, -128},
+    {-128, -128, -128, -128, -9, 10, 10, -128, -128},
+    {8, 8, -128, -128, 8, -7, 10, -128, -128},
+    {-128, -9, -128, -128, -9, -9, 10, -128, -128},
+    {-128, -128, -128, -128, 10, -9, 10, -128, -128},
+    {8, -128, -128, -128, -9, -9, 10, -128, -128},
+    {-128, -128, -128, -128, 10, 8, 10, -128, -128},
+    {-128, -128, -9, -128, -128, -9, 10, -128, -128},
+    {-128, 10, -128, -128, -128, -9, 10, -128, -128},
+    {10, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -7, 8, 0, -128, 8, 10, -128, -128},
+    {0, -128, 8, 0, -128, 8, 10, -128, -128},
+    {-128, -128, 8, -9, -128, -9, 10, -128, -128},
+    {-128, -128, -128, 8, -128, 10, 10, -128, -128},
+    {-9, -9, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -9, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -9, 10, -128, -128},
+    {-9, -128, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -128, 8, -128, -128, -9, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -9, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-9, -9, -9, -128, -128, 8, 10, -128, -128},
+    {-128, -9, -9, -128, -128, -9, 10, -128, -128},
+    {-128, -128, -9, -128, -128, -9, 10, -128, -128},
+    {-9, -128, -9, -128, -128, 8, 10, -128, -128},
+    {-128, -128, -9, -128, -128, 8, 10, -128, -128},
+    {-128, -9, -128, -128, -128, 10, 10, -128, -128},
+    {-9, -128, -128, -128, -128, 10, 10, -128, -128},
+    {-128, -128, -128, -128, -128, 10, 10, -128, -128},
+    {-9, -9, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -9, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -128, 10, -128, -9, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -9, -128, 10, -128, -128},
+    {8, -128, -128, -128, -9, -128, 10, -128, -128},
+    {-128, -128, 10, -9, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -9, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, -9, 10, -128, -128, -128, 10, -128, -128},
+    {8, -128, 10, -128, -128, -128, 10, -128, -128},
+    {-128, -128, 10, -128, -128, -128, 10, -128, -128},
+    {-9, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, 8, 0, 0, 8, -128, 10, -128, -128},
+    {8, -128, 0, 0, 8, -128, 10, -128, -128},
+    {-128, -128, 0, -9, -9, -128, 10, -128, -128},
+    {-128, -128, -128, 0, 0, -128, 10, -128, -128},
+    {8, 8, -128, 6, 8, -128, 10, -128, -128},
+    {-128, 8, -128, -9, -9, -128, 10, -128, -128},
+    {-128, -128, -128, 8, 10, -128, 10, -128, -128},
+    {8, -128, -128, -9, -9, -128, 10, -128, -128},
+    {-128, -128, -128, 8, 10, -128, 10, -128, -128},
+    {-128, -128, 0, -128, -9, -128, 10, -128, -128},
+    {-128, 8, -128, -128, -9, -128, 10, -128, -128},
+    {8, -128, -128, -128, -9, -128, 10, -128, -128},
+    {-9, -9, -9, -128, 8, -128, 10, -128, -128},
+    {-128, -9, -9, -128, -9, -128, 10, -128, -128},
+    {-128, -128, -9, -128, 10, -128, 10, -128, -128},
+    {-9, -128, -9, -128, 8, -128, 10, -128, -128},
+    {-128, -128, -9, -128, 10, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -9, -128, 10, -128, -128},
+    {-9, -128, -128, -128, 8, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -9, -128, 10, -128, -128},
+    {-9, -9, -128, -128, 8, -128, 10, -128, -128},
+    {-128, -9, -128, -128, 10, -128, 10, -128, -128},
+    {-9, -128, -128, -128, 10, -128, 10, -128, -128},
+    {-128, -128, -128, -128, 10, -128, 10, -128, -128},
+    {-128, -128, -128, -128, 10, -128, 10, -128, -128},
+    {-128, -128, 0, -9, -128, -128, 10, -128, -128},
+    {-128, 10, -128, -9, -128, -128, 10, -128, -128},
+    {10, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, 10, -9, -128, -128, -128, 10, -128, -128},
+    {10, -128, 8, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -9, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {10, 10, -128, -128, -128, -128, 10, -128, -128},
+    {-128, 10, -128, -128, -128, -128, 10, -128, -128},
+    {10, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -9, -9, 0, -128, -128, 10, -128, -128},
+    {-128, -9, -9, 0, -128, -128, 10, -128, -128},
+    {-128, -128, -9, 0, -128, -128, 10, -128, -128},
+    {-9, -128, -9, 0, -128, -128, 10, -128, -128},
+    {-128, -128, -9, 0, -128, -128, 10, -128, -128},
+    {-128, -9, -128, 0, -128, -128, 10, -128, -128},
+    {-9, -128, -128, 0, -128, -128, 10, -128, -128},
+    {-128, -128, -128, 0, -128, -128, 10, -128, -128},
+    {-9, -9, -128, -9, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -9, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, 0, 0, -128, -128, -128, 10, -128, -128},
+    {0, -128, 0, -128, -128, -128, 10, -128, -128},
+    {-128, -128, 0, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -9, -7, -9, -9, -128, -128, -128},
+    {0, -128, 0, -7, -7, -7, -128, -128, -128},
+    {-128, -128, -9, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, 0, -9, 10, -128, -128, -128},
+    {-9, -9, -128, -9, 8, -9, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-9, -128, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-128, -128, 0, -128, -9, -9, -128, -128, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -128, -128},
+    {-9, -128, -128, -128, -9, -9, -128, -128, -128},
+    {-7, -9, -9, -128, -9, -9, -128, -128, -128},
+    {-7, -128, -9, -128, -9, -9, -128, -128, -128},
+    {-128, -128, 8, -128, 10, 8, -128, -128, -128},
+    {8, -128, -128, -128, -9, 10, -128, -128, -128},
+    {-9, -9, -128, -128, -9, -9, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -9, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -9, -9, -128, -9, -128, -128, -128},
+    {-128, 10, -128, -9, -128, -9, -128, -128, -128},
+    {10, -128, -128, -9, -128, -9, -128, -128, -128},
+    {10, -128, -9, -128, -128, -9, -128, -128, -128},
+    {10, 10, -128, -128, -128, -9, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-9, -9, 0, -9, -128, -9, -128, -128, -128},
+    {-128, -9, -9, -9, -128, -9, -128, -128, -128},
+    {-128, -128, -9, -9, -128, -9, -128, -128, -128},
+    {-9, -128, 0, -9, -128, -9, -128, -128, -128},
+    {-128, -128, 0, -9, -128, -9, -128, -128, -128},
+    {-128, -9, -128, 0, -128, 10, -128, -128, -128},
+    {0, -128, -128, 0, -128, 10, -128, -128, -128},
+    {-128, -128, -128, 0, -128, 10, -128, -128, -128},
+    {-128, -9, 0, -128, -128, -9, -128, -128, -128},
+    {-9, -128, 0, -128, -128, -9, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-9, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -9, -128, -128, -9, -128, -128, -128},
+    {-9, -9, -128, -128, -128, 10, -128, -128, -128},
+    {-9, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, 10, -9, -9, -128, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -128, -128},
+    {-9, -128, -128, -9, -9, -128, -128, -128, -128},
+    {8, -128, 10, -128, -9, -128, -128, -128, -128},
+    {-9, -9, -128, -128, -9, -128, -128, -128, -128},
+    {-9, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 10, -9, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-7, -7, -7, 0, 8, -128, -128, -128, -128},
+    {-128, -9, -9, -7, -9, -128, -128, -128, -128},
+    {-128, -128, -9, 0, 10, -128, -128, -128, -128},
+    {-7, -128, -7, -7, -7, -128, -128, -128, -128},
+    {-128, -128, 0, 0, 10, -128, -128, -128, -128},
+    {-128, -9, -128, 0, -9, -128, -128, -128, -128},
+    {0, -128, -128, 0, 0, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -9, -128, -128, -128, -128},
+    {-9, -9, -128, -9, 8, -128, -128, -128, -128},
+    {-128, -9, -128, -9, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, 0, 0, -128, 0, -128, -128, -128, -128},
+    {0, -128, 0, -128, 0, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-9, -9, -128, -128, 8, -128, -128, -128, -128},
+    {-128, -9, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -9, -9, -128, -9, -128, -128, -128, -128},
+    {-128, -9, -9, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-9, -9, -128, -128, -9, -128, -128, -128, -128},
+    {-9, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, 10, -9, 0, -128, -128, -128, -128, -128},
+    {10, -128, 0, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {10, 10, -128, 8, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -9, -128, -128, -128, -128, -128},
+    {10, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {10, 10, -9, -128, -128, -128, -128, -128, -128},
+    {10, -128, -9, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {10, 10, -128, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -9, -9, -9, -128, -128, -128, -128, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-9, -9, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -9, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-9, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-9, -9, 0, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 0, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {0, 0, 6, 0, 6, 6, 0, -128, -128},
+    {-128, 0, 0, -7, 0, -5, -7, -128, -128},
+    {-128, -128, 0, 0, 0, 0, 0, -128, -128},
+    {-9, -128, -9, -9, 6, -9, -9, -128, -128},
+    {-128, -128, -9, -9, 10, -9, -9, -128, -128},
+    {-128, 0, -128, 0, 8, 10, 8, -128, -128},
+    {-9, -128, -128, -9, 8, 10, -9, -128, -128},
+    {-128, -128, -128, -9, 8, 10, -9, -128, -128},
+    {-7, 0, -128, -7, 0, -7, -7, -128, -128},
+    {-128, 0, -128, 8, 10, -7, 8, -128, -128},
+    {0, -128, -128, 0, 0, 0, 0, -128, -128},
+    {-128, -128, -128, 0, 0, -7, 0, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -9, -128, -128},
+    {-128, 0, 0, -128, 0, 8, -7, -128, -128},
+    {-9, -128, -9, -128, 8, -9, -9, -128, -128},
+    {-128, -128, -9, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, 8, 10, -9, -128, -128},
+    {8, 0, -128, -128, 8, -7, 0, -128, -128},
+    {-128, 0, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, 0, 0, 0, -128, -128},
+    {-9, -128, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -9, 10, -128, -128},
+    {-7, 0, 6, -128, 0, -5, -7, -128, -128},
+    {-128, 8, 8, -128, 10, 8, -7, -128, -128},
+    {8, -128, 8, -128, 0, 0, 0, -128, -128},
+    {-128, -128, -9, -128, -9, -9, 0, -128, -128},
+    {-128, -128, -9, -128, 10, -9, -9, -128, -128},
+    {8, 8, -128, -128, 8, 10, 8, -128, -128},
+    {-128, -9, -128, -128, -9, 10, 8, -128, -128},
+    {-128, -128, -128, -128, -9, 10, 8, -128, -128},
+    {-9, -128, -128, -128, 8, 10, -9, -128, -128},
+    {-128, -128, -128, -128, 10, 10, -9, -128, -128},
+    {-128, -7, -128, -128, 10, -7, -7, -128, -128},
+    {-7, -128, -128, -128, 0, -7, 0, -128, -128},
+    {-128, -128, -128, -128, 10, 0, 0, -128, -128},
+    {-128, 0, 8, 0, -128, 8, 0, -128, -128},
+    {10, -128, 8, 8, -128, 8, 8, -128, -128},
+    {-128, -128, 8, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, 8, -128, 10, 10, -128, -128},
+    {10, 0, -128, 8, -128, 8, 0, -128, -128},
+    {-128, 0, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, 0, -128, 0, 0, -128, -128},
+    {10, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -128, 8, -128, -128, 10, -9, -128, -128},
+    {-128, 0, -128, -128, -128, 10, -9, -128, -128},
+    {10, -128, -128, -128, -128, 10, -9, -128, -128},
+    {10, 0, 8, -128, -128, 8, 8, -128, -128},
+    {-128, -9, -9, -128, -128, -9, 0, -128, -128},
+    {-128, -128, -9, -128, -128, -9, 0, -128, -128},
+    {10, -128, 8, -128, -128, 8, 8, -128, -128},
+    {-128, -9, -128, -128, -128, 10, 10, -128, -128},
+    {10, -128, -128, -128, -128, 10, 10, -128, -128},
+    {-128, -128, -128, -128, -128, 10, 10, -128, -128},
+    {10, 0, -128, -128, -128, -7, 0, -128, -128},
+    {10, -128, -128, -128, -128, 0, 0, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 0, -128, -128},
+    {-9, 0, -9, -9, -128, -9, -9, -128, -128},
+    {-128, 0, -9, -9, -128, -9, -9, -128, -128},
+    {0, -128, 8, 0, -128, 0, 0, -128, -128},
+    {-128, -128, 0, 0, -128, 0, 0, -128, -128},
+    {-9, 8, -128, -9, -128, 10, -9, -128, -128},
+    {-128, 0, -128, -9, -128, 10, -9, -128, -128},
+    {-128, -128, -128, 0, -128, 10, 0, -128, -128},
+    {-128, -9, -128, -9, -128, -9, -9, -128, -128},
+    {-9, -128, -128, -9, -128, -9, 0, -128, -128},
+    {-128, -128, -128, -9, -128, -9, 0, -128, -128},
+    {-9, 0, -9, -128, -128, -9, -9, -128, -128},
+    {-128, 0, -9, -128, -128, -9, -9, -128, -128},
+    {-128, -128, 0, -128, -128, 0, 0, -128, -128},
+    {-128, 0, -128, -128, -128, 10, -9, -128, -128},
+    {-9, -9, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -9, -128, -128, -128, -9, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -9, 0, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 0, -128, -128},
+    {-128, -9, -9, -128, -128, -9, -9, -128, -128},
+    {-9, -128, -9, -128, -128, 0, -9, -128, -128},
+    {-128, -128, 10, -128, -128, 0, -9, -128, -128},
+    {-9, -9, -128, -128, -128, 10, -9, -128, -128},
+    {-128, 10, -128, -128, -128, 10, -9, -128, -128},
+    {10, -128, -128, -128, -128, 10, -9, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-128, 0, 10, 8, 8, -128, 0, -128, -128},
+    {-9, -128, 10, -9, 8, -128, -9, -128, -128},
+    {-128, -128, 10, -9, -9, -128, -9, -128, -128},
+    {-7, 0, -128, -7, 8, -128, -7, -128, -128},
+    {-128, -7, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, 0, 0, -128, 0, -128, -128},
+    {-9, -128, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -9, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -9, -128, -128},
+    {-128, 0, -128, -128, 10, -128, -9, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -9, -128, -128},
+    {8, 0, 10, -128, 8, -128, 0, -128, -128},
+    {-128, -9, 10, -128, -9, -128, 0, -128, -128},
+    {-128, -128, 10, -128, -9, -128, 0, -128, -128},
+    {-9, -128, 10, -128, 8, -128, -9, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -9, -128, -128},
+    {-7, -7, -128, -128, -7, -128, -7, -128, -128},
+    {-128, 0, -128, -128, 10, -128, 0, -128, -128},
+    {0, -128, -128, -128, 0, -128, 0, -128, -128},
+    {-128, -128, -128, -128, -9, -128, 0, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, 10, 10, -128, -128, -9, -128, -128},
+    {-128, 0, -128, 10, -128, -128, -9, -128, -128},
+    {10, -128, -128, 10, -128, -128, -9, -128, -128},
+    {-128, -9, 10, -128, -128, -128, 0, -128, -128},
+    {10, -128, 10, -128, -128, -128, 8, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -9, -128, -128},
+    {10, 0, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {10, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-9, 0, 10, -9, -128, -128, -9, -128, -128},
+    {-128, 0, 10, -9, -128, -128, -9, -128, -128},
+    {-128, -128, 10, 0, -128, -128, 0, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -9, -128, -128},
+    {-128, -9, -128, -9, -128, -128, -9, -128, -128},
+    {-9, -128, -128, -9, -128, -128, 0, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 0, -128, -128},
+    {-128, 0, 10, -128, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -9, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-9, 0, 10, -128, -128, -128, -9, -128, -128},
+    {-128, 0, 10, -128, -128, -128, -9, -128, -128},
+    {0, -128, 10, -128, -128, -128, 0, -128, -128},
+    {-128, -128, 10, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -128, -128, -128, -128, -9, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-7, 0, -7, 0, 0, -128, -7, -128, -128},
+    {-128, 8, 8, 8, 10, -128, 8, -128, -128},
+    {8, -128, 0, 0, 0, -128, 0, -128, -128},
+    {-128, -128, -7, 0, 0, -128, 0, -128, -128},
+    {-128, -128, -9, -9, 10, -128, -9, -128, -128},
+    {8, 0, -128, 0, 8, -128, -7, -128, -128},
+    {-128, -7, -128, 0, 0, -128, -7, -128, -128},
+    {-128, -128, -128, 0, 0, -128, 0, -128, -128},
+    {-9, -128, -128, -9, 8, -128, -9, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -9, -128, -128},
+    {-128, -7, -128, 8, 10, -128, 8, -128, -128},
+    {-7, -128, -128, 0, 0, -128, 0, -128, -128},
+    {-128, -128, -128, 8, 10, -128, 8, -128, -128},
+    {8, 0, 0, -128, 0, -128, 0, -128, -128},
+    {-128, 0, 0, -128, 0, -128, -7, -128, -128},
+    {-128, -128, 0, -128, 0, -128, 0, -128, -128},
+    {-9, -128, -9, -128, 0, -128, -9, -128, -128},
+    {-128, -128, -9, -128, 10, -128, 10, -128, -128},
+    {-128, 0, -128, -128, 0, -128, 0, -128, -128},
+    {-9, -128, -128, -128, 8, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -9, -128, -128},
+    {8, 0, -128, -128, 0, -128, 0, -128, -128},
+    {-128, 8, -128, -128, 10, -128, 10, -128, -128},
+    {8, -128, -128, -128, 0, -128, 0, -128, -128},
+    {-128, -128, -128, -128, 0, -128, 0, -128, -128},
+    {-128, -128, -128, -128, 10, -128, 10, -128, -128},
+    {-128, -9, -9, -128, 10, -128, -9, -128, -128},
+    {-9, -128, -9, -128, 0, -128, -9, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -9, -128, -128},
+    {-9, -9, -128, -128, 8, -128, -9, -128, -128},
+    {-128, 10, -128, -128, 10, -128, -9, -128, -128},
+    {10, -128, -128, -128, 8, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {10, 0, 8, 0, -128, -128, 8, -128, -128},
+    {-128, 0, 0, 0, -128, -128, 0, -128, -128},
+    {-128, -128, 0, 0, -128, -128, 0, -128, -128},
+    {10, -128, 8, 0, -128, -128, 8, -128, -128},
+    {-128, 0, -128, 0, -128, -128, 10, -128, -128},
+    {10, -128, -128, 8, -128, -128, 10, -128, -128},
+    {-128, -128, -128, 0, -128, -128, 10, -128, -128},
+    {10, 0, -128, 0, -128, -128, 0, -128, -128},
+    {10, -128, -128, 0, -128, -128, 0, -128, -128},
+    {-128, -128, -128, 0, -128, -128, 0, -128, -128},
+    {-128, 0, 0, -128, -128, -128, 0, -128, -128},
+    {10, -128, 8, -128, -128, -128, 8, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {10, 0, -128, -128, -128, -128, 0, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {10, -128, -128, -128, -128, -128, -9, -128, -128},
+    {10, 0, 8, -128, -128, -128, 8, -128, -128},
+    {10, -128, 8, -128, -128, -128, 8, -128, -128},
+    {-128, -128, -9, -128, -128, -128, 0, -128, -128},
+    {10, 8, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {10, -128, -128, -128, -128, -128, 10, -128, -128},
+    {10, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -9, -9, -128, -128, -9, -128, -128},
+    {-9, -128, -9, 0, -128, -128, -9, -128, -128},
+    {-128, -128, 10, 8, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -9, -128, -128},
+    {-128, 10, -128, -9, -128, -128, -9, -128, -128},
+    {10, -128, -128, 0, -128, -128, -9, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -9, -128, -128, -9, -128, -128},
+    {-9, 0, -9, -128, -128, -128, -9, -128, -128},
+    {-128, 8, -9, -128, -128, -128, 10, -128, -128},
+    {8, -128, 0, -128, -128, -128, 0, -128, -128},
+    {-128, -128, 0, -128, -128, -128, 0, -128, -128},
+    {-9, 0, -128, -128, -128, -128, -9, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, 0, 8, -7, 0, 0, -128, -128, -128},
+    {-9, -128, -9, -9, 8, -9, -128, -128, -128},
+    {-128, -128, -9, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, 10, -128, -128, -128},
+    {8, 0, -128, 0, 0, -7, -128, -128, -128},
+    {-128, 0, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, 0, 0, 0, -128, -128, -128},
+    {-9, -128, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, 10, 10, -9, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -9, -128, -128, -128},
+    {-128, 0, -128, -128, -9, -9, -128, -128, -128},
+    {10, -128, -128, -128, -9, -9, -128, -128, -128},
+    {-7, 0, 8, -128, 8, 0, -128, -128, -128},
+    {-128, 0, 8, -128, 0, 0, -128, -128, -128},
+    {-128, -128, 8, -128, 0, 0, -128, -128, -128},
+    {-9, -128, -9, -128, 8, -9, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -9, -128, -128, -128},
+    {-128, 8, -128, -128, 10, 10, -128, -128, -128},
+    {-9, -128, -128, -128, 10, 10, -128, -128, -128},
+    {-128, -128, -128, -128, 10, 10, -128, -128, -128},
+    {-7, 0, -128, -128, 0, -7, -128, -128, -128},
+    {-128, 0, -128, -128, 10, 0, -128, -128, -128},
+    {0, -128, -128, -128, 0, 0, -128, -128, -128},
+    {-128, -128, -128, -128, 0, 0, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -9, -128, -128, -128},
+    {-128, 0, -128, -9, -128, -9, -128, -128, -128},
+    {10, -128, -128, -9, -128, -9, -128, -128, -128},
+    {-128, 0, 10, -128, -128, 0, -128, -128, -128},
+    {10, -128, 10, -128, -128, 8, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -9, -128, -128, -128},
+    {10, 0, -128, -128, -128, 0, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-9, 0, -9, -9, -128, -9, -128, -128, -128},
+    {-128, 0, -9, -9, -128, -9, -128, -128, -128},
+    {-128, -128, 0, 0, -128, 0, -128, -128, -128},
+    {-128, 0, -128, -9, -128, 10, -128, -128, -128},
+    {-9, 0, -128, -9, -128, -9, -128, -128, -128},
+    {-128, 0, -128, 10, -128, -9, -128, -128, -128},
+    {0, -128, -128, 0, -128, 0, -128, -128, -128},
+    {-128, -128, -128, 0, -128, 0, -128, -128, -128},
+    {-128, 0, -9, -128, -128, -9, -128, -128, -128},
+    {10, 0, -128, -128, -128, -9, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-9, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-9, -128, -9, -128, -128, 0, -128, -128, -128},
+    {-128, -128, -9, -128, -128, 0, -128, -128, -128},
+    {-9, -9, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -9, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -9, -128, -128, -128, -9, -128, -128, -128},
+    {-9, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -128, 10, -9, -9, -128, -128, -128, -128},
+    {-128, 0, -128, -9, -9, -128, -128, -128, -128},
+    {-9, -128, -128, -9, -9, -128, -128, -128, -128},
+    {-128, 0, 10, -128, 0, -128, -128, -128, -128},
+    {-9, -128, 10, -128, 8, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -9, -128, -128, -128, -128},
+    {0, 0, -128, -128, 0, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-9, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 0, 10, -9, -128, -128, -128, -128, -128},
+    {-9, 0, -128, -9, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {-9, 0, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 0, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-9, 0, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {8, 0, -7, 0, 8, -128, -128, -128, -128},
+    {-128, 0, -7, -7, 0, -128, -128, -128, -128},
+    {-128, -128, 0, 0, 0, -128, -128, -128, -128},
+    {-9, -128, -9, -9, 8, -128, -128, -128, -128},
+    {-128, -128, -9, 10, 10, -128, -128, -128, -128},
+    {-128, 0, -128, 0, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {8, 0, -128, 0, 0, -128, -128, -128, -128},
+    {-128, 8, -128, 10, 10, -128, -128, -128, -128},
+    {8, -128, -128, 0, 0, -128, -128, -128, -128},
+    {-128, -128, -128, 0, 0, -128, -128, -128, -128},
+    {-128, -128, -128, 10, 10, -128, -128, -128, -128},
+    {-128, 0, 0, -128, 0, -128, -128, -128, -128},
+    {10, -128, -9, -128, 8, -128, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {10, 0, -128, -128, 0, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {10, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-9, -9, -9, -128, 8, -128, -128, -128, -128},
+    {-128, -9, -9, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -9, -128, 8, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-9, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, 0, 10, 0, -128, -128, -128, -128, -128},
+    {10, -128, 10, 8, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {10, 0, -128, 0, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {10, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {10, 8, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 0, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {10, -128, 10, -128, -128, -128, -128, -128, -128},
+    {10, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -9, -9, 10, -128, -128, -128, -128, -128},
+    {-9, -128, -9, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -9, 0, -128, -128, -128, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -9, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -9, -128, 10, -128, -128, -128, -128, -128},
+    {-9, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {10, 0, -9, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-7, 0, 6, -7, 0, 6, -128, -128, -128},
+    {-128, 8, 8, -7, 10, 8, -128, -128, -128},
+    {8, -128, 8, 6, 0, 6, -128, -128, -128},
+    {-128, -128, -9, 0, -9, -9, -128, -128, -128},
+    {-128, -128, -9, -9, 10, -9, -128, -128, -128},
+    {8, 8, -128, 6, 8, 10, -128, -128, -128},
+    {-128, -9, -128, 0, -9, 10, -128, -128, -128},
+    {-128, -128, -128, 0, -9, 10, -128, -128, -128},
+    {-9, -128, -128, -9, 8, 10, -128, -128, -128},
+    {-128, -128, -128, -9, 10, 10, -128, -128, -128},
+    {-128, -9, -128, -9, 10, -9, -128, -128, -128},
+    {-9, -128, -128, -9, 0, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-7, 6, 6, -128, 8, 8, -128, -128, -128},
+    {-128, 0, 0, -128, 0, 8, -128, -128, -128},
+    {-128, -128, 0, -128, 0, 8, -128, -128, -128},
+    {-9, -128, -9, -128, 8, -9, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -9, -128, -128, -128},
+    {-128, 0, -128, -128, 0, 10, -128, -128, -128},
+    {-9, -128, -128, -128, 8, 10, -128, -128, -128},
+    {-128, -128, -128, -128, 0, 10, -128, -128, -128},
+    {-9, -9, -128, -128, 8, -9, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -9, -128, -128, -128},
+    {-9, -128, -128, -128, 8, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, 8, 8, -128, 10, 8, -128, -128, -128},
+    {8, -128, -9, -128, -9, -9, -128, -128, -128},
+    {-128, -128, 10, -128, 10, 8, -128, -128, -128},
+    {8, -9, -128, -128, -9, 10, -128, -128, -128},
+    {-128, 10, -128, -128, 10, 10, -128, -128, -128},
+    {10, -128, -128, -128, -9, 10, -128, -128, -128},
+    {-128, -128, -128, -128, 10, 10, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {10, 0, 8, 8, -128, 8, -128, -128, -128},
+    {-128, -9, -9, 0, -128, -9, -128, -128, -128},
+    {-128, -128, -9, 0, -128, -9, -128, -128, -128},
+    {10, -128, 8, 8, -128, 8, -128, -128, -128},
+    {-128, -9, -128, 0, -128, 10, -128, -128, -128},
+    {10, -128, -128, 8, -128, 10, -128, -128, -128},
+    {-128, -128, -128, 0, -128, 10, -128, -128, -128},
+    {10, 0, -128, 8, -128, 8, -128, -128, -128},
+    {10, -128, -128, 8, -128, 8, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -9, -128, -128, -128},
+    {-128, 0, 0, -128, -128, 10, -128, -128, -128},
+    {10, -128, 8, -128, -128, 10, -128, -128, -128},
+    {-128, -128, 0, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {10, 8, -128, -128, -128, 10, -128, -128, -128},
+    {-128, 0, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {10, -128, -128, -128, -128, 10, -128, -128, -128},
+    {10, -9, -9, -128, -128, -9, -128, -128, -128},
+    {10, -128, -9, -128, -128, -9, -128, -128, -128},
+    {10, -9, -128, -128, -128, 10, -128, -128, -128},
+    {10, -128, -128, -128, -128, 10, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -9, -9, -9, -128, -9, -128, -128, -128},
+    {-9, -128, 8, -9, -128, -9, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -9, -128, -128, -128},
+    {-9, 8, -128, -9, -128, 10, -128, -128, -128},
+    {-128, 10, -128, -9, -128, 10, -128, -128, -128},
+    {10, -128, -128, 8, -128, 10, -128, -128, -128},
+    {-128, -128, -128, 0, -128, 10, -128, -128, -128},
+    {-9, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-9, -128, 8, -128, -128, -9, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -9, -128, -128, -128},
+    {-9, 8, -128, -128, -128, 10, -128, -128, -128},
+    {-128, 0, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -9, -128, -128, -128},
+    {-128, 10, -128, -128, -128, 10, -128, -128, -128},
+    {10, -128, -128, -128, -128, 10, -128, -128, -128},
+    {8, 6, 10, 8, 8, -128, -128, -128, -128},
+    {-128, -9, 10, 8, -9, -128, -128, -128, -128},
+    {-128, -128, 10, 8, -9, -128, -128, -128, -128},
+    {-9, -128, 10, -9, 8, -128, -128, -128, -128},
+    {-128, -128, 10, -9, 10, -128, -128, -128, -128},
+    {-9, -9, -128, -9, 8, -128, -128, -128, -128},
+    {-128, -9, -128, -9, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -9, 8, -128, -128, -128, -128},
+    {-128, -128, -128, -9, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, 8, 10, -128, 10, -128, -128, -128, -128},
+    {-9, -128, 10, -128, 10, -128, -128, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -128, -128, -128},
+    {-9, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {8, -9, 10, -128, -9, -128, -128, -128, -128},
+    {-128, 8, 10, -128, 10, -128, -128, -128, -128},
+    {8, -128, 10, -128, -9, -128, -128, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, 10, 10, -128, -128, -128, -128, -128},
+    {10, -128, 10, 10, -128, -128, -128, -128, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -128, -128},
+    {10, 8, -128, 10, -128, -128, -128, -128, -128},
+    {-128, -9, -128, 10, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {10, -128, -128, 10, -128, -128, -128, -128, -128},
+    {10, -9, 10, -128, -128, -128, -128, -128, -128},
+    {10, -128, 10, -128, -128, -128, -128, -128, -128},
+    {10, -9, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-9, -9, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -9, 10, -9, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-9, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 8, 8, -7, 10, -128, -128, -128, -128},
+    {8, -128, 0, 0, 0, -128, -128, -128, -128},
+    {-128, -128, 10, 8, 10, -128, -128, -128, -128},
+    {8, 0, -128, 0, 0, -128, -128, -128, -128},
+    {-128, 10, -128, 8, 10, -128, -128, -128, -128},
+    {10, -128, -128, 0, 0, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-7, 0, 0, -128, 0, -128, -128, -128, -128},
+    {-128, 8, 8, -128, 10, -128, -128, -128, -128},
+    {8, -128, 0, -128, 0, -128, -128, -128, -128},
+    {-128, -128, 0, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {8, 0, -128, -128, 0, -128, -128, -128, -128},
+    {-128, 0, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -128, -128, -128},
+    {-128, 10, -128, -128, 10, -128, -128, -128, -128},
+    {10, -128, -128, -128, -9, -128, -128, -128, -128},
+    {10, 0, 0, 0, -128, -128, -128, -128, -128},
+    {10, -128, 0, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -9, 0, -128, -128, -128, -128, -128},
+    {10, 0, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -9, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {10, -128, -128, 0, -128, -128, -128, -128, -128},
+    {10, -128, -128, 0, -128, -128, -128, -128, -128},
+    {10, 0, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 0, 0, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {10, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {10, 0, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -9, -128, -128, -128, -128, -128, -128},
+    {10, -9, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -9, -128, -128, -128, -128, -128},
+    {10, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -9, -9, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-9, 0, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-5, -5, -5, -5, 0, -5, -5, -5, -128},
+    {-128, -5, 6, -5, 0, 0, 6, 0, -128},
+    {-5, -128, 6, -5, 0, -5, 0, -5, -128},
+    {-128, -128, -9, -9, 0, -9, -9, -9, -128},
+    {-128, -128, -7, -5, 0, -7, 0, 0, -128},
+    {6, 6, -128, 0, 0, -5, 6, 0, -128},
+    {-128, -9, -128, -9, -7, -9, -9, -9, -128},
+    {-128, -128, -128, -9, 8, -9, -9, -9, -128},
+    {-7, -128, -128, -7, 0, -7, -7, 0, -128},
+    {-128, -128, -128, 0, 0, -7, 8, 0, -128},
+    {-128, -9, -128, -9, -9, -7, -9, -9, -128},
+    {-9, -128, -128, -9, -9, -7, -9, -9, -128},
+    {-128, -128, -128, -9, -9, -7, -9, -9, -128},
+    {-5, -5, 0, -128, 0, -5, 6, -5, -128},
+    {-128, -9, -9, -128, 0, -9, -9, -9, -128},
+    {-128, -128, -9, -128, 8, -9, -9, -9, -128},
+    {-5, -128, -7, -128, 0, -7, -7, -7, -128},
+    {-128, -128, 0, -128, 8, 8, 10, 0, -128},
+    {-128, -9, -128, -128, 8, -9, -9, -9, -128},
+    {0, -128, -128, -128, 8, -7, 8, 0, -128},
+    {-128, -128, -128, -128, 8, -9, -9, -9, -128},
+    {-9, -9, -128, -128, -9, -7, -9, -9, -128},
+    {-128, -9, -128, -128, -9, 8, 10, -9, -128},
+    {-9, -128, -128, -128, -9, -7, -9, -9, -128},
+    {-128, -128, -128, -128, -9, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -9, 8, 10, -9, -128},
+    {-128, -5, 0, -128, 0, 0, -7, -7, -128},
+    {-5, -128, -7, -128, 0, -7, -7, -7, -128},
+    {-128, -128, 10, -128, 8, 0, 0, 8, -128},
+    {0, -7, -128, -128, -7, -7, -7, -7, -128},
+    {-128, 10, -128, -128, 8, 0, 8, 0, -128},
+    {10, -128, -128, -128, 8, -7, 8, 8, -128},
+    {-128, -128, -128, -128, -9, -9, -9, -9, -128},
+    {-128, -128, -128, -128, 0, -7, -7, 0, -128},
+    {-128, -128, -128, -128, -9, -7, -9, -9, -128},
+    {0, 0, 0, 0, -128, 0, 0, 0, -128},
+    {-128, 0, -7, 0, -128, 0, -7, 0, -128},
+    {-128, -128, 8, 8, -128, 8, 8, 10, -128},
+    {0, -128, 0, 0, -128, 0, -7, -7, -128},
+    {-128, -128, 0, 8, -128, 0, 8, 0, -128},
+    {-128, 8, -128, 8, -128, 8, 10, 8, -128},
+    {0, -128, -128, 8, -128, 8, 10, 0, -128},
+    {-128, -128, -128, 8, -128, 8, 10, 0, -128},
+    {-9, -9, -128, -9, -128, 0, -9, -9, -128},
+    {-128, -9, -128, -9, -128, 0, -9, -9, -128},
+    {-9, -128, -128, -9, -128, 8, -9, 10, -128},
+    {-128, -128, -128, -9, -128, 8, -9, 10, -128},
+    {-128, -128, -128, -9, -128, 0, -9, -9, -128},
+    {-128, 8, 8, -128, -128, 10, 8, 8, -128},
+    {8, -128, 8, -128, -128, 10, 8, 0, -128},
+    {-128, -128, 8, -128, -128, 10, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, 10, 8, -128},
+    {-9, -9, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -9, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, -9, 10, -128},
+    {-9, -128, -128, -128, -128, 10, -9, -9, -128},
+    {-128, -128, -128, -128, -128, 10, 10, -9, -128},
+    {0, 0, -7, -128, -128, -7, 0, 0, -128},
+    {-128, 8, 8, -128, -128, 0, 0, 0, -128},
+    {8, -128, 8, -128, -128, 0, 8, 10, -128},
+    {-128, -128, -9, -128, -128, -9, 8, 10, -128},
+    {-128, -128, 0, -128, -128, 0, 0, 0, -128},
+    {8, 8, -128, -128, -128, -7, 10, 8, -128},
+    {-128, -9, -128, -128, -128, -9, 10, -9, -128},
+    {-128, -128, -128, -128, -128, -9, 10, 10, -128},
+    {0, -128, -128, -128, -128, -7, 10, 0, -128},
+    {-128, -128, -128, -128, -128, 0, 10, 0, -128},
+    {-128, -9, -128, -128, -128, 0, -9, -9, -128},
+    {-9, -128, -128, -128, -128, 0, -9, 10, -128},
+    {-128, -128, -128, -128, -128, 0, -9, 10, -128},
+    {-128, -7, 0, -7, -128, -7, 0, -7, -128},
+    {-7, -128, -9, -9, -128, -9, -9, -9, -128},
+    {-128, -128, 10, 8, -128, 0, 8, -7, -128},
+    {0, -9, -128, -9, -128, -9, -9, -9, -128},
+    {-128, 10, -128, 8, -128, 0, 8, 0, -128},
+    {10, -128, -128, -9, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -9, -9, 0, -128},
+    {-128, -128, -128, -9, -128, -9, -9, -9, -128},
+    {-7, -9, -9, -128, -128, -9, -9, -9, -128},
+    {-128, 8, 8, -128, -128, -7, 10, 0, -128},
+    {8, -128, -9, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -9, -128, -128, -9, 10, 0, -128},
+    {8, -9, -128, -128, -128, -9, -9, -9, -128},
+    {-9, -128, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -9, 10, 0, -128},
+    {-128, -9, -128, -128, -128, -9, 10, -9, -128},
+    {-9, -128, -128, -128, -128, -9, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -9, -128},
+    {-128, -128, 10, -128, -128, 0, -9, -9, -128},
+    {-128, 10, -128, -128, -128, 0, -9, -9, -128},
+    {10, -128, -128, -128, -128, -9, -9, -9, -128},
+    {0, -5, -5, -5, 0, -128, 0, 0, -128},
+    {-128, -9, -9, -9, 0, -128, -9, -9, -128},
+    {-128, -128, -9, -9, 8, -128, -9, -9, -128},
+    {-7, -128, -7, -7, 0, -128, -7, -7, -128},
+    {-128, -128, -7, 8, 0, -128, 0, 0, -128},
+    {-128, -9, -128, -9, 8, -128, -9, -9, -128},
+    {-7, -128, -128, -7, 8, -128, -7, 0, -128},
+    {-128, -128, -128, -9, 8, -128, -9, -9, -128},
+    {-7, -7, -128, -7, 0, -128, -7, -7, -128},
+    {-128, -7, -128, 8, 0, -128, 0, 0, -128},
+    {-7, -128, -128, -7, 8, -128, 0, -7, -128},
+    {-128, -128, -128, -9, 8, -128, -9, -9, -128},
+    {-128, -128, -128, 8, 0, -128, 0, 0, -128},
+    {-128, -9, -9, -128, 10, -128, -9, -9, -128},
+    {8, -128, -7, -128, 10, -128, 8, 0, -128},
+    {-128, -128, -9, -128, 10, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -9, -128},
+    {8, -7, -128, -128, 10, -128, 8, -7, -128},
+    {-128, -9, -128, -128, 10, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -9, -128},
+    {8, -128, -128, -128, 10, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 10, -128, 10, 8, -128},
+    {0, -7, -7, -128, -7, -128, 0, -7, -128},
+    {-128, 0, 0, -128, 0, -128, 0, 0, -128},
+    {0, -128, -7, -128, 0, -128, 0, 0, -128},
+    {-128, -128, -9, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -7, -128, 0, -128, 0, 0, -128},
+    {0, -7, -128, -128, -7, -128, 0, -7, -128},
+    {-128, -9, -128, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -9, -128},
+    {-7, -128, -128, -128, -7, -128, -7, -7, -128},
+    {-128, -128, -128, -128, 0, -128, 0, 0, -128},
+    {-128, -7, -128, -128, 0, -128, 0, 0, -128},
+    {-7, -128, -128, -128, 0, -128, 0, -7, -128},
+    {-128, -128, -128, -128, 0, -128, 0, 0, -128},
+    {-128, 8, 8, 10, -128, -128, 8, 8, -128},
+    {0, -128, 8, 10, -128, -128, 8, 0, -128},
+    {-128, -128, 8, 10, -128, -128, -9, -9, -128},
+    {-128, -128, -128, 10, -128, -128, 10, 8, -128},
+    {0, 8, -128, 10, -128, -128, 0, 8, -128},
+    {-128, 8, -128, 10, -128, -128, -9, -9, -128},
+    {-128, -128, -128, 10, -128, -128, 8, 10, -128},
+    {0, -128, -128, 10, -128, -128, -9, -9, -128},
+    {-128, -128, -128, 10, -128, -128, 0, 0, -128},
+    {0, 0, -7, -128, -128, -128, 0, 0, -128},
+    {-128, -9, -9, -128, -128, -128, 0, -9, -128},
+    {-128, -128, -9, -128, -128, -128, 8, 10, -128},
+    {0, -128, -7, -128, -128, -128, 0, -7, -128},
+    {-128, -128, 0, -128, -128, -128, 0, 0, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -9, -128},
+    {0, -128, -128, -128, -128, -128, 10, 0, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -9, -128},
+    {0, 0, -128, -128, -128, -128, 0, 0, -128},
+    {-128, 0, -128, -128, -128, -128, 0, 0, -128},
+    {0, -128, -128, -128, -128, -128, 0, 10, -128},
+    {-128, -128, -128, -128, -128, -128, 0, 10, -128},
+    {-128, -128, -128, -128, -128, -128, 0, 0, -128},
+    {-7, -9, -9, -9, -128, -128, -9, -9, -128},
+    {-128, 0, 0, -7, -128, -128, 0, 0, -128},
+    {0, -128, -9, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -9, -9, -128, -128, -9, 0, -128},
+    {0, -9, -128, -9, -128, -128, -9, -9, -128},
+    {-9, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -128, -9, 0, -128},
+    {-128, -9, -128, -9, -128, -128, 0, -9, -128},
+    {-9, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -9, -128, -128, 0, -9, -128},
+    {-7, -9, -9, -128, -128, -128, -9, -9, -128},
+    {-9, -128, -9, -128, -128, -128, -9, -9, -128},
+    {-128, -128, -9, -128, -128, -128, 10, 0, -128},
+    {-9, -128, -128, -128, -128, -128, -9, -9, -128},
+    {-9, -9, -128, -128, -128, -128, -9, -9, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -9, -128},
+    {-9, -128, -128, -128, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -9, -128},
+    {-128, 0, 0, -128, -128, -128, 0, 0, -128},
+    {0, -128, -9, -128, -128, -128, -9, -9, -128},
+    {-128, -128, 10, -128, -128, -128, 0, 0, -128},
+    {0, -9, -128, -128, -128, -128, -9, -9, -128},
+    {-128, 10, -128, -128, -128, -128, 0, 0, -128},
+    {10, -128, -128, -128, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -9, 0, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -9, -128},
+    {-128, -9, 6, -9, -9, -128, -9, -9, -128},
+    {-9, -128, 6, -9, -9, -128, -9, -9, -128},
+    {-128, -128, 10, -9, -9, -128, -9, -9, -128},
+    {6, 6, -128, 0, 0, -128, -7, -7, -128},
+    {-128, 10, -128, 8, 8, -128, 8, 6, -128},
+    {10, -128, -128, 6, 8, -128, 8, 8, -128},
+    {-128, -128, -128, -9, 8, -128, -9, -9, -128},
+    {-128, -128, -128, 0, 0, -128, 8, 0, -128},
+    {-9, -9, 0, -128, -9, -128, -9, -9, -128},
+    {-128, -9, 8, -128, -9, -128, 10, -9, -128},
+    {-9, -128, 6, -128, -9, -128, -9, -9, -128},
+    {-128, -128, -9, -128, -9, -128, -9, -9, -128},
+    {-128, -128, 0, -128, -9, -128, 10, -9, -128},
+    {8, 6, -128, -128, 0, -128, 8, 6, -128},
+    {-128, -9, -128, -128, 0, -128, -9, -9, -128},
+    {-128, -128, -128, -128, 8, -128, -9, -9, -128},
+    {0, -128, -128, -128, 0, -128, 8, 0, -128},
+    {-128, -128, -128, -128, 0, -128, 10, 0, -128},
+    {-128, -128, 10, -128, -9, -128, -9, -9, -128},
+    {-128, 10, -128, -128, 8, -128, -9, -9, -128},
+    {10, -128, -128, -128, 8, -128, -9, -9, -128},
+    {-9, -9, 0, -9, -128, -128, -9, -9, -128},
+    {-128, -9, 8, -9, -128, -128, -9, -9, -128},
+    {-9, -128, 8, -9, -128, -128, -9, 10, -128},
+    {-128, -128, 8, -9, -128, -128, -9, 10, -128},
+    {-128, -128, 0, -9, -128, -128, -9, -9, -128},
+    {8, 8, -128, 0, -128, -128, 10, 8, -128},
+    {-128, 8, -128, 0, -128, -128, 10, 8, -128},
+    {-128, -128, -128, 8, -128, -128, 10, 10, -128},
+    {0, -128, -128, 0, -128, -128, 10, 0, -128},
+    {-128, -128, -128, 0, -128, -128, 10, 0, -128},
+    {-9, -9, 0, -128, -128, -128, -9, -9, -128},
+    {-128, -9, 0, -128, -128, -128, -9, -9, -128},
+    {-128, -128, 8, -128, -128, -128, -9, 10, -128},
+    {-9, -128, 0, -128, -128, -128, -9, -9, -128},
+    {-128, -128, 0, -128, -128, -128, 10, -9, -128},
+    {-128, 8, -128, -128, -128, -128, 10, 8, -128},
+    {0, -128, -128, -128, -128, -128, 10, 0, -128},
+    {-128, -128, -128, -128, -128, -128, 10, 0, -128},
+    {-128, -9, 8, -128, -128, -128, -9, -9, -128},
+    {-9, -128, 8, -128, -128, -128, -9, 10, -128},
+    {-128, -128, 10, -128, -128, -128, -9, 10, -128},
+    {8, 8, -128, -128, -128, -128, 10, 8, -128},
+    {-128, 10, -128, -128, -128, -128, 10, 8, -128},
+    {10, -128, -128, -128, -128, -128, 10, 10, -128},
+    {-128, -128, -128, -128, -128, -128, 10, 10, -128},
+    {-128, -128, -128, -128, -128, -128, 10, 0, -128},
+    {-128, -128, 10, -9, -128, -128, -9, -9, -128},
+    {-128, 10, -128, 8, -128, -128, -9, -9, -128},
+    {10, -128, -128, -9, -128, -128, -9, -9, -128},
+    {-128, -9, 8, -128, -128, -128, 10, -9, -128},
+    {-9, -128, -9, -128, -128, -128, -9, -9, -128},
+    {-128, -128, 10, -128, -128, -128, 10, -9, -128},
+    {8, -9, -128, -128, -128, -128, -9, -9, -128},
+    {-128, 10, -128, -128, -128, -128, 10, 8, -128},
+    {10, -128, -128, -128, -128, -128, -9, -9, -128},
+    {-128, -128, -128, -128, -128, -128, 10, 0, -128},
+    {6, 0, 6, 6, 0, 0, -128, -5, -128},
+    {-128, -9, -9, -9, -7, -9, -128, -9, -128},
+    {-128, -128, -9, -9, 8, -9, -128, -9, -128},
+    {0, -128, -7, -7, -7, -7, -128, -7, -128},
+    {-128, -128, 8, 10, 8, 0, -128, 0, -128},
+    {-128, -9, -128, -9, 10, -9, -128, -9, -128},
+    {8, -128, -128, 8, 10, -7, -128, 0, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -9, -128},
+    {-9, -9, -128, -9, -9, -7, -128, -9, -128},
+    {-128, -9, -128, 10, -9, 0, -128, -9, -128},
+    {-9, -128, -128, -9, -9, 0, -128, -9, -128},
+    {-128, -128, -128, -9, -9, -9, -128, -9, -128},
+    {-128, -128, -128, 10, -9, 0, -128, -9, -128},
+    {-128, -9, -9, -128, 8, -9, -128, -9, -128},
+    {10, -128, 8, -128, 8, 8, -128, -7, -128},
+    {-128, -128, -9, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -9, -128},
+    {10, -9, -128, -128, -9, 8, -128, -9, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, -9, -9, -128, -9, -128},
+    {10, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-7, -7, -7, -128, 0, 0, -128, -7, -128},
+    {-128, 0, 8, -128, 0, 0, -128, -7, -128},
+    {0, -128, 8, -128, 8, 0, -128, -7, -128},
+    {-128, -128, -9, -128, 8, -9, -128, -9, -128},
+    {-128, -128, -7, -128, 0, 0, -128, -7, -128},
+    {8, 8, -128, -128, 10, 0, -128, -7, -128},
+    {-128, -9, -128, -128, 10, -9, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -9, -128},
+    {-7, -128, -128, -128, 10, -7, -128, -7, -128},
+    {-128, -128, -128, -128, 10, 0, -128, 0, -128},
+    {-128, -9, -128, -128, -9, 0, -128, -9, -128},
+    {-9, -128, -128, -128, -9, 0, -128, -9, -128},
+    {-128, -128, -128, -128, -9, 0, -128, -9, -128},
+    {-128, 8, 10, 8, -128, 8, -128, 8, -128},
+    {8, -128, 10, 8, -128, 8, -128, -7, -128},
+    {-128, -128, 10, -9, -128, -9, -128, -9, -128},
+    {-9, -9, -128, -9, -128, 0, -128, -9, -128},
+    {-128, -9, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, -9, -128, 8, -128, 10, -128},
+    {-9, -128, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, 10, -128, 0, -128, -9, -128},
+    {-128, -128, 10, -128, -128, 10, -128, -9, -128},
+    {-128, -9, -128, -128, -128, 10, -128, -9, -128},
+    {10, -128, -128, -128, -128, 10, -128, -9, -128},
+    {0, 8, 10, -128, -128, 0, -128, 8, -128},
+    {-128, 8, 10, -128, -128, 0, -128, 8, -128},
+    {-128, -128, 10, -128, -128, 8, -128, 10, -128},
+    {0, -128, 10, -128, -128, 0, -128, -7, -128},
+    {-128, -128, 10, -128, -128, 0, -128, 0, -128},
+    {-9, -9, -128, -128, -128, 0, -128, -9, -128},
+    {-128, -9, -128, -128, -128, 0, -128, -9, -128},
+    {-9, -128, -128, -128, -128, 0, -128, 10, -128},
+    {-128, -128, -128, -128, -128, 0, -128, 10, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -9, -128},
+    {0, -9, -9, -9, -128, -9, -128, -9, -128},
+    {-128, 8, 8, 10, -128, 0, -128, 0, -128},
+    {8, -128, -9, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -9, 10, -128, -9, -128, 0, -128},
+    {8, -9, -128, -9, -128, -9, -128, -9, -128},
+    {-9, -128, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, 10, -128, -9, -128, 0, -128},
+    {-128, -9, -128, 10, -128, 0, -128, -9, -128},
+    {-9, -128, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, 10, -128, 0, -128, -9, -128},
+    {10, -9, -9, -128, -128, -9, -128, -9, -128},
+    {10, -128, -9, -128, -128, -9, -128, -9, -128},
+    {10, -128, -128, -128, -128, -9, -128, -9, -128},
+    {10, -9, -128, -128, -128, -9, -128, -9, -128},
+    {10, -128, -128, -128, -128, -9, -128, -9, -128},
+    {-128, -9, -9, -128, -128, 0, -128, -9, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -9, -128},
+    {-128, -128, 10, -128, -128, 0, -128, -9, -128},
+    {-9, -9, -128, -128, -128, -9, -128, -9, -128},
+    {-128, 10, -128, -128, -128, 0, -128, -9, -128},
+    {10, -128, -128, -128, -128, -9, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -9, -128, -9, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -9, -128},
+    {-128, -9, -9, -9, 8, -128, -128, -9, -128},
+    {0, -128, -7, 8, 8, -128, -128, -7, -128},
+    {-128, -128, -9, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -9, -128},
+    {0, 0, -128, 8, 0, -128, -128, -7, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -9, 8, -128, -128, -9, -128},
+    {0, -128, -128, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, 10, 0, -128, -128, 0, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {10, -128, -128, -128, 10, -128, -128, -9, -128},
+    {0, 0, 0, -128, 0, -128, -128, 0, -128},
+    {-128, -9, -9, -128, 0, -128, -128, -9, -128},
+    {-128, -128, -9, -128, 8, -128, -128, -9, -128},
+    {0, -128, -7, -128, 0, -128, -128, -7, -128},
+    {-128, -128, 0, -128, 0, -128, -128, 0, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {0, -128, -128, -128, 10, -128, -128, 0, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {0, 0, -128, -128, 0, -128, -128, -7, -128},
+    {-128, 0, -128, -128, 0, -128, -128, 0, -128},
+    {0, -128, -128, -128, 0, -128, -128, 0, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 0, -128, -128, 0, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -9, -128},
+    {-128, 8, -128, 10, -128, -128, -128, -9, -128},
+    {0, -128, -128, 10, -128, -128, -128, -9, -128},
+    {-128, 8, 10, -128, -128, -128, -128, 8, -128},
+    {0, -128, 10, -128, -128, -128, -128, 0, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {0, 0, -128, -128, -128, -128, -128, 0, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {0, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {0, -9, -9, -9, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -9, -128},
+    {-128, -128, -9, 10, -128, -128, -128, 0, -128},
+    {-9, -128, -128, -9, -128, -128, -128, -9, -128},
+    {0, -9, -128, -9, -128, -128, -128, -9, -128},
+    {-128, 0, -128, 10, -128, -128, -128, 0, -128},
+    {0, -128, -128, -9, -128, -128, -128, -9, -128},
+    {-128, -128, -128, 10, -128, -128, -128, 0, -128},
+    {10, -128, -9, -128, -128, -128, -128, -9, -128},
+    {10, -9, -128, -128, -128, -128, -128, -9, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {0, -9, -9, -128, -128, -128, -128, -9, -128},
+    {-128, 0, 0, -128, -128, -128, -128, 0, -128},
+    {0, -128, -9, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -9, -128, -128, -128, -128, 0, -128},
+    {0, -9, -128, -128, -128, -128, -128, -9, -128},
+    {-9, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, 0, -128, -128, -128, -128, -128, 0, -128},
+    {0, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-9, -9, -7, -9, -9, -128, -128, -9, -128},
+    {-128, -9, 8, 10, -9, -128, -128, -9, -128},
+    {-9, -128, 8, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -9, -9, -9, -128, -128, -9, -128},
+    {-128, -128, 8, 10, -9, -128, -128, -9, -128},
+    {8, 8, -128, 8, 10, -128, -128, -7, -128},
+    {-128, -9, -128, -9, 10, -128, -128, -9, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -9, -128},
+    {8, -128, -128, 8, 10, -128, -128, -7, -128},
+    {-128, -128, -128, 10, 10, -128, -128, 8, -128},
+    {10, -9, 8, -128, -9, -128, -128, -9, -128},
+    {-128, -9, -9, -128, -9, -128, -128, -9, -128},
+    {-128, -128, -9, -128, -9, -128, -128, -9, -128},
+    {10, -128, 8, -128, -9, -128, -128, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {10, -128, -128, -128, 10, -128, -128, 8, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -9, -9, -128, -9, -128, -128, -9, -128},
+    {-9, -128, -9, -128, -9, -128, -128, -9, -128},
+    {-128, -128, 10, -128, -9, -128, -128, -9, -128},
+    {-9, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-128, 10, -128, -128, 10, -128, -128, -9, -128},
+    {10, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -9, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -9, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -9, -128, -128, -128, 10, -128},
+    {-9, -128, 10, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -9, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -9, -128},
+    {10, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-9, -9, 10, -128, -128, -128, -128, -9, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -9, -128},
+    {-9, -128, 10, -128, -128, -128, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -128, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-128, -9, -9, 10, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -9, -128},
+    {-9, -9, -128, -9, -128, -128, -128, -9, -128},
+    {-128, 10, -128, 10, -128, -128, -128, -9, -128},
+    {10, -128, -128, -9, -128, -128, -128, -9, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -9, -128},
+    {10, -9, -9, -128, -128, -128, -128, -9, -128},
+    {10, -128, -9, -128, -128, -128, -128, -9, -128},
+    {10, -9, -128, -128, -128, -128, -128, -9, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -9, -9, -9, -9, -9, -128, -7, -128},
+    {-9, -128, -9, -9, -9, -9, -128, -7, -128},
+    {-128, -128, 10, -9, -9, -9, -128, 8, -128},
+    {-9, -9, -128, -9, -9, -9, -128, -7, -128},
+    {-128, 10, -128, -9, -9, -9, -128, 0, -128},
+    {10, -128, -128, -9, -9, -9, -128, 8, -128},
+    {-128, -128, -128, -9, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -9, -9, -9, -128, 0, -128},
+    {-128, -128, -128, -9, -9, -9, -128, -9, -128},
+    {-9, -9, -9, -128, -9, -9, -128, -7, -128},
+    {-128, -9, -9, -128, -9, -9, -128, -7, -128},
+    {-9, -128, -9, -128, -9, -9, -128, -7, -128},
+    {-128, -128, -9, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -9, -128, -9, -9, -128, -7, -128},
+    {-9, -9, -128, -128, -9, -9, -128, 0, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-9, -128, -128, -128, -9, -9, -128, 0, -128},
+    {-128, -128, -128, -128, -9, -9, -128, 0, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -9, -128},
+    {-9, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-128, -128, 10, -128, -9, -9, -128, 8, -128},
+    {-128, 10, -128, -128, -9, -9, -128, 0, -128},
+    {10, -128, -128, -128, -9, -9, -128, -9, -128},
+    {-9, -9, -9, -9, -128, -9, -128, 0, -128},
+    {-128, -9, -9, -9, -128, -9, -128, 0, -128},
+    {-9, -128, -9, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -9, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -9, -9, -128, -9, -128, 0, -128},
+    {-9, -9, -128, -9, -128, -9, -128, 0, -128},
+    {-128, -9, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -128, -128, -9, -128, -9, -128, 10, -128},
+    {-9, -128, -128, -9, -128, -9, -128, 0, -128},
+    {-128, -128, -128, -9, -128, -9, -128, 0, -128},
+    {-128, -9, -128, -9, -128, -9, -128, -9, -128},
+    {-9, -128, -128, -9, -128, -9, -128, 10, -128},
+    {-128, -128, -128, -9, -128, -9, -128, 10, -128},
+    {-9, -9, -9, -128, -128, 10, -128, 8, -128},
+    {-128, -9, -9, -128, -128, 10, -128, 8, -128},
+    {-128, -128, -9, -128, -128, 10, -128, 10, -128},
+    {-9, -128, -9, -128, -128, 10, -128, 0, -128},
+    {-128, -128, -9, -128, -128, 10, -128, 0, -128},
+    {-128, -9, -128, -128, -128, 10, -128, 8, -128},
+    {-9, -128, -128, -128, -128, 10, -128, 0, -128},
+    {-128, -128, -128, -128, -128, 10, -128, 0, -128},
+    {-9, -9, -128, -128, -128, 10, -128, -9, -128},
+    {-128, -9, -128, -128, -128, 10, -128, -9, -128},
+    {-9, -128, -128, -128, -128, 10, -128, 10, -128},
+    {-128, -128, -128, -128, -128, 10, -128, 10, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -9, -128},
+    {-128, -9, -9, -128, -128, -9, -128, 0, -128},
+    {-9, -128, -9, -128, -128, -9, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -9, -128, 10, -128},
+    {-9, -9, -128, -128, -128, -9, -128, -9, -128},
+    {-128, 10, -128, -128, -128, -9, -128, 0, -128},
+    {10, -128, -128, -128, -128, -9, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -9, -128, 0, -128},
+    {-128, -128, -128, -128, -128, -9, -128, 10, -128},
+    {-128, -128, 10, -9, -128, -9, -128, -9, -128},
+    {-128, 10, -128, -9, -128, -9, -128, 0, -128},
+    {10, -128, -128, -9, -128, -9, -128, -9, -128},
+    {-128, -9, -9, -128, -128, -9, -128, -9, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -9, -128},
+    {-128, -128, 10, -128, -128, -9, -128, -9, -128},
+    {-9, -9, -128, -128, -128, -9, -128, -9, -128},
+    {-128, 10, -128, -128, -128, -9, -128, 0, -128},
+    {10, -128, -128, -128, -128, -9, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -9, -128, 0, -128},
+    {-9, -9, -9, -9, -9, -128, -128, -7, -128},
+    {-128, -9, -9, -9, -9, -128, -128, 0, -128},
+    {-9, -128, -9, -9, -9, -128, -128, -7, -128},
+    {-128, -128, -9, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -9, -9, -9, -128, -128, 0, -128},
+    {-9, -9, -128, -9, -9, -128, -128, -7, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -9, -9, -128, -128, -9, -128},
+    {-9, -128, -128, -9, -9, -128, -128, -7, -128},
+    {-128, -128, -128, -9, -9, -128, -128, 0, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -9, -128},
+    {-9, -128, -128, -9, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -9, -9, -128, -128, -9, -128},
+    {-9, -9, -9, -128, 10, -128, -128, -7, -128},
+    {-128, -9, -9, -128, 10, -128, -128, -9, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -9, -128, 10, -128, -128, -7, -128},
+    {-128, -128, -9, -128, 10, -128, -128, 0, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -128, -128, 10, -128, -128, 0, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -9, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -9, -128},
+    {-128, -9, -9, -128, -9, -128, -128, 0, -128},
+    {-9, -128, -9, -128, -9, -128, -128, -9, -128},
+    {-128, -128, 10, -128, -9, -128, -128, 8, -128},
+    {-9, -9, -128, -128, -9, -128, -128, -9, -128},
+    {-128, 10, -128, -128, -9, -128, -128, 0, -128},
+    {10, -128, -128, -128, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -9, -128, -128, 0, -128},
+    {-128, -128, -128, -128, -9, -128, -128, -9, -128},
+    {-9, -9, -9, 10, -128, -128, -128, 8, -128},
+    {-128, -9, -9, 10, -128, -128, -128, -9, -128},
+    {-128, -128, -9, 10, -128, -128, -128, 10, -128},
+    {-9, -128, -9, 10, -128, -128, -128, 0, -128},
+    {-128, -128, -9, 10, -128, -128, -128, 0, -128},
+    {-128, -9, -128, 10, -128, -128, -128, -9, -128},
+    {-9, -128, -128, 10, -128, -128, -128, 0, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -9, -128},
+    {-9, -9, -128, 10, -128, -128, -128, 8, -128},
+    {-128, -9, -128, 10, -128, -128, -128, 8, -128},
+    {-9, -128, -128, 10, -128, -128, -128, 10, -128},
+    {-128, -128, -128, 10, -128, -128, -128, 10, -128},
+    {-128, -128, -128, 10, -128, -128, -128, 0, -128},
+    {-9, -9, -9, -128, -128, -128, -128, -9, -128},
+    {-128, -9, -9, -128, -128, -128, -128, 0, -128},
+    {-9, -128, -9, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -9, -128, -128, -128, -128, 0, -128},
+    {-9, -9, -128, -128, -128, -128, -128, -9, -128},
+    {-9, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -9, -128, -128, -128, -128, -128, 0, -128},
+    {-9, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -9, -9, -9, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -9, -128},
+    {-9, -9, -128, -9, -128, -128, -128, -9, -128},
+    {-128, 10, -128, -9, -128, -128, -128, 0, -128},
+    {10, -128, -128, -9, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -9, -128, -128, -128, 0, -128},
+    {-9, -9, -9, -128, -128, -128, -128, -9, -128},
+    {-128, -9, -9, -128, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -9, -128, -128, -128, -128, -9, -128},
+    {-9, -9, -128, -128, -128, -128, -128, -9, -128},
+    {-9, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-128, 10, -128, -128, -128, -128, -128, 0, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {-128, -128, 10, -9, -9, -128, -128, -9, -128},
+    {-128, 10, -128, -9, -9, -128, -128, 0, -128},
+    {10, -128, -128, -9, -9, -128, -128, 8, -128},
+    {-128, -9, -9, -128, -9, -128, -128, -9, -128},
+    {-9, -128, -9, -128, -9, -128, -128, -9, -128},
+    {-128, -128, 10, -128, -9, -128, -128, -9, -128},
+    {-9, -9, -128, -128, -9, -128, -128, 0, -128},
+    {-128, 10, -128, -128, -9, -128, -128, 0, -128},
+    {10, -128, -128, -128, -9, -128, -128, 8, -128},
+    {-128, -128, -128, -128, -9, -128, -128, -9, -128},
+    {-128, -128, -128, -128, -9, -128, -128, 0, -128},
+    {-128, -9, -9, -9, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -9, -128, -128, -128, 10, -128},
+    {-128, -128, 10, -9, -128, -128, -128, 10, -128},
+    {-9, -9, -128, -9, -128, -128, -128, 0, -128},
+    {-128, 10, -128, -9, -128, -128, -128, 0, -128},
+    {10, -128, -128, -9, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -9, -128, -128, -128, 10, -128},
+    {-128, -128, -128, -9, -128, -128, -128, 0, -128},
+    {-9, -9, -9, -128, -128, -128, -128, -9, -128},
+    {-128, -9, -9, -128, -128, -128, -128, -9, -128},
+    {-9, -128, -9, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -9, -128, -128, -128, -128, 10, -128},
+    {-128, -128, -9, -128, -128, -128, -128, -9, -128},
+    {-9, -9, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -9, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-9, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, -128, -128, -128, -128, -128, 0, -128},
+    {-128, -128, 10, -128, -128, -128, -128, 10, -128},
+    {-128, 10, -128, -128, -128, -128, -128, 0, -128},
+    {10, -128, -128, -128, -128, -128, -128, 10, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -9, -128},
+    {-128, 10, -128, -128, -128, -128, -128, 0, -128},
+    {10, -128, -128, -128, -128, -128, -128, -9, -128},
+    {0, -5, 0, -5, 0, 0, -5, -128, -128},
+    {-128, -9, -9, -9, 0, -9, -9, -128, -128},
+    {-128, -128, -9, -9, 10, -9, -9, -128, -128},
+    {0, -128, 0, -7, -7, -7, -7, -128, -128},
+    {-128, -128, 0, 0, 0, 0, 0, -128, -128},
+    {-128, -9, -128, -9, 8, -9, -9, -128, -128},
+    {0, -128, -128, 0, 0, 0, 0, -128, -128},
+    {-128, -128, -128, -9, 0, -9, -9, -128, -128},
+    {-9, -9, -128, -9, -9, -7, -9, -128, -128},
+    {-128, -9, -128, -9, -9, 0, -9, -128, -128},
+    {-9, -128, -128, -9, 10, -7, -9, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -9, -128, -128},
+    {-128, -128, -128, -9, -9, 0, -9, -128, -128},
+    {-128, -9, -9, -128, 8, -9, -9, -128, -128},
+    {0, -128, 0, -128, 0, 0, -7, -128, -128},
+    {-128, -128, -9, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, 8, -9, -9, -128, -128},
+    {-9, -9, -128, -128, -9, -7, -9, -128, -128},
+    {-128, -9, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -9, -128, -128},
+    {-9, -128, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -9, 8, 10, -128, -128},
+    {-7, -7, -7, -128, 0, -7, -7, -128, -128},
+    {-128, 8, 0, -128, 0, 0, -7, -128, -128},
+    {8, -128, 8, -128, 10, 0, -7, -128, -128},
+    {-128, -128, -9, -128, 10, -9, -9, -128, -128},
+    {-128, -128, 0, -128, 0, 0, -7, -128, -128},
+    {0, 8, -128, -128, 8, -7, -7, -128, -128},
+    {-128, -9, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -9, -128, -128},
+    {0, -128, -128, -128, 0, -7, -7, -128, -128},
+    {-128, -128, -128, -128, 0, 0, 0, -128, -128},
+    {-128, -9, -128, -128, -9, 0, -9, -128, -128},
+    {-9, -128, -128, -128, 10, -7, -9, -128, -128},
+    {-128, -128, -128, -128, 10, 0, -9, -128, -128},
+    {-128, 10, 8, 8, -128, 8, 8, -128, -128},
+    {0, -128, 0, 0, -128, 0, -7, -128, -128},
+    {-128, -128, 0, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, 8, -128, 8, 10, -128, -128},
+    {-9, 10, -128, -9, -128, 8, -9, -128, -128},
+    {-128, 10, -128, -9, -128, -9, -9, -128, -128},
+    {-9, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, -9, -128, 0, -9, -128, -128},
+    {-128, -128, 8, -128, -128, 10, -9, -128, -128},
+    {-128, 10, -128, -128, -128, 10, -9, -128, -128},
+    {-9, -128, -128, -128, -128, 10, -9, -128, -128},
+    {0, 10, 8, -128, -128, 0, 8, -128, -128},
+    {-128, 10, -9, -128, -128, -9, 8, -128, -128},
+    {0, -128, 0, -128, -128, -7, -7, -128, -128},
+    {-128, -128, 0, -128, -128, 0, 0, -128, -128},
+    {-128, 10, -128, -128, -128, -9, 10, -128, -128},
+    {0, -128, -128, -128, -128, 0, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-9, 10, -128, -128, -128, 0, -9, -128, -128},
+    {-128, 10, -128, -128, -128, 0, -9, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -9, -128, -128},
+    {-7, -9, -9, -9, -128, -9, -9, -128, -128},
+    {-128, -7, 0, 0, -128, 0, 0, -128, -128},
+    {-7, -128, -9, -9, -128, -9, -9, -128, -128},
+    {-128, -128, 0, 0, -128, 0, 0, -128, -128},
+    {0, -9, -128, -9, -128, -9, -9, -128, -128},
+    {0, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, 0, -128, 0, 0, -128, -128},
+    {-128, -9, -128, -9, -128, -9, -9, -128, -128},
+    {-9, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, -9, -128, -9, -9, -128, -128},
+    {0, -9, -9, -128, -128, -9, -9, -128, -128},
+    {0, -128, -9, -128, -128, -9, -9, -128, -128},
+    {-128, -128, 0, -128, -128, 0, 10, -128, -128},
+    {0, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-9, -9, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -9, -128, -128, -128, -9, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -9, -9, -128, -128, 0, -9, -128, -128},
+    {-9, -128, -9, -128, -128, -9, -9, -128, -128},
+    {-128, -128, 10, -128, -128, 0, -9, -128, -128},
+    {-9, -9, -128, -128, -128, -9, -9, -128, -128},
+    {-128, 10, -128, -128, -128, 0, -9, -128, -128},
+    {10, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -9, -9, -9, 8, -128, -9, -128, -128},
+    {0, -128, 0, 0, 0, -128, -7, -128, -128},
+    {-128, -128, -9, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -9, 8, -128, -9, -128, -128},
+    {0, -7, -128, -7, 8, -128, -7, -128, -128},
+    {-128, -9, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -9, -128, -128},
+    {0, -128, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, 8, 0, -128, 0, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -9, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -9, -128, -128},
+    {8, -128, -128, -128, 10, -128, -9, -128, -128},
+    {0, 0, -7, -128, 0, -128, 0, -128, -128},
+    {-128, -9, -9, -128, -9, -128, -9, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -9, -128, -128},
+    {0, -128, -7, -128, -7, -128, -7, -128, -128},
+    {-128, -128, 0, -128, 0, -128, 0, -128, -128},
+    {-128, -9, -128, -128, -9, -128, -9, -128, -128},
+    {0, -128, -128, -128, 0, -128, 0, -128, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -128, -128},
+    {0, -7, -128, -128, 0, -128, -7, -128, -128},
+    {-128, 0, -128, -128, 0, -128, 0, -128, -128},
+    {0, -128, -128, -128, 10, -128, 0, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 0, -128, 0, -128, -128},
+    {-128, -128, 8, 10, -128, -128, -9, -128, -128},
+    {-128, 10, -128, 10, -128, -128, -9, -128, -128},
+    {0, -128, -128, 10, -128, -128, -9, -128, -128},
+    {-128, 10, -9, -128, -128, -128, 8, -128, -128},
+    {0, -128, 0, -128, -128, -128, 0, -128, -128},
+    {-128, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {0, 10, -128, -128, -128, -128, 0, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -9, -128, -128},
+    {0, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {0, -9, -9, -9, -128, -128, -9, -128, -128},
+    {0, -128, -9, -9, -128, -128, -9, -128, -128},
+    {-128, -128, 0, 0, -128, -128, 0, -128, -128},
+    {0, -128, -128, -9, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -9, -128, -128},
+    {-128, -9, -128, -9, -128, -128, 0, -128, -128},
+    {-9, -128, -128, -9, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 0, -128, -128},
+    {0, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -128, -128, -128, -9, -128, -128},
+    {-9, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {0, -9, -9, -128, -128, -128, -9, -128, -128},
+    {-128, 0, 0, -128, -128, -128, 0, -128, -128},
+    {0, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -128, 0, -128, -128, -128, 0, -128, -128},
+    {0, -9, -128, -128, -128, -128, -9, -128, -128},
+    {0, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 0, -128, -128},
+    {-9, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-9, -9, -7, -9, -9, -128, -9, -128, -128},
+    {-128, -9, 6, -9, -9, -128, -9, -128, -128},
+    {-9, -128, 8, -9, 10, -128, -9, -128, -128},
+    {-128, -128, -9, -9, 10, -128, -9, -128, -128},
+    {-128, -128, 0, -9, -9, -128, -9, -128, -128},
+    {6, 8, -128, 6, 8, -128, -7, -128, -128},
+    {-128, -9, -128, -9, 8, -128, -9, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -9, -128, -128},
+    {0, -128, -128, 0, 0, -128, -7, -128, -128},
+    {-128, -128, -128, 0, 0, -128, 8, -128, -128},
+    {-9, -9, 6, -128, -9, -128, -9, -128, -128},
+    {-128, -9, -9, -128, -9, -128, -9, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -9, -128, -128},
+    {-9, -128, 0, -128, -9, -128, -9, -128, -128},
+    {-128, -128, 0, -128, -9, -128, 10, -128, -128},
+    {-128, -9, -128, -128, 8, -128, -9, -128, -128},
+    {0, -128, -128, -128, 0, -128, 8, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -9, -128, -128},
+    {-128, -9, -9, -128, -9, -128, -9, -128, -128},
+    {-9, -128, -9, -128, 10, -128, -9, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -9, -128, -128},
+    {-9, -9, -128, -128, 8, -128, -9, -128, -128},
+    {-128, 10, -128, -128, 8, -128, -9, -128, -128},
+    {10, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -9, -128, -128},
+    {-9, 10, 8, -9, -128, -128, -9, -128, -128},
+    {-128, 10, 8, -9, -128, -128, -9, -128, -128},
+    {-9, -128, 0, -9, -128, -128, -9, -128, -128},
+    {-128, -128, 0, -9, -128, -128, -9, -128, -128},
+    {-128, 10, -128, 8, -128, -128, 10, -128, -128},
+    {0, -128, -128, 0, -128, -128, 10, -128, -128},
+    {-128, -128, -128, 0, -128, -128, 10, -128, -128},
+    {-128, 10, 8, -128, -128, -128, -9, -128, -128},
+    {-9, -128, 0, -128, -128, -128, -9, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, 10, 8, -128, -128, -128, -9, -128, -128},
+    {-128, 10, 8, -128, -128, -128, -9, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -9, -128, -128},
+    {8, 10, -128, -128, -128, -128, 10, -128, -128},
+    {-128, 10, -128, -128, -128, -128, 10, -128, -128},
+    {0, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -9, -9, -128, -128, -9, -128, -128},
+    {-9, -128, -9, -9, -128, -128, -9, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -9, -128, -128},
+    {-128, 10, -128, 8, -128, -128, -9, -128, -128},
+    {10, -128, -128, -9, -128, -128, -9, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -9, -128, -128},
+    {-9, -9, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -9, 8, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -128, 0, -128, -128, -128, 10, -128, -128},
+    {8, -9, -128, -128, -128, -128, -9, -128, -128},
+    {0, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -9, -9, 8, -9, -128, -128, -128},
+    {0, -128, 0, -7, -7, -7, -128, -128, -128},
+    {-128, -128, -9, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-9, -9, -128, -9, -9, -7, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-9, -128, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, 10, -9, 0, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -9, -128, -128, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -128, -128},
+    {10, -128, -128, -128, -9, -9, -128, -128, -128},
+    {-7, -7, -7, -128, 8, 0, -128, -128, -128},
+    {-128, -9, -9, -128, 8, -9, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -9, -128, -128, -128},
+    {-7, -128, -7, -128, -7, -7, -128, -128, -128},
+    {-128, -128, 0, -128, 0, 0, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -9, -128, -128, -128},
+    {0, -128, -128, -128, 10, 0, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-9, -9, -128, -128, -9, -7, -128, -128, -128},
+    {-128, -9, -128, -128, -9, 0, -128, -128, -128},
+    {-9, -128, -128, -128, 10, 0, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -9, 0, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -9, -128, -128, -128},
+    {-128, 10, -128, -9, -128, -9, -128, -128, -128},
+    {-9, -128, -128, -9, -128, -9, -128, -128, -128},
+    {-128, 10, 10, -128, -128, 8, -128, -128, -128},
+    {0, -128, 10, -128, -128, 0, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -9, -128, -128, -128},
+    {-9, 10, -128, -128, -128, 0, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -9, -128, -128, -128},
+    {-9, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {0, -9, -9, -9, -128, -9, -128, -128, -128},
+    {0, -128, -9, -9, -128, -9, -128, -128, -128},
+    {-128, -128, 0, 10, -128, 0, -128, -128, -128},
+    {0, -128, -128, -9, -128, -9, -128, -128, -128},
+    {-9, -9, -128, -9, -128, -9, -128, -128, -128},
+    {-128, -9, -128, 10, -128, 0, -128, -128, -128},
+    {-9, -128, -128, -9, -128, -9, -128, -128, -128},
+    {-128, -128, -128, 10, -128, 0, -128, -128, -128},
+    {10, -128, -9, -128, -128, -9, -128, -128, -128},
+    {10, -9, -128, -128, -128, -9, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-9, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -9, -9, -128, -128, 0, -128, -128, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -9, -128, -128, 0, -128, -128, -128},
+    {-9, -9, -128, -128, -128, -9, -128, -128, -128},
+    {-9, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -9, -128, -128, -128, 0, -128, -128, -128},
+    {-9, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -128, -9, -9, -9, -128, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -128, -128},
+    {0, -128, -128, -9, -9, -128, -128, -128, -128},
+    {-128, -9, -9, -128, 8, -128, -128, -128, -128},
+    {0, -128, 0, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {0, 0, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -9, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {0, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -9, -9, -128, -128, -128, -128, -128},
+    {0, -9, -128, -9, -128, -128, -128, -128, -128},
+    {0, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {0, -9, -9, -128, -128, -128, -128, -128, -128},
+    {0, -128, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {0, -9, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -7, -9, -9, -128, -128, -128, -128},
+    {-128, -9, -9, -9, -9, -128, -128, -128, -128},
+    {-128, -128, -9, -9, 10, -128, -128, -128, -128},
+    {-9, -128, -7, -9, -9, -128, -128, -128, -128},
+    {-128, -128, 8, 10, -9, -128, -128, -128, -128},
+    {-128, -9, -128, -9, 10, -128, -128, -128, -128},
+    {8, -128, -128, 8, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -9, -9, -128, -9, -128, -128, -128, -128},
+    {10, -128, 8, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -9, -9, -128, -9, -128, -128, -128, -128},
+    {-128, -9, -9, -128, -9, -128, -128, -128, -128},
+    {-9, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -128, -128, -128, -128},
+    {-9, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, 10, 10, -9, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-9, 10, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 10, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -9, -9, 10, -128, -128, -128, -128, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -9, 10, -128, -128, -128, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -128, -128, -128},
+    {-9, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {10, -9, -9, -128, -128, -128, -128, -128, -128},
+    {10, -128, -9, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-7, -7, -7, -7, 0, -7, -128, -128, -128},
+    {-128, 8, 0, -7, 0, 0, -128, -128, -128},
+    {8, -128, 8, -7, 10, -7, -128, -128, -128},
+    {-128, -128, -9, -9, 10, -9, -128, -128, -128},
+    {-128, -128, 0, -7, 0, 0, -128, -128, -128},
+    {0, 8, -128, 0, 0, -7, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {0, -128, -128, 0, 0, -7, -128, -128, -128},
+    {-128, -128, -128, 0, 0, 0, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -9, -128, -128, -128},
+    {-9, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-7, -7, 0, -128, 8, -7, -128, -128, -128},
+    {-128, -9, -9, -128, 8, -9, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -9, -128, -128, -128},
+    {-7, -128, 0, -128, 0, -7, -128, -128, -128},
+    {-128, -128, 0, -128, 0, 0, -128, -128, -128},
+    {-128, -9, -128, -128, 8, -9, -128, -128, -128},
+    {0, -128, -128, -128, 0, 0, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -9, -128, -128, -128},
+    {-9, -9, -128, -128, -9, -9, -128, -128, -128},
+    {-128, -9, -128, -128, -9, -9, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -9, -9, -128, -128, -128},
+    {-128, 8, 0, -128, 0, 0, -128, -128, -128},
+    {8, -128, -9, -128, 10, -9, -128, -128, -128},
+    {-128, -128, 10, -128, 10, 8, -128, -128, -128},
+    {0, -9, -128, -128, -9, -9, -128, -128, -128},
+    {-128, 10, -128, -128, 0, 0, -128, -128, -128},
+    {10, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 0, 0, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {0, 10, 0, 8, -128, 8, -128, -128, -128},
+    {-128, 10, -9, 8, -128, -9, -128, -128, -128},
+    {0, -128, 0, 0, -128, 0, -128, -128, -128},
+    {-128, -128, 0, 0, -128, 0, -128, -128, -128},
+    {-128, 10, -128, 8, -128, -9, -128, -128, -128},
+    {0, -128, -128, 0, -128, 0, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -9, -128, -128, -128},
+    {-9, 10, -128, -9, -128, 8, -128, -128, -128},
+    {-128, 10, -128, -9, -128, 8, -128, -128, -128},
+    {-128, -128, -128, -9, -128, 0, -128, -128, -128},
+    {-128, 10, 8, -128, -128, 10, -128, -128, -128},
+    {0, -128, 0, -128, -128, 10, -128, -128, -128},
+    {-128, -128, 0, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-9, 10, -128, -128, -128, 10, -128, -128, -128},
+    {-128, 10, -128, -128, -128, 10, -128, -128, -128},
+    {-9, -128, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {0, 10, -9, -128, -128, -9, -128, -128, -128},
+    {-128, 10, 0, -128, -128, 0, -128, -128, -128},
+    {-128, -128, 0, -128, -128, 0, -128, -128, -128},
+    {0, 10, -128, -128, -128, -9, -128, -128, -128},
+    {0, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, 10, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -9, 0, -9, -128, -9, -128, -128, -128},
+    {-9, -128, -9, -9, -128, -9, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -9, -128, -128, -128},
+    {0, -9, -128, -9, -128, -9, -128, -128, -128},
+    {-128, 10, -128, 0, -128, 0, -128, -128, -128},
+    {10, -128, -128, -9, -128, -9, -128, -128, -128},
+    {-128, -128, -128, 0, -128, 0, -128, -128, -128},
+    {-9, -9, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -9, 0, -128, -128, -9, -128, -128, -128},
+    {-9, -128, -9, -128, -128, -9, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -9, -128, -128, -128},
+    {0, -9, -128, -128, -128, -9, -128, -128, -128},
+    {0, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -9, -128, -128, -128},
+    {-128, 10, -128, -128, -128, 0, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {0, -7, -7, -7, 8, -128, -128, -128, -128},
+    {-128, -9, -9, -9, -9, -128, -128, -128, -128},
+    {-128, -128, -9, -9, 10, -128, -128, -128, -128},
+    {0, -128, -7, -7, 0, -128, -128, -128, -128},
+    {-128, -128, 0, 0, 0, -128, -128, -128, -128},
+    {-128, -9, -128, -9, -9, -128, -128, -128, -128},
+    {0, -128, -128, 0, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -9, -9, -128, -128, -128, -128},
+    {-9, -9, -128, -9, 8, -128, -128, -128, -128},
+    {-128, -9, -128, -9, 8, -128, -128, -128, -128},
+    {-9, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 0, -128, -128, -128, -128},
+    {-128, -9, -9, -128, 10, -128, -128, -128, -128},
+    {0, -128, 0, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {0, -9, -9, -128, -9, -128, -128, -128, -128},
+    {-128, 8, 0, -128, 0, -128, -128, -128, -128},
+    {8, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, 0, -128, 0, -128, -128, -128, -128},
+    {0, -9, -128, -128, -9, -128, -128, -128, -128},
+    {0, -128, -128, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 0, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, 10, -9, 10, -128, -128, -128, -128, -128},
+    {0, -128, 0, 10, -128, -128, -128, -128, -128},
+    {-128, -128, -9, 10, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {8, 10, -128, 10, -128, -128, -128, -128, -128},
+    {-128, 10, -128, 10, -128, -128, -128, -128, -128},
+    {0, -128, -128, 10, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {0, 10, -9, -128, -128, -128, -128, -128, -128},
+    {0, -128, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {0, 10, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -9, 0, -9, -128, -128, -128, -128, -128},
+    {-9, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -9, -128, -128, -128, -128, -128},
+    {0, -9, -128, -9, -128, -128, -128, -128, -128},
+    {0, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-9, -9, -9, -128, -128, -128, -128, -128, -128},
+    {-9, -128, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 0, -128, -128, -128, -128, -128, -128},
+    {-9, -128, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {0, -9, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 0, -9, -9, -128, -128, -128, -128},
+    {-9, -128, 8, -9, 10, -128, -128, -128, -128},
+    {-128, -128, 10, -9, 10, -128, -128, -128, -128},
+    {0, 8, -128, 0, 0, -128, -128, -128, -128},
+    {-128, 10, -128, 0, 0, -128, -128, -128, -128},
+    {10, -128, -128, 8, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, 0, 0, -128, -128, -128, -128},
+    {-9, -9, 0, -128, -9, -128, -128, -128, -128},
+    {-128, -9, 0, -128, -9, -128, -128, -128, -128},
+    {-9, -128, 8, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -9, -128, -128, -128, -128},
+    {0, 8, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {0, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, 10, -128, 10, -128, -128, -128, -128},
+    {-128, 10, -128, -128, 0, -128, -128, -128, -128},
+    {10, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, 10, 0, -9, -128, -128, -128, -128, -128},
+    {-128, 10, 0, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -9, -128, -128, -128, -128, -128},
+    {0, 10, -128, 0, -128, -128, -128, -128, -128},
+    {-128, 10, -128, 0, -128, -128, -128, -128, -128},
+    {0, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 0, -128, -128, -128, -128, -128},
+    {-9, 10, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 10, 0, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 0, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, 0, -128, -128, -128, -128, -128, -128},
+    {0, 10, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, 10, -128, 0, -128, -128, -128, -128, -128},
+    {10, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -9, 0, -128, -128, -128, -128, -128, -128},
+    {-9, -128, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {0, -9, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -9, -9, -9, -9, -9, 6, -128, -128},
+    {-9, -128, -9, -9, -9, -9, 0, -128, -128},
+    {-128, -128, 10, -9, -9, -9, 8, -128, -128},
+    {-9, -9, -128, -9, -9, -9, -7, -128, -128},
+    {-128, 10, -128, -9, -9, -9, 8, -128, -128},
+    {10, -128, -128, -9, -9, -9, 8, -128, -128},
+    {-128, -128, -128, -9, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -9, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -9, -9, -9, -9, -128, -128},
+    {-9, -9, -9, -128, -9, -9, 6, -128, -128},
+    {-128, -9, -9, -128, -9, -9, 10, -128, -128},
+    {-9, -128, -9, -128, -9, -9, 6, -128, -128},
+    {-128, -128, -9, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -9, -128, -9, -9, 10, -128, -128},
+    {-9, -9, -128, -128, -9, -9, 8, -128, -128},
+    {-128, -9, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -9, -9, -128, -128},
+    {-9, -128, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -9, 10, -128, -128},
+    {-128, -9, -128, -128, -9, -9, 10, -128, -128},
+    {-9, -128, -128, -128, -9, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -9, 10, -128, -128},
+    {-128, -128, 10, -128, -9, -9, 0, -128, -128},
+    {-128, 10, -128, -128, -9, -9, 8, -128, -128},
+    {10, -128, -128, -128, -9, -9, 8, -128, -128},
+    {-9, -9, -9, -9, -128, -9, 0, -128, -128},
+    {-128, -9, -9, -9, -128, -9, 8, -128, -128},
+    {-9, -128, -9, -9, -128, -9, 0, -128, -128},
+    {-128, -128, -9, -9, -128, -9, 0, -128, -128},
+    {-128, -128, -9, -9, -128, -9, 8, -128, -128},
+    {-9, -9, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -9, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -9, 10, -128, -128},
+    {-9, -128, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -9, 10, -128, -128},
+    {-128, -9, -128, -9, -128, -9, -9, -128, -128},
+    {-9, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-9, -9, -9, -128, -128, 10, 8, -128, -128},
+    {-128, -9, -9, -128, -128, 10, 8, -128, -128},
+    {-128, -128, -9, -128, -128, 10, 8, -128, -128},
+    {-9, -128, -9, -128, -128, 10, 8, -128, -128},
+    {-128, -128, -9, -128, -128, 10, 10, -128, -128},
+    {-128, -9, -128, -128, -128, 10, 10, -128, -128},
+    {-9, -128, -128, -128, -128, 10, 10, -128, -128},
+    {-128, -128, -128, -128, -128, 10, 10, -128, -128},
+    {-9, -9, -128, -128, -128, 10, -9, -128, -128},
+    {-128, -9, -128, -128, -128, 10, 10, -128, -128},
+    {-9, -128, -128, -128, -128, 10, -9, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -9, -128, -128},
+    {-128, -128, -128, -128, -128, 10, 10, -128, -128},
+    {-128, -9, -9, -128, -128, -9, 0, -128, -128},
+    {-9, -128, -9, -128, -128, -9, 0, -128, -128},
+    {-128, -128, 10, -128, -128, -9, 0, -128, -128},
+    {-9, -9, -128, -128, -128, -9, 10, -128, -128},
+    {-128, 10, -128, -128, -128, -9, 10, -128, -128},
+    {10, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -128, 10, -9, -128, -9, 8, -128, -128},
+    {-128, 10, -128, -9, -128, -9, -9, -128, -128},
+    {10, -128, -128, -9, -128, -9, -9, -128, -128},
+    {-128, -9, -9, -128, -128, -9, 10, -128, -128},
+    {-9, -128, -9, -128, -128, -9, -9, -128, -128},
+    {-128, -128, 10, -128, -128, -9, 10, -128, -128},
+    {-9, -9, -128, -128, -128, -9, -9, -128, -128},
+    {-128, 10, -128, -128, -128, -9, 10, -128, -128},
+    {10, -128, -128, -128, -128, -9, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -9, 10, -128, -128},
+    {-9, -9, -9, -9, -9, -128, -7, -128, -128},
+    {-128, -9, -9, -9, -9, -128, 6, -128, -128},
+    {-9, -128, -9, -9, -9, -128, 6, -128, -128},
+    {-128, -128, -9, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -9, -9, -9, -128, -9, -128, -128},
+    {-9, -9, -128, -9, -9, -128, -7, -128, -128},
+    {-128, -9, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -9, -9, -128, -9, -128, -128},
+    {-9, -128, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -9, -9, -128, -9, -128, -128},
+    {-128, -9, -128, -9, -9, -128, 0, -128, -128},
+    {-9, -128, -128, -9, -9, -128, 0, -128, -128},
+    {-128, -128, -128, -9, -9, -128, 0, -128, -128},
+    {-9, -9, -9, -128, 10, -128, 8, -128, -128},
+    {-128, -9, -9, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -9, -128, -128},
+    {-9, -128, -9, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -9, -128, 10, -128, 10, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -9, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-9, -9, -128, -128, 10, -128, 8, -128, -128},
+    {-128, -9, -128, -128, 10, -128, 10, -128, -128},
+    {-9, -128, -128, -128, 10, -128, 8, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -9, -128, -128},
+    {-128, -128, -128, -128, 10, -128, 10, -128, -128},
+    {-128, -9, -9, -128, -9, -128, 0, -128, -128},
+    {-9, -128, -9, -128, -9, -128, 0, -128, -128},
+    {-128, -128, 10, -128, -9, -128, 0, -128, -128},
+    {-9, -9, -128, -128, -9, -128, -7, -128, -128},
+    {-128, 10, -128, -128, -9, -128, 8, -128, -128},
+    {10, -128, -128, -128, -9, -128, 8, -128, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -128, 0, -128, -128},
+    {-9, -9, -9, 10, -128, -128, 8, -128, -128},
+    {-128, -9, -9, 10, -128, -128, 8, -128, -128},
+    {-128, -128, -9, 10, -128, -128, 8, -128, -128},
+    {-9, -128, -9, 10, -128, -128, 8, -128, -128},
+    {-128, -128, -9, 10, -128, -128, 8, -128, -128},
+    {-128, -9, -128, 10, -128, -128, 10, -128, -128},
+    {-9, -128, -128, 10, -128, -128, 10, -128, -128},
+    {-128, -128, -128, 10, -128, -128, 10, -128, -128},
+    {-9, -9, -128, 10, -128, -128, 0, -128, -128},
+    {-128, -9, -128, 10, -128, -128, 0, -128, -128},
+    {-9, -128, -128, 10, -128, -128, 0, -128, -128},
+    {-128, -128, -128, 10, -128, -128, 0, -128, -128},
+    {-128, -128, -128, 10, -128, -128, 0, -128, -128},
+    {-9, -9, -9, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -9, -128, -128, -128, 0, -128, -128},
+    {-9, -128, -9, -128, -128, -128, 0, -128, -128},
+    {-128, -128, -9, -128, -128, -128, 0, -128, -128},
+    {-128, -128, -9, -128, -128, -128, 0, -128, -128},
+    {-9, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 0, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 0, -128, -128},
+    {-128, -9, -9, -9, -128, -128, -9, -128, -128},
+    {-9, -128, -9, -9, -128, -128, -9, -128, -128},
+    {-128, -128, 10, -9, -128, -128, 8, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -9, -128, -128},
+    {-128, 10, -128, -9, -128, -128, -9, -128, -128},
+    {10, -128, -128, -9, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 0, -128, -128},
+    {-9, -9, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -9, -9, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, 10, -128, -128, -128, 0, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -9, -128, -128},
+    {10, -128, -128, -128, -128, -128, -9, -128, -128},
+    {-128, -128, 10, -9, -9, -128, -9, -128, -128},
+    {-128, 10, -128, -9, -9, -128, 8, -128, -128},
+    {10, -128, -128, -9, -9, -128, 8, -128, -128},
+    {-128, -9, -9, -128, -9, -128, 10, -128, -128},
+    {-9, -128, -9, -128, -9, -128, -9, -128, -128},
+    {-128, -128, 10, -128, -9, -128, 10, -128, -128},
+    {-9, -9, -128, -128, -9, -128, 8, -128, -128},
+    {-128, 10, -128, -128, -9, -128, 10, -128, -128},
+    {10, -128, -128, -128, -9, -128, 8, -128, -128},
+    {-128, -128, -128, -128, -9, -128, -9, -128, -128},
+    {-128, -128, -128, -128, -9, -128, 10, -128, -128},
+    {-128, -9, -9, -9, -128, -128, -9, -128, -128},
+    {-9, -128, -9, -9, -128, -128, -9, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -9, -128, -128},
+    {-9, -9, -128, -9, -128, -128, 10, -128, -128},
+    {-128, 10, -128, -9, -128, -128, 10, -128, -128},
+    {10, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -9, -128, -128, 10, -128, -128},
+    {-9, -9, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -9, -9, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -9, -128, -128, -128, -9, -128, -128},
+    {-128, -128, -9, -128, -128, -128, 10, -128, -128},
+    {-9, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -9, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-9, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -9, -128, -128},
+    {-128, 10, -128, -128, -128, -128, 10, -128, -128},
+    {10, -128, -128, -128, -128, -128, 10, -128, -128},
+    {-128, -128, 10, -128, -128, -128, 10, -128, -128},
+    {-128, 10, -128, -128, -128, -128, 10, -128, -128},
+    {10, -128, -128, -128, -128, -128, -9, -128, -128},
+    {6, 0, -7, 6, 0, -7, -128, -128, -128},
+    {-128, 8, 8, 10, 8, 6, -128, -128, -128},
+    {8, -128, 8, 6, 0, 6, -128, -128, -128},
+    {-128, -128, -9, -9, 0, -9, -128, -128, -128},
+    {-128, -128, -9, 10, 8, -9, -128, -128, -128},
+    {8, 8, -128, 8, 10, -7, -128, -128, -128},
+    {-128, -9, -128, -9, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-9, -128, -128, -9, 10, -9, -128, -128, -128},
+    {-128, -128, -128, 10, 10, -9, -128, -128, -128},
+    {-128, -9, -128, 10, -9, 0, -128, -128, -128},
+    {-9, -128, -128, -9, -9, 0, -128, -128, -128},
+    {-128, -128, -128, 10, -9, 0, -128, -128, -128},
+    {10, 6, 8, -128, 8, 8, -128, -128, -128},
+    {-128, -9, -9, -128, 8, -9, -128, -128, -128},
+    {-128, -128, -9, -128, 8, -9, -128, -128, -128},
+    {10, -128, -9, -128, 8, -9, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -9, -128, -128, -128},
+    {10, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {10, -9, -128, -128, -9, 8, -128, -128, -128},
+    {10, -128, -128, -128, -9, 8, -128, -128, -128},
+    {-128, -128, -128, -128, -9, -9, -128, -128, -128},
+    {-128, 0, 8, -128, 0, 0, -128, -128, -128},
+    {0, -128, 8, -128, 0, 0, -128, -128, -128},
+    {-128, -128, 10, -128, 0, 0, -128, -128, -128},
+    {8, 8, -128, -128, 10, -7, -128, -128, -128},
+    {-128, 10, -128, -128, 10, 8, -128, -128, -128},
+    {10, -128, -128, -128, 10, 8, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -9, -128, -128, -128},
+    {-128, -128, -128, -128, -9, 0, -128, -128, -128},
+    {8, 0, 10, 8, -128, 8, -128, -128, -128},
+    {-128, 0, 10, 8, -128, 8, -128, -128, -128},
+    {-128, -128, 10, 8, -128, 8, -128, -128, -128},
+    {8, -128, 10, 8, -128, 8, -128, -128, -128},
+    {-128, -128, 10, 10, -128, 8, -128, -128, -128},
+    {-9, -9, -128, -9, -128, 0, -128, -128, -128},
+    {-128, -9, -128, 10, -128, 0, -128, -128, -128},
+    {-9, -128, -128, -9, -128, 0, -128, -128, -128},
+    {-128, -128, -128, -9, -128, 0, -128, -128, -128},
+    {-128, -128, -128, 10, -128, 0, -128, -128, -128},
+    {-128, 8, 10, -128, -128, 10, -128, -128, -128},
+    {10, -128, 10, -128, -128, 10, -128, -128, -128},
+    {-128, -128, 10, -128, -128, 10, -128, -128, -128},
+    {10, -9, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -9, -128, -128, -128, 10, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 10, -128, -128, -128},
+    {10, -128, -128, -128, -128, 10, -128, -128, -128},
+    {0, 0, 10, -128, -128, 0, -128, -128, -128},
+    {-128, 0, 10, -128, -128, 0, -128, -128, -128},
+    {0, -128, 10, -128, -128, 0, -128, -128, -128},
+    {-128, -128, 10, -128, -128, 0, -128, -128, -128},
+    {-128, -128, 10, -128, -128, 0, -128, -128, -128},
+    {-128, -9, -128, -128, -128, 0, -128, -128, -128},
+    {-9, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, -128, -128, -128, -128, 0, -128, -128, -128},
+    {-128, 8, -9, 10, -128, -9, -128, -128, -128},
+    {8, -128, -9, -9, -128, -9, -128, -128, -128},
+    {-128, -128, 10, 10, -128, 8, -128, -128, -128},
+    {-9, -9, -128, -9, -128, -9, -128, -128, -128},
+    {-128, 10, -128, 10, -128, -9, -128, -128, -128},
+    {10, -128, -128, -9, -128, -9, -128, -128, -128},
+    {-128, -128, -128, 10, -128, 0, -128, -128, -128},
+    {10, -9, -9, -128, -128, -9, -128, -128, -128},
+    {10, -128, -9, -128, -128, -9, -128, -128, -128},
+    {10, -9, -128, -128, -128, -9, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {-128, -128, 10, -128, -128, 0, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -9, -128, -128, -128},
+    {10, -128, -128, -128, -128, -9, -128, -128, -128},
+    {6, 6, -7, 8, 8, -128, -128, -128, -128},
+    {-128, -9, -9, -9, 8, -128, -128, -128, -128},
+    {-128, -128, -9, -9, 8, -128, -128, -128, -128},
+    {-9, -128, -9, -9, 8, -128, -128, -128, -128},
+    {-128, -128, -9, 10, 8, -128, -128, -128, -128},
+    {-128, -9, -128, -9, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {0, 0, -128, 8, 0, -128, -128, -128, -128},
+    {-128, 0, -128, 10, 0, -128, -128, -128, -128},
+    {0, -128, -128, 8, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 0, -128, -128, -128, -128},
+    {-128, -128, -128, 10, 0, -128, -128, -128, -128},
+    {-128, -9, -9, -128, 10, -128, -128, -128, -128},
+    {10, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {10, 8, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {10, -128, -128, -128, 10, -128, -128, -128, -128},
+    {0, 0, -7, -128, 0, -128, -128, -128, -128},
+    {-128, 0, 8, -128, 0, -128, -128, -128, -128},
+    {0, -128, 8, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -9, -128, 0, -128, -128, -128, -128},
+    {8, 8, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, 0, -128, -128, 0, -128, -128, -128, -128},
+    {0, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 0, -128, -128, -128, -128},
+    {-128, 8, 10, 10, -128, -128, -128, -128, -128},
+    {8, -128, 10, 10, -128, -128, -128, -128, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -128, -128},
+    {0, 0, -128, 10, -128, -128, -128, -128, -128},
+    {-128, 0, -128, 10, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {0, -128, -128, 10, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {0, 0, 10, -128, -128, -128, -128, -128, -128},
+    {-128, 0, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {0, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {0, 0, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -128, -128, -128, -128, -128, -128, -128},
+    {0, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -9, -9, -128, -128, -128, -128, -128},
+    {-128, 8, -9, 10, -128, -128, -128, -128, -128},
+    {8, -128, -9, -9, -128, -128, -128, -128, -128},
+    {-9, -9, -128, -9, -128, -128, -128, -128, -128},
+    {-128, 0, -128, 10, -128, -128, -128, -128, -128},
+    {0, -128, -128, -9, -128, -128, -128, -128, -128},
+    {-128, -128, -128, 10, -128, -128, -128, -128, -128},
+    {10, -9, -9, -128, -128, -128, -128, -128, -128},
+    {10, -9, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 0, -9, -128, -128, -128, -128, -128, -128},
+    {0, -128, -9, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -9, -128, -128, -128, -128, -128, -128, -128},
+    {-128, 10, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 8, 10, -9, -128, -128, -128, -128},
+    {-9, -128, 8, -9, -9, -128, -128, -128, -128},
+    {-128, -128, 10, 10, -9, -128, -128, -128, -128},
+    {8, 8, -128, 8, 10, -128, -128, -128, -128},
+    {-128, 10, -128, 10, 10, -128, -128, -128, -128},
+    {10, -128, -128, 8, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -9, 10, -128, -128, -128, -128},
+    {-128, -128, -128, 10, 10, -128, -128, -128, -128},
+    {10, -9, 8, -128, -9, -128, -128, -128, -128},
+    {10, -128, 8, -128, -9, -128, -128, -128, -128},
+    {-128, -128, -9, -128, -9, -128, -128, -128, -128},
+    {10, 8, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -9, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, -128, -128, 10, -128, -128, -128, -128},
+    {10, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -9, -128, -128, -128, -128},
+    {-128, 10, -128, -128, 10, -128, -128, -128, -128},
+    {10, -128, -128, -128, 10, -128, -128, -128, -128},
+    {-9, -9, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -9, 10, 10, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -9, -128, -128, -128, -128, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -128, -128},
+    {10, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {10, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -9, 10, -128, -128, -128, -128, -128, -128},
+    {-9, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, -128, -128, -128, -128, -128, -128},
+    {-128, -128, 10, 10, -128, -128, -128, -128, -128},
+    {-128, 10, -128, 10, -128, -128, -128, -128, -128},
+    {10, -128, -128, -9, -128, -128, -128, -128, -128},
+    {10, -128, -9, -128, -128, -128, -128, -128, -128},
+    {10, -9, -128, -128, -128, -128, -128, -128, -128},
+    {10, -128, -128, -128, -128, -128, -128, -128, -128}
+};
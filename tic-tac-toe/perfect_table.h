@@ -0,0 +1,25 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef PERFECT_TABLE_H  /* Run the following if PERFECT_TABLE_H has not been defined */
+#define PERFECT_TABLE_H  /* Defines PERFECT_TABLE_H */
+
+#include <stdint.h>
+#include "minimax.h"
+
+/*
+ * Move scores for every reachable position with the computer (X) to move,
+ * generated into perfect_table.c by tools/gen_perfect_table.c.
+ *
+ * key = perfectBase3[X cells] + 2 * perfectBase3[O cells]
+ * perfectIndex[key] = row of perfectScores, 0 if the position is not stored
+ * perfectScores[row][cell] = minimax() score of X playing cell, or
+ *                            PERFECT_NO_MOVE if the cell is taken
+ */
+#define PERFECT_TABLE_CELLS 9       // Table covers the 3x3 board only
+#define PERFECT_TABLE_KEYS 19683    // 3^9 boards
+#define PERFECT_NO_MOVE INT8_MIN    // Score stored for an occupied cell
+
+extern const uint16_t perfectBase3[1 << PERFECT_TABLE_CELLS];
+extern const uint16_t perfectIndex[PERFECT_TABLE_KEYS];
+extern const int8_t perfectScores[][PERFECT_TABLE_CELLS];
+
+#endif  /* End of header file */
@@ -0,0 +1,327 @@
+/* Define preprocessor statements */
+#include "pns.h"
+#include "gui.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Proof and disproof numbers of a position, seen from the side to move:
+// phi is the proof number at attacker nodes and the disproof number at
+// defender nodes, delta is the other one
+typedef struct {
+    uint64_t key;           // Position, side to move and attacker
+    uint32_t phi;
+    uint32_t delta;
+    uint32_t work;          // Nodes searched below the entry, larger entries are kept
+} PnsEntry;
+
+// Position being proven, one bitboard per side
+typedef struct {
+    Bitboard pieces[2];
+    int attacker;           // Side trying to prove a win
+} PnsState;
+
+static BoardGeometry geometry;
+static PnsEntry *table = NULL;
+static long nodes = 0;
+static long limit = 0;
+
+/*******************************************************************
+function: mix
+    scrambles 64 bits so similar positions land far apart
+
+    Input:
+    x - value to scramble
+
+    Return:
+    scrambled value
+********************************************************************/
+static inline uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/*******************************************************************
+function: positionKey
+    table key of a position
+
+    Input:
+    state - Pointer to the position
+    side - side to move
+
+    Return:
+    64-bit key
+********************************************************************/
+static inline uint64_t positionKey(const PnsState *state, int side) {
+    return mix(state->pieces[0] ^ mix(state->pieces[1] + 0x9E3779B97F4A7C15ULL)) ^ (uint64_t)(side * 2 + state->attacker);
+}
+
+/*******************************************************************
+function: attackerCanWin
+    checks the attacker still has a line free of the defender's
+    marks. Once every line is blocked the attacker cannot win,
+    which settles most drawn positions long before the board fills
+
+    Input:
+    state - Pointer to the position
+
+    Return:
+    boolean value - is any line still open to the attacker
+********************************************************************/
+static bool attackerCanWin(const PnsState *state) {
+    Bitboard defender = state->pieces[!state->attacker];
+
+    for(int i = 0; i < geometry.lineCount; i++) {
+        if(!(geometry.lines[i] & defender)) return true;
+    }
+    return false;
+}
+
+/*******************************************************************
+function: lookup
+    reads the numbers stored for a position. Unknown positions
+    start at 1 and 1, finished games are settled straight away
+
+    Input:
+    state - Pointer to the position
+    side - side to move
+    phi - receives the proof number from the side to move's view
+    delta - receives the disproof number from the side to move's view
+********************************************************************/
+static void lookup(const PnsState *state, int side, uint32_t *phi, uint32_t *delta) {
+    uint64_t key = positionKey(state, side);
+    PnsEntry *bucket = &table[(key % (PNS_TABLE_ENTRIES / 2)) * 2];
+
+    for(int i = 0; i < 2; i++) {
+        if(bucket[i].key == key) {
+            *phi = bucket[i].phi;
+            *delta = bucket[i].delta;
+            return;
+        }
+    }
+
+    // Attacker proven or disproven, as proof and disproof number
+    uint32_t pn = 1;
+    uint32_t dn = 1;
+    if(bbHasWon(&geometry, state->pieces[!side])) {
+        bool attackerWon = ((!side) == state->attacker);
+        pn = attackerWon ? 0 : PNS_INFINITY;
+        dn = attackerWon ? PNS_INFINITY : 0;
+    }
+    else if(!attackerCanWin(state)) {
+        // A draw is not a win for the attacker
+        pn = PNS_INFINITY;
+        dn = 0;
+    }
+    *phi = (side == state->attacker) ? pn : dn;
+    *delta = (side == state->attacker) ? dn : pn;
+}
+
+/*******************************************************************
+function: store
+    saves the numbers of a position, the bucket keeps whichever
+    entries took more work to find
+
+    Input:
+    state - Pointer to the position
+    side - side to move
+    phi - proof number from the side to move's view
+    delta - disproof number from the side to move's view
+    work - nodes searched to find them
+********************************************************************/
+static void store(const PnsState *state, int side, uint32_t phi, uint32_t delta, long work) {
+    uint64_t key = positionKey(state, side);
+    PnsEntry *bucket = &table[(key % (PNS_TABLE_ENTRIES / 2)) * 2];
+    PnsEntry *slot = (bucket[0].key == key || (bucket[1].key != key && bucket[0].work <= bucket[1].work)) ? &bucket[0] : &bucket[1];
+
+    slot->key = key;
+    slot->phi = phi;
+    slot->delta = delta;
+    slot->work = (work > UINT32_MAX) ? UINT32_MAX : (uint32_t)work;
+}
+
+/*******************************************************************
+function: addCapped
+    sum of numbers that saturates at PNS_INFINITY
+********************************************************************/
+static inline uint32_t addCapped(uint32_t a, uint32_t b) {
+    return (a + (uint64_t)b >= PNS_INFINITY) ? PNS_INFINITY : a + b;
+}
+
+/*******************************************************************
+function: mid
+    depth-first proof-number search (df-pn). Expands the most
+    proving child until the position's numbers reach the
+    thresholds, then stores them and returns to the parent
+
+    Input:
+    state - Pointer to the position, unchanged on return
+    side - side to move
+    thPhi - threshold for phi
+    thDelta - threshold for delta
+********************************************************************/
+static void mid(PnsState *state, int side, uint32_t thPhi, uint32_t thDelta) {
+    long startNodes = nodes++;
+    uint32_t phi;
+    uint32_t delta;
+
+    lookup(state, side, &phi, &delta);
+    if(phi >= thPhi || delta >= thDelta) return;
+
+    Bitboard moves = geometry.full & ~(state->pieces[0] | state->pieces[1]);
+    int cells[MAX_CELLS];
+    int count = 0;
+    for(; moves; moves &= moves - 1) cells[count++] = BB_FIRST(moves);
+
+    // No moves left, the side to move cannot win from here
+    if(count == 0) {
+        store(state, side, PNS_INFINITY, 0, nodes - startNodes);
+        return;
+    }
+
+    while(nodes < limit) {
+        // phi is the smallest child delta, delta the sum of child phis
+        uint32_t childPhi[MAX_CELLS];
+        uint32_t childDelta[MAX_CELLS];
+        int best = 0;
+        uint32_t secondDelta = PNS_INFINITY;
+        phi = PNS_INFINITY;
+        delta = 0;
+
+        for(int i = 0; i < count; i++) {
+            state->pieces[side] |= BB_CELL(cells[i]);
+            lookup(state, !side, &childPhi[i], &childDelta[i]);
+            state->pieces[side] &= ~BB_CELL(cells[i]);
+
+            delta = addCapped(delta, childPhi[i]);
+            if(childDelta[i] < phi) {
+                secondDelta = phi;
+                phi = childDelta[i];
+                best = i;
+            }
+            else if(childDelta[i] < secondDelta) {
+                secondDelta = childDelta[i];
+            }
+        }
+
+        if(phi >= thPhi || delta >= thDelta) break;
+
+        // Search the best child until it stops being best or the parent's thresholds are reached
+        uint32_t childThPhi = addCapped(thDelta - delta, childPhi[best]);
+        uint32_t childThDelta = (thPhi < addCapped(secondDelta, 1)) ? thPhi : addCapped(secondDelta, 1);
+
+        state->pieces[side] |= BB_CELL(cells[best]);
+        mid(state, !side, childThPhi, childThDelta);
+        state->pieces[side] &= ~BB_CELL(cells[best]);
+    }
+
+    store(state, side, phi, delta, nodes - startNodes);
+}
+
+/*******************************************************************
+function: prove
+    tries to prove that the attacker can force a win
+
+    Input:
+    state - Pointer to the position, attacker set
+    side - side to move
+
+    Return:
+    1 proven, 0 disproven, -1 node limit reached
+********************************************************************/
+static int prove(PnsState *state, int side) {
+    uint32_t phi;
+    uint32_t delta;
+
+    mid(state, side, PNS_INFINITY, PNS_INFINITY);
+    lookup(state, side, &phi, &delta);
+
+    uint32_t pn = (side == state->attacker) ? phi : delta;
+    uint32_t dn = (side == state->attacker) ? delta : phi;
+    if(pn == 0) return 1;
+    if(dn == 0) return 0;
+    return -1;
+}
+
+/*******************************************************************
+function: pnsSolve
+    proves whether a position is won, drawn or lost with two
+    proof-number searches: can the side to move force a win,
+    and if not, can the other side. Settled positions stay in
+    the table for later calls with the same rules
+
+    Input:
+    board - game board, size x size cells are used
+    size - board side, MIN_BOARD_SIZE to MAX_BITBOARD_SIZE
+    winLength - marks in a row needed to win
+    toMove - X_PLAYER or O_PLAYER
+    nodeLimit - positions to expand before giving up, shared by both searches
+
+    Return:
+    PNS_WIN, PNS_DRAW or PNS_LOSS for toMove, PNS_UNKNOWN if the
+    limit was reached first
+********************************************************************/
+int pnsSolve(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, int winLength, char toMove, long nodeLimit) {
+    if(size < MIN_BOARD_SIZE || size > MAX_BITBOARD_SIZE || winLength < MIN_WIN_LENGTH || winLength > size) return PNS_UNKNOWN;
+
+    if(!table) {
+        table = calloc(PNS_TABLE_ENTRIES, sizeof(PnsEntry));
+        if(!table) {
+            fprintf(stderr, "Failed to allocate proof table\n");
+            return PNS_UNKNOWN;
+        }
+    }
+    // Stored numbers only hold for the rules they were found under
+    if(geometry.size != size || geometry.winLength != winLength) {
+        bbGeometryInit(&geometry, size, winLength);
+        for(int i = 0; i < PNS_TABLE_ENTRIES; i++) table[i] = (PnsEntry){0};
+    }
+
+    // Side 0 = X, side 1 = O
+    PnsState state = {{0, 0}, 0};
+    for(int i = 0; i < size; i++) {
+        for(int j = 0; j < size; j++) {
+            if(board[i][j] == X_PLAYER) state.pieces[0] |= BB_CELL(i * size + j);
+            if(board[i][j] == O_PLAYER) state.pieces[1] |= BB_CELL(i * size + j);
+        }
+    }
+    int side = (toMove == X_PLAYER) ? 0 : 1;
+
+    nodes = 0;
+    limit = nodeLimit;
+
+    state.attacker = side;
+    int result = prove(&state, side);
+    if(result == 1) return PNS_WIN;
+    if(result < 0) return PNS_UNKNOWN;
+
+    state.attacker = !side;
+    result = prove(&state, side);
+    if(result == 1) return PNS_LOSS;
+    if(result < 0) return PNS_UNKNOWN;
+    return PNS_DRAW;
+}
+
+/*******************************************************************
+function: pnsNodes
+    positions expanded by the last pnsSolve() call
+
+    Return:
+    node count
+********************************************************************/
+long pnsNodes(void) {
+    return nodes;
+}
+
+/*******************************************************************
+function: pnsFree
+    releases the proof table, the next pnsSolve() allocates it again
+********************************************************************/
+void pnsFree(void) {
+    free(table);
+    table = NULL;
+    geometry.size = 0;
+}
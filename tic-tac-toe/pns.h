@@ -0,0 +1,20 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef PNS_H  /* Run the following if PNS_H has not been defined */
+#define PNS_H  /* Defines PNS_H */
+
+#include "bitboard.h"
+
+#define PNS_TABLE_ENTRIES (1 << 20)     // Proof table slots, fixed so memory stays bounded
+#define PNS_INFINITY 100000000          // Proof or disproof number of a settled position
+
+// Results of pnsSolve() for the side to move
+#define PNS_UNKNOWN 0   // Node limit reached first
+#define PNS_WIN 1
+#define PNS_DRAW 2
+#define PNS_LOSS 3
+
+int pnsSolve(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, int winLength, char toMove, long nodeLimit);
+long pnsNodes(void);
+void pnsFree(void);
+
+#endif  /* End of header file */
@@ -2,12 +2,13 @@
 
 const float LR = 0.2f;      // Learning rate for Q-value updates
 const float DECAY = 0.9f;   // Decay factor for exploration rate over episodes
+const int Q_POW3[MAX_LENGTH] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};  // Weight of each cell in the board index
 
 /***
  * initPlayer(): Initialise a Player
  * 
- * Allocates memory for the Q-table, sets the player's state to default, 
- * and assigns an exploration rate
+ * Allocates the Q-table with every board unknown, clears the player's
+ * states and assigns an exploration rate
  * 
  * params:
  *  - Player *player: pointer to the Player object to initialise
@@ -16,22 +17,16 @@ const float DECAY = 0.9f;   // Decay factor for exploration rate over episodes
 void initPlayer(Player *player, float exp_rate){
     DEBUG_PRINT("Initialising Player...\n");
 
-    // Initialise player's sate array to zero
-    memset(player->state, 0, sizeof(player->state));
+    // No states recorded yet
+    player->states = 0;
 
-    // Allocate memory for Q-table entries and initialise values
-    for(int i = 0; i< QTABLE_LENGTH; i++){
-        player->state_val[i] = malloc(sizeof(Qvalue));  // Allocate memory for a Qvalue struct
+    // Allocate the Q-table in one block, every value 0 and every board unknown
+    player->state_val = newQTable();
 
-        // Check if memory allocation was successful
-        if(!player->state_val[i]){
-            fprintf(stderr, "Memory allocation failed for Q-table enter %d\n", i);
-            exit(EXIT_FAILURE); // Exit the program is memory allocation fails
-        }
-
-        // Initialise the key and value of Qvalue struct
-        memset(player->state_val[i]->key, 0, sizeof(player->state_val[i]->key));    // Set the key array to zero
-        player->state_val[i]->val = 0.0f;   // Set the Q-value to 0.0
+    // Check if memory allocation was successful
+    if(!player->state_val){
+        fprintf(stderr, "Memory allocation failed for Q-table\n");
+        exit(EXIT_FAILURE); // Exit the program is memory allocation fails
     }
 
     // Set player's exploration rate to the provided value
@@ -41,6 +36,56 @@ void initPlayer(Player *player, float exp_rate){
 }
 
 
+/***
+ * freePlayer(): Release a Player's Q-table
+ * 
+ * params:
+ *  - Player *player: player set up by initPlayer()
+ */
+void freePlayer(Player *player){
+    freeQTable(player->state_val);
+    player->state_val = NULL;
+}
+
+
+/***
+ * newQTable(): Allocate an empty Q-table
+ * 
+ * The whole table is one block starting on a cache line, the values come
+ * first and the known flags after them, so lookups read neighbouring memory.
+ * 
+ * return:
+ *  - QTable*: every value 0 and every board unknown, NULL if out of memory.
+ *    Release it with freeQTable()
+ */
+QTable *newQTable(void){
+    // aligned_alloc() wants a whole number of alignment steps
+    size_t size = (sizeof(QTable) + QTABLE_ALIGN - 1) / QTABLE_ALIGN * QTABLE_ALIGN;
+#ifdef _WIN32
+    QTable *q_table = _aligned_malloc(size, QTABLE_ALIGN);
+#else
+    QTable *q_table = aligned_alloc(QTABLE_ALIGN, size);
+#endif
+    if(q_table) memset(q_table, 0, sizeof(QTable));
+    return q_table;
+}
+
+
+/***
+ * freeQTable(): Release a Q-table from newQTable()
+ * 
+ * params:
+ *  - QTable *q_table: table to release, may be NULL
+ */
+void freeQTable(QTable *q_table){
+#ifdef _WIN32
+    _aligned_free(q_table);
+#else
+    free(q_table);
+#endif
+}
+
+
 /***
  * startingPlayer(): Determine the starting player
  * 
@@ -65,9 +110,9 @@ int startingPlayer(){
  *  - int board[3][3]: game board to reset
  */
 void reset(Player players[2], int board[3][3]){
-    // Loop through each player to reset their state
+    // Loop through each player to forget their recorded states
     for(int p = 0; p<2; p++){
-        memset(players[p].state, 0, sizeof(players[p].state));  // Set player state to zero
+        players[p].states = 0;
     }
 
     // Clear the game board by setting all cells to 0 (empty)
@@ -82,11 +127,14 @@ void reset(Player players[2], int board[3][3]){
  * integer-based board (-1 for CPU, 1 for HUMAN, 0 for BOARD_BLANK)for 
  * the AI to process and learn.
  * 
+ * The Q-table only knows the 3x3 board, so only the top-left 3x3 cells of the
+ * GUI board are converted. The GUI switches to 3x3 for this game mode.
+ * 
  * params:
- *  - char board[3][3]: character board to convert
+ *  - char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]: character board to convert
  *  - int convertedState[3][3]: integer board to store converted values
  */
-void convertBoard(char board[3][3], int convertedState[3][3]){
+void convertBoard(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int convertedState[3][3]){
     DEBUG_PRINT("Converting Board...\n");
     
     // Loop through each cell in the character board
@@ -160,72 +208,80 @@ int availPos(int board[3][3], Coord availCoord[9]){
 
 
 /***
- * defaultQValue: Set default Q-value for a new state
+ * stateIndex(): Base-3 index of a board
  * 
- * Adds a new state to the Q-table with a default Q-value of 0. If the Q-table is full,
- * the function exits with an error.
+ * Every 3x3 board has its own index from 0 to QTABLE_STATES - 1, so the Q-table
+ * can store the value of a board at that index instead of searching for it.
+ * Cell i adds Q_DIGIT(cell) * Q_POW3[i].
  * 
  * params:
- * - Qvalue *q_table[QTABLE_LENGTH]: pointer to Q-table where the state will be added.
- * - int state[]: The new state to be added as a key in the Q-table.
+ * - const int state[MAX_LENGTH]: flattened board
  * 
+ * return:
+ * - int: index of the board in the Q-table
  */
-void defaultQValue(Qvalue *q_table[QTABLE_LENGTH], int state[]) {
-    for (int i = 0; i < QTABLE_LENGTH; i++) {
-        if (q_table[i]->key[0] == 0) { // Check if the key is empty (first element is 0)
-            memcpy(q_table[i]->key, state, MAX_LENGTH * sizeof(int)); // Copy the state
-            q_table[i]->val = 0.0f; // Initialise the Q-value as 0
-            DEBUG_PRINT("Default value set for Q-value at index %d\n", i);
-            return;
-        }
+int stateIndex(const int state[MAX_LENGTH]) {
+    int index = 0;
+    for (int i = 0; i < MAX_LENGTH; i++) {
+        index += Q_DIGIT(state[i]) * Q_POW3[i];
     }
-    fprintf(stderr, "Error: Q-table is full, cannot add new state.\n");
-    exit(EXIT_FAILURE); // Ensure the program exits gracefully when Q-table is full
+    return index;
+}
+
+
+/***
+ * defaultQValue: Set default Q-value for a new state
+ * 
+ * Marks a state as known in the Q-table with a default Q-value of 0.
+ * 
+ * params:
+ * - QTable *q_table: pointer to Q-table where the state will be added.
+ * - int state[]: The new state to be added to the Q-table.
+ * 
+ */
+void defaultQValue(QTable *q_table, int state[]) {
+    int index = stateIndex(state);
+    q_table->known[index] = true;
+    q_table->val[index] = 0.0f; // Initialise the Q-value as 0
+    DEBUG_PRINT("Default value set for Q-value at index %d\n", index);
 }
 
 
 /***
  * findQValue(): Find the index of a state in the Q-table
  * 
- * Searches for a given state in the Q-table. If the state is found, its index is returned;
+ * Looks up a given state in the Q-table. If the state is known, its index is returned;
  * otherwise, the function returns -1.
  * 
  * params:
- * - int state[MAX_LENGTH]: The state to search for in the Q-table.
- * - Qvalue *q_table[QTABLE_LENGTH]: pointer to Q-table where the state is being searched.
+ * - int state[MAX_LENGTH]: The state to look up in the Q-table.
+ * - QTable *q_table: pointer to Q-table where the state is being looked up.
  * 
  * return:
- * - int: Index of the state in the Q-table if found, otherwise -1.
+ * - int: Index of the state in the Q-table if known, otherwise -1.
  */
-int findQValue(int state[MAX_LENGTH], Qvalue *q_table[QTABLE_LENGTH]) {
-    for (int i = 0; i < QTABLE_LENGTH; i++) {
-        if (q_table[i]->key[0] == 0) break; // Stop searching when reaching an empty slot
-        if (memcmp(q_table[i]->key, state, MAX_LENGTH * sizeof(int)) == 0) {
-            return i; // State found
-        }
-    }
-    return -1; // State not found
+int findQValue(int state[MAX_LENGTH], QTable *q_table) {
+    int index = stateIndex(state);
+    return q_table->known[index] ? index : -1;
 }
 
 
 /***
  * addState(): Add a state to the player's state array
  * 
- * Adds a new state to the player's array of visited states during a game. If the state
+ * Appends a new state to the player's array of visited states during a game. If the state
  * array is full, the function exits with an error.
  * 
  * params:
  * - Player *p: pointer to player object to which the state will be added.
- * - int board1d[MAX_LENGTH]: The state to add, represented as a flattened board array.
+ * - int index: The state to add, as its board index (see stateIndex()).
  * 
  */
-void addState(Player *p, int board1d[MAX_LENGTH]) {
-    for (int i = 0; i < MAX_STRINGS; i++) {
-        if (p->state[i][0] == 0) { // Find the first empty slot
-            memcpy(p->state[i], board1d, MAX_LENGTH * sizeof(int)); // Copy the state
-            DEBUG_PRINT("State added at index %d\n", i);
-            return;
-        }
+void addState(Player *p, int index) {
+    if (p->states < MAX_TRAJECTORY) {
+        p->state[p->states++] = index;
+        DEBUG_PRINT("State added at index %d\n", p->states - 1);
+        return;
     }
     fprintf(stderr, "Error: Player state array is full, cannot add new state.\n");
     exit(EXIT_FAILURE); // Ensure the program exits gracefully when the state array is full
@@ -248,28 +304,22 @@ void updateQtable(Player *player, int winner) {
     float reward = (winner == 1) ? 0.0f : (winner == -1) ? 1.0f : 0.5f; // Define the reward
     DEBUG_PRINT("Updating Q-table with reward %.2f\n", reward);
 
-    for (int i = MAX_STRINGS - 1; i >= 0; i--) {
-        if (player->state[i][0] == 0) continue; // Skip uninitialised states
+    QTable *q_table = player->state_val;
 
-        int q_index = findQValue(player->state[i], player->state_val);
-        if (q_index == -1) {
-            defaultQValue(player->state_val, player->state[i]); // Add new state to Q-table
-            q_index = findQValue(player->state[i], player->state_val);
-        }
+    for (int i = player->states - 1; i >= 0; i--) {
+        int q_index = player->state[i];
+        q_table->known[q_index] = true; // New states start from the default value 0
 
         // Compute the maximum Q-value for the next state
         float max_next_q = 0.0f;
-        if (i + 1 < MAX_STRINGS && player->state[i + 1][0] != 0) {
-            int next_q_index = findQValue(player->state[i + 1], player->state_val);
-            if (next_q_index != -1) {
-                max_next_q = player->state_val[next_q_index]->val;
-            }
+        if (i + 1 < player->states) {
+            max_next_q = q_table->val[player->state[i + 1]];
         }
 
         // Apply the Q-learning formula
-        player->state_val[q_index]->val += LR * (reward + DECAY * max_next_q - player->state_val[q_index]->val);
+        q_table->val[q_index] += LR * (reward + DECAY * max_next_q - q_table->val[q_index]);
 
-        DEBUG_PRINT("Updated Q-value at index %d: %.2f\n", q_index, player->state_val[q_index]->val);
+        DEBUG_PRINT("Updated Q-value at index %d: %.2f\n", q_index, q_table->val[q_index]);
         reward *= DECAY; // Propagate reward backward through visited states
     }
     DEBUG_PRINT("Q-table updated successfully.\n");
@@ -286,40 +336,29 @@ void updateQtable(Player *player, int winner) {
  *  - int pos_index: number of available positions
  *  - int board[3][3]: current game board
  *  - int playerSym: symbol representing the AI player
- *  - Player *p: pointer to the AI Player object
+ *  - const QTable *q_table: Q-values of the model, only read
+ *  - float exp_rate: chance of playing a random move instead
  * 
  * return:
  *  - Coord: AI's chosen position
  */
-Coord aiMove(Coord position[], int pos_index, int board[3][3], int playerSym, Player *p){
+Coord aiMove(Coord position[], int pos_index, int board[3][3], int playerSym, const QTable *q_table, float exp_rate){
     float max_val = -1e9;   // Initialise max_val to a very small number
     Coord best_action = position[0];    // Default to first available position
 
     // Exploration
-    if((float)rand() / RAND_MAX < p->exp_rate){
+    if((float)rand() / RAND_MAX < exp_rate){
         int rand_index = rand() % pos_index;    // Pick a ranom position
         return position[rand_index];
     }
 
     // Exploitation
-    for(int i = 0; i< pos_index; i++){
-        int nextBoard[3][3];
+    int index = stateIndex(&board[0][0]);   // Index of the current board
 
-        memcpy(nextBoard, board, sizeof(nextBoard));    // Copy current board
-
-        nextBoard[position[i].row][position[i].col] = playerSym;    // Simulate move
-
-        int board1d[MAX_LENGTH];
-        memcpy(board1d, &nextBoard[0][0], sizeof(board1d)); // Convert board to 1D array
-
-        // Search Q-value for the a given state
-        float q_val = 0.0f;
-        for(int j=0; j< QTABLE_LENGTH; j++){
-            if(memcmp(board1d, p->state_val[j]->key, MAX_LENGTH * sizeof(int)) == 0){
-                q_val = p->state_val[j]->val;
-                break;
-            }
-        }
+    for(int i = 0; i< pos_index; i++){
+        // Index of the board after the move, unknown boards have the value 0
+        int next = index + Q_DIGIT(playerSym) * Q_POW3[position[i].row * 3 + position[i].col];
+        float q_val = q_table->val[next];
 
         // Update best action based on Q-value
         if (q_val > max_val){
@@ -378,6 +417,7 @@ Coord playerMove(Coord position[], int pos_index, int board[3][3]){
  */
 void updateBoardState(int board[3][3], Coord action, Game *game){
     board[action.row][action.col] = game->playing;  // Update the board with current player's symbol
+    game->index += Q_DIGIT(game->playing) * Q_POW3[action.row * 3 + action.col];    // Update the board index
     game->playing = -game->playing; // Switch player
 }
 
@@ -406,10 +446,10 @@ int check_win(int board[3][3], Game *game){
             col_sum += board[j][i]; // Sum the column
         }
 
-        // Check if any row or column is a win
+        // Check if any row or column is a win, the full line decides the winner
         if(abs(row_sum) == 3 || abs(col_sum) == 3){
             game->game_status = true;   // Mark the game as finished
-            return row_sum > 0 || col_sum > 0 ? HUMAN : CPU;
+            return row_sum == 3 || col_sum == 3 ? HUMAN : CPU;
         }
 
         diag_sum1 += board[i][i];   // Sum for the first diagonal (Top Left to Bottom Right)
@@ -419,7 +459,7 @@ int check_win(int board[3][3], Game *game){
     // Check if any diagonal is a win
     if (abs(diag_sum1) == 3 || abs(diag_sum2) == 3){
         game->game_status = true;   // Mark the game as finished
-        return diag_sum1 > 0 || diag_sum2 > 0? HUMAN : CPU; // Return winner
+        return diag_sum1 == 3 || diag_sum2 == 3 ? HUMAN : CPU; // Return winner
     }
 
     // check for draw
@@ -433,16 +473,166 @@ int check_win(int board[3][3], Game *game){
 }
 
 
+/***
+ * qChecksum(): FNV-1a hash of the bytes after the Q-table file header
+ * 
+ * params:
+ *  - const void *data: bytes to hash
+ *  - size_t length: number of bytes
+ * 
+ * return:
+ *  - uint32_t: 32-bit FNV-1a hash
+ */
+static uint32_t qChecksum(const void *data, size_t length){
+    const unsigned char *bytes = data;
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < length; i++){
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+
+/***
+ * floatToHalf(): Round a float to IEEE 754 half precision
+ * 
+ * Values too small for a half become 0, values too large become infinity.
+ * 
+ * params:
+ *  - float value: value to convert
+ * 
+ * return:
+ *  - uint16_t: half precision bits
+ */
+static uint16_t floatToHalf(float value){
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = (bits >> 16) & 0x8000;
+    int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if(exponent >= 31) return sign | 0x7C00;   // Too large, infinity
+    if(exponent <= 0){
+        if(exponent < -10) return sign;         // Too small, 0
+        mantissa |= 0x800000;                   // Subnormal half, shift in the hidden bit
+        int shift = 14 - exponent;
+        return sign | (uint16_t)((mantissa + (1u << (shift - 1))) >> shift);
+    }
+    // Round to nearest, a carry into the exponent is still correct
+    return sign | (uint16_t)(((uint32_t)exponent << 10) + ((mantissa + 0x1000) >> 13));
+}
+
+
+/***
+ * halfToFloat(): Widen an IEEE 754 half precision value to a float
+ * 
+ * params:
+ *  - uint16_t half: half precision bits
+ * 
+ * return:
+ *  - float: the same value
+ */
+static float halfToFloat(uint16_t half){
+    int exponent = (half >> 10) & 0x1F;
+    int mantissa = half & 0x3FF;
+    float value;
+
+    if(exponent == 0) value = mantissa / 16777216.0f;                       // Subnormal, mantissa * 2^-24
+    else if(exponent == 31) value = mantissa ? NAN : INFINITY;
+    else value = ldexpf(1.0f + mantissa / 1024.0f, exponent - 15);
+
+    return (half & 0x8000) ? -value : value;
+}
+
+
+/***
+ * qValueBytes(): Bytes taken by one value in the Q-table file
+ * 
+ * params:
+ *  - uint32_t format: QValueFormat of the values
+ * 
+ * return:
+ *  - size_t: bytes per value, 0 for an unknown format
+ */
+static size_t qValueBytes(uint32_t format){
+    switch(format){
+        case QFORMAT_FLOAT32: return sizeof(float);
+        case QFORMAT_FLOAT16: return sizeof(uint16_t);
+        case QFORMAT_INT8: return sizeof(uint8_t);
+        default: return 0;  // QFORMAT_DENSE has no separate values
+    }
+}
+
+
 /***
  * saveQTable(): Save Q-table to a file
  * 
- * Serializes and saves the Q-table to a binary file for future use.
+ * Writes the known boards of the Q-table to a binary file for future use:
+ * a QTableHeader, the board index of each known board, then their values
+ * in the given format. INT8 values are scaled between the lowest and highest value.
+ * QFORMAT_DENSE writes the whole QTable after the padded header instead.
  * 
  * params:
- *  - Qvalue *q_table[QTABLE_LENGTH]: pointer to Q-table to save
+ *  - QTable *q_table: pointer to Q-table to save
  *  - const char *filename: binary filename to save the Q-table
+ *  - QValueFormat format: how the values are stored
  */
-void saveQTable(Qvalue *q_table[QTABLE_LENGTH], const char *filename){
+void saveQTable(QTable *q_table, const char *filename, QValueFormat format){
+    QTableHeader header = {.magic = {0}, .version = QTABLE_VERSION, .size = 3, .format = format, .scale = 1.0f};
+    memcpy(header.magic, QTABLE_MAGIC, sizeof(header.magic));
+
+    size_t valueBytes = qValueBytes(format);
+    bool dense = (format == QFORMAT_DENSE);
+    if(!valueBytes && !dense){
+        fprintf(stderr, "Failed to save Q-table: unknown value format\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Range of the known values, INT8 is spread across it
+    float low = 0.0f, high = 0.0f;
+    for(int i = 0; i < QTABLE_STATES; i++){
+        if(!q_table->known[i]) continue;
+        if(header.entries == 0 || q_table->val[i] < low) low = q_table->val[i];
+        if(header.entries == 0 || q_table->val[i] > high) high = q_table->val[i];
+        header.entries++;
+    }
+    if(format == QFORMAT_INT8){
+        header.offset = low;
+        header.scale = (high > low) ? (high - low) / 255.0f : 1.0f;
+    }
+
+    // Dense tables are written as they are, other formats are packed first
+    unsigned char *payload = dense ? NULL : malloc(header.entries * (sizeof(uint16_t) + valueBytes) + 1);
+    if(!dense && !payload){
+        fprintf(stderr, "Failed to save Q-table: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Keys first, values after all of them
+    unsigned char *values = dense ? NULL : payload + header.entries * sizeof(uint16_t);
+    uint32_t entry = 0;
+    for(int i = 0; !dense && i < QTABLE_STATES; i++){
+        if(!q_table->known[i]) continue;
+        float val = q_table->val[i];
+        uint16_t key = (uint16_t)i;
+        memcpy(payload + entry * sizeof(uint16_t), &key, sizeof(key));
+
+        if(format == QFORMAT_FLOAT32){
+            memcpy(values + entry * valueBytes, &val, sizeof(val));
+        } else if(format == QFORMAT_FLOAT16){
+            uint16_t half = floatToHalf(val);
+            memcpy(values + entry * valueBytes, &half, sizeof(half));
+        } else{
+            values[entry] = (uint8_t)lroundf((val - header.offset) / header.scale);
+        }
+        entry++;
+    }
+
+    const void *written = dense ? (const void *)q_table : payload;
+    size_t payloadBytes = dense ? sizeof(QTable) : header.entries * (sizeof(uint16_t) + valueBytes);
+    header.checksum = qChecksum(written, payloadBytes);
+
     FILE *file = fopen(filename, "wb"); // Open file in write-binary mode
 
     // Check if file is successfully opened
@@ -451,15 +641,17 @@ void saveQTable(Qvalue *q_table[QTABLE_LENGTH], const char *filename){
         exit(EXIT_FAILURE);
     }
 
-    // Write each Q-values to the file
-    for(int i = 0; i < QTABLE_LENGTH; i++){
-        if(q_table[i] != NULL){
-            fwrite(q_table[i]->key, sizeof(int), MAX_LENGTH, file); // Write the key
-            fwrite(&(q_table[i]->val), sizeof(float), 1, file);     // Write the value
-        } 
+    static const unsigned char padding[QTABLE_DENSE_OFFSET] = {0};
+    size_t paddingBytes = dense ? QTABLE_DENSE_OFFSET - sizeof(header) : 0;
+
+    if(fwrite(&header, sizeof(header), 1, file) != 1 || fwrite(padding, 1, paddingBytes, file) != paddingBytes ||
+       fwrite(written, 1, payloadBytes, file) != payloadBytes){
+        perror("Failed to write Q-table");
+        exit(EXIT_FAILURE);
     }
 
     fclose(file);   // Close the file after writing
+    free(payload);
     DEBUG_PRINT("Q-table saved successfully to %s\n", filename);
 }
 
@@ -467,35 +659,124 @@ void saveQTable(Qvalue *q_table[QTABLE_LENGTH], const char *filename){
 /***
  * loadQTable(): Load Q-table from a file
  * 
- * Reads a previously saved Q-table from a binary file and loads it into memory.
+ * Reads a Q-table written by saveQTable() into the slots of its boards. The
+ * header, file length, checksum and board indexes are checked first, the
+ * Q-table is left as it was if any of them is wrong.
  * 
  * params:
- *  - Qvalue *q_table[QTABLE_LENGTH]: pointer to array to store loaded Q-table entries
+ *  - QTable *q_table: pointer to Q-table to store loaded entries
  *  - const char *filename: binary filename of the saved Q-table
+ * 
+ * return:
+ *  - bool: true if the file was loaded, false if it is missing or corrupt
  */
-void loadQTable(Qvalue *q_table[QTABLE_LENGTH], const char *filename){
+bool loadQTable(QTable *q_table, const char *filename){
     FILE *file = fopen(filename, "rb"); // open file in read-binary mode
 
     // Check if file is successfully opened
     if(!file){
         perror("Failed to open file for loading Q-table");
-        exit(EXIT_FAILURE);
+        return false;
     }
 
-    // Read each Q-values from the file
-    for(int i=0; i< QTABLE_LENGTH; i++){
-        q_table[i] =malloc(sizeof(Qvalue)); // Allocate memory based off Qvalue struct size
-        
-        // Attempt to read key and value from file
-        if(fread(q_table[i]->key, sizeof(int), MAX_LENGTH, file) != MAX_LENGTH || 
-        fread(&(q_table[i]->val), sizeof(float), 1, file) != 1){
-            free(q_table[i]);   // Free memory if read fails
-            q_table[i] = NULL;  // set pointer to NULL
-            break;
-        }
+    QTableHeader header;
+    const char *problem = NULL;
+    unsigned char *payload = NULL;
+    size_t valueBytes = 0, payloadBytes = 0;
+
+    if(fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, QTABLE_MAGIC, sizeof(header.magic)) != 0){
+        problem = "not a Q-table file";
+    } else if(header.version != QTABLE_VERSION || header.size != 3){
+        problem = "unsupported version or board size";
+    } else if((!(valueBytes = qValueBytes(header.format)) && header.format != QFORMAT_DENSE) || header.entries > QTABLE_STATES){
+        problem = "bad value format or entry count";
+    } else{
+        bool dense = (header.format == QFORMAT_DENSE);
+        payloadBytes = dense ? sizeof(QTable) : header.entries * (sizeof(uint16_t) + valueBytes);
+        payload = malloc(payloadBytes ? payloadBytes : 1);
+        if(!payload) problem = "out of memory";
+        else if(dense && fseek(file, QTABLE_DENSE_OFFSET, SEEK_SET) != 0) problem = "wrong file length";
+        else if(fread(payload, 1, payloadBytes, file) != payloadBytes || fgetc(file) != EOF) problem = "wrong file length";
+        else if(qChecksum(payload, payloadBytes) != header.checksum) problem = "checksum mismatch";
     }
     fclose(file);   // Close the file after reading
+
+    // Dense tables hold every board, nothing more to check
+    if(!problem && header.format == QFORMAT_DENSE){
+        memcpy(q_table, payload, sizeof(QTable));
+        free(payload);
+        return true;
+    }
+
+    // Board indexes must be valid and strictly increasing, as saveQTable() writes them
+    for(uint32_t i = 0; !problem && i < header.entries; i++){
+        uint16_t key, previous = 0;
+        memcpy(&key, payload + i * sizeof(uint16_t), sizeof(key));
+        if(i > 0) memcpy(&previous, payload + (i - 1) * sizeof(uint16_t), sizeof(previous));
+        if(key >= QTABLE_STATES || (i > 0 && key <= previous)) problem = "bad board index";
+    }
+
+    if(problem){
+        fprintf(stderr, "Rejected Q-table %s: %s\n", filename, problem);
+        free(payload);
+        return false;
+    }
+
+    const unsigned char *values = payload + header.entries * sizeof(uint16_t);
+    for(uint32_t i = 0; i < header.entries; i++){
+        uint16_t key;
+        float val;
+        memcpy(&key, payload + i * sizeof(uint16_t), sizeof(key));
+
+        if(header.format == QFORMAT_FLOAT32){
+            memcpy(&val, values + i * valueBytes, sizeof(val));
+        } else if(header.format == QFORMAT_FLOAT16){
+            uint16_t half;
+            memcpy(&half, values + i * valueBytes, sizeof(half));
+            val = halfToFloat(half);
+        } else{
+            val = header.offset + values[i] * header.scale;
+        }
+        q_table->val[key] = val;
+        q_table->known[key] = true;
+    }
+
+    free(payload);
     DEBUG_PRINT("Q-table loaded successfully from %s\n", filename);
+    return true;
+}
+
+
+/***
+ * mapQTable(): Map a dense Q-table file for reading in place
+ * 
+ * Maps a QFORMAT_DENSE file written by saveQTable() and returns the QTable inside
+ * the mapping. Nothing is read or copied, the OS pages the values in as they are
+ * looked up and shares them between processes mapping the same file. Only the header
+ * and length are checked, the checksum would read the whole file.
+ * 
+ * params:
+ *  - MappedFile *map: filled with the mapping, release it with unmapFile()
+ *  - const char *filename: binary filename of the saved Q-table
+ * 
+ * return:
+ *  - const QTable*: Q-table inside the mapping, NULL if the file is missing or not dense
+ */
+const QTable *mapQTable(MappedFile *map, const char *filename){
+    if(!mapFile(map, filename)) return NULL;
+
+    QTableHeader header;
+    bool dense = false;
+    if(map->size == QTABLE_DENSE_OFFSET + sizeof(QTable)){
+        memcpy(&header, map->data, sizeof(header));
+        dense = memcmp(header.magic, QTABLE_MAGIC, sizeof(header.magic)) == 0 && header.version == QTABLE_VERSION &&
+                header.size == 3 && header.format == QFORMAT_DENSE;
+    }
+    if(!dense){
+        unmapFile(map);
+        return NULL;
+    }
+    return (const QTable *)(map->data + QTABLE_DENSE_OFFSET);
 }
 
 
@@ -537,9 +818,7 @@ void trainModel(int episode, int board[3][3]){
                 
                 updateBoardState(board, action, &game); // Update board
 
-                int board1d[MAX_LENGTH];
-                memcpy(board1d, &board, sizeof(board1d)); // Convert board to 1D array
-                addState(&players[p], board1d);
+                addState(&players[p], game.index); // Record the board after the move
 
                 // Get game status
                 int win = check_win(board, &game);
@@ -553,7 +832,9 @@ void trainModel(int episode, int board[3][3]){
                     } else{
                         draw += 1;
                     }
-                    updateQtable(&players[p], win); // If got winner, update Q-table
+                    // Game over, both players learn from it, the loser too
+                    updateQtable(&players[0], win);
+                    updateQtable(&players[1], win);
                     break;
                 }
             }
@@ -563,7 +844,98 @@ void trainModel(int episode, int board[3][3]){
     printf("Total Game Player 2 Won = %d\n", win2);
     printf("Total Game Draws = %d\n", draw);
     // Save trained Q-table to file for future use
-    saveQTable(players[0].state_val, "q_table.bin");
+    saveQTable(players[0].state_val, QTABLE_FILE, QFORMAT_DENSE);
+
+    // Release both players' Q-tables
+    for(int p = 0; p < 2; p++){
+        freePlayer(&players[p]);
+    }
+}
+
+
+// Model played by guiMLmove() and pve(), loaded once per process and kept until qModelRelease()
+static struct{
+    pthread_once_t once;        // Runs loadModel() exactly once, callers wait for it
+    pthread_t preloader;        // Thread started by qModelPreload()
+    bool preloading;            // preloader is not joined yet
+    const QTable *table;        // NULL when QTABLE_FILE is missing or corrupt
+    QTable *loaded;             // Heap copy when the file is not dense
+    MappedFile map;             // Mapping when the file is dense
+} model = {.once = PTHREAD_ONCE_INIT};
+
+
+/***
+ * loadModel(): Read the trained model into model.table
+ * 
+ * Embedded builds use the compiled in model without any file I/O. Otherwise a
+ * dense QTABLE_FILE is used in place through a mapping, other formats are loaded
+ * into memory. Called once through model.once.
+ */
+static void loadModel(void){
+#if Q_EMBEDDED_MODEL
+    model.table = &qEmbeddedModel;
+#else
+    model.table = mapQTable(&model.map, QTABLE_FILE);
+    if(model.table) return;
+
+    model.loaded = newQTable();
+    if(model.loaded && loadQTable(model.loaded, QTABLE_FILE)){
+        model.table = model.loaded;
+    } else{
+        freeQTable(model.loaded);
+        model.loaded = NULL;
+    }
+#endif
+}
+
+
+/***
+ * preloadThread(): Background thread of qModelPreload()
+ */
+static void *preloadThread(void *arg){
+    (void)arg;
+    pthread_once(&model.once, loadModel);
+    return NULL;
+}
+
+
+/***
+ * qModelPreload(): Start loading the trained model in the background
+ * 
+ * Optional, lets the first move in Q-learning mode find the model ready.
+ * The model is loaded on that move when this is not called.
+ */
+void qModelPreload(void){
+    if(model.preloading) return;
+    model.preloading = (pthread_create(&model.preloader, NULL, preloadThread, NULL) == 0);
+}
+
+
+/***
+ * qModel(): Trained model played by the AI
+ * 
+ * Loads the model the first time, waiting for qModelPreload() if it started.
+ * Later calls return the same table without any work.
+ * 
+ * return:
+ *  - const QTable*: the model, NULL if QTABLE_FILE is missing or corrupt
+ */
+const QTable *qModel(void){
+    pthread_once(&model.once, loadModel);
+    return model.table;
+}
+
+
+/***
+ * qModelRelease(): Free the trained model when the program ends
+ */
+void qModelRelease(void){
+    if(model.preloading) pthread_join(model.preloader, NULL);
+    model.preloading = false;
+    if(model.map.data) unmapFile(&model.map);
+    freeQTable(model.loaded);
+    model.loaded = NULL;
+    model.table = NULL;
 }
 
 
@@ -576,12 +948,11 @@ void trainModel(int episode, int board[3][3]){
  *  - int board[3][3]: converted intger 2D character board array
  */
 void pve(int board[3][3]){
-    Player ai;
+    float exp_rate = 0.2f;  // AI's exploration rate
 
-    initPlayer(&ai, 0.2f);   // Initialise AI with exploration rate
-    
-    // Load trained Q-table from file and store to AI state_val
-    loadQTable(ai.state_val, "q_table.bin"); 
+    // Trained model, kept loaded between moves
+    const QTable *model = qModel();
+    if(!model) exit(EXIT_FAILURE);
 
     // Initialise game variables and randomly choose a starting player
     Game game={.game_status = false, .playing=startingPlayer()};
@@ -602,7 +973,7 @@ void pve(int board[3][3]){
             updateBoardState(board, action, &game); // Update board
         } else{
             DEBUG_PRINT("AI is deciding its move...\n");
-            Coord action = aiMove(avail_pos, pos_index, board, CPU, &ai); // get AI move
+            Coord action = aiMove(avail_pos, pos_index, board, CPU, model, exp_rate); // get AI move
             updateBoardState(board, action, &game); // Update board
         }
 
@@ -620,12 +991,12 @@ void pve(int board[3][3]){
  * guiMLmove(): Handles AI move in GUI mode 
  * 
  * params:
- *  - char board[3][3]: 2D character board arrray to be converted
+ *  - char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]: 2D character board arrray to be converted
  * 
  * return:
  *  - Coord action: contains AI selection in row and column
  */
-Coord guiMLmove(char board[3][3]){
+Coord guiMLmove(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]){
     
     int intBoard[3][3] = {0};   // Initialise to empty 2D array
 
@@ -634,18 +1005,17 @@ Coord guiMLmove(char board[3][3]){
     // Convert the character board to integer board for the AI to work with
     convertBoard(board, intBoard);
     
-    Player ai;
+    float exp_rate = 0.2f;  // AI's exploration rate
 
-    initPlayer(&ai, 0.2);   // Initialise AI with exploration rate
-    
-    // Load trained Q-table from file and store to AI state_val
-    loadQTable(ai.state_val, "q_table.bin"); 
+    // Trained model, kept loaded between moves
+    const QTable *model = qModel();
+    if(!model) exit(EXIT_FAILURE);
     
     Coord avail_pos[9];
     int pos_index = availPos(intBoard, avail_pos); // Get available positions
 
     // AI decides its next move
-    Coord action = aiMove(avail_pos, pos_index, intBoard, CPU, &ai);
+    Coord action = aiMove(avail_pos, pos_index, intBoard, CPU, model, exp_rate);
 
     return action; 
 
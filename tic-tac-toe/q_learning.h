@@ -3,10 +3,15 @@
 #define Q_LEARNING  // Defines Q_LEARNING
 
 #include <stdbool.h>
+#include <stdint.h> // Fixed width fields of the Q-table file
+#include <math.h>   // Rounding and scaling of stored Q-values
 #include <stdio.h> // Required for printf
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h> // Background preload of the trained model
+#include "board_config.h"
+#include "mapped_file.h"
 
 /**
  * q_learning.h: Header file for Q-learning Implementation 
@@ -26,13 +31,34 @@
 #endif
 
 // Constant
-#define MAX_STRINGS 10000 // Maximum number of states stored in the player's state array
 #define MAX_LENGTH 9 // Length of each state array when flatten (3x3)
-#define QTABLE_LENGTH 5000 // Maximum number of entries in Q-table
+#define MAX_TRAJECTORY 5 // Most moves one player makes in a game, so the most states it records
+#define QTABLE_STATES 19683 // 3^9 boards, every board has its own slot in the Q-table
+#define QTABLE_ALIGN 64     // Q-tables from newQTable() start on a cache line
+
+// Base-3 digit of a cell in the board index: BOARD_BLANK 0, CPU 1, HUMAN 2.
+// Cell (row * 3 + col) has weight Q_POW3[row * 3 + col]
+#define Q_DIGIT(sym) ((sym) == CPU ? 1 : (sym) == HUMAN ? 2 : 0)
+
+// Q-table file written by saveQTable(): a QTableHeader, then the base-3 index of every
+// known board as a uint16_t, then the value of each of those boards in the header's format.
+// QFORMAT_DENSE files instead hold the whole QTable from QTABLE_DENSE_OFFSET on, so
+// mapQTable() can use the file in place
+#define QTABLE_MAGIC "TTTQTBL1"
+#define QTABLE_VERSION 1
+#define QTABLE_DENSE_OFFSET 64      // Header padded to a cache line
+#define QTABLE_FILE "q_table.bin"   // Model trained by trainModel() and played by the GUI
+
+// Build with -DQ_EMBEDDED_MODEL=1 to play the model compiled into q_model.c
+// (see tools/qtable_to_c.c) instead of reading QTABLE_FILE
+#ifndef Q_EMBEDDED_MODEL
+#define Q_EMBEDDED_MODEL 0
+#endif
 
 // Learning Parameters
 extern const float LR;      // Learning rate for Q-value updates
 extern const float DECAY;   // Decary factor for exploration rate over episodes
+extern const int Q_POW3[MAX_LENGTH];    // Weight of each cell in the board index
 
 // Enumerations
 // Represents the type of player: HUMAN, CPU, or an empty board cell
@@ -45,16 +71,35 @@ typedef struct{
     int row, col;
 } Coord;
 
-// Represents a single Q-value entry with a state key and its associated value
+// How Q-values are stored in the file. Quantized values are offset + stored * scale
+typedef enum { QFORMAT_FLOAT32 = 0, QFORMAT_FLOAT16 = 1, QFORMAT_INT8 = 2, QFORMAT_DENSE = 3 } QValueFormat;
+
 typedef struct{
-    int key[MAX_LENGTH];    //Key representing the board state in a flatten array
-    float val;              // Q-value associated with the state
-} Qvalue;
+    char magic[8];          // QTABLE_MAGIC, not 0 terminated
+    uint32_t version;       // QTABLE_VERSION
+    uint32_t size;          // Board side, 3
+    uint32_t entries;       // Boards stored, at most QTABLE_STATES
+    uint32_t format;        // QValueFormat of the values
+    float scale;            // QFORMAT_INT8 only: value = offset + stored * scale
+    float offset;
+    uint32_t checksum;      // FNV-1a of every byte after the header
+} QTableHeader;
+
+// Q-table with one slot per board, indexed by the base-3 board index (see stateIndex())
+typedef struct{
+    float val[QTABLE_STATES];   // Q-value of each board, 0 until learned
+    bool known[QTABLE_STATES];  // Set once the board is learned or loaded
+} QTable;
+
+#if Q_EMBEDDED_MODEL
+extern const QTable qEmbeddedModel;     // Trained model compiled in, generated into q_model.c
+#endif
 
 // Represents a player with their state history, Q-table, and exploration rate
 typedef struct{
-    int state[MAX_STRINGS][MAX_LENGTH]; // Player's recorded state
-    Qvalue *state_val[QTABLE_LENGTH];   // Pointer to player's Q-table
+    int state[MAX_TRAJECTORY];          // Board index after each of the player's moves this round
+    int states;                         // Number of recorded states this round, reset() sets it to 0
+    QTable *state_val;                  // Pointer to player's Q-table
     float exp_rate;                     // Exploration rate for Q-learning
 } Player;
 
@@ -63,28 +108,37 @@ typedef struct{
     bool game_status;   // True if game has ended, false otherwise
     Player p1, p2;      // Players in the game
     int playing;        // Indicates the current player (HUMAN Or CPU)
+    int index;          // Base-3 index of the board, kept up to date by updateBoardState()
 } Game;
 
 // Function prototypes
 void initPlayer(Player *player, float exp_rate);
+void freePlayer(Player *player);
+QTable *newQTable(void);
+void freeQTable(QTable *q_table);
 int startingPlayer();
 void reset(Player player[2], int board[3][3]);
-void convertBoard(char board[3][3], int convertedState[3][3]);
+void convertBoard(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int convertedState[3][3]);
 void printConvertedBoard(int convertedState[3][3]);
 int availPos(int board[3][3], Coord availCoord[9]);
-void defaultQValue(Qvalue* q_table[QTABLE_LENGTH], int state[]);
-int findQValue(int state[MAX_LENGTH], Qvalue *q_table[QTABLE_LENGTH]);
-void addState(Player *p, int board1d[MAX_LENGTH]);
+int stateIndex(const int state[MAX_LENGTH]);
+void defaultQValue(QTable *q_table, int state[]);
+int findQValue(int state[MAX_LENGTH], QTable *q_table);
+void addState(Player *p, int index);
 void updateQtable(Player* player, int winner);
-Coord aiMove(Coord position[], int pos_index, int board[3][3], int playerSym, Player *p);
+Coord aiMove(Coord position[], int pos_index, int board[3][3], int playerSym, const QTable *q_table, float exp_rate);
 Coord playerMove(Coord position[], int pos_index, int board[3][3]);
 void updateBoardState(int board[3][3], Coord action, Game *game);
 int check_win(int board[3][3], Game *game);
-void saveQTable(Qvalue *q_table[QTABLE_LENGTH], const char *filename);
-void loadQTable(Qvalue *q_table[QTABLE_LENGTH], const char *filename);
+void saveQTable(QTable *q_table, const char *filename, QValueFormat format);
+bool loadQTable(QTable *q_table, const char *filename);
+const QTable *mapQTable(MappedFile *map, const char *filename);
+void qModelPreload(void);
+const QTable *qModel(void);
+void qModelRelease(void);
 void trainModel(int episode, int board[3][3]);
 void pve(int board[3][3]);
-Coord guiMLmove(char board[3][3]);
+Coord guiMLmove(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
 
 
 #endif
\ No newline at end of file
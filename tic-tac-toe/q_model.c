@@ -0,0 +1,3090 @@
+/* Generated by tools/qtable_to_c.c - do not edit by hand */
+#include "q_learning.h"
+
+#if Q_EMBEDDED_MODEL
+
+const QTable qEmbeddedModel = {
+    .val = {
+        0, 2.07142234f, 0.976927996f, 1.72497332f, 0, 0, 1.44382119f, 0,
+        0, 1.95768082f, 0, 0, 0, 0, 1.23129582f, 0,
+        1.44721317f, 1.28787076f, 0.89252317f, 0, 0, 0, 0.852520347f, 1.01942921f,
+        0, 1.18998027f, 0, 1.98160601f, 0, 0, 0, 0,
+        1.46661437f, 0, 1.73721004f, 0.786242247f, 0, 0, 1.97875845f, 0,
+        0, 0, 1.91778362f, 0, 0, 0, 1.75395131f, 0.791964412f,
+        1.35444713f, 0, 0, 0.642266512f, 0, 0, 1.22210026f, 0,
+        0, 0, 1.47462058f, 0.998147964f, 0, 0.847203493f, 0, 0,
+        1.68541372f, 0.652668595f, 1.87452292f, 0, 0, 1.29266703f, 0, 0,
+        0, 0.674703658f, 0, 0.683731258f, 0, 0, 0, 0,
+        0, 2.30299997f, 0, 0, 0, 0, 1.58649385f, 0,
+        2.00289512f, 0.849084556f, 0, 0, 2.20345497f, 0, 0, 0,
+        2.0745101f, 0, 0, 0, 1.79781342f, 0.542745948f, 2.10939384f, 0,
+        0, 1.10839915f, 0, 0, 0, 0, 2.09353423f, 0,
+        0, 0, 1.7909677f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.8509016f, 1.45751417f, 0,
+        0, 0, 0, 1.72474146f, 0, 1.79475939f, 0, 0,
+        1.93711507f, 1.12297833f, 2.03864765f, 0, 0, 1.28713918f, 0, 0,
+        1.75628424f, 0, 0, 0, 0, 0.914829969f, 0, 2.16838193f,
+        1.25539124f, 1.14698792f, 0, 0, 0, 1.61973584f, 0.92594856f, 0,
+        1.03485382f, 0, 0.760790169f, 0, 0, 0, 1.44540012f, 0.257498294f,
+        0, 0.593736708f, 0, 0, 1.32925308f, 0.563923776f, 1.47395802f, 0,
+        0, 0.837547898f, 0, 0, 0, 0.48076877f, 0, 0.35877794f,
+        0, 0, 0, 0, 0, 0, 1.34459043f, 0.5097633f,
+        1.23800302f, 0, 0, 0.189268544f, 0, 0, 1.17319047f, 0,
+        0, 0, 0, 1.03258538f, 0, 0.993729115f, 0.425355226f, 0.55384022f,
+        0, 0, 0, 0.789268732f, 0.365423799f, 0, 0.681404114f, 0,
+        0, 0.589119136f, 0, 0.444024533f, 0, 0, 0, 0,
+        0, 0.697919667f, 0, 0, 0, 0.999999881f, 0.100398742f, 0,
+        0.0944256783f, 0, 0, 0, 0, 0, 0.21310167f, 0,
+        0, 0, 0, 2.05222821f, 0, 0, 0, 0,
+        1.04607511f, 0, 1.77522922f, 0.38808924f, 0, 0, 1.55716491f, 0,
+        0, 0, 1.7560792f, 0, 0, 0, 1.49366081f, 0.452106386f,
+        1.92530572f, 0, 0, 0.307773739f, 0, 0, 0, 0,
+        1.42020404f, 0, 0, 0, 1.27147043f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.34115601f,
+        1.36496305f, 0, 0, 0, 0, 1.23525262f, 0, 1.44979382f,
+        0, 0, 2.15629625f, 0.528712988f, 1.72883868f, 0, 0, 0.882687211f,
+        0, 0, 2.05565882f, 0, 0, 0, 0, 0.87623769f,
+        0, 1.81686044f, 1.08629382f, 0.711801648f, 0, 0, 0, 1.33655357f,
+        0.567828059f, 0, 0.792992473f, 0, 0, 0, 1.79961836f, 0,
+        0, 0, 1.93080842f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.77862084f, 1.45733297f, 0,
+        0, 0, 0, 1.93964171f, 0, 1.82672179f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0.999999881f,
+        0, 0, 1.87497163f, 0, 0, 0, 0, 0.893450856f,
+        0, 1.93417549f, 0.198056072f, 0, 0, 1.23263693f, 0, 0,
+        0, 2.01651454f, 0, 0, 0, 1.78918576f, 0.414100498f, 1.76267624f,
+        0, 0, 0.448112398f, 0, 0, 0, 0.977454007f, 0.665629268f,
+        1.16759706f, 0, 0, 0.6331774f, 0, 0, 1.43329144f, 0,
+        0, 0, 0, 1.06214666f, 0, 0.530902028f, 0.466820121f, 0.187822446f,
+        0, 0, 0, 0.550580263f, 0.098728843f, 0, 0.75267005f, 0,
+        0.877870083f, 0, 0, 0, 0, 0.366630584f, 0, 0.690802395f,
+        0.0242720004f, 0, 0, 0.689482212f, 0, 0, 0, 0.674938858f,
+        0, 0, 0, 0.481446743f, 0, 0.425765991f, 0, 0,
+        0.0291975047f, 0, 0, 0.824536443f, 0, 0, 0, 1.49339056f,
+        0.438007355f, 0, 0.600784659f, 0, 0, 1.23476768f, 0.548075974f, 1.33879328f,
+        0, 0, 0.734826028f, 0, 0, 0, 0.200957865f, 0,
+        0.222669214f, 0, 0, 0, 0, 0, 0.876992106f, 0,
+        0, 0, 1.84600103f, 0.768794715f, 0, 1.18203354f, 0, 0,
+        1.58709574f, 0.950000763f, 1.30252516f, 0, 0, 0.921570539f, 0, 0,
+        0, 0.928699851f, 0, 0.757721305f, 0, 0, 0, 0,
+        0, 0, 2.09676909f, 0.794947028f, 1.66138542f, 0, 0, 1.00735831f,
+        0, 0, 1.91551852f, 0, 0, 0, 0, 1.18232501f,
+        0, 1.64800036f, 0.932189047f, 0.7854321f, 0, 0, 0, 1.01206017f,
+        0.573191345f, 0, 1.14904392f, 0, 0, 0.901078999f, 0, 0.681551099f,
+        0, 0, 0, 0, 0, 1.28944314f, 0, 0,
+        0, 0.999999881f, 0.232068539f, 0, 0.803751111f, 0, 0, 0,
+        0, 0, 0.941095233f, 0, 0, 0, 0, 0,
+        1.98123515f, 1.12962186f, 1.80585015f, 0, 0, 0.870185792f, 0, 0,
+        2.16513658f, 0, 0, 0, 0, 1.68364871f, 0, 1.96742046f,
+        1.09398568f, 0.799537718f, 0, 0, 0, 0.899905324f, 0.910102189f, 0,
+        0.743401229f, 0, 1.78724337f, 0, 0, 0, 0, 1.60924315f,
+        0, 1.77131653f, 0.463264167f, 0, 0, 1.77021849f, 0, 0,
+        0, 1.76072514f, 0, 0, 0, 1.37055004f, 0.443217576f, 1.05024004f,
+        0, 0, 0.367300928f, 0, 0, 1.68861687f, 0, 0,
+        0, 1.86836469f, 1.65591049f, 0, 1.19395983f, 0, 0, 1.91120636f,
+        0.894623518f, 1.67790139f, 0, 0, 1.33357072f, 0, 0, 0,
+        0.661828279f, 0, 1.17737782f, 0, 0, 0, 0, 0,
+        0, 0.662361622f, 0, 0.605489612f, 0, 0, 0, 0,
+        0, 0.675435126f, 0, 0, 0, 0.999999881f, 0.417104483f, 0,
+        0.381199479f, 0, 0, 0, 0, 0, 0.108874001f, 0,
+        0, 0, 0, 1.19004786f, 0, 0, 0, 1.70416284f,
+        0.523501039f, 0, 0.969365478f, 0, 0, 1.71128976f, 0.506563246f, 1.67136121f,
+        0, 0, 0.654597878f, 0, 0, 0, 0.681425571f, 0,
+        0.47230041f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2.1341598f, 0, 0, 0, 0, 1.67994821f, 0,
+        2.01464272f, 0.218975902f, 0, 0, 1.93797314f, 0, 0, 0,
+        1.85391557f, 0, 0, 0, 1.8453598f, 1.04639757f, 1.54677165f, 0,
+        0, 0.923517823f, 0, 0, 0, 0, 1.15690434f, 0,
+        0, 0, 1.71297836f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.39759779f, 1.54872942f, 0,
+        0, 0, 0, 1.46173704f, 0, 0.999999881f, 0, 0,
+        1.58365715f, 1.16762257f, 1.94476509f, 0, 0, 1.06852555f, 0, 0,
+        2.00385642f, 0, 0, 0, 0, 1.45019078f, 0, 1.38610709f,
+        1.29511559f, 0.909019649f, 0, 0, 0, 1.04672015f, 1.20519233f, 0,
+        1.06113911f, 0, 0, 0, 1.84131873f, 0, 0, 0,
+        2.16509867f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 1.42298043f, 0, 0, 0,
+        0, 1.61565721f, 0, 1.62916875f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.31505322f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.465245873f, 0, 0, 0, 0.91429913f, 0, 0,
+        2.14118099f, 0, 0, 0, 0, 1.9893558f, 0, 1.86003184f,
+        1.22153413f, 0, 0, 0.999999881f, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 1.20706141f, 0.870400965f, 1.58912134f, 0, 0,
+        0.16465275f, 0, 0, 0, 1.81121469f, 0.925039649f, 1.76989782f, 0,
+        0, 0.78043282f, 0, 0, 1.16815901f, 0, 0, 0,
+        0, 0.245395914f, 0, 0.673329234f, 0.268873692f, 0.972236454f, 0, 0,
+        0, 0.889525831f, 0.461622268f, 0, 0.87735939f, 0, 1.20802903f, 0,
+        0, 0, 0, 0.98143065f, 0, 0.999999881f, 0.035648603f, 0,
+        0, 0.293510318f, 0, 0, 0, 0.553153157f, 0, 0,
+        0, 0.999999881f, 0.694321275f, 1.54008281f, 0, 0, 0.780320525f, 0,
+        0, 0.637307525f, 0, 0, 0, 0.841460049f, 0.0574237593f, 0,
+        0.63165164f, 0, 0, 0.544288874f, 0.322805196f, 1.27362466f, 0, 0,
+        0.396799147f, 0, 0, 0, 0.560379624f, 0, 0.596447051f, 0,
+        0, 0, 0, 0, 0, 0, 1.623788f, 0,
+        0, 0, 1.55268097f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.62505841f, 1.24251986f, 0,
+        0, 0, 0, 1.42523313f, 0, 1.77324808f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.502906263f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.868396997f, 0, 0, 0, 1.40132558f,
+        0, 0, 2.25771976f, 0, 0, 0, 0, 1.97922122f,
+        0, 1.84003162f, 0.572582006f, 0, 0, 1.7492733f, 0, 0,
+        0, 1.85024154f, 0, 0, 0, 1.64138067f, 0.704253554f, 1.46384537f,
+        0, 0, 0.699236631f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.28311348f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.17872727f, 0, 0, 0, 1.17622614f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.45118177f, 0, 0,
+        0, 1.81944478f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.92395705f, 0, 0,
+        0, 0, 1.31543863f, 0, 1.39312887f, 0, 1.2129041f, 0,
+        0, 0, 0, 0.641645968f, 0, 1.3712008f, 0.164402097f, 0,
+        0, 1.27829707f, 0, 0, 0, 0.758359015f, 0, 0,
+        0, 1.72576594f, 0.327599823f, 1.58601701f, 0, 0, 0.672535002f, 0,
+        0, 0, 0, 0.245357931f, 0, 0, 0, 0.149357885f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.700096428f, 0, 0, 0, 0,
+        0.487379432f, 0, 0.999999881f, 0, 0, 1.40582228f, 0.865239263f, 1.75301075f,
+        0, 0, 0.508586049f, 0, 0, 1.63041246f, 0, 0,
+        0, 0, 0.844435036f, 0, 0.499427527f, 0.4541682f, 0.900769711f, 0,
+        0, 0, 0.899999797f, 0.527534127f, 0, 0.510267913f, 0, 0,
+        1.73031771f, 1.15402448f, 1.44477224f, 0, 0, 1.49277425f, 0, 0,
+        2.15946221f, 0, 0, 0, 0, 1.48805034f, 0, 1.41859949f,
+        1.00995111f, 1.39616477f, 0, 0, 0, 1.31864882f, 1.07285643f, 0,
+        0.839526713f, 0, 1.7569679f, 0, 0, 0, 0, 1.35334814f,
+        0, 0.999999881f, 0.316269785f, 0, 0, 1.67407882f, 0, 0,
+        0, 1.87580109f, 0, 0, 0, 0.999999881f, 0.246608704f, 0.952216625f,
+        0, 0, 0.934434474f, 0, 0, 1.12320948f, 0, 0,
+        0, 1.08880067f, 0.817937434f, 0, 0.411598861f, 0, 0, 1.11815715f,
+        0.993761837f, 0.768668473f, 0, 0, 0.849581838f, 0, 0, 0,
+        0.469680697f, 0, 0.765752196f, 0, 0, 0, 0, 0,
+        2.02023506f, 0, 0, 0, 0, 1.902367f, 0, 1.80242229f,
+        1.19838703f, 0, 0, 0.999999881f, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 1.00428522f, 0.430422634f, 0.80737257f, 0, 0,
+        0.467412174f, 0, 0, 0, 0, 1.45156372f, 0, 0,
+        0, 1.58563685f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.02586782f, 0, 0,
+        0, 0, 0.445275754f, 0, 0.999999881f, 0, 0, 1.24548984f,
+        1.38199651f, 1.83614135f, 0, 0, 1.52305412f, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0.858193278f, 0, 0, 0, 1.24423528f, 0.937623918f, 0, 0.336179644f,
+        0, 0.57281673f, 0, 0, 0, 0.528195083f, 0.292323351f, 0,
+        0.426130593f, 0, 0, 0.876715779f, 0.0657476634f, 0.371674716f, 0, 0,
+        0.174016118f, 0, 0, 0, 0.928865612f, 0, 0.686772645f, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0.498579353f, 1.26836514f,
+        0, 0, 0.742298424f, 0, 0, 1.56289089f, 0, 0,
+        0, 0, 0.234409288f, 0, 0.999999881f, 0, 1.18174398f, 0,
+        0, 0, 0.999999881f, 0.547907054f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.838415504f, 0, 0, 0, 1.60092556f, 0.480133235f,
+        0, 0.734091818f, 0, 0, 1.72646165f, 0.59691745f, 1.08477461f, 0,
+        0, 0.771541834f, 0, 0, 0, 0.695468962f, 0, 0.656464577f,
+        0, 0, 0, 0, 0, 0, 1.11603427f, 0.874533594f,
+        1.08776903f, 0, 0, 0.733766437f, 0, 0, 1.86928988f, 0,
+        0, 0, 0, 1.30065262f, 0, 1.06439114f, 1.39075661f, 0.480358303f,
+        0, 0, 0, 0.508901477f, 0.500533462f, 0, 0.419037282f, 0,
+        0, 1.37634456f, 0, 0.648108959f, 0, 0, 0, 0,
+        0, 0.899976909f, 0, 0, 0, 0.999999881f, 0, 0,
+        0.820216298f, 0, 0, 0, 0, 0, 0.636352897f, 0,
+        0, 0, 0, 0, 2.24230981f, 0.786098421f, 1.99842763f, 0,
+        0, 1.18838549f, 0, 0, 1.48374307f, 0, 0, 0,
+        0, 0.246834517f, 0, 1.45635188f, 0.939574718f, 1.2172128f, 0, 0,
+        0, 1.14177191f, 1.08073354f, 0, 1.23003268f, 0, 1.84707391f, 0,
+        0, 0, 0, 1.68330383f, 0, 1.8149128f, 1.14867079f, 0,
+        0, 1.88504875f, 0, 0, 0, 1.53374457f, 0, 0,
+        0, 1.71666026f, 1.1621232f, 1.96309066f, 0, 0, 0.733909607f, 0,
+        0, 0.741623044f, 0, 0, 0, 1.633582f, 0, 0,
+        1.24585164f, 0, 0, 1.78067958f, 0, 0.698493242f, 0, 0,
+        0.153459817f, 0, 0, 0, 1.41907942f, 0, 1.00909328f, 0,
+        0, 0, 0, 0, 0, 0.792601943f, 0, 0.281506598f,
+        0, 0, 0, 0, 0, 1.15146172f, 0, 0,
+        0, 0.999999881f, 0.24247995f, 0, 0.237915963f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.359575033f,
+        0, 0, 0, 0.923663437f, 0.261977792f, 0, 0.0802083537f, 0,
+        0, 1.24675679f, 1.22538781f, 1.41386342f, 0, 0, 0.730669141f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.207849652f, 0,
+        0, 0, 0, 0, 0.795021236f, 0, 0.640247405f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2.08450341f, 0.986652672f,
+        1.09201932f, 0, 0, 0.746223271f, 0, 0, 1.35214388f, 0,
+        0, 0, 0, 0.308920354f, 0, 1.415362f, 1.21805167f, 0.667832375f,
+        0, 0, 0, 1.12253833f, 0.160244182f, 0, 1.30509722f, 0,
+        1.39624143f, 0, 0, 0, 0, 1.04593062f, 0, 1.21099913f,
+        1.10305274f, 0, 0, 1.53222919f, 0, 0, 0, 1.52270663f,
+        0, 0, 0, 1.11048627f, 0.569354355f, 0.731928945f, 0, 0,
+        0.464737982f, 0, 0, 0.244921997f, 0, 0, 0, 1.48950529f,
+        0, 0, 0.920574069f, 0, 0, 1.48170102f, 0, 0.876463592f,
+        0, 0, 0.301287621f, 0, 0, 0, 0.501680732f, 0,
+        0.118543707f, 0, 0, 0, 0, 0, 1.99410951f, 0,
+        0, 0, 0, 0.608556271f, 0, 1.73293054f, 0.61991322f, 0,
+        0, 1.28704953f, 0, 0, 0, 1.39475942f, 0, 0,
+        0, 1.86416805f, 0.459050804f, 1.77347541f, 0, 0, 1.01015973f, 0,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0.999999881f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 1.85520661f, 0, 0.506789148f,
+        0, 0, 0.46794492f, 0, 0, 0.824485183f, 0, 0,
+        0, 0, 0, 0, 1.49142158f, 0, 0.857919097f, 0,
+        0, 0, 1.79999959f, 0, 0, 0.952405572f, 0, 0.464508384f,
+        0, 0, 0, 0.772674978f, 0.157657012f, 0, 0.363261878f, 0,
+        0, 1.42422521f, 0.652000308f, 1.30500221f, 0, 0, 0.513817132f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.163943574f, 0.102399446f, 0.705832005f, 0, 0,
+        0.0240780152f, 0, 0, 1.32692015f, 0, 0, 0, 0,
+        0.181274563f, 0, 0.385857821f, 0.520084262f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.25136232f, 0,
+        0.139146507f, 0, 0, 0, 0, 0, 0.616647243f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.966946542f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.13937283f, 0, 1.24898815f, 0, 0, 0, 0,
+        0, 0.657004356f, 0, 0, 0, 0.999999881f, 0.154657632f, 0,
+        0.768900692f, 0, 0, 0, 0, 0, 1.13726377f, 0,
+        0, 0, 0, 0.89993155f, 0, 0, 0, 0.962057233f,
+        0.576693952f, 0, 0.775131822f, 0, 0, 1.68178487f, 0.618196964f, 1.75019848f,
+        0, 0, 0.937825203f, 0, 0, 0, 0.594819665f, 0,
+        0.240846157f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.923503399f, 0, 0, 0, 0, 0,
+        0.825026631f, 0, 0.732302308f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.45801711f, 0, 0, 0, 1.82317054f, 0.705720067f, 0,
+        0.786350846f, 0, 0, 1.78785276f, 0.478946328f, 1.30579925f, 0, 0,
+        1.07670534f, 0, 0, 0, 0.701471448f, 0, 1.01095617f, 0,
+        0, 0, 0, 0, 0, 1.39527702f, 0.647638023f, 1.44866681f,
+        0, 0, 0.530935645f, 0, 0, 0.989355147f, 0, 0,
+        0, 0, 1.52118158f, 0, 1.15225637f, 0.899999797f, 0.239097089f, 0,
+        0, 0, 0.91031605f, 0.946652949f, 0, 0.434812367f, 0, 0,
+        1.44444335f, 0, 1.12316024f, 0, 0, 0, 0, 0,
+        1.31884265f, 0, 0, 0, 0.999999881f, 0, 0, 0.967811763f,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.166299433f, 0,
+        0, 0, 0, 0, 0.742779851f, 0, 0.638731122f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.557480097f, 0,
+        0.313447714f, 0, 0, 0, 0, 0, 0.801971018f, 0,
+        0, 0, 0.999999881f, 0.443722188f, 0, 0.60299176f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.7602309f, 0, 0, 0, 0,
+        1.29420781f, 0, 2.09492207f, 0.704712152f, 0, 0, 1.86418295f, 0,
+        0, 0, 2.09523845f, 0, 0, 0, 1.27329528f, 0.788486302f,
+        1.64945436f, 0, 0, 0.796956778f, 0, 0, 0, 0,
+        1.62279356f, 0, 0, 0, 1.56342411f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.46375167f,
+        1.0149138f, 0, 0, 0, 0, 1.01384318f, 0, 1.63884676f,
+        0, 0, 1.5828892f, 0.931238532f, 1.3129878f, 0, 0, 1.09076905f,
+        0, 0, 1.90312576f, 0, 0, 0, 0, 0.600897789f,
+        0, 1.8278594f, 0.736302495f, 1.06427932f, 0, 0, 0, 0.703305483f,
+        0.702540636f, 0, 1.01310563f, 0, 0, 0, 1.30735373f, 0,
+        0, 0, 1.64725983f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.95697618f, 2.05750823f, 0,
+        0, 0, 0, 0.999999881f, 0, 1.87900209f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.71148026f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.27992797f, 0, 0, 0, 0.695348978f,
+        0, 0, 2.17664313f, 0, 0, 0, 0, 0.999999881f,
+        0, 1.88913798f, 0.968227208f, 0, 0, 1.41641223f, 0, 0,
+        0, 1.48986495f, 0, 0, 0, 1.85824549f, 0.589789152f, 0.999999881f,
+        0, 0, 0.481497437f, 0, 0, 0, 1.31782913f, 0.383899182f,
+        0.544790328f, 0, 0, 0.57950747f, 0, 0, 1.73976696f, 0,
+        0, 0, 0, 0.21218963f, 0, 1.25459516f, 0.822996914f, 0.421473175f,
+        0, 0, 0, 0.252152979f, 0.0712781549f, 0, 0.522654653f, 0,
+        0.641194046f, 0, 0, 0, 0, 0.469790906f, 0, 1.63031125f,
+        0.291314185f, 0, 0, 1.11856902f, 0, 0, 0, 1.8364414f,
+        0, 0, 0, 1.02789736f, 0.000566621777f, 0.578959882f, 0, 0,
+        0.346840203f, 0, 0, 0.563529909f, 0, 0, 0, 0.455806941f,
+        0.157736763f, 0, 0.560240924f, 0, 0, 1.51012421f, 0.220743865f, 0.537830591f,
+        0, 0, 0.99208051f, 0, 0, 0, 0.0860318765f, 0,
+        0.0240192376f, 0, 0, 0, 0, 0, 0, 0,
+        1.41231501f, 0, 0, 0, 1.81540143f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.67458916f,
+        0.893995643f, 0, 0, 0, 0, 1.33824849f, 0, 1.54123235f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.632499814f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.02995527f, 0, 0,
+        0, 0.346507132f, 0, 0, 1.51966572f, 0, 0, 0,
+        0, 0.929170489f, 0, 2.00938463f, 0.214254335f, 0, 0, 0.570141792f,
+        0, 0, 0, 1.73314619f, 0, 0, 0, 1.31501079f,
+        0.338886917f, 1.77032506f, 0, 0, 0.657722175f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.3619858f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.15990376f, 0, 0, 0, 0.701987445f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.35253942f,
+        0, 0, 0, 0.920644283f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.01446891f, 1.52612519f,
+        0, 0, 0, 0, 0.999999881f, 0, 1.28992367f, 0,
+        1.05900478f, 0, 0, 0, 0, 0.130214334f, 0, 1.33143044f,
+        0.185539752f, 0, 0, 1.20138586f, 0, 0, 0, 1.7869761f,
+        0, 0, 0, 1.01326644f, 0.101584122f, 0.938014925f, 0, 0,
+        0.372826934f, 0, 0, 0, 0, 0.440011799f, 0, 0,
+        0, 1.37986469f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.08060575f, 0.182045713f, 0, 0,
+        0, 0, 0, 0, 1.25879526f, 0, 0, 1.64416838f,
+        0.770579517f, 1.07994914f, 0, 0, 0.7938115f, 0, 0, 1.69275439f,
+        0, 0, 0, 0, 0, 0, 1.55751002f, 0.322129041f,
+        0.473051578f, 0, 0, 0, 0.536892116f, 0, 0, 0.374433398f,
+        0, 0, 1.76822925f, 1.09211659f, 1.32937205f, 0, 0, 1.0252825f,
+        0, 0, 1.81373048f, 0, 0, 0, 0, 0.778427064f,
+        0, 1.61401665f, 1.38919938f, 0.918310106f, 0, 0, 0, 0.708010197f,
+        0.913375258f, 0, 0.419109404f, 0, 1.96367717f, 0, 0, 0,
+        0, 1.44336903f, 0, 1.54848719f, 0.55345726f, 0, 0, 1.39796185f,
+        0, 0, 0, 1.8155185f, 0, 0, 0, 1.57094681f,
+        0.122157857f, 0.69001925f, 0, 0, 0.796372116f, 0, 0, 0.774319232f,
+        0, 0, 0, 1.0124383f, 0.351239949f, 0, 0.623086095f, 0,
+        0, 1.1037811f, 0.340095609f, 0.664941132f, 0, 0, 0.39803341f, 0,
+        0, 0, 0.93162477f, 0, 0.583870232f, 0, 0, 0,
+        0, 0, 1.88941395f, 0, 0, 0, 0, 0.999999881f,
+        0, 1.76905894f, 0.654584229f, 0, 0, 2.04172134f, 0, 0,
+        0, 1.74740124f, 0, 0, 0, 1.51683414f, 0.41791448f, 0.999999881f,
+        0, 0, 0.468074024f, 0, 0, 0, 0, 1.55217075f,
+        0, 0, 0, 1.14574087f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.39882421f, 1.29570341f,
+        0, 0, 0, 0, 0.999999881f, 0, 1.14950049f, 0,
+        0, 1.87142634f, 1.15889394f, 0.999999881f, 0, 0, 1.0163722f, 0,
+        0, 1.84525645f, 0, 0, 0, 0, 0.999999881f, 0,
+        1.79999959f, 0.239053011f, 0.920393527f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.368896008f, 0, 0.64995271f, 0, 0, 0, 0.733923674f,
+        0.299760878f, 0, 0.942805529f, 0, 0, 1.10724521f, 0.430678219f, 0.638431311f,
+        0, 0, 0.588031173f, 0, 0, 0, 0.216501445f, 0,
+        0.343322873f, 0, 0, 0, 0, 0, 0, 1.51195192f,
+        0.525627732f, 1.09032023f, 0, 0, 0.846196651f, 0, 0, 1.80220306f,
+        0, 0, 0, 0, 0.469209135f, 0, 1.09474945f, 0.326640487f,
+        0.126438841f, 0, 0, 0, 0, 0, 0, 0.287651777f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.44360399f, 0,
+        0, 0, 1.96896446f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.76731002f, 1.13529098f, 0,
+        0, 0, 0, 1.6255337f, 0, 1.61270905f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.04324412f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.867273331f, 0, 0, 0, 1.31795645f,
+        0, 0, 1.41776955f, 0, 0, 0, 0, 1.41631734f,
+        0, 1.51366162f, 0.932937741f, 0, 0, 1.07378745f, 0, 0,
+        0, 1.87560272f, 0, 0, 0, 1.24257767f, 1.11706197f, 1.36545885f,
+        0, 0, 0.699203968f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.18829846f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.906663239f, 0, 0, 0, 1.0550735f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.59068751f, 0, 0,
+        0, 1.73717403f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.36025631f, 0, 0,
+        0, 0, 0.999999881f, 0, 1.4557451f, 0, 1.58949983f, 0,
+        0, 0, 0, 1.11484683f, 0, 1.77019083f, 0.526010156f, 0,
+        0, 0.973104656f, 0, 0, 0, 1.2112273f, 0, 0,
+        0, 1.68302536f, 0.468082607f, 1.07647562f, 0, 0, 1.05954409f, 0,
+        0, 0, 0, 0.728828788f, 0, 0, 0, 1.7506479f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.04914522f, 1.49272525f, 0, 0, 0, 0,
+        1.0907172f, 0, 0.999999881f, 0, 0, 1.01216125f, 0.676946044f, 0.675529182f,
+        0, 0, 0.892756104f, 0, 0, 0.924308777f, 0, 0,
+        0, 0, 0, 0, 0.245886415f, 0.422875583f, 1.12896943f, 0,
+        0, 0, 0.641278684f, 0.450704455f, 0, 0.950624645f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.66337347f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.485507101f, 0, 0, 0, 1.03191984f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.56768298f,
+        0, 0, 0, 1.36895812f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.79999959f, 1.64562786f,
+        0, 0, 0, 0, 1.79999959f, 0, 1.36197376f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.641679525f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.04423559f, 0, 0, 0, 0.540050149f, 0,
+        0, 0, 0, 0.439902246f, 0, 0, 0, 1.34270942f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.832906127f, 1.73330402f, 0, 0, 0, 0,
+        0.61180079f, 0, 1.79999959f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.717529655f, 0, 0, 1.38441217f,
+        0, 0, 0, 0, 0.859794617f, 0, 1.23321903f, 0.624756336f,
+        0, 0, 0.975748897f, 0, 0, 0, 1.32001913f, 0,
+        0, 0, 1.13919067f, 0.515592456f, 1.42481256f, 0, 0, 0.937741458f,
+        0, 0, 1.62423933f, 0, 0, 0, 0, 1.28266048f,
+        0, 1.72722602f, 0.936745465f, 0, 0, 1.66427922f, 0, 0,
+        0, 1.91210949f, 0, 0, 0, 0.974810421f, 0.908508062f, 0.957010865f,
+        0, 0, 0.310176432f, 0, 0, 0, 0, 1.45114076f,
+        0, 0, 0, 1.95070028f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.79999959f, 0.584491849f,
+        0, 0, 0, 0, 0.495434821f, 0, 0.999999881f, 0,
+        0, 1.30037808f, 1.05479062f, 0.720632255f, 0, 0, 0.627452731f, 0,
+        0, 1.29624224f, 0, 0, 0, 0, 0.784989715f, 0,
+        0.830407917f, 0.999999881f, 0.783059418f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.572173715f, 0, 0, 0, 1.6689471f, 0, 0,
+        0, 1.78630555f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.688191831f, 0, 0,
+        0, 0, 0.999999881f, 0, 1.17672706f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.73348105f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.73173177f, 0, 0, 0, 0, 0.999999881f, 0,
+        1.79999959f, 0.999999881f, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.790322721f, 0.999999881f, 0.999999881f, 0,
+        0, 0.286371917f, 0, 0, 0, 1.63554466f, 0.439760029f, 0.278738916f,
+        0, 0, 0.911345959f, 0, 0, 0.544157624f, 0, 0,
+        0, 0, 0, 0, 0.875285506f, 0.573806882f, 0.521588326f, 0,
+        0, 0, 0, 0.628629804f, 0, 0.999999881f, 0, 1.38552153f,
+        0, 0, 0, 0, 0.891188622f, 0, 0.999999881f, 0.333807409f,
+        0, 0, 0.298292309f, 0, 0, 0, 1.79999959f, 0,
+        0, 0, 0.999999881f, 0.547991216f, 0.89124465f, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.79066908f, 0.674380183f,
+        0.954381585f, 0, 0, 0.529446006f, 0, 0, 1.49406743f, 0,
+        0, 0, 0, 0.851557672f, 0, 1.4139787f, 0.606625736f, 0.7691378f,
+        0, 0, 0, 0.720188916f, 0.94523102f, 0, 0.591608703f, 0,
+        1.52068949f, 0, 0, 0, 0, 1.28389645f, 0, 1.44409573f,
+        0.474772394f, 0, 0, 1.53480601f, 0, 0, 0, 1.77248669f,
+        0, 0, 0, 0.537507534f, 0.615099072f, 0.651470542f, 0, 0,
+        0.242451236f, 0, 0, 0.946114421f, 0, 0, 0, 1.53309822f,
+        0, 0, 1.01793659f, 0, 0, 1.3826102f, 0, 0.642514706f,
+        0, 0, 0.446335137f, 0, 0, 0, 0.975791454f, 0,
+        0.806819022f, 0, 0, 0, 0, 0, 1.86557102f, 0,
+        0, 0, 0, 0.999999881f, 0, 1.85937655f, 0.140511841f, 0,
+        0, 0.736522794f, 0, 0, 0, 1.50465429f, 0, 0,
+        0, 2.09978127f, 0.429775476f, 0.999999881f, 0, 0, 0.669571579f, 0,
+        0, 0, 0, 1.79768264f, 0, 0, 0, 1.71594214f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.54612958f, 1.67470777f, 0, 0, 0, 0,
+        0.999999881f, 0, 1.79999959f, 0, 0, 2.20207119f, 0, 0.999999881f,
+        0, 0, 0.584031165f, 0, 0, 1.37543213f, 0, 0,
+        0, 0, 0, 0, 1.30472386f, 0, 0.804329574f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.952622354f, 0, 0.300870866f,
+        0, 0, 0, 0.762411952f, 0, 0, 0.431299001f, 0,
+        0, 1.72591805f, 0.329595864f, 1.04606152f, 0, 0, 0.894016623f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.990181565f, 0.168205172f, 0.822672367f, 0, 0,
+        0.407534599f, 0, 0, 1.41638923f, 0, 0, 0, 0,
+        0.563509285f, 0, 0.899999797f, 0.289340913f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.429774225f, 0,
+        0.067531921f, 0, 0, 0, 0, 0, 0.473856837f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.499711007f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.16671002f, 0, 0, 0, 0, 0.472919405f, 0, 1.72186863f,
+        0.293295085f, 0, 0, 0.916976929f, 0, 0, 0, 1.84060347f,
+        0, 0, 0, 0.965728939f, 0.7394979f, 0.69463855f, 0, 0,
+        0.436918557f, 0, 0, 0, 0, 1.12157583f, 0, 0,
+        0, 1.4900105f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.79999959f, 0.374293655f, 0, 0,
+        0, 0, 0.842603981f, 0, 1.20123982f, 0, 0, 1.96950173f,
+        0, 0.715379238f, 0, 0, 1.03868699f, 0, 0, 1.2679069f,
+        0, 0, 0, 0, 0, 0, 1.25275421f, 0,
+        0.409736365f, 0, 0, 0, 0.955828011f, 0, 0, 0.550199151f,
+        0, 0, 0, 0.964582741f, 0, 0, 0, 1.88966405f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.14412177f, 1.40581918f, 0, 0, 0, 0,
+        0.999999881f, 0, 1.79999959f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 1.36336184f,
+        0, 0, 0, 0, 0, 0, 1.30175471f, 0,
+        0, 0, 0, 0, 0, 0, 0.64804405f, 0,
+        0, 0, 1.79999959f, 0, 0.999999881f, 0, 0, 0.663609445f,
+        0, 0, 0, 0.976629317f, 0.151861548f, 0.332274258f, 0, 0,
+        0.528209209f, 0, 0, 1.30324805f, 0, 0, 0, 0,
+        0, 0, 1.47070003f, 0.589357138f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.324436665f, 0, 0,
+        0, 0, 0, 0, 0.472907752f, 0, 0, 0,
+        1.37750196f, 0, 0, 0, 1.18266678f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.229663059f, 0, 0, 0, 0.813654244f, 0, 0, 0.345102489f,
+        0, 0, 1.79999959f, 0, 1.25814557f, 0, 0, 0.946128964f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999015927f, 0, 0, 0, 1.54598796f,
+        0.561903596f, 0, 0.718878031f, 0, 0, 1.69689608f, 0.614119709f, 1.03145874f,
+        0, 0, 1.05633235f, 0, 0, 0, 0.649499536f, 0,
+        0.334327281f, 0, 0, 0, 0, 0, 0, 1.36605215f,
+        0.734525859f, 1.61082351f, 0, 0, 0.799841881f, 0, 0, 1.81110919f,
+        0, 0, 0, 0, 1.44460022f, 0, 0.899999797f, 0.899999797f,
+        0.118889108f, 0, 0, 0, 0, 0.534432471f, 0, 0,
+        0, 0, 0.854180992f, 0, 0.907318652f, 0, 0, 0,
+        0, 0, 0.30772543f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.625430048f, 0, 0, 0, 0, 0, 0.632322192f,
+        0, 0, 0, 0, 0, 1.72026992f, 0.934730828f, 0.999999881f,
+        0, 0, 0.598476291f, 0, 0, 1.66899908f, 0, 0,
+        0, 0, 0.999999881f, 0, 1.28165817f, 0.703704476f, 0.55161494f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.336824179f, 0, 1.4625231f,
+        0, 0, 0, 0, 0.999999881f, 0, 1.18584371f, 0.603264987f,
+        0, 0, 1.42637765f, 0, 0, 0, 0.899999797f, 0,
+        0, 0, 0.805438399f, 0.731670678f, 0.999999881f, 0, 0, 0,
+        0, 0, 1.34108162f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.944503725f, 0, 0, 1.79999959f, 0, 0.999999881f, 0,
+        0, 0.677961588f, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.386577487f, 0,
+        0.558674097f, 0, 0, 0, 0, 0, 0.473605394f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.635374248f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.670841098f, 0, 0, 0, 0.499363333f, 0, 0, 0.589332223f,
+        0, 0, 1.34625053f, 0.681144893f, 1.42467415f, 0, 0, 0.899999797f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.29593444f, 0,
+        0, 0, 1.87546909f, 0.608321011f, 0, 1.47084463f, 0, 0,
+        1.73800981f, 1.00939894f, 1.81172705f, 0, 0, 1.05199182f, 0, 0,
+        0, 0.901082814f, 0, 0.537252903f, 0, 0, 0, 0,
+        0, 0, 1.72610438f, 0.583627045f, 1.89836097f, 0, 0, 1.21854365f,
+        0, 0, 1.78460956f, 0, 0, 0, 0, 1.22099984f,
+        0, 1.14076948f, 1.18567169f, 0.690260291f, 0, 0, 0, 1.38041723f,
+        0.578920007f, 0, 1.17092705f, 0, 0, 1.14233446f, 0, 0.605811417f,
+        0, 0, 0, 0, 0, 1.11097598f, 0, 0,
+        0, 0.999999881f, 0.356693983f, 0, 0.811295271f, 0, 0, 0,
+        0, 0, 0.349418342f, 0, 0, 0, 0, 0,
+        2.16616154f, 0.981188476f, 1.67713392f, 0, 0, 1.42708552f, 0, 0,
+        2.06090689f, 0, 0, 0, 0, 0.982684731f, 0, 1.88113618f,
+        1.702474f, 0.964123845f, 0, 0, 0, 1.18758667f, 0.745085955f, 0,
+        1.50268567f, 0, 2.12336493f, 0, 0, 0, 0, 1.5872947f,
+        0, 1.81945908f, 1.00196731f, 0, 0, 1.9301182f, 0, 0,
+        0, 1.77676117f, 0, 0, 0, 1.63555121f, 1.09889162f, 1.68479276f,
+        0, 0, 1.15140545f, 0, 0, 1.01828504f, 0, 0,
+        0, 1.62941289f, 0.439861774f, 0, 1.07334661f, 0, 0, 1.79320872f,
+        0.620196998f, 1.62030888f, 0, 0, 1.35724556f, 0, 0, 0,
+        1.0062747f, 0, 0.608933926f, 0, 0, 0, 0, 0,
+        0, 1.06266797f, 0, 0.78662312f, 0, 0, 0, 0,
+        0, 0.872565627f, 0, 0, 0, 0.999999881f, 0.566897869f, 0,
+        0, 0, 0, 0, 0, 0, 0.479575157f, 0,
+        0, 0, 0, 0.568226516f, 0, 0, 0, 1.46419001f,
+        0.24493441f, 0, 0, 0, 0, 0.942991912f, 0.186387613f, 1.39817035f,
+        0, 0, 0, 0, 0, 0, 0.970061481f, 0,
+        0.393418431f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.666780293f, 0, 0, 0, 0, 0,
+        0.693253815f, 0, 0.961490333f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.45492268f, 1.04514158f, 2.12495804f, 0, 0, 0.512307346f,
+        0, 0, 1.29189563f, 0, 0, 0, 0, 1.26654387f,
+        0, 0.903731823f, 1.1074053f, 0.817881584f, 0, 0, 0, 0.73892194f,
+        0.536364019f, 0, 1.11857879f, 0, 1.02635825f, 0, 0, 0,
+        0, 1.20871615f, 0, 0.622284174f, 0.858462811f, 0, 0, 1.51830041f,
+        0, 0, 0, 0.800462484f, 0, 0, 0, 1.1050458f,
+        0.358938545f, 1.41318738f, 0, 0, 1.14214814f, 0, 0, 1.17103195f,
+        0, 0, 0, 1.36440706f, 0.395462483f, 0, 0.964844942f, 0,
+        0, 1.64019799f, 1.00220656f, 1.91227376f, 0, 0, 1.2520988f, 0,
+        0, 0, 0.871665835f, 0, 0.997968435f, 0, 0, 0,
+        0, 0, 1.88191354f, 0, 0, 0, 0, 1.70241392f,
+        0, 1.9830699f, 1.16026461f, 0, 0, 1.50573993f, 0, 0,
+        0, 2.0443213f, 0, 0, 0, 1.75621653f, 0.875177741f, 1.73151505f,
+        0, 0, 0.728886247f, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0.999999881f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 1.57607996f, 0.525179386f, 1.50899374f, 0, 0, 1.32202768f, 0,
+        0, 1.58284843f, 0, 0, 0, 0, 0.83966732f, 0,
+        1.79999959f, 0.999999881f, 0.961402535f, 0, 0, 0, 1.33040845f, 0.236015275f,
+        0, 0.937058032f, 0, 0.430912048f, 0, 0, 0, 1.551983f,
+        0.41740799f, 0, 0, 0, 0, 1.29099417f, 0.566766679f, 1.3714813f,
+        0, 0, 0, 0, 0, 0, 0.1067302f, 0,
+        0.40367648f, 0, 0, 0, 0, 0, 0, 0.382768452f,
+        0.328644067f, 0.940291762f, 0, 0, 0, 0, 0, 0.608345509f,
+        0, 0, 0, 0, 1.52719223f, 0, 0, 0,
+        0.0553195588f, 0, 0, 0, 0.599913239f, 0, 0, 0,
+        0, 0, 0.432251364f, 0, 1.29215443f, 0, 0, 0,
+        0, 0, 0.86610961f, 0, 0, 0, 0.999999881f, 0.251706123f,
+        0, 0, 0, 0, 0, 0, 0, 0.436606973f,
+        0, 0, 0, 0, 0, 1.40059066f, 0, 0.763647676f,
+        0, 0, 0, 0, 0, 0.898955941f, 0, 0,
+        0, 0.999999881f, 0.419536114f, 0, 0.752802968f, 0, 0, 0,
+        0, 0, 0.339505464f, 0, 0, 0, 0, 0.879705131f,
+        0, 0, 0, 1.80339777f, 0.440380186f, 0, 0.608485162f, 0,
+        0, 1.63116729f, 0.733915925f, 1.74349105f, 0, 0, 1.09860134f, 0,
+        0, 0, 1.26812434f, 0, 0.453831196f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.776519835f, 0,
+        0, 0, 0, 0, 0.963780999f, 0, 0.909223557f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.61657548f, 0, 0,
+        0, 1.47730219f, 0.57324791f, 0, 1.58116305f, 0, 0, 1.61315322f,
+        1.05936551f, 1.73261285f, 0, 0, 1.11147654f, 0, 0, 0,
+        0.651138842f, 0, 0.658570528f, 0, 0, 0, 0, 0,
+        0, 1.69788635f, 0.803147733f, 1.05023825f, 0, 0, 1.19036376f, 0,
+        0, 1.58857334f, 0, 0, 0, 0, 1.24805653f, 0,
+        1.79999959f, 0.961080313f, 0.429999441f, 0, 0, 0, 0.971770406f, 0.406739146f,
+        0, 0.999999881f, 0, 0, 1.50463951f, 0, 1.28318512f, 0,
+        0, 0, 0, 0, 0.963931322f, 0, 0, 0,
+        0.999999881f, 0.67599386f, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0.247828454f, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.10910106f, 0, 0, 0, 0, 0,
+        0.771077037f, 0, 1.03791738f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.72933358f, 0, 0.741784632f, 0, 0, 0,
+        0, 0, 0.74446106f, 0, 0, 0, 0.999999881f, 0.421030104f,
+        0, 0, 0, 0, 0, 0, 0, 0.65094614f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.93440831f, 1.41931593f, 2.05985618f, 0, 0, 0.925995588f, 0, 0,
+        1.86484134f, 0, 0, 0, 0, 1.96954668f, 0, 1.26429939f,
+        1.02099788f, 1.15921843f, 0, 0, 0, 1.57207954f, 0.728372693f, 0,
+        1.0364238f, 0, 1.91986489f, 0, 0, 0, 0, 1.34338963f,
+        0, 0.999999881f, 0.272753656f, 0, 0, 0.86627692f, 0, 0,
+        0, 1.45654476f, 0, 0, 0, 0.999999881f, 0.416796446f, 1.67691314f,
+        0, 0, 0.606042325f, 0, 0, 1.15328228f, 0, 0,
+        0, 1.48716354f, 0.867747784f, 0, 0.880693257f, 0, 0, 1.55085862f,
+        0.891508341f, 2.03255558f, 0, 0, 0.707215309f, 0, 0, 0,
+        0.421723038f, 0, 0.87713933f, 0, 0, 0, 0, 0,
+        2.18035746f, 0, 0, 0, 0, 1.96704757f, 0, 1.86409557f,
+        0.976466894f, 0, 0, 0.999999881f, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 1.42791593f, 0.27439028f, 1.42980289f, 0, 0,
+        1.19623268f, 0, 0, 0, 0, 1.93087506f, 0, 0,
+        0, 1.69141471f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.6248771f, 0, 0,
+        0, 0, 1.63451159f, 0, 0.999999881f, 0, 0, 1.78707075f,
+        1.01405859f, 1.96831846f, 0, 0, 1.17534232f, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0.790869594f, 0, 0, 0, 1.26681054f, 0.899999797f, 0, 0.945423484f,
+        0, 0.427667201f, 0, 0, 0, 1.84546721f, 0.441247135f, 0,
+        0, 0, 0, 0.578900099f, 0.0849791169f, 1.34395814f, 0, 0,
+        0, 0, 0, 0, 1.09242952f, 0, 0.751590967f, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0.215584606f, 1.48628545f,
+        0, 0, 0, 0, 0, 0.74768585f, 0, 0,
+        0, 0, 0.526517868f, 0, 0, 0, 0.818070829f, 0,
+        0, 0, 0.999999881f, 0.623951137f, 0, 0, 0, 0,
+        0.346559733f, 0, 0.480561554f, 0, 0, 0, 0, 0,
+        0.10804069f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.372840941f, 0, 0,
+        0, 0, 1.94878566f, 0, 0, 0, 0, 1.75523388f,
+        0, 1.73964739f, 0.84405911f, 0, 0, 1.74276018f, 0, 0,
+        0, 0.764135659f, 0, 0, 0, 1.70648384f, 0.719483972f, 1.74632108f,
+        0, 0, 0.735887408f, 0, 0, 0, 0, 0.985221386f,
+        0, 0, 0, 1.41437304f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.06477964f, 1.60348439f,
+        0, 0, 0, 0, 1.16451752f, 0, 0.999999881f, 0,
+        0, 1.41461575f, 1.12214816f, 1.8653276f, 0, 0, 0.846187413f, 0,
+        0, 1.73921406f, 0, 0, 0, 0, 1.79999959f, 0,
+        0.544886053f, 0.999999881f, 0.941431224f, 0, 0, 0, 0.899999797f, 0.899999797f,
+        0, 0.683819234f, 0, 0, 0, 1.47628284f, 0, 0,
+        0, 1.71933424f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.76499748f, 0, 0,
+        0, 0, 1.20797753f, 0, 1.79999959f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 1.83481371f, 0, 0, 0, 0, 1.3315165f, 0,
+        1.79999959f, 0.608906746f, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 1.07352543f, 0.612564981f, 0.899999797f, 0,
+        0, 0.200499684f, 0, 0, 0, 1.16695929f, 0.379091024f, 1.57005632f,
+        0, 0, 0, 0, 0, 1.08397698f, 0, 0,
+        0, 0, 1.1523509f, 0, 0, 0, 0.662202477f, 0,
+        0, 0, 1.44965255f, 0.54151088f, 0, 0, 0, 0.837874591f,
+        0, 0, 0, 0, 0.322652161f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 1.33393288f, 0, 0, 0,
+        0, 0, 0.435204923f, 0, 0, 0, 1.3777554f, 0.143086597f,
+        0, 0, 0, 0, 0.86899972f, 0.323538005f, 1.79999959f, 0,
+        0, 0, 0, 0, 0, 0.579772234f, 0, 0.899999797f,
+        0, 0, 0, 0, 0, 1.0053786f, 0, 0,
+        0, 1.68772256f, 0.610619068f, 0, 1.186499f, 0, 0, 1.45810199f,
+        0.924622416f, 1.82613993f, 0, 0, 0.343852907f, 0, 0, 0,
+        0.724118114f, 0, 0.308935612f, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0.432679504f, 1.74519908f, 0, 0, 0.546843827f, 0,
+        0, 1.7038039f, 0, 0, 0, 0, 1.07783127f, 0,
+        0.999999881f, 0.230331659f, 1.03411031f, 0, 0, 0, 0.999999881f, 0.711595297f,
+        0, 0, 0, 0, 0.738669395f, 0, 0.363433063f, 0,
+        0, 0, 0, 0, 0.988502979f, 0, 0, 0,
+        0.999999881f, 0.176909089f, 0, 0.56498307f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.4622165f,
+        1.13935208f, 1.691028f, 0, 0, 1.09095109f, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0.663283765f, 0, 0, 0, 0.741328597f, 0.260903448f, 0, 0.999999881f,
+        0, 1.67796278f, 0, 0, 0, 0, 1.23110735f, 0,
+        0.999999881f, 0.269869417f, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0.770356417f, 0,
+        0, 0.559405029f, 0, 0, 1.10164475f, 0, 0, 0,
+        1.79999959f, 0.960965753f, 0, 0.999999881f, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0.538002372f,
+        0, 0.258167684f, 0, 0, 0, 0, 0, 0,
+        0.652858555f, 0, 0.362149119f, 0, 0, 0, 0, 0,
+        0.174434111f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.362995207f, 0, 0,
+        0, 0, 0.855632842f, 0, 0, 0, 0.999999881f, 0.255006462f,
+        0, 0, 0, 0, 0.999999881f, 0, 1.10936177f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.947544992f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.765438616f, 0, 0.415718526f, 0, 0, 0, 0,
+        0, 1.15321016f, 0, 0, 0, 0.999999881f, 0.212750793f, 0,
+        0.368625194f, 0, 0, 0, 0, 0, 0.191536099f, 0,
+        0, 0, 0, 0.873771608f, 0, 0, 0, 0.777570844f,
+        0.757376313f, 0, 1.32237005f, 0, 0, 0.618496358f, 0.947815955f, 1.14680314f,
+        0, 0, 0.155247241f, 0, 0, 0, 0.471247017f, 0,
+        0.571996391f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.978845179f, 0, 0, 0, 0, 0,
+        0.676853836f, 0, 0.585620403f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.510894418f, 0, 0, 0, 1.09838831f, 0.479241997f, 0,
+        1.24301243f, 0, 0, 1.27596259f, 0.936219752f, 0.731715441f, 0, 0,
+        0.758118689f, 0, 0, 0, 0.700565457f, 0, 0.563736379f, 0,
+        0, 0, 0, 0, 0, 0.859493196f, 0.925593793f, 1.25932133f,
+        0, 0, 1.11453271f, 0, 0, 1.43411815f, 0, 0,
+        0, 0, 0.396023959f, 0, 1.24166405f, 0.915955365f, 1.12559462f, 0,
+        0, 0, 0.761297345f, 0.921230972f, 0, 0.999999881f, 0, 0,
+        0.817284048f, 0, 0.291912228f, 0, 0, 0, 0, 0,
+        0.395587265f, 0, 0, 0, 0.999999881f, 0, 0, 0.156798527f,
+        0, 0, 0, 0, 0, 0.628780663f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.591168761f, 0,
+        0, 0, 0, 0, 1.20429933f, 0, 0.804717302f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.0102137728f, 0,
+        0.361692965f, 0, 0, 0, 0, 0, 0.318841606f, 0,
+        0, 0, 0.999999881f, 0.676817119f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.904572189f, 0, 0, 0, 1.45950592f,
+        0.321645945f, 0, 0.425527662f, 0, 0, 0.781900048f, 0.995911956f, 0.645212948f,
+        0, 0, 0.994275391f, 0, 0, 0, 0.45462817f, 0,
+        0.273508459f, 0, 0, 0, 0, 0, 0, 0.572995067f,
+        0.679823816f, 0.764625967f, 0, 0, 0.929044425f, 0, 0, 0.850898147f,
+        0, 0, 0, 0, 0.336862504f, 0, 0, 0.999999881f,
+        0.486084402f, 0, 0, 0, 0, 0.356947124f, 0, 0.89969033f,
+        0, 0, 0.413524777f, 0, 0.190354675f, 0, 0, 0,
+        0, 0, 0.467835367f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.558536053f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.23935783f, 0.426038563f, 1.14507711f,
+        0, 0, 1.58456087f, 0, 0, 0.832190812f, 0, 0,
+        0, 0, 0, 0, 0.99906826f, 0.999999881f, 0.5791502f, 0,
+        0, 0, 0.725973129f, 0.437364101f, 0, 0.999999881f, 0, 0.999999881f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0.329778939f, 0, 0, 0, 1.04090369f, 0,
+        0, 0.674384236f, 0, 0, 0.971606076f, 0, 0, 0,
+        0, 0.144457906f, 0, 0, 0, 0.373514324f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.368044674f, 0,
+        0.655537724f, 0, 0, 0, 0, 0, 1.00100255f, 0,
+        0, 0, 0.999999881f, 0.694974244f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.257579267f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.511196971f, 0.97625953f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.416093886f,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.396241724f, 0, 0, 0, 0, 0,
+        0.58729285f, 0, 1.03565121f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.648570836f, 0, 0.322328806f, 0, 0, 0,
+        0, 0, 0.396898985f, 0, 0, 0, 0.999999881f, 0.26280874f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.868635654f, 0, 0.218440026f, 0, 0, 0, 0, 0,
+        0.692468047f, 0, 0, 0, 0.999999881f, 0, 0, 0.355358005f,
+        0, 0, 0, 0, 0, 0.345537513f, 0, 0,
+        0, 0, 0.892557502f, 0, 0, 0, 1.11696899f, 0.265541881f,
+        0, 0.802089334f, 0, 0, 1.12972963f, 0.458042026f, 0.441232532f, 0,
+        0, 0.68795979f, 0, 0, 0, 0.452916622f, 0, 0.35141179f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0.760212779f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.375720918f,
+        0, 0, 0, 0, 0, 0.355965436f, 0, 0.953726947f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2.16868734f, 0, 0, 0, 0, 1.35995615f, 0,
+        1.81755805f, 1.19418132f, 0, 0, 1.76198161f, 0, 0, 0,
+        2.04710102f, 0, 0, 0, 1.5976429f, 0.585788667f, 1.88272667f, 0,
+        0, 0.640491307f, 0, 0, 0, 0, 1.87798905f, 0,
+        0, 0, 1.46998131f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 2.11545181f, 1.43994951f, 0,
+        0, 0, 0, 1.63321579f, 0, 1.51757908f, 0, 0,
+        1.91263843f, 0.897873223f, 1.90618086f, 0, 0, 1.10211289f, 0, 0,
+        2.02465034f, 0, 0, 0, 0, 1.19834006f, 0, 1.60674167f,
+        1.01046014f, 1.16449678f, 0, 0, 0, 1.03183985f, 0.860276699f, 0,
+        1.22696579f, 0, 0, 0, 1.14513171f, 0, 0, 0,
+        2.05394983f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.59308517f, 1.94316971f, 0, 0, 0,
+        0, 1.83602941f, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.17695487f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.895799279f, 0, 0, 0, 1.30720258f, 0, 0,
+        1.96002626f, 0, 0, 0, 0, 1.06406522f, 0, 0.999999881f,
+        0.629197657f, 0, 0, 1.38453805f, 0, 0, 0, 1.79643917f,
+        0, 0, 0, 0.999999881f, 1.01550925f, 1.6293608f, 0, 0,
+        1.03060162f, 0, 0, 0, 1.05944335f, 0.800551593f, 1.37268209f, 0,
+        0, 0.935145319f, 0, 0, 1.78325272f, 0, 0, 0,
+        0, 1.1901449f, 0, 0.499031425f, 1.36769116f, 0.39286828f, 0, 0,
+        0, 0.448816121f, 0.748556733f, 0, 0.997310102f, 0, 1.27071297f, 0,
+        0, 0, 0, 1.28191257f, 0, 0.559181392f, 0.598628223f, 0,
+        0, 1.62153804f, 0, 0, 0, 1.14847529f, 0, 0,
+        0, 0.736751318f, 0.448730946f, 1.23594189f, 0, 0, 0.417810142f, 0,
+        0, 0.564805865f, 0, 0, 0, 1.08421278f, 0.493165195f, 0,
+        0.420694679f, 0, 0, 0.843562484f, 0.482451826f, 0.7107265f, 0, 0,
+        0.909083605f, 0, 0, 0, 0.188123494f, 0, 0.358517706f, 0,
+        0, 0, 0, 0, 0, 0, 1.6380074f, 0,
+        0, 0, 1.64710104f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 1.08941233f, 0,
+        0, 0, 0, 1.35558546f, 0, 1.74894071f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.876186609f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.649125755f, 0, 0, 0, 0.316614449f,
+        0, 0, 1.89944386f, 0, 0, 0, 0, 1.1024785f,
+        0, 1.97981215f, 0.9386971f, 0, 0, 0.999999881f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 1.66744733f, 0.551920533f, 1.24693024f,
+        0, 0, 0.746343911f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.16973686f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.240240619f, 0, 0, 0, 0.860964894f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.947980881f, 0, 0,
+        0, 1.66887665f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.03492725f, 0, 0,
+        0, 0, 0.603782296f, 0, 0.999999881f, 0, 0.924471557f, 0,
+        0, 0, 0, 1.21976686f, 0, 0.59446764f, 0.889904022f, 0,
+        0, 0.999999881f, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0.853713989f, 0.277514189f, 0.585208893f, 0, 0, 0.0574615709f, 0,
+        0, 0, 0, 1.20104825f, 0, 0, 0, 1.00649679f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0.457262486f, 0, 0, 0, 0,
+        0.440171093f, 0, 0, 0, 0, 1.14385092f, 0.80460906f, 1.46703219f,
+        0, 0, 0.929435372f, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0.387828112f, 0,
+        0, 0, 0.230927914f, 0.42345351f, 0, 0, 0, 0,
+        2.00799465f, 0.888790727f, 1.9708544f, 0, 0, 1.16979122f, 0, 0,
+        1.76441979f, 0, 0, 0, 0, 1.29867768f, 0, 0.881885588f,
+        1.28292882f, 1.36963522f, 0, 0, 0, 1.55496562f, 1.36821342f, 0,
+        1.12862384f, 0, 1.96275508f, 0, 0, 0, 0, 1.5301373f,
+        0, 1.48363638f, 0.662080705f, 0, 0, 1.75449347f, 0, 0,
+        0, 1.50795293f, 0, 0, 0, 1.86907494f, 0.712500393f, 1.71205795f,
+        0, 0, 0.454072922f, 0, 0, 1.30290639f, 0, 0,
+        0, 1.145486f, 0.393975407f, 0, 0.841602981f, 0, 0, 1.20936835f,
+        0.695109963f, 0.648237348f, 0, 0, 1.15830171f, 0, 0, 0,
+        0.69443959f, 0, 0.861684501f, 0, 0, 0, 0, 0,
+        2.20727777f, 0, 0, 0, 0, 1.54558718f, 0, 0.999999881f,
+        0.617044628f, 0, 0, 1.57639539f, 0, 0, 0, 1.86800134f,
+        0, 0, 0, 0.999999881f, 0.780865967f, 1.93875742f, 0, 0,
+        0.632924855f, 0, 0, 0, 0, 1.23543072f, 0, 0,
+        0, 1.94973993f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.19078791f, 1.39764369f, 0, 0,
+        0, 0, 1.21177495f, 0, 0.999999881f, 0, 0, 0.999999881f,
+        0.952557683f, 1.84307134f, 0, 0, 1.45484245f, 0, 0, 1.98912418f,
+        0, 0, 0, 0, 1.46869206f, 0, 0.999999881f, 0.576101303f,
+        1.39064622f, 0, 0, 0, 0.999999881f, 0.970624268f, 0, 0,
+        0, 0.240193799f, 0, 0, 0, 0.902732193f, 0.815878987f, 0,
+        0.0608297959f, 0, 0, 0.281535447f, 0.678210735f, 1.39811897f, 0, 0,
+        0.454517961f, 0, 0, 0, 0.264577389f, 0, 0.290241718f, 0,
+        0, 0, 0, 0, 0, 1.65838122f, 0.757450461f, 1.89459336f,
+        0, 0, 1.19527626f, 0, 0, 1.16812754f, 0, 0,
+        0, 0, 0.899999797f, 0, 0.221682936f, 0.629786253f, 1.09742582f, 0,
+        0, 0, 1.02797711f, 0.610556066f, 0, 0.424322069f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.97750485f, 0, 0, 0,
+        1.26743424f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.94413519f, 1.87666225f, 0, 0, 0,
+        0, 1.68493474f, 0, 1.4956665f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.73442781f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.863158941f, 0, 0, 0, 0.834183872f, 0, 0,
+        1.9707036f, 0, 0, 0, 0, 1.85190189f, 0, 1.72350085f,
+        1.11964726f, 0, 0, 1.84150445f, 0, 0, 0, 1.59282517f,
+        0, 0, 0, 1.89444494f, 1.19967258f, 1.90682411f, 0, 0,
+        0.74473691f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.26421058f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.06961191f,
+        0, 0, 0, 1.39816964f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.4964515f, 0, 0, 0, 1.81783628f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 1.70337236f, 0, 0, 0, 0,
+        1.49487031f, 0, 0.999999881f, 0, 1.48728895f, 0, 0, 0,
+        0, 1.69060147f, 0, 0.610434413f, 1.06507146f, 0, 0, 1.47668839f,
+        0, 0, 0, 0.853342295f, 0, 0, 0, 1.78925359f,
+        1.01625228f, 1.67165637f, 0, 0, 0.816500664f, 0, 0, 0,
+        0, 1.26684558f, 0, 0, 0, 0.676304221f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.972880483f, 1.56174779f, 0, 0, 0, 0, 1.15754509f, 0,
+        0.999999881f, 0, 0, 0.650833845f, 1.23255217f, 1.44444621f, 0, 0,
+        0.388858557f, 0, 0, 0.727560282f, 0, 0, 0, 0,
+        1.01807129f, 0, 0, 0.999999881f, 0.560553432f, 0, 0, 0,
+        0.577513397f, 0.977935016f, 0, 0.624565899f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.24955785f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.810016751f, 0, 0, 0, 0.61520493f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.99870157f, 0, 0,
+        0, 1.73244381f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.58425856f, 0, 0,
+        0, 0, 1.63578999f, 0, 1.79999959f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.739821076f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.490681082f, 0, 0, 0, 0.830028355f, 0, 0, 0,
+        0, 1.1216079f, 0, 0, 0, 0.3712717f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 1.22163391f, 0, 0, 0, 0, 1.35391629f, 0,
+        1.01950061f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.259454221f, 0,
+        0, 0, 0, 0, 0, 1.88752389f, 0, 0,
+        0, 0, 1.79999959f, 0, 0.862402618f, 0.999999881f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        1.49378097f, 0.953739882f, 1.43188047f, 0, 0, 0.492915213f, 0, 0,
+        1.89116287f, 0, 0, 0, 0, 1.55755901f, 0, 1.63632894f,
+        0.976738095f, 0, 0, 1.76500356f, 0, 0, 0, 1.28339422f,
+        0, 0, 0, 1.77136648f, 1.12946093f, 2.03608489f, 0, 0,
+        1.56017721f, 0, 0, 0, 0, 1.76356387f, 0, 0,
+        0, 1.72199667f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.79999959f, 1.67788637f, 0, 0,
+        0, 0, 1.15040743f, 0, 0.999999881f, 0, 0, 1.13164222f,
+        1.18085706f, 1.14116836f, 0, 0, 1.36474371f, 0, 0, 1.18852973f,
+        0, 0, 0, 0, 1.11886895f, 0, 0.831112862f, 0.999999881f,
+        0.479192823f, 0, 0, 0, 0.877825379f, 0.947602928f, 0, 0.999999881f,
+        0, 0, 0, 1.86709619f, 0, 0, 0, 1.6439687f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 1.67507744f, 0, 0, 0, 0,
+        1.22188067f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.875947475f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.634529889f, 0, 0, 0, 0.532476723f, 0, 0, 1.82805145f,
+        0, 0, 0, 0, 1.79999959f, 0, 0.999999881f, 0.999999881f,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0.977905214f, 1.79999959f, 0, 0, 0.999999881f,
+        0, 0, 0, 1.31564188f, 0.608031988f, 0.55040884f, 0, 0,
+        0.917699218f, 0, 0, 0.95555836f, 0, 0, 0, 0,
+        0.344321996f, 0, 0, 0.345981717f, 1.22847974f, 0, 0, 0,
+        0.876998246f, 0.970867753f, 0, 0.999999881f, 0, 1.76292276f, 0, 0,
+        0, 0, 1.2886132f, 0, 0.999999881f, 0.504644036f, 0, 0,
+        1.36531532f, 0, 0, 0, 0.692617118f, 0, 0, 0,
+        0.999999881f, 0.955718875f, 1.79999959f, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.86324775f, 0.389157206f, 1.74527645f, 0,
+        0, 1.04107976f, 0, 0, 1.6095413f, 0, 0, 0,
+        0, 1.01408887f, 0, 1.70134914f, 1.27964199f, 0.601357579f, 0, 0,
+        0, 1.40364134f, 0.098162517f, 0, 0.714395404f, 0, 1.75889349f, 0,
+        0, 0, 0, 1.22520947f, 0, 1.26776659f, 0.897037506f, 0,
+        0, 1.55798447f, 0, 0, 0, 1.78708112f, 0, 0,
+        0, 0.977392852f, 0.226750299f, 1.02739072f, 0, 0, 0.436372817f, 0,
+        0, 0.910633862f, 0, 0, 0, 1.37912714f, 0, 0,
+        0.748970747f, 0, 0, 1.68388057f, 0, 1.01195168f, 0, 0,
+        0.748224378f, 0, 0, 0, 1.0024122f, 0, 0.107222341f, 0,
+        0, 0, 0, 0, 1.920362f, 0, 0, 0,
+        0, 0.755827069f, 0, 0.999999881f, 0.2200201f, 0, 0, 1.14555585f,
+        0, 0, 0, 1.65733242f, 0, 0, 0, 0.999999881f,
+        0.352435291f, 1.879511f, 0, 0, 0.806147873f, 0, 0, 0,
+        0, 1.57117641f, 0, 0, 0, 1.65012288f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.56802928f, 1.86254656f, 0, 0, 0, 0, 1.79999959f, 0,
+        0.999999881f, 0, 0, 0.999999881f, 0, 1.63034844f, 0, 0,
+        0.720142603f, 0, 0, 1.06404662f, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0.727830112f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0, 0.572201908f, 0, 0,
+        0, 0.692221999f, 0.2646707f, 0, 0.0867539123f, 0, 0, 1.50244546f,
+        0.453056037f, 1.61404729f, 0, 0, 0.550539613f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.715502858f, 0.649722517f, 0.444896162f, 0, 0, 0.193118274f, 0,
+        0, 1.52292418f, 0, 0, 0, 0, 1.42287838f, 0,
+        0.597898901f, 0.968677819f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.792655051f, 0, 0.515649974f, 0,
+        0, 0, 0, 0, 0.696923912f, 0, 0, 0,
+        0.999999881f, 0, 0, 0.297878414f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.30456972f, 0,
+        0, 0, 0, 0.676713943f, 0, 1.97361195f, 0.876103818f, 0,
+        0, 0.999999881f, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 1.05972111f, 0.313989341f, 0.875640512f, 0, 0, 0.432680428f, 0,
+        0, 0, 0, 1.38786447f, 0, 0, 0, 1.09756649f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0.665125966f, 0, 0, 0, 0,
+        0.642852664f, 0, 0.998553395f, 0, 0, 1.79604101f, 0, 1.0909853f,
+        0, 0, 0.487437189f, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0.747800231f, 0,
+        0, 0, 0.945417225f, 0, 0, 0.534841061f, 0, 0,
+        0, 0.78908813f, 0, 0, 0, 1.54874027f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 1.25397754f, 0, 0, 0, 0, 1.24149883f, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.701048553f, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0.817493916f, 0, 0, 0.655632257f, 0, 0,
+        0, 0.268396139f, 0.744097829f, 1.01926494f, 0, 0, 0.577323914f, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.42374349f, 0, 0, 0, 0,
+        0.559197545f, 0, 0, 0.641039491f, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.502687931f, 0,
+        0, 0, 1.07975531f, 0, 0, 0.219160363f, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.888516307f, 0, 0, 0, 0.938258529f, 0.265978992f, 0,
+        0.555877566f, 0, 0, 1.37877989f, 0.423641622f, 1.26972044f, 0, 0,
+        0.518223941f, 0, 0, 0, 0.831055403f, 0, 0.76796782f, 0,
+        0, 0, 0, 0, 0, 1.81884003f, 0.876583576f, 1.67675924f,
+        0, 0, 0.898785591f, 0, 0, 1.47476518f, 0, 0,
+        0, 0, 0.899999797f, 0, 1.39583671f, 0.899999797f, 0.664126575f, 0,
+        0, 0, 0.932883143f, 0.272483021f, 0, 0.512372553f, 0, 0,
+        1.15487003f, 0, 0.276444435f, 0, 0, 0, 0, 0,
+        0.331046879f, 0, 0, 0, 0.999999881f, 0, 0, 0.658900917f,
+        0, 0, 0, 0, 0, 0.828958571f, 0, 0,
+        0, 0, 0, 0.999999881f, 0.600876093f, 1.73977065f, 0, 0,
+        0.837101221f, 0, 0, 1.46037304f, 0, 0, 0, 0,
+        0.592399776f, 0, 0.999999881f, 0.301183939f, 1.20089638f, 0, 0, 0,
+        0.999999881f, 0.921681821f, 0, 0, 0, 1.89169073f, 0, 0,
+        0, 0, 1.29743373f, 0, 0.999999881f, 0.688525438f, 0, 0,
+        0.899999797f, 0, 0, 0, 1.16533554f, 0, 0, 0,
+        0.999999881f, 0.272292197f, 1.79999959f, 0, 0, 0.227683976f, 0, 0,
+        0.936152816f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 1.24684334f, 0, 0, 0.307212085f,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0.373170406f, 0, 0.0873266235f, 0,
+        0, 0, 0, 0, 0.485676259f, 0, 0, 0,
+        0.999999881f, 0.484110653f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.322500616f, 0,
+        0, 0, 0.962156594f, 0.360889494f, 0, 0, 0, 0,
+        1.33932221f, 0.899999797f, 1.40456998f, 0, 0, 0.607303739f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.16485167f, 0,
+        0, 0, 1.8928982f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.67927396f, 1.61633646f, 0,
+        0, 0, 0, 1.61482465f, 0, 1.54582632f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.50648618f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.724835992f, 0, 0, 0, 0.934821963f,
+        0, 0, 1.62620234f, 0, 0, 0, 0, 1.2787627f,
+        0, 2.07921863f, 1.04067945f, 0, 0, 1.19191325f, 0, 0,
+        0, 2.08374238f, 0, 0, 0, 1.53420699f, 0.360560685f, 1.25902772f,
+        0, 0, 0.941857874f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.402830809f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.31295705f, 0, 0, 0, 1.39634609f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.23122752f, 0, 0,
+        0, 1.80726242f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.816526115f, 1.67945015f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 1.18695486f, 0,
+        0, 0, 0, 1.06160843f, 0, 1.28585362f, 1.27027011f, 0,
+        0, 1.33163166f, 0, 0, 0, 1.84656715f, 0, 0,
+        0, 0.512110889f, 0.880830646f, 1.2109139f, 0, 0, 0.710591435f, 0,
+        0, 0, 0, 1.36902165f, 0, 0, 0, 1.37679422f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.79999959f, 0.895688236f, 0, 0, 0, 0,
+        0.756750703f, 0, 0.714704573f, 0, 0, 0.744756818f, 0.310752362f, 0.252764851f,
+        0, 0, 0.736107111f, 0, 0, 1.4996109f, 0, 0,
+        0, 0, 0, 0, 1.3679924f, 0.999999881f, 0.384965509f, 0,
+        0, 0, 0, 0.609557271f, 0, 0.284439534f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.58897817f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.430975825f, 0, 0, 0, 0.950074911f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.04038155f,
+        0, 0, 0, 1.69950807f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 1.36667585f,
+        0, 0, 0, 0, 0.681234479f, 0, 1.79999959f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.32056236f, 0,
+        0, 0, 0, 1.72336817f, 0, 0, 0, 1.75415385f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0.564034104f, 0, 0, 0, 0,
+        0.829604924f, 0, 0.603843212f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.15092027f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.42342114f,
+        0, 0, 0, 0, 0.588726819f, 0, 1.79999959f, 0.999999881f,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.921172798f, 0.4545964f, 0.796067417f, 0, 0, 0.666531086f,
+        0, 0, 1.55042076f, 0, 0, 0, 0, 1.63860071f,
+        0, 1.6709609f, 0.744291663f, 0, 0, 1.39562273f, 0, 0,
+        0, 1.73244131f, 0, 0, 0, 1.788306f, 1.08893847f, 1.45758557f,
+        0, 0, 0.746498108f, 0, 0, 0, 0, 1.42294002f,
+        0, 0, 0, 1.45252633f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.61055899f, 1.66147661f,
+        0, 0, 0, 0, 1.79999959f, 0, 1.79999959f, 0,
+        0, 1.0407517f, 0.681238353f, 0.804659367f, 0, 0, 0.485447407f, 0,
+        0, 1.06889486f, 0, 0, 0, 0, 0, 0,
+        0.837799549f, 0.534966171f, 0.95207423f, 0, 0, 0, 0.505625427f, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0, 1.4652909f, 0, 0,
+        0, 1.7707094f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.07724273f, 1.76728392f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.587679088f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.924851716f, 0, 0, 0, 0.799156666f, 0,
+        0, 1.93442857f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0.75186789f, 0, 0, 0.989486933f, 0, 0, 0,
+        1.79999959f, 0, 0, 0, 0.999999881f, 0.999999881f, 0.999999881f, 0,
+        0, 0.999999881f, 0, 0, 0, 0.703571975f, 0.550121784f, 0.584096551f,
+        0, 0, 0.827064872f, 0, 0, 0.528281808f, 0, 0,
+        0, 0, 0.39291212f, 0, 0.406877846f, 0.974588335f, 0.369851708f, 0,
+        0, 0, 0, 0.381511927f, 0, 0.665482879f, 0, 1.63103449f,
+        0, 0, 0, 0, 0.983518779f, 0, 1.49132419f, 0.942814589f,
+        0, 0, 1.18077707f, 0, 0, 0, 1.23536003f, 0,
+        0, 0, 1.41566408f, 0.566211581f, 0.624906838f, 0, 0, 0.759254694f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0.999999881f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0.999999881f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 0.999999881f, 0, 0, 0,
+        0, 0.999999881f, 0, 0.999999881f, 0, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0.999999881f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.56032777f, 0,
+        0, 0, 0, 0.519546628f, 0, 1.38000834f, 0.195399061f, 0,
+        0, 0.638722301f, 0, 0, 0, 1.98237979f, 0, 0,
+        0, 0.590426326f, 0.0531382561f, 0.962775469f, 0, 0, 0.100353479f, 0,
+        0, 0, 0, 1.52467561f, 0, 0, 0, 1.05299032f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.65198863f, 1.26050687f, 0, 0, 0, 0,
+        0.331366658f, 0, 0.485338122f, 0, 0, 1.41534257f, 0, 0.258524954f,
+        0, 0, 0.154394224f, 0, 0, 1.1082716f, 0, 0,
+        0, 0, 0, 0, 1.79999959f, 0, 0.723041654f, 0,
+        0, 0, 0.923227131f, 0, 0, 0.576843023f, 0, 0,
+        0, 0.479976952f, 0, 0, 0, 0.910311103f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.439566016f, 1.77021122f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.492676347f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.844362259f, 0,
+        0, 0, 1.02669954f, 0, 0, 1.68653619f, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 1.23955071f, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0.307792157f, 0, 0,
+        0, 0.958684742f, 0.123722352f, 0.0986388698f, 0, 0, 0.394034564f, 0,
+        0, 0.738411546f, 0, 0, 0, 0, 0.185749695f, 0,
+        1.12086642f, 0.952399015f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.824400246f, 0, 0, 0, 0,
+        0.303711504f, 0, 0.354294002f, 0.15522787f, 0, 0, 1.31685209f, 0,
+        0, 0, 1.37964678f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.0780916065f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.373317033f, 0, 0, 0, 0, 0.369238168f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.539098084f, 0, 0, 0, 1.58638632f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0.514811099f, 0, 0, 0, 0,
+        0, 0, 0.874091685f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.947311163f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.633134902f,
+        0, 0, 0, 0, 0, 0, 1.79999959f, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 1.17806232f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.903557539f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.54578626f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999421597f, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0.822237849f, 0, 0, 0, 0,
+        0, 0, 0.923050761f, 0.633559644f, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.937248766f, 0, 0, 0, 1.08105445f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.669179559f, 0, 0, 0, 0, 0.365163654f,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.40888906f, 0.370406389f, 0.312916607f,
+        0, 0, 0.516189933f, 0, 0, 0.898035288f, 0, 0,
+        0, 0, 0.236161232f, 0, 1.67328489f, 0.574797273f, 0.796871781f, 0,
+        0, 0, 0.919265747f, 0.561385453f, 0, 0.272513628f, 0, 1.35517633f,
+        0, 0, 0, 0, 1.56166899f, 0, 1.12953711f, 0.626210332f,
+        0, 0, 0.899999797f, 0, 0, 0, 0.899999797f, 0,
+        0, 0, 0.775505185f, 0, 1.33809125f, 0, 0, 0,
+        0, 0, 0.188420519f, 0, 0, 0, 0.771726489f, 0,
+        0, 0.323375642f, 0, 0, 0.805173874f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.827899337f, 0, 0.523594737f,
+        0, 0, 0, 0, 0, 1.81401253f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0.309933454f, 0, 0, 0, 1.49278724f, 0, 0, 0,
+        0.999999881f, 0.380360574f, 0.999999881f, 0, 0, 0.428064972f, 0, 0,
+        0, 0, 1.43209445f, 0, 0, 0, 1.43503737f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.49999994f, 1.79999959f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 0.59631151f, 0, 0, 0.790640652f, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 0, 0.999999881f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0.0565774329f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.323388487f, 0.426516116f, 0.484024197f, 0, 0, 0.56456989f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.51616478f, 0.199885115f, 0.191942722f, 0, 0, 0.346244633f,
+        0, 0, 0.899999797f, 0, 0, 0, 0, 0.49999994f,
+        0, 0.49999994f, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.88966012f, 0.808057904f, 2.04547238f, 0, 0, 0.754690349f, 0, 0,
+        2.07268333f, 0, 0, 0, 0, 1.64564431f, 0, 0.740596592f,
+        0.665945351f, 0.538436174f, 0, 0, 0, 1.50079882f, 0.618717551f, 0,
+        0.970760226f, 0, 1.03242195f, 0, 0, 0, 0, 1.54008079f,
+        0, 1.47197378f, 0.361984193f, 0, 0, 1.24969304f, 0, 0,
+        0, 1.32450247f, 0, 0, 0, 1.38807857f, 0.590616584f, 1.38530946f,
+        0, 0, 0.550607681f, 0, 0, 0.842639625f, 0, 0,
+        0, 1.52347612f, 0.470336318f, 0, 0.927238643f, 0, 0, 1.42934465f,
+        1.25464642f, 1.73568869f, 0, 0, 1.04132247f, 0, 0, 0,
+        0.698571682f, 0, 0.52133131f, 0, 0, 0, 0, 0,
+        2.3763833f, 0, 0, 0, 0, 1.40541017f, 0, 0.999999881f,
+        1.33242381f, 0, 0, 1.64976454f, 0, 0, 0, 2.06511307f,
+        0, 0, 0, 0.999999881f, 0.586596668f, 1.93588305f, 0, 0,
+        0.737619936f, 0, 0, 0, 0, 1.72972727f, 0, 0,
+        0, 2.04256082f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.79999959f, 1.76915097f, 0, 0,
+        0, 0, 1.37149405f, 0, 0.999999881f, 0, 0, 0.999999881f,
+        0.580350041f, 1.9516052f, 0, 0, 1.19199359f, 0, 0, 1.75718033f,
+        0, 0, 0, 0, 1.01801956f, 0, 0.999999881f, 0.999999881f,
+        0.68160224f, 0, 0, 0, 0.999999881f, 0.12922284f, 0, 0,
+        0, 0.779461563f, 0, 0, 0, 1.78649127f, 0.854639292f, 0,
+        0, 0, 0, 0.988663077f, 0.672452092f, 1.80951428f, 0, 0,
+        0, 0, 0, 0, 0.0798206478f, 0, 0.512103796f, 0,
+        0, 0, 0, 0, 0, 1.25019968f, 0.196190089f, 1.85331595f,
+        0, 0, 0, 0, 0, 1.06510675f, 0, 0,
+        0, 0, 1.34914982f, 0, 0, 0, 0.229561925f, 0,
+        0, 0, 0.977452755f, 0.447743356f, 0, 0, 0, 0,
+        0.00995631609f, 0, 0.417278528f, 0, 0, 0, 0, 0,
+        0.459646136f, 0, 0, 0, 0.999999881f, 0.1535258f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.75930154f, 0, 0, 0, 0, 1.53254151f,
+        0, 1.15102875f, 0.447460771f, 0, 0, 0.999999881f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 1.1737057f, 0.228904486f, 1.69748378f,
+        0, 0, 0.366884947f, 0, 0, 0, 0, 1.06335211f,
+        0, 0, 0, 0.726207674f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 1.28583503f,
+        0, 0, 0, 0, 1.22973144f, 0, 0.482843101f, 0,
+        0, 1.72747481f, 0.626036882f, 1.5701921f, 0, 0, 0.911766648f, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0.540081441f, 0, 0, 0, 1.53143442f, 0.447980046f,
+        0, 0.529357731f, 0, 0, 0, 1.36471307f, 0, 0,
+        0, 1.81285322f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.82923055f, 0, 0,
+        0, 0, 1.42282915f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 1.55313039f, 0, 0, 0, 0, 0.285124391f, 0,
+        0.999999881f, 0.658378363f, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 1.35479093f, 0,
+        0, 0.347493827f, 0, 0, 0, 0.557692826f, 0.614094257f, 1.22801006f,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.261666209f, 0,
+        0, 0, 0.565380514f, 0.192827001f, 0, 0, 0, 0.948268294f,
+        0, 0, 0, 0, 1.17442071f, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.342359096f, 0, 0, 0,
+        0, 0, 0.564728796f, 0, 0, 0, 1.41766024f, 0.935876012f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.58025831f,
+        0, 0, 0, 0, 0, 0.922074318f, 0, 0,
+        0, 1.96629608f, 0.736023188f, 0, 1.01243174f, 0, 0, 1.83760262f,
+        0.851843238f, 1.78143477f, 0, 0, 1.00548768f, 0, 0, 0,
+        0.898142517f, 0, 0.540391803f, 0, 0, 0, 0, 0,
+        0, 1.99987066f, 0.692625582f, 1.68494785f, 0, 0, 0.688640416f, 0,
+        0, 1.62511849f, 0, 0, 0, 0, 0.899999797f, 0,
+        0.693219006f, 0.410067648f, 1.23866796f, 0, 0, 0, 1.79999959f, 0.899999797f,
+        0, 0.999999881f, 0, 0, 0.671631575f, 0, 0.338834226f, 0,
+        0, 0, 0, 0, 0.94753921f, 0, 0, 0,
+        0.999999881f, 0, 0, 0.677869201f, 0, 0, 0, 0,
+        0, 0.456484556f, 0, 0, 0, 0, 0, 0.999999881f,
+        1.04610622f, 2.1001215f, 0, 0, 1.0765655f, 0, 0, 1.89454687f,
+        0, 0, 0, 0, 1.46261656f, 0, 0.999999881f, 0.952409446f,
+        1.00809085f, 0, 0, 0, 0.999999881f, 0.899999797f, 0, 0,
+        0, 1.88688278f, 0, 0, 0, 0, 0.899999797f, 0,
+        0.999999881f, 0.501271605f, 0, 0, 1.2839371f, 0, 0, 0,
+        1.79999959f, 0, 0, 0, 0.999999881f, 0.318033069f, 1.38228762f, 0,
+        0, 0.602449656f, 0, 0, 1.06175292f, 0, 0, 0,
+        0.999999881f, 0.694173813f, 0, 0, 0, 0, 0.999999881f, 0.352336198f,
+        1.79999959f, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0.908336997f, 0, 0, 0, 0, 0, 0,
+        0.115065172f, 0, 0.380368412f, 0, 0, 0, 0, 0,
+        0.457565665f, 0, 0, 0, 0.999999881f, 0.694954336f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.504801393f, 0, 0, 0, 1.79999959f, 0.899999797f,
+        0, 0, 0, 0, 1.01763833f, 0.47824055f, 1.30867946f, 0,
+        0, 0, 0, 0, 0, 0.583347261f, 0, 0.61368531f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.9102f, 0, 0, 0, 0, 1.54417324f, 0, 1.19641197f,
+        0.350281298f, 0, 0, 1.65593362f, 0, 0, 0, 1.14309907f,
+        0, 0, 0, 1.64174151f, 0.751127362f, 1.55589056f, 0, 0,
+        0.155898228f, 0, 0, 0, 0, 0.602371693f, 0, 0,
+        0, 0.424210399f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.498126209f, 0.942473531f, 0, 0,
+        0, 0, 0.899999797f, 0, 0.999999881f, 0, 0, 1.67368746f,
+        0.895807385f, 1.97190499f, 0, 0, 0.721081257f, 0, 0, 1.77135479f,
+        0, 0, 0, 0, 1.79999959f, 0, 1.19701898f, 0.999999881f,
+        0.871718287f, 0, 0, 0, 1.27679396f, 0.899999797f, 0, 0.607292771f,
+        0, 0, 0, 1.80015266f, 0, 0, 0, 1.59251666f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 1.32544172f, 0, 0, 0, 0,
+        0.899999797f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.2346338f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.422461122f, 0, 0, 0, 0.764513373f, 0, 0, 1.81756365f,
+        0, 0, 0, 0, 1.35542047f, 0, 0.999999881f, 0.602885902f,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0.38855046f, 1.19124401f, 0, 0, 0.641806304f,
+        0, 0, 0, 0.816253066f, 0.290026128f, 1.31266248f, 0, 0,
+        0, 0, 0, 0.0959094837f, 0, 0, 0, 0,
+        1.3197819f, 0, 0, 0, 0.731434107f, 0, 0, 0,
+        1.45006073f, 0.899999797f, 0, 0, 0, 0.497155249f, 0, 0,
+        0, 0, 0.899999797f, 0, 0, 0, 0, 0,
+        0.376892f, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0.257725954f, 1.26088905f, 0, 0, 0, 0, 0,
+        0.76165694f, 0, 0, 0, 0.417654604f, 0.418137789f, 0, 0,
+        0, 0, 0, 0.724723577f, 0.935568571f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.633418679f, 0, 0,
+        0, 0, 0, 0, 0, 1.24362063f, 0, 0,
+        0, 1.01757836f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 1.24970853f, 0, 0,
+        0, 0, 0.899999797f, 0, 0.742289901f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.710587919f, 0, 0, 0, 0, 0,
+        0, 1.89377618f, 0, 0, 0, 0, 1.40097404f, 0,
+        1.29159617f, 0.298647314f, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 1.26927829f, 0.507196128f, 0.899999797f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.708143592f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.356040239f, 0, 0, 0, 1.12989151f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.62884915f, 0, 0, 0,
+        1.79999959f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 1.57127535f, 0, 0, 0,
+        0, 0.49999994f, 0, 0.999999881f, 0, 0.924045563f, 0, 0,
+        0, 0, 1.36100864f, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0.608461618f, 0.39206171f, 0.899999797f, 0, 0, 0, 0, 0,
+        0, 0, 0.539936543f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.585861146f, 0, 0, 0, 0, 0.49999994f,
+        0, 0, 0, 0, 0.592703879f, 0.941916585f, 1.38872385f, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0.451177359f, 0, 0,
+        0, 0.49999994f, 0.49999994f, 0, 0, 0, 0, 1.52832866f,
+        0.914178193f, 1.27106357f, 0, 0, 0.757914662f, 0, 0, 1.48980212f,
+        0, 0, 0, 0, 1.16044855f, 0, 0.819907427f, 0.678937912f,
+        0.605797172f, 0, 0, 0, 1.79999959f, 0.899999797f, 0, 0.999999881f,
+        0, 1.79460049f, 0, 0, 0, 0, 0.899999797f, 0,
+        0.999999881f, 0, 0, 0, 1.14679229f, 0, 0, 0,
+        1.17823875f, 0, 0, 0, 0.999999881f, 0.379601657f, 1.24151981f, 0,
+        0, 0.51119715f, 0, 0, 0.724840343f, 0, 0, 0,
+        0.521796346f, 0.419809252f, 0, 0.39072445f, 0, 0, 1.21647179f, 0.833728135f,
+        0.938653111f, 0, 0, 0.413945735f, 0, 0, 0, 0.0949656516f,
+        0, 0.410164505f, 0, 0, 0, 0, 0, 2.0347414f,
+        0, 0, 0, 0, 1.24679172f, 0, 0.999999881f, 0.376825988f,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0.659277916f, 1.26395845f, 0, 0, 0.136399567f,
+        0, 0, 0, 0, 1.37706578f, 0, 0, 0,
+        1.79999959f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 1.32331085f, 0, 0, 0,
+        0, 0.49999994f, 0, 0.999999881f, 0, 0, 0.999999881f, 0.932350278f,
+        1.79999959f, 0, 0, 0.999999881f, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0.999999881f, 0, 0.999999881f, 0, 0.92988342f,
+        0, 0, 0, 0.999999881f, 0.49999994f, 0, 0, 0,
+        0.27248621f, 0, 0, 0, 0.851521015f, 0.567531407f, 0, 0,
+        0, 0, 0, 0, 0.327502817f, 0, 0, 0,
+        0, 0, 0, 0.321177155f, 0, 0.314878583f, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.238243014f, 1.21716952f, 0,
+        0, 0, 0, 0, 0.615978897f, 0, 0, 0,
+        0, 0.49999994f, 0, 0, 0, 0.951547027f, 0, 0,
+        0, 0.999999881f, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.43700123f, 0, 0, 0, 1.69713163f, 0.659024119f, 0,
+        0.542914629f, 0, 0, 1.53474689f, 0.887262464f, 1.54139769f, 0, 0,
+        1.01608229f, 0, 0, 0, 1.01014876f, 0, 0.25921306f, 0,
+        0, 0, 0, 0, 0, 1.03229511f, 1.12343538f, 1.85552084f,
+        0, 0, 0.67955935f, 0, 0, 1.95327151f, 0, 0,
+        0, 0, 1.36184967f, 0, 0.443834722f, 0.964407206f, 0.787919879f, 0,
+        0, 0, 0.956341267f, 0.65875268f, 0, 0.482693255f, 0, 0,
+        1.33155155f, 0, 0.368429631f, 0, 0, 0, 0, 0,
+        1.05825186f, 0, 0, 0, 0.999999881f, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0.525952876f, 0, 0,
+        0, 0, 0, 0.999999881f, 1.37404299f, 2.01652575f, 0, 0,
+        1.60294855f, 0, 0, 1.74633312f, 0, 0, 0, 0,
+        0.36550349f, 0, 0.999999881f, 0.930338323f, 1.19429314f, 0, 0, 0,
+        0.999999881f, 0.513618648f, 0, 0, 0, 2.04465151f, 0, 0,
+        0, 0, 1.16700697f, 0, 0.999999881f, 0.933185518f, 0, 0,
+        1.54544246f, 0, 0, 0, 1.79999959f, 0, 0, 0,
+        0.999999881f, 0.940595746f, 1.79999959f, 0, 0, 0.999999881f, 0, 0,
+        0.895283461f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0.762297988f, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0.296680033f, 0, 0,
+        0, 0, 0, 0, 0.319551498f, 0, 0.794825256f, 0,
+        0, 0, 0, 0, 1.15266836f, 0, 0, 0,
+        0.999999881f, 0.960986555f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.480101407f, 0,
+        0, 0, 0.8159464f, 0.476995885f, 0, 0, 0, 0,
+        0.830435634f, 0.959339261f, 1.79999959f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.480492949f, 0, 0,
+        0, 0, 0, 0.999999881f, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.39384711f, 1.12455821f, 1.82710338f,
+        0, 0, 0.835240066f, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0.748812735f, 0,
+        0, 0, 1.05191267f, 0, 0, 0.505958855f, 0, 1.34915924f,
+        0, 0, 0, 0, 1.79999959f, 0, 0.832778275f, 0.999999881f,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.596642852f, 0.450255483f, 1.0447768f, 0, 0, 0.559848428f,
+        0, 0, 1.17881572f, 0, 0, 0, 1.79999959f, 0,
+        0, 0.999999881f, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0.686259806f, 0, 0,
+        0, 0, 0, 0, 0, 1.75937963f, 0, 0,
+        0, 0, 0.475120008f, 0, 0.999999881f, 0.999999881f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0.584339201f, 1.79999959f, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0.999999881f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0.999999881f, 0, 1.0484755f, 0,
+        0, 0.999999881f, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 0, 0.580894411f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0.575973153f, 0,
+        0, 0, 0.874935269f, 0.50870049f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.512861848f, 1.35831892f, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.620201409f, 0, 0.506536961f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.889223456f, 0, 0.862224936f, 0, 0, 0, 0, 0,
+        0.985748649f, 0, 0, 0, 0.999999881f, 0.52707088f, 0, 0.417592466f,
+        0, 0, 0, 0, 0, 0.406599909f, 0, 0,
+        0, 0, 0.816449046f, 0, 0, 0, 1.79999959f, 0.899999797f,
+        0, 0.275671065f, 0, 0, 1.79999959f, 0.899999797f, 1.24464798f, 0,
+        0, 0.62648809f, 0, 0, 0, 0.510458648f, 0, 0.180841252f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0.236848205f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.27599132f, 0, 0, 0, 0.999999881f, 0.553413212f, 0, 0,
+        0, 0, 0.999999881f, 0.430963755f, 1.47162616f, 0, 0, 0.979394317f,
+        0, 0, 0, 0, 0, 0.94446367f, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.899999797f, 1.23179698f, 0,
+        0, 0.943407536f, 0, 0, 1.31644166f, 0, 0, 0,
+        0, 0.49999994f, 0, 0.999999881f, 0.49999994f, 0.950344801f, 0, 0,
+        0, 0.999999881f, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0.73138082f, 0, 0, 0, 0, 0, 0.30593425f,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.305722505f, 0, 0,
+        0, 0, 0, 0.627274632f, 0, 0.965541899f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.382571757f,
+        0, 0, 0, 0, 0, 0.431952208f, 0, 0,
+        0, 0.999999881f, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.92229712f, 0, 0, 0, 1.67273068f, 0.628243864f,
+        0, 0.69446826f, 0, 0, 1.95764816f, 0.807069421f, 1.53214061f, 0,
+        0, 0.977403641f, 0, 0, 0, 0.477311432f, 0, 0.502208114f,
+        0, 0, 0, 0, 0, 0, 1.4701755f, 0.550328195f,
+        1.07915008f, 0, 0, 1.06282043f, 0, 0, 1.66498351f, 0,
+        0, 0, 0, 0.51656878f, 0, 1.47470009f, 0.653418064f, 0.633329391f,
+        0, 0, 0, 0.603814781f, 0.172201604f, 0, 0.934907615f, 0,
+        0, 0.873728693f, 0, 1.07766521f, 0, 0, 0, 0,
+        0, 1.13418496f, 0, 0, 0, 0.999999881f, 0.331966102f, 0,
+        0.822010398f, 0, 0, 0, 0, 0, 0.272738129f, 0,
+        0, 0, 0, 0, 1.13306105f, 1.69719505f, 1.72382891f, 0,
+        0, 1.33276379f, 0, 0, 2.06863499f, 0, 0, 0,
+        0, 1.35155797f, 0, 1.39185631f, 1.20958269f, 0.891273618f, 0, 0,
+        0, 0.895998478f, 1.15260375f, 0, 0.831861138f, 0, 1.81312716f, 0,
+        0, 0, 0, 1.94098723f, 0, 1.6749419f, 1.26289964f, 0,
+        0, 2.08612466f, 0, 0, 0, 1.85688281f, 0, 0,
+        0, 0.842311621f, 1.16575158f, 0.998411059f, 0, 0, 0.526504874f, 0,
+        0, 1.38656449f, 0, 0, 0, 1.58357048f, 1.22992027f, 0,
+        1.12977052f, 0, 0, 1.81481338f, 1.11643517f, 1.41654778f, 0, 0,
+        0.951940715f, 0, 0, 0, 0.0957111344f, 0, 0.56328696f, 0,
+        0, 0, 0, 0, 0, 0.661471546f, 0, 0.461871266f,
+        0, 0, 0, 0, 0, 1.06403494f, 0, 0,
+        0, 0.999999881f, 0, 0, 0.357942432f, 0, 0, 0,
+        0, 0, 0.131063223f, 0, 0, 0, 0, 0.530609488f,
+        0, 0, 0, 1.27693534f, 0, 0, 0.630855799f, 0,
+        0, 1.52390218f, 0, 0.203336671f, 0, 0, 0.449453354f, 0,
+        0, 0, 0.46751529f, 0, 0.263141483f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.489186168f, 0,
+        0, 0, 0, 0, 0.99389869f, 0, 0.403782517f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.87432301f, 0.468868613f,
+        1.37499237f, 0, 0, 0.693390727f, 0, 0, 1.22191179f, 0,
+        0, 0, 0, 0.0512944534f, 0, 0.794068456f, 0.707821965f, 1.13018036f,
+        0, 0, 0, 1.27455711f, 0.731918514f, 0, 1.2178247f, 0,
+        1.10344517f, 0, 0, 0, 0, 0.686218262f, 0, 0.826844096f,
+        0.373524427f, 0, 0, 1.25860548f, 0, 0, 0, 1.61679208f,
+        0, 0, 0, 1.13864827f, 0.589148641f, 1.20896673f, 0, 0,
+        0.933427453f, 0, 0, 0.887125254f, 0, 0, 0, 1.7816664f,
+        0.17130959f, 0, 1.0078938f, 0, 0, 1.79010224f, 0.186310202f, 1.698982f,
+        0, 0, 0.503671587f, 0, 0, 0, 0.70864594f, 0,
+        0.675753355f, 0, 0, 0, 0, 0, 1.83610606f, 0,
+        0, 0, 0, 1.90038002f, 0, 1.56750774f, 0.561707556f, 0,
+        0, 1.38529313f, 0, 0, 0, 1.76616311f, 0, 0,
+        0, 1.71409118f, 0.912123561f, 1.50659847f, 0, 0, 1.00824428f, 0,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0.999999881f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 1.11021006f, 0.915461421f, 1.85697234f,
+        0, 0, 0.702447176f, 0, 0, 1.52833939f, 0, 0,
+        0, 0, 1.25195563f, 0, 1.54217327f, 0.640915871f, 1.09842205f, 0,
+        0, 0, 1.13548005f, 0.947101593f, 0, 0.899999797f, 0, 0.501420379f,
+        0, 0, 0, 1.53438902f, 0, 0, 0.543863893f, 0,
+        0, 1.18598294f, 0, 0.618562818f, 0, 0, 0.222237557f, 0,
+        0, 0, 0.566409469f, 0, 0.181866452f, 0, 0, 0,
+        0, 0, 0, 1.6112746f, 0, 0.62441957f, 0, 0,
+        0.0574278347f, 0, 0, 0.11624378f, 0, 0, 0, 0,
+        0, 0, 0.344093144f, 0, 0.357827485f, 0, 0, 0,
+        0.777071297f, 0, 0, 0.51911819f, 0, 0, 0.82041955f, 0,
+        0.23075068f, 0, 0, 0, 0, 0, 0.505458355f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.516854346f, 0, 0,
+        0, 0, 0, 0.320809096f, 0, 0, 0, 0,
+        0, 0.988632321f, 0, 0.713533759f, 0, 0, 0, 0,
+        0, 1.28319943f, 0, 0, 0, 0.999999881f, 0.501200318f, 0,
+        0.924626827f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.942392111f, 0, 0, 0, 1.04510784f,
+        0.313363791f, 0, 0.765193462f, 0, 0, 1.71895337f, 0.764999092f, 1.55250359f,
+        0, 0, 1.23951256f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.384699255f, 0, 0, 0, 0, 0,
+        1.09410393f, 0, 1.16317844f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.784431756f, 0, 0, 0, 0.903425038f, 1.06294239f, 0,
+        0.721634269f, 0, 0, 1.49195945f, 1.03892636f, 1.80568504f, 0, 0,
+        1.09194601f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.60655582f, 0.903820932f, 1.34113348f,
+        0, 0, 0.423076779f, 0, 0, 1.86740518f, 0, 0,
+        0, 0, 1.79999959f, 0, 1.31730068f, 0.94217658f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.22723258f, 0, 1.09977531f, 0, 0, 0, 0, 0,
+        1.48011637f, 0, 0, 0, 0.999999881f, 0.999999881f, 0, 0.971718848f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.771951675f, 0,
+        0, 0, 0, 0, 1.26056087f, 0, 0.552046835f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.85068661f, 0,
+        0.886148393f, 0, 0, 0, 0, 0, 1.33372641f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.97280699f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1.69212258f, 0.722105503f, 1.29962003f, 0,
+        0, 0.885308862f, 0, 0, 1.7044313f, 0, 0, 0,
+        0, 1.51716268f, 0, 1.80849314f, 0.672447145f, 0.950392365f, 0, 0,
+        0, 0.536271989f, 0.16603215f, 0, 0.933097064f, 0, 1.68092167f, 0,
+        0, 0, 0, 0.755431771f, 0, 0.999999881f, 0.202104419f, 0,
+        0, 1.15326297f, 0, 0, 0, 1.65621006f, 0, 0,
+        0, 0.999999881f, 0.00301255425f, 0.837277532f, 0, 0, 0.731843114f, 0,
+        0, 0.854979336f, 0, 0, 0, 1.23912466f, 1.04987609f, 0,
+        0.461955816f, 0, 0, 1.84124565f, 0.53237927f, 0.847988009f, 0, 0,
+        0.733067095f, 0, 0, 0, 0.69367075f, 0, 0.495601565f, 0,
+        0, 0, 0, 0, 2.12296891f, 0, 0, 0,
+        0, 1.83393133f, 0, 1.47680819f, 1.05693674f, 0, 0, 0.999999881f,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0.759433746f,
+        0.495052993f, 1.33282495f, 0, 0, 0.726112247f, 0, 0, 0,
+        0, 1.60099185f, 0, 0, 0, 1.62298763f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0.978796184f, 0, 0, 0, 0, 0.671305835f, 0,
+        0.999999881f, 0, 0, 1.47298717f, 1.23130071f, 1.59155357f, 0, 0,
+        0.684393764f, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0.39903006f, 0, 0, 0,
+        0.395832658f, 0.960925162f, 0, 0.429274708f, 0, 0.616031349f, 0, 0,
+        0, 1.47510326f, 0, 0, 0.749204159f, 0, 0, 1.54429698f,
+        0, 1.33381033f, 0, 0, 0.00904242694f, 0, 0, 0,
+        1.1159544f, 0, 0.408567876f, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 1.02004921f, 0, 0, 0.821600258f, 0,
+        0, 0.778063059f, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 0.536252379f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0.453069627f, 0, 0.464135498f, 0,
+        0, 0, 0, 0, 0.321832836f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.34289673f, 0, 0, 0, 0, 1.84041965f, 0,
+        0, 0, 0, 1.18975472f, 0, 1.80872583f, 0.394761384f, 0,
+        0, 0.956430554f, 0, 0, 0, 1.37191069f, 0, 0,
+        0, 1.81415403f, 0.614415646f, 1.17105854f, 0, 0, 0.985794961f, 0,
+        0, 0, 0, 0.921159506f, 0, 0, 0, 1.25695324f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.944124222f, 1.33866024f, 0, 0, 0, 0,
+        0.857668519f, 0, 0.999999881f, 0, 0, 1.58868206f, 0.718982577f, 1.81237316f,
+        0, 0, 0.96074605f, 0, 0, 1.89189351f, 0, 0,
+        0, 0, 1.01137102f, 0, 1.4145242f, 0.625555456f, 1.00862706f, 0,
+        0, 0, 0.899999797f, 0.453316391f, 0, 0.899999797f, 0, 0,
+        0, 1.9636296f, 0, 0, 0, 1.71874833f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 1.88737011f, 0, 0, 0, 0, 1.79999959f, 0,
+        1.13082361f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 1.99476159f, 0, 0,
+        0, 0, 1.79999959f, 0, 1.45456934f, 0.66877538f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.899999797f, 0.753567934f, 1.2556479f, 0, 0, 0.563860834f, 0, 0,
+        0, 1.71966577f, 0, 0.917060375f, 0, 0, 0.362056464f, 0,
+        0, 0.519177079f, 0, 0, 0, 0, 0, 0,
+        0.456175208f, 0, 0.685344517f, 0, 0, 0, 1.25467384f, 0,
+        0, 0.968248308f, 0, 1.02420151f, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0.307639658f, 0, 0, 0.325191259f, 0, 0, 0.472525269f, 0,
+        0, 0, 1.23898542f, 0, 0, 0.4814623f, 0, 0,
+        1.01976681f, 0, 1.13939273f, 0, 0, 0, 0, 0,
+        0, 0.899999797f, 0, 0.428622007f, 0, 0, 0, 0,
+        0, 0.510232985f, 0, 0, 0, 1.31178796f, 0.500900745f, 0,
+        0.955997348f, 0, 0, 1.92720222f, 0.868444681f, 1.4528712f, 0, 0,
+        1.06805992f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0.467237115f, 0.961227238f,
+        0, 0, 1.04501009f, 0, 0, 1.67522204f, 0, 0,
+        0, 0, 1.27141941f, 0, 0.999999881f, 0.413812578f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.360637188f, 0, 0.640586376f, 0, 0, 0, 0, 0,
+        1.25873685f, 0, 0, 0, 0.999999881f, 0.756826758f, 0, 0.419201434f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.877872825f, 0.962172329f, 1.39849913f, 0, 0,
+        0.510893345f, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.942053795f, 0, 0,
+        0, 0, 1.24749839f, 0, 0.999999881f, 0.455589235f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.508810699f, 0, 0, 0, 0.274523407f, 0.999999881f, 0, 0.333351433f,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.465006053f, 0, 0.22018525f, 0,
+        0, 0, 0, 0, 0.715353489f, 0, 0, 0,
+        0.999999881f, 0, 0, 0.38692227f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.38199833f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 1.10166895f, 0, 0, 0.615610957f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.732912481f, 0, 0.743820429f,
+        0, 0, 0, 0, 0, 0.914877892f, 0, 0,
+        0, 0.999999881f, 0.04398017f, 0, 0.530697703f, 0, 0, 0,
+        0, 0, 0.478583097f, 0, 0, 0, 0, 0.207743734f,
+        0, 0, 0, 0.739760637f, 0.417755544f, 0, 0.564486504f, 0,
+        0, 0.905941963f, 0.408577055f, 0.37316367f, 0, 0, 0.525161684f, 0,
+        0, 0, 0.00279222196f, 0, 0.278056294f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.1044445f, 0,
+        0, 0, 0, 0, 1.01592588f, 0, 0.696412921f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.23876917f, 0, 0,
+        0, 1.16109991f, 0.826841176f, 0, 0.291035414f, 0, 0, 1.05893648f,
+        0.783192694f, 0.929581106f, 0, 0, 0.642472029f, 0, 0, 0,
+        0.424181879f, 0, 0.897925913f, 0, 0, 0, 0, 0,
+        0, 0.650401235f, 0.96935463f, 0.258944392f, 0, 0, 1.04946995f, 0,
+        0, 0.812459588f, 0, 0, 0, 0, 0.607897162f, 0,
+        0.727439642f, 0.984939456f, 0.837069452f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.295785576f, 0, 0, 0.897920251f, 0, 0.950310588f, 0,
+        0, 0, 0, 0, 0.636129737f, 0, 0, 0,
+        0.999999881f, 0, 0, 0.592124164f, 0, 0, 0, 0,
+        0, 0.27768603f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.773770571f, 0, 0, 0, 0, 0,
+        0.869693518f, 0, 0.5763973f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.110103011f, 0, 0.241320848f, 0, 0, 0,
+        0, 0, 0.269454598f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.45307529f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.456566751f,
+        0, 0, 0, 1.38174903f, 0.211768106f, 0, 0.348766327f, 0,
+        0, 1.03664386f, 0.00243452191f, 0.147146434f, 0, 0, 0.324614674f, 0,
+        0, 0, 0.367866844f, 0, 0.721405506f, 0, 0, 0,
+        0, 0, 0, 0.285904557f, 0.374337137f, 0.31196779f, 0, 0,
+        0.474802583f, 0, 0, 0.490849257f, 0, 0, 0, 0,
+        0, 0, 0.514100194f, 0.3254655f, 0.321929216f, 0, 0, 0,
+        0, 0.338208467f, 0, 0.625999749f, 0, 0, 0.417669594f, 0,
+        0.0856936425f, 0, 0, 0, 0, 0, 0.5752213f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.540463567f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.10084987f, 1.0522511f, 1.01069605f, 0, 0, 0.995717406f, 0,
+        0, 1.06287766f, 0, 0, 0, 0, 0, 0,
+        0.689347208f, 0.335532367f, 1.09918594f, 0, 0, 0, 0.508071244f, 0.999999881f,
+        0, 0.918526471f, 0, 0.999999881f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0.412940204f, 0,
+        0, 0, 0.505761027f, 0, 0, 0.626143396f, 0, 0,
+        0.544832051f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.542046547f, 0, 0.552527785f, 0, 0, 0, 0,
+        0, 0, 0.361348152f, 0, 0.266562313f, 0, 0, 0,
+        0, 0, 0.512513161f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.501919508f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.588382542f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.392603874f, 0, 0, 0, 0,
+        0, 0.945485353f, 0, 0.332108378f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.06343281f, 0,
+        0, 0, 0, 0, 0.987362623f, 0, 0.831563413f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.465953231f, 0,
+        0.368852854f, 0, 0, 0, 0, 0, 0.444938004f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.393299699f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.135587066f, 0, 0.635925591f, 0,
+        0, 0, 0, 0, 1.19901657f, 0, 0, 0,
+        0.999999881f, 0.514608026f, 0, 0.639056385f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.485473812f, 0,
+        0, 0, 0, 0.655458689f, 0, 0, 0, 0,
+        0.254751801f, 0.480420917f, 0.355206221f, 0, 0, 0.559614301f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0.959270597f, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.563503623f, 0, 0, 0, 0,
+        0, 0.942026973f, 0, 0.297751099f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.72690725f, 0.610925496f,
+        1.31911635f, 0, 0, 0.736951947f, 0, 0, 1.49813342f, 0,
+        0, 0, 0, 1.23926818f, 0, 1.45367026f, 0.864057302f, 0.429986626f,
+        0, 0, 0, 0.377599865f, 0.830373406f, 0, 0.891696155f, 0,
+        1.30727577f, 0, 0, 0, 0, 0.436767489f, 0, 1.39106309f,
+        0.1888607f, 0, 0, 0.811811149f, 0, 0, 0, 1.55599058f,
+        0, 0, 0, 1.2318697f, 0.213506818f, 0.33888948f, 0, 0,
+        0.297994554f, 0, 0, 1.00384688f, 0, 0, 0, 1.76058578f,
+        0.592573643f, 0, 0.893439293f, 0, 0, 1.74454856f, 0.19083105f, 1.49788201f,
+        0, 0, 0.69973141f, 0, 0, 0, 0.517237484f, 0,
+        0.60589546f, 0, 0, 0, 0, 0, 1.92157984f, 0,
+        0, 0, 0, 0.999999881f, 0, 1.74872255f, 0.886595368f, 0,
+        0, 1.55077517f, 0, 0, 0, 1.94426787f, 0, 0,
+        0, 1.36345255f, 1.0044229f, 0.999999881f, 0, 0, 0.517665625f, 0,
+        0, 0, 0, 1.06440234f, 0, 0, 0, 1.69130874f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.79999959f, 1.02426684f, 0, 0, 0, 0,
+        0.999999881f, 0, 1.04384947f, 0, 0, 1.93534386f, 0.772203922f, 0.999999881f,
+        0, 0, 0.845829606f, 0, 0, 1.71889913f, 0, 0,
+        0, 0, 0.999999881f, 0, 1.27262616f, 0.635888636f, 0.709473491f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.307265043f, 0, 0.339367241f,
+        0, 0, 0, 0.538305402f, 0, 0, 1.00896704f, 0,
+        0, 1.63640785f, 0, 0.270838678f, 0, 0, 0.710153699f, 0,
+        0, 0, 0.479353756f, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.78201306f, 0, 0.101357006f, 0, 0,
+        0.394551486f, 0, 0, 1.42710471f, 0, 0, 0, 0,
+        0, 0, 1.29248297f, 0, 0.110944465f, 0, 0, 0,
+        0, 0, 0, 0.382444978f, 0, 0, 0.335530609f, 0,
+        0.0778096467f, 0, 0, 0, 0, 0, 0.284814984f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.819815338f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1.54818475f, 0, 0, 0, 0, 0.684394538f, 0, 1.62864578f,
+        0.0176597983f, 0, 0, 0.288047433f, 0, 0, 0, 1.34224296f,
+        0, 0, 0, 1.99059129f, 0.239477962f, 1.28798318f, 0, 0,
+        0.601268888f, 0, 0, 0, 0, 1.15802741f, 0, 0,
+        0, 1.11742973f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.272139072f, 1.3136996f, 0, 0,
+        0, 0, 0.884343743f, 0, 1.79999959f, 0, 0, 1.61588895f,
+        0.234459564f, 1.62688172f, 0, 0, 0.790090144f, 0, 0, 1.2709409f,
+        0, 0, 0, 0, 0, 0, 0.899999797f, 0,
+        0.504619122f, 0, 0, 0, 1.42069662f, 0.43637681f, 0, 0.899999797f,
+        0, 0, 0, 1.77647579f, 0, 0, 0, 1.73973119f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.79999959f, 1.84873354f, 0, 0, 0, 0,
+        0.999999881f, 0, 1.53529966f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 1.57698393f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.899999797f, 0,
+        0, 0, 0.925850749f, 0, 0, 0, 1.37269533f, 0,
+        0, 0, 1.29082632f, 0.157210037f, 0.999999881f, 0, 0, 0.509509206f,
+        0, 0, 0, 1.51340032f, 0, 0.912676871f, 0, 0,
+        0.225113824f, 0, 0, 0.626192927f, 0, 0, 0, 0,
+        0, 0, 0.899999797f, 0, 0.230484441f, 0, 0, 0,
+        0.377576768f, 0, 0, 0.29695034f, 0, 0.298925817f, 0, 0,
+        0, 0, 0, 0, 1.59608781f, 0, 0, 0,
+        0, 0, 0, 0, 0.385166585f, 0, 0, 0,
+        0.72689569f, 0, 0, 0, 0, 0, 0, 0,
+        0.290126652f, 0, 0, 0, 1.22530711f, 0, 0, 0.899999797f,
+        0, 0, 1.37886059f, 0, 0.95387733f, 0, 0, 0.412584096f,
+        0, 0, 0, 0.462127566f, 0, 0, 0, 0,
+        0, 0, 0, 0.389849514f, 0, 0, 0, 1.12776244f,
+        0.642171621f, 0, 0.59604609f, 0, 0, 1.82363105f, 1.00121033f, 1.33508551f,
+        0, 0, 0.953799248f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.904676437f,
+        0.715337336f, 0.540848613f, 0, 0, 0.498754263f, 0, 0, 1.7314595f,
+        0, 0, 0, 0, 0.746929407f, 0, 1.25059974f, 0.458892047f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.26955536f, 0, 0.79116112f, 0, 0, 0,
+        0, 0, 0.748775184f, 0, 0, 0, 0.999999881f, 0.720921636f,
+        0, 0.595438361f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.45707679f, 1.36302686f, 0.999999881f,
+        0, 0, 0.869224966f, 0, 0, 1.96312678f, 0, 0,
+        0, 0, 0.999999881f, 0, 1.22386074f, 0.932853341f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.805558264f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.576509058f, 0.462081432f,
+        0, 0, 1.79999959f, 0, 0, 0, 1.24630964f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.995806873f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.327016592f, 0, 0, 1.79999959f, 0.999999881f, 0.999999881f, 0,
+        0, 0.96131295f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.151451275f, 0,
+        0.176895648f, 0, 0, 0, 0, 0, 0.529459357f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.3921296f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.308674753f, 0, 0, 0, 1.31028712f, 0, 0, 0.945135355f,
+        0, 0, 1.79999959f, 0, 0.49696213f, 0, 0, 0.482092619f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.24687421f, 0,
+        0, 0, 0, 1.26271844f, 0, 1.85543382f, 0.192828387f, 0,
+        0, 0.928152919f, 0, 0, 0, 1.34546864f, 0, 0,
+        0, 0.81071341f, 0.159593374f, 0.975190401f, 0, 0, 0.297777355f, 0,
+        0, 0, 0, 0.557739615f, 0, 0, 0, 1.79471433f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.17851019f, 0.436903298f, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0.777754486f, 0.751922488f, 0.79029119f,
+        0, 0, 0.633567572f, 0, 0, 1.5585016f, 0, 0,
+        0, 0, 0.690470576f, 0, 1.43519068f, 0.557994485f, 0.38160935f, 0,
+        0, 0, 0.638651371f, 0.627458453f, 0, 0.318167657f, 0, 0,
+        0, 1.30960643f, 0, 0, 0, 1.70002544f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.999999881f, 0.666482329f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.462536693f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.942310333f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.78365052f, 0, 0,
+        0, 0, 0.999999881f, 0, 1.2884841f, 0.485895216f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.345941246f, 0.381760895f, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 1.58340633f, 0, 0.265551269f, 0, 0, 0.220085591f, 0,
+        0, 0.870271683f, 0, 0, 0, 0, 0, 0,
+        1.27577209f, 0, 0.154172108f, 0, 0, 0, 0.359439194f, 0,
+        0, 0.951356769f, 0, 0.858134747f, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 1.48175812f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0.716812372f, 0, 0, 0.215232775f, 0,
+        0, 0, 0.577568471f, 0, 0, 0.651082814f, 0, 0,
+        0.688742757f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.644498587f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.59397471f, 0, 0, 0, 1.12681067f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.895647287f, 0.713032484f, 0, 0, 0, 0,
+        0.610595644f, 0, 1.3785193f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.956527293f, 0, 0, 1.3063817f,
+        0, 0, 0, 0, 1.27714765f, 0, 0.899999797f, 0,
+        0, 0, 1.01310611f, 0, 0, 0, 1.27466524f, 0,
+        0, 0, 0.899999797f, 0, 1.41980004f, 0, 0, 0.107939862f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.918188691f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.878205299f, 0,
+        0, 0, 0.324148715f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.79999959f, 0, 0, 0, 1.42656934f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 1.40870106f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.49999994f, 0, 1.059708f, 0, 0, 0, 0,
+        0, 0, 1.53077173f, 0, 0, 0, 0, 0,
+        0, 0, 0.235046312f, 0, 0, 0, 1.33400202f, 0,
+        0.492668033f, 0, 0, 0.538064837f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.47044605f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.42069158f, 0, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0.899999797f, 0, 0.493083954f, 0, 0, 0.348156393f,
+        0, 0, 0.440454692f, 0, 0, 0, 0, 0,
+        0, 0.49999994f, 0, 0.621459723f, 0, 0, 0, 0.49999994f,
+        0, 0, 0.49999994f, 0, 0, 0.614463866f, 0.738852739f, 0.547130585f,
+        0, 0, 0.390453726f, 0, 0, 1.50816607f, 0, 0,
+        0, 0, 0.600495934f, 0, 1.79999959f, 0.730629802f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1.08637333f,
+        0, 0, 0, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 1.08201444f, 0, 0, 0, 1.79999959f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.510802865f, 0, 0, 0, 0, 0.492884725f,
+        0, 0, 0, 0, 0.847828865f, 0.653031826f, 0.723950386f, 0,
+        0, 0.268375278f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1.19169223f, 0, 0,
+        0, 0, 0.999999881f, 0, 0.980264664f, 0.773793399f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.1212368f, 0, 0, 0, 1.11178195f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.532608271f, 0.999999881f, 0.999999881f, 0,
+        0, 0.457127661f, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0.999999881f, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.181628972f, 0,
+        0, 0, 0, 0, 0, 0.328096449f, 0, 0,
+        0.947350025f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0.695818305f,
+        0, 0, 0.778424263f, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.551471889f,
+        0, 0, 0, 1.32449007f, 0.551262081f, 0, 0.626974583f, 0,
+        0, 1.64004898f, 0.149964735f, 1.54500222f, 0, 0, 0.65474242f, 0,
+        0, 0, 0.0755380765f, 0, 0.855942726f, 0, 0, 0,
+        0, 0, 0, 1.24152279f, 0.62716043f, 1.32563305f, 0, 0,
+        0.737715006f, 0, 0, 1.67834282f, 0, 0, 0, 0,
+        0.36880523f, 0, 0.899999797f, 0.349159747f, 0.497395098f, 0, 0, 0,
+        0, 0.697899938f, 0, 0, 0, 0, 1.1754384f, 0,
+        0.809835732f, 0, 0, 0, 0, 0, 0.629818678f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.899999797f, 0, 0,
+        0, 0, 0, 0.613444805f, 0, 0, 0, 0,
+        0, 1.4751873f, 1.23720479f, 0.999999881f, 0, 0, 0.977422893f, 0,
+        0, 1.58304012f, 0, 0, 0, 0, 0.999999881f, 0,
+        0.899999797f, 0.385435343f, 0.844306767f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.446362972f, 0, 1.20042169f, 0, 0, 0, 0,
+        0.999999881f, 0, 1.22761548f, 0.96932292f, 0, 0, 1.79999959f, 0,
+        0, 0, 1.37708437f, 0, 0, 0, 0.962166607f, 0.999999881f,
+        0.999999881f, 0, 0, 0.562443078f, 0, 0, 0.907348096f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.899999797f, 0, 0,
+        1.40576088f, 0, 0.999999881f, 0, 0, 0.305675328f, 0, 0,
+        0, 0.928689837f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.527334094f, 0, 0.409573734f, 0, 0, 0,
+        0, 0, 1.03815591f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.899999797f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.245682538f, 0, 0, 0,
+        0.815860093f, 0, 0, 0.305903554f, 0, 0, 1.22734714f, 0,
+        0.783109784f, 0, 0, 0.576322019f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.753458619f, 0, 0, 0, 0,
+        0, 0.927419305f, 0, 0.506240726f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1.45455742f, 0.159765124f, 0.883393049f, 0, 0,
+        0.950778663f, 0, 0, 1.12890553f, 0, 0, 0, 0,
+        0, 0, 0.899999797f, 0, 0.590232253f, 0, 0, 0,
+        1.23490417f, 0.496724784f, 0, 0.660907507f, 0, 1.3715601f, 0, 0,
+        0, 0, 0.289483339f, 0, 1.47263229f, 0.54571712f, 0, 0,
+        0.913193226f, 0, 0, 0, 1.2259711f, 0, 0, 0,
+        0.572747707f, 0.415216595f, 0.583366156f, 0, 0, 0.537178576f, 0, 0,
+        0.37529245f, 0, 0, 0, 1.79999959f, 0, 0, 0.899999797f,
+        0, 0, 1.69920313f, 0, 0.702484906f, 0, 0, 0.174014881f,
+        0, 0, 0, 0.343632758f, 0, 0.465797186f, 0, 0,
+        0, 0, 0, 1.76246953f, 0, 0, 0, 0,
+        0.999999881f, 0, 1.4070977f, 0.633628726f, 0, 0, 1.00209582f, 0,
+        0, 0, 1.33988953f, 0, 0, 0, 1.79999959f, 0.999999881f,
+        0.999999881f, 0, 0, 0.986700892f, 0, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.999999881f,
+        0.999999881f, 0, 0, 0, 0, 0.999999881f, 0, 0.999999881f,
+        0, 0, 1.31085432f, 0, 0.999999881f, 0, 0, 0.684047878f,
+        0, 0, 0.340938807f, 0, 0, 0, 0, 0,
+        0, 0.49999994f, 0, 0.933466494f, 0, 0, 0, 0.999999881f,
+        0, 0, 0.49999994f, 0, 0.120380268f, 0, 0, 0,
+        0.835006893f, 0, 0, 0.454474598f, 0, 0, 1.3018887f, 0,
+        0.963675678f, 0, 0, 0.568411052f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.516829848f, 0, 0, 0, 0, 0, 0, 0,
+        0.335552335f, 0, 0, 0, 0, 0, 0, 0.49999994f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.187481433f, 0, 0, 0, 0,
+        0, 0, 0, 0.28156659f, 0, 0, 0, 0.999999881f,
+        0, 0, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.15371716f, 0,
+        0.973406672f, 0, 0, 0, 0, 0, 1.152964f, 0,
+        0, 0, 0.999999881f, 0.494491637f, 0, 0.899999797f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.698966146f, 0, 0, 0, 0.762557864f, 0.812776446f, 0, 0.512919903f,
+        0, 0, 1.42994344f, 0.215801358f, 1.79999959f, 0, 0, 0.899999797f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0.916233063f, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.00447774f, 0,
+        0, 0, 0.999999881f, 0, 0, 0.393969923f, 0, 0,
+        1.39603412f, 0.97371161f, 0.999999881f, 0, 0, 0.899999797f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.283568472f, 0.929202139f, 0.999999881f, 0, 0, 0.720228314f,
+        0, 0, 1.61116695f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.49999994f, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.960476995f, 0, 0,
+        0, 0, 0, 0, 0, 0.939900815f, 0, 0,
+        0, 0.999999881f, 0, 0, 0.49999994f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.596213996f, 0, 0, 0, 0,
+        0, 0.94285816f, 0, 0.65733552f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.218352944f, 0, 0, 0, 0,
+        0, 0, 0, 0.627422452f, 0, 0, 0, 0.999999881f,
+        0, 0, 0.49999994f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1.42526495f, 0, 0.843754649f, 0, 0, 0, 0,
+        0, 1.02398074f, 0, 0, 0, 0.999999881f, 0.0874295831f, 0,
+        0.255696297f, 0, 0, 0, 0, 0, 0.329220235f, 0,
+        0, 0, 0, 0.568271041f, 0, 0, 0, 0.991128743f,
+        0.274439692f, 0, 0.854627013f, 0, 0, 1.11217928f, 0.414700866f, 0.613613367f,
+        0, 0, 0.455990523f, 0, 0, 0, 0.905056f, 0,
+        0.155415609f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.745983958f, 0, 0, 0, 0, 0,
+        0.859107435f, 0, 0.692751467f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.524728835f, 0, 0, 0, 0.679642975f, 0.881255329f, 0,
+        0.72006464f, 0, 0, 0.926087976f, 0.630410612f, 1.49283683f, 0, 0,
+        0.718788326f, 0, 0, 0, 0.431969315f, 0, 0.532723129f, 0,
+        0, 0, 0, 0, 0, 1.23719501f, 0.731523454f, 0.78123337f,
+        0, 0, 1.21965134f, 0, 0, 1.01937366f, 0, 0,
+        0, 0, 0.516138613f, 0, 0.65029639f, 0.999999881f, 0.441215456f, 0,
+        0, 0, 0, 0.591849327f, 0, 0.999999881f, 0, 0,
+        0.699118972f, 0, 0.518167198f, 0, 0, 0, 0, 0,
+        0.519998133f, 0, 0, 0, 0.999999881f, 0.719937384f, 0, 0.639662087f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1.28539181f, 0,
+        0, 0, 0, 0, 0.700482845f, 0, 0.523979425f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0.450382411f, 0,
+        0.884487271f, 0, 0, 0, 0, 0, 0.140203387f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.471716642f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.417099327f, 0, 0, 0, 1.04214406f,
+        0.782144308f, 0, 0.266038835f, 0, 0, 1.23394203f, 0.767744899f, 1.95604753f,
+        0, 0, 0.157653436f, 0, 0, 0, 1.0888871f, 0,
+        0.487357765f, 0, 0, 0, 0, 0, 0, 1.52154779f,
+        0.329805702f, 0.775632262f, 0, 0, 0.523776352f, 0, 0, 0.332738101f,
+        0, 0, 0, 0, 0, 0, 0, 0.20320341f,
+        0.870289147f, 0, 0, 0, 0.612405658f, 0.456777096f, 0, 0.999999881f,
+        0, 0, 0.662563264f, 0, 0.670335472f, 0, 0, 0,
+        0, 0, 0.559015393f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.518127918f,
+        0, 0, 0, 0, 0, 0.714331269f, 1.16484046f, 1.53466225f,
+        0, 0, 0.966357887f, 0, 0, 0.89252615f, 0, 0,
+        0, 0, 0.640778422f, 0, 0.72902596f, 0.999999881f, 0.773009002f, 0,
+        0, 0, 0.158140406f, 0.925989091f, 0, 0.956930399f, 0, 0.999999881f,
+        0, 0, 0, 0, 0.999999881f, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0.53509444f, 0, 0, 0, 0.431175232f, 0.493436188f,
+        0, 0.396323413f, 0, 0, 0.564814091f, 0.304532707f, 1.31632733f, 0,
+        0, 0.394708186f, 0, 0, 0, 0.487744093f, 0, 0.662233114f,
+        0, 0, 0, 0, 0, 0, 0.48067826f, 0,
+        0.273538411f, 0, 0, 0, 0, 0, 0.0429172143f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.385543436f, 0, 0, 0, 0,
+        0.0761207119f, 0, 0, 0, 1.14203155f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.561871767f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.96739769f,
+        0, 0, 0, 0, 0, 0.357526004f, 0, 0.70599097f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.149616f, 0, 0, 0, 0, 0,
+        0.900098503f, 0, 0.638908505f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.515137613f, 0, 0.0919615328f, 0, 0, 0,
+        0, 0, 0.471229553f, 0, 0, 0, 0.999999881f, 0,
+        0, 0.484677434f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.766858459f, 0, 0.112929896f, 0, 0, 0, 0, 0,
+        0.575917065f, 0, 0, 0, 0.999999881f, 0.757985651f, 0, 0.561201096f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.214001626f, 0, 0, 0, 0, 0,
+        0, 0.549495459f, 0, 0, 1.05764854f, 0.529349625f, 1.10536206f, 0,
+        0, 0.436520189f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.811191618f, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0.40160805f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.985163033f, 0, 0, 0, 1.63241899f, 0.342165947f, 0,
+        0.79737848f, 0, 0, 1.93476331f, 0.693212926f, 1.60811853f, 0, 0,
+        0.789114118f, 0, 0, 0, 1.03712296f, 0, 0.341778785f, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0.485163778f, 1.41372728f,
+        0, 0, 0.632379055f, 0, 0, 1.47922254f, 0, 0,
+        0, 0, 0.981697381f, 0, 0.999999881f, 0.421757281f, 0.942784727f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0.906118095f, 0, 1.02964091f, 0, 0, 0, 0, 0,
+        1.08404613f, 0, 0, 0, 0.999999881f, 0.513152599f, 0, 0.306289852f,
+        0, 0, 0, 0, 0, 0.541867733f, 0, 0,
+        0, 0, 0, 1.95443189f, 1.45664287f, 2.00355101f, 0, 0,
+        1.63076043f, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0.999999881f, 0, 0.999999881f, 0, 0.933644891f, 0, 0, 0,
+        0.479726046f, 0.359184206f, 0, 0.95008868f, 0, 1.79280663f, 0, 0,
+        0, 0, 1.79999959f, 0, 0.999999881f, 0.999999881f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        0.999999881f, 0.943389058f, 1.38655078f, 0, 0, 0.999999881f, 0, 0,
+        0.893821239f, 0, 0, 0, 1.45835948f, 0.923938572f, 0, 0.937341154f,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0.369963557f, 0, 0.409598708f, 0, 0,
+        0, 0, 0, 0, 1.29778886f, 0, 0.711477101f, 0,
+        0, 0, 0, 0, 0.669473231f, 0, 0, 0,
+        0.999999881f, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.968483567f, 0, 0, 0, 0, 0.460642338f, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0, 0,
+        0.999999881f, 0, 1.1501745f, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.359411538f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.954283893f, 0, 0,
+        0, 0, 0, 0.492691666f, 0, 0.201724857f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 2.07008719f, 0.826381803f, 1.77774215f,
+        0, 0, 0.655020535f, 0, 0, 1.35316026f, 0, 0,
+        0, 0, 1.13773549f, 0, 1.3170681f, 0.684999466f, 1.3288914f, 0,
+        0, 0, 1.3225683f, 0.455835164f, 0, 0.95130378f, 0, 1.12117374f,
+        0, 0, 0, 0, 1.0652051f, 0, 0.999999881f, 0.133411273f,
+        0, 0, 0.924366653f, 0, 0, 0, 0.609002411f, 0,
+        0, 0, 0.999999881f, 0.502097487f, 1.79999959f, 0, 0, 0.999999881f,
+        0, 0, 0.945214152f, 0, 0, 0, 1.24760783f, 0.583625019f,
+        0, 0.6542871f, 0, 0, 1.79999959f, 0.52110523f, 1.79999959f, 0,
+        0, 0.297610164f, 0, 0, 0, 0.899999797f, 0, 0.899999797f,
+        0, 0, 0, 0, 0, 1.80971694f, 0, 0,
+        0, 0, 1.79999959f, 0, 1.79999959f, 0.999999881f, 0, 0,
+        0.999999881f, 0, 0, 0, 0.999999881f, 0, 0, 0,
+        1.42595375f, 0.939638317f, 1.40333998f, 0, 0, 0.91297102f, 0, 0,
+        0, 0, 0.999999881f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0.999999881f, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 1.21337795f, 0.941625953f, 1.59815586f, 0,
+        0, 0.969129622f, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0.999999881f, 0, 0.999999881f, 0, 0.899999797f, 0, 0,
+        0, 0.49999994f, 0.49999994f, 0, 0.49999994f, 0, 0.435665309f, 0,
+        0, 0, 1.79999959f, 0, 0, 0, 0, 0,
+        0.640636802f, 0, 0.941333055f, 0, 0, 0, 0, 0,
+        0, 0.911427855f, 0, 0.46445322f, 0, 0, 0, 0,
+        0, 0, 0.999999881f, 0, 0.795679688f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.584625781f, 0, 0, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0.17930457f, 0, 0.588975608f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0.49999994f, 0, 0, 0, 0, 0,
+        1.30381215f, 0, 0.732904851f, 0, 0, 0, 0, 0,
+        1.26547313f, 0, 0, 0, 0.999999881f, 0.866090596f, 0, 0.999999881f,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1.16254091f, 0, 0, 0, 0.999999881f, 0,
+        0, 0, 0, 0, 0.999999881f, 0.515695333f, 1.79999959f, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0.717081547f, 0, 0, 0, 0, 0, 0.999999881f,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0.682370365f, 0, 0, 0, 1.04445386f, 0.588985205f, 0, 0.999999881f,
+        0, 0, 0.999999881f, 0, 0.999999881f, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0.999999881f, 0.587825596f, 1.01605248f, 0,
+        0, 0.999999881f, 0, 0, 0.999999881f, 0, 0, 0,
+        0, 0.999999881f, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.321664512f,
+        0, 0.267070949f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0.999999881f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0.999999881f, 0, 0,
+        0, 0, 0, 0.999999881f, 0, 0.240683228f, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0.46683985f,
+        0, 0, 0, 0, 0, 0.398796588f, 0, 0,
+        0, 0.999999881f, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0
+    },
+    .known = {
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1,
+        1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+        0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1,
+        1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1,
+        1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1,
+        1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1,
+        0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+        1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0,
+        0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0,
+        1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+        0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0,
+        1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1,
+        1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
+        1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1,
+        1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0,
+        0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+        0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1,
+        1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+        1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+        1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0,
+        0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0,
+        0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1,
+        0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1,
+        0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1,
+        0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,
+        1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0,
+        0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0,
+        0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+        0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0
+    }
+};
+
+#endif
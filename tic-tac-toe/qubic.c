@@ -0,0 +1,416 @@
+/* Define preprocessor statements */
+#include "qubic.h"
+#include "gui.h"
+#include "search_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+double qubicTimeBudget = 1.0;
+int qubicMaxDepth = QUBIC_MAX_DEPTH;
+bool qubicStatsDump = false;
+
+#define QUBIC_WIN 10000                             // Score of a line completed at the root
+#define QUBIC_INFINITY 20000
+#define QUBIC_WIN_BOUND (QUBIC_WIN - QUBIC_CELLS - 2)   // Scores past this are wins or losses
+#define QUBIC_IS_WIN_SCORE(s) SEARCH_IS_WIN_SCORE(s, QUBIC_WIN_BOUND)
+#define STOP_POLL_NODES 4096                        // Nodes between clock reads
+#define HISTORY_LIMIT (1 << 20)                     // History scores are halved past this
+
+// Transposition table bounds
+#define QUBIC_EXACT 0
+#define QUBIC_LOWER 1
+#define QUBIC_UPPER 2
+
+typedef struct {
+    uint64_t key;
+    int16_t score;          // Win scores relative to the stored position
+    int8_t depth;           // Plies searched below the position
+    uint8_t flag;           // QUBIC_EXACT, QUBIC_LOWER or QUBIC_UPPER
+    uint8_t move;           // Best cell found
+} QubicEntry;
+
+static Bitboard lines[QUBIC_LINES];
+static int cellLineCount[QUBIC_CELLS];  // Lines through each cell, 7 or 4
+static uint64_t zobrist[2][QUBIC_CELLS];
+static bool linesReady = false;
+
+static QubicEntry *table = NULL;
+static int history[QUBIC_CELLS];        // Cutoffs caused by each cell, aged every search
+static Bitboard pieces[2];              // Position being searched, pieces[0] = computer
+static long nodes;
+static double deadline;                 // Monotonic seconds, 0 = no deadline
+static bool stopped;
+
+/*******************************************************************
+function: initLines
+    builds the 76 winning lines of the cube: a line runs along
+    each of the 13 directions from every cell where 4 cells fit.
+    Also counts the lines through every cell and fills the hash keys
+********************************************************************/
+static void initLines(void) {
+    int count = 0;
+
+    for(int dl = -1; dl <= 1; dl++) {
+        for(int dr = -1; dr <= 1; dr++) {
+            for(int dc = -1; dc <= 1; dc++) {
+                // One of each pair of opposite directions
+                if(dl < 0 || (dl == 0 && dr < 0) || (dl == 0 && dr == 0 && dc <= 0)) continue;
+
+                for(int cell = 0; cell < QUBIC_CELLS; cell++) {
+                    int l = cell / 16 + dl * (QUBIC_SIZE - 1);
+                    int r = (cell / QUBIC_SIZE) % QUBIC_SIZE + dr * (QUBIC_SIZE - 1);
+                    int c = cell % QUBIC_SIZE + dc * (QUBIC_SIZE - 1);
+                    if(l < 0 || l >= QUBIC_SIZE || r < 0 || r >= QUBIC_SIZE || c < 0 || c >= QUBIC_SIZE) continue;
+
+                    Bitboard line = 0;
+                    for(int i = 0; i < QUBIC_SIZE; i++) line |= BB_CELL(cell + i * (dl * 16 + dr * QUBIC_SIZE + dc));
+                    lines[count++] = line;
+                }
+            }
+        }
+    }
+
+    for(int i = 0; i < QUBIC_LINES; i++) {
+        for(Bitboard cells = lines[i]; cells; cells &= cells - 1) cellLineCount[BB_FIRST(cells)]++;
+    }
+
+    uint64_t seed = ZOBRIST_SEED;
+    zobristFill(&zobrist[0][0], 2 * QUBIC_CELLS, &seed);
+    linesReady = true;
+}
+
+/*******************************************************************
+function: qubicHasWon
+    checks the cells for 4 in a row along any of the 76 lines
+
+    Input:
+    cells - cells marked by one side
+
+    Return:
+    boolean value - is any line complete
+********************************************************************/
+bool qubicHasWon(Bitboard cells) {
+    if(!linesReady) initLines();
+
+    for(int i = 0; i < QUBIC_LINES; i++) {
+        if((cells & lines[i]) == lines[i]) return true;
+    }
+    return false;
+}
+
+/*******************************************************************
+function: threats
+    empty cells that would complete a line for a side: lines
+    holding 3 of its marks and none of the other side's
+
+    Input:
+    own - cells marked by the side
+    other - cells marked by the other side
+
+    Return:
+    bitboard of winning cells
+********************************************************************/
+static inline Bitboard threats(Bitboard own, Bitboard other) {
+    Bitboard cells = 0;
+
+    for(int i = 0; i < QUBIC_LINES; i++) {
+        if(!(lines[i] & other) && BB_COUNT(lines[i] & own) == QUBIC_SIZE - 1) cells |= lines[i] & ~own;
+    }
+    return cells;
+}
+
+/*******************************************************************
+function: evaluateLines
+    heuristic score of a position for the side to move. Every
+    line still open to only one side counts for that side, more
+    the more marks it holds
+
+    Input:
+    own - cells marked by the side to move
+    other - cells marked by the other side
+
+    Return:
+    score, positive when the side to move is ahead
+********************************************************************/
+static int evaluateLines(Bitboard own, Bitboard other) {
+    static const int weight[QUBIC_SIZE] = {0, 1, 6, 40};
+    int score = 0;
+
+    for(int i = 0; i < QUBIC_LINES; i++) {
+        Bitboard mine = lines[i] & own;
+        Bitboard theirs = lines[i] & other;
+        if(mine && !theirs) score += weight[BB_COUNT(mine)];
+        else if(theirs && !mine) score -= weight[BB_COUNT(theirs)];
+    }
+    return score;
+}
+
+/*******************************************************************
+function: orderMoves
+    sorts the moves so the table's best move comes first, then
+    cells by history, then by the number of lines through them
+
+    Input:
+    moves - candidate cells
+    first - cell tried first, -1 for none
+    cells - receives the cells in search order
+
+    Return:
+    number of cells
+********************************************************************/
+static int orderMoves(Bitboard moves, int first, int cells[QUBIC_CELLS]) {
+    int keys[QUBIC_CELLS];
+    int count = 0;
+
+    for(; moves; moves &= moves - 1) {
+        int cell = BB_FIRST(moves);
+        int key = (cell == first) ? QUBIC_INFINITY * 100 : history[cell] * 8 + cellLineCount[cell];
+
+        // Insertion sort, highest key first
+        int i = count++;
+        for(; i > 0 && keys[i - 1] < key; i--) {
+            keys[i] = keys[i - 1];
+            cells[i] = cells[i - 1];
+        }
+        keys[i] = key;
+        cells[i] = cell;
+    }
+    return count;
+}
+
+/*******************************************************************
+function: negamax
+    alpha-beta search with principal variation windows and a
+    transposition table. A side that can complete a line wins
+    at once and a single threat must be blocked, searched past
+    the depth limit so the horizon never hides a forced line
+
+    Input:
+    side - side to move, 0 computer, 1 player
+    key - hash of the position and side to move
+    depth - plies left before the heuristic is used
+    alpha, beta - search window
+    ply - plies from the root
+
+    Return:
+    score for the side to move
+********************************************************************/
+static int negamax(int side, uint64_t key, int depth, int alpha, int beta, int ply) {
+    if((++nodes & (STOP_POLL_NODES - 1)) == 0 && deadline > 0 && nowSeconds() > deadline) stopped = true;
+    if(stopped) return 0;
+
+    Bitboard own = pieces[side];
+    Bitboard other = pieces[!side];
+    Bitboard empty = ~(own | other);
+    if(!empty) return 0;
+
+    // Completing a line ends the game on the next ply
+    if(threats(own, other) & empty) return QUBIC_WIN - ply - 1;
+
+    // Two open threats cannot both be blocked
+    Bitboard blocks = threats(other, own) & empty;
+    if(BB_COUNT(blocks) > 1) return -(QUBIC_WIN - ply - 2);
+    if(depth <= 0 && !blocks) return evaluateLines(own, other);
+
+    if(mateWindow(&alpha, &beta, QUBIC_WIN, ply)) return alpha;
+
+    QubicEntry *entry = &table[key & (QUBIC_TT_ENTRIES - 1)];
+    int hashMove = -1;
+    if(entry->key == key) {
+        hashMove = entry->move;
+        if(entry->depth >= depth) {
+            int stored = scoreFromTT(entry->score, ply, QUBIC_WIN_BOUND);
+            if(entry->flag == QUBIC_EXACT) return stored;
+            if(entry->flag == QUBIC_LOWER && stored > alpha) alpha = stored;
+            if(entry->flag == QUBIC_UPPER && stored < beta) beta = stored;
+            if(alpha >= beta) return stored;
+        }
+    }
+
+    int cells[QUBIC_CELLS];
+    int count = orderMoves(blocks ? blocks : empty, hashMove, cells);
+    int alphaOrig = alpha;
+    int bestScore = -QUBIC_INFINITY;
+    int bestCell = cells[0];
+
+    for(int i = 0; i < count; i++) {
+        int cell = cells[i];
+        uint64_t childKey = key ^ zobrist[side][cell] ^ 1;
+        int score;
+
+        // Forced blocks do not use up depth
+        pieces[side] |= BB_CELL(cell);
+        if(i == 0) {
+            score = -negamax(!side, childKey, depth - !blocks, -beta, -alpha, ply + 1);
+        }
+        else {
+            score = -negamax(!side, childKey, depth - !blocks, -alpha - 1, -alpha, ply + 1);
+            if(score > alpha && score < beta) score = -negamax(!side, childKey, depth - !blocks, -beta, -alpha, ply + 1);
+        }
+        pieces[side] &= ~BB_CELL(cell);
+        if(stopped) return 0;
+
+        if(score > bestScore) {
+            bestScore = score;
+            bestCell = cell;
+        }
+        if(score > alpha) alpha = score;
+        if(alpha >= beta) {
+            if((history[cell] += depth * depth) > HISTORY_LIMIT) {
+                for(int j = 0; j < QUBIC_CELLS; j++) history[j] /= 2;
+            }
+            break;
+        }
+    }
+
+    entry->key = key;
+    entry->score = scoreToTT(bestScore, ply, QUBIC_WIN_BOUND);
+    entry->depth = depth;
+    entry->flag = (bestScore <= alphaOrig) ? QUBIC_UPPER : (bestScore >= beta) ? QUBIC_LOWER : QUBIC_EXACT;
+    entry->move = bestCell;
+    return bestScore;
+}
+
+/*******************************************************************
+function: searchRoot
+    one iteration of the search at the root, the best move of
+    the last iteration goes first. The computer has no line to
+    complete here, qubicSearch() plays those without searching
+
+    Input:
+    depth - plies to search
+    best - best cell so far, replaced by this iteration's
+
+    Return:
+    score of the best move, meaningless if the search stopped
+********************************************************************/
+static int searchRoot(int depth, int *best) {
+    uint64_t key = 0;
+    for(int side = 0; side < 2; side++) {
+        for(Bitboard cells = pieces[side]; cells; cells &= cells - 1) key ^= zobrist[side][BB_FIRST(cells)];
+    }
+
+    Bitboard empty = ~(pieces[0] | pieces[1]);
+    Bitboard blocks = threats(pieces[1], pieces[0]) & empty;
+    int cells[QUBIC_CELLS];
+    int count = orderMoves(blocks ? blocks : empty, *best, cells);
+    int alpha = -QUBIC_INFINITY;
+    int bestCell = cells[0];
+
+    for(int i = 0; i < count; i++) {
+        int cell = cells[i];
+        int score;
+
+        pieces[0] |= BB_CELL(cell);
+        if(i == 0) {
+            score = -negamax(1, key ^ zobrist[0][cell] ^ 1, depth - 1, -QUBIC_INFINITY, -alpha, 1);
+        }
+        else {
+            score = -negamax(1, key ^ zobrist[0][cell] ^ 1, depth - 1, -alpha - 1, -alpha, 1);
+            if(score > alpha) score = -negamax(1, key ^ zobrist[0][cell] ^ 1, depth - 1, -QUBIC_INFINITY, -alpha, 1);
+        }
+        pieces[0] &= ~BB_CELL(cell);
+        if(stopped) break;
+
+        if(score > alpha) {
+            alpha = score;
+            bestCell = cell;
+        }
+    }
+
+    // A partly searched iteration keeps any move it finished
+    if(alpha > -QUBIC_INFINITY) *best = bestCell;
+    return alpha;
+}
+
+/*******************************************************************
+function: qubicSearch
+    iterative deepening alpha-beta over the 4x4x4 board for the
+    computer, stopping after qubicTimeBudget seconds, at
+    qubicMaxDepth or once the game is decided. Prints the depth
+    reached and the search speed
+
+    Input:
+    computer - cells marked by the computer
+    player - cells marked by the player
+
+    Return:
+    cell index of the best move, -1 if the board is full
+********************************************************************/
+int qubicSearch(Bitboard computer, Bitboard player) {
+    Bitboard empty = ~(computer | player);
+    if(!empty) return -1;
+    if(!linesReady) initLines();
+
+    if(!table) {
+        table = calloc(QUBIC_TT_ENTRIES, sizeof(QubicEntry));
+        if(!table) {
+            fprintf(stderr, "Failed to allocate Qubic transposition table\n");
+            return BB_FIRST(empty);
+        }
+    }
+
+    // Complete a line when possible, nothing to search
+    Bitboard wins = threats(computer, player) & empty;
+    if(wins) return BB_FIRST(wins);
+
+    pieces[0] = computer;
+    pieces[1] = player;
+    nodes = 0;
+    stopped = false;
+    for(int cell = 0; cell < QUBIC_CELLS; cell++) history[cell] /= 2;
+
+    double begin = nowSeconds();
+    int maxDepth = (qubicMaxDepth < 1) ? 1 : (qubicMaxDepth > QUBIC_MAX_DEPTH) ? QUBIC_MAX_DEPTH : qubicMaxDepth;
+    int best = -1;
+    int score = 0;
+    int depth = 0;
+
+    for(int d = 1; d <= maxDepth && d <= BB_COUNT(empty); d++) {
+        // First iteration always finishes so there is a move to play
+        deadline = (d > 1 && qubicTimeBudget > 0) ? begin + qubicTimeBudget : 0;
+        int found = searchRoot(d, &best);
+        if(stopped) break;
+
+        score = found;
+        depth = d;
+        if(QUBIC_IS_WIN_SCORE(score)) break;
+    }
+
+    double elapsed = nowSeconds() - begin;
+    if(qubicStatsDump) fprintf(stderr, "qubic: depth %d, %ld nodes, %.3fs, %.0f nodes/s, score %d\n",
+        depth, nodes, elapsed, (elapsed > 0) ? nodes / elapsed : 0.0, score);
+    return best;
+}
+
+/*******************************************************************
+function: qubicAi
+    converts the GUI board to bitboards, searches the computer's
+    move and marks it on the board
+
+    Input:
+    board - game board holding the 4 layers, see QUBIC_ROW
+********************************************************************/
+void qubicAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    Bitboard computer = 0;
+    Bitboard player = 0;
+
+    for(int cell = 0; cell < QUBIC_CELLS; cell++) {
+        char mark = board[QUBIC_ROW(cell)][QUBIC_COL(cell)];
+        if(mark == X_PLAYER) computer |= BB_CELL(cell);
+        if(mark == O_PLAYER) player |= BB_CELL(cell);
+    }
+
+    int cell = qubicSearch(computer, player);
+    if(cell >= 0) board[QUBIC_ROW(cell)][QUBIC_COL(cell)] = X_PLAYER;
+}
+
+/*******************************************************************
+function: qubicFree
+    releases the transposition table, the next search allocates
+    it again
+********************************************************************/
+void qubicFree(void) {
+    free(table);
+    table = NULL;
+}
@@ -0,0 +1,29 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef QUBIC_H  /* Run the following if QUBIC_H has not been defined */
+#define QUBIC_H  /* Defines QUBIC_H */
+
+#include <stdbool.h>
+#include "bitboard.h"
+
+// 4x4x4 board, cell (layer * 16 + row * 4 + col) is one bit of a Bitboard
+#define QUBIC_SIZE 4
+#define QUBIC_CELLS 64
+#define QUBIC_LINES 76                      // 48 straight, 24 plane diagonal, 4 space diagonal
+#define QUBIC_TT_ENTRIES (1 << 21)          // Transposition table slots, allocated on first search
+#define QUBIC_MAX_DEPTH 64
+
+// The GUI keeps the 4 layers in the 8x8 board, two layers per row of layers:
+// layer 0 top left, 1 top right, 2 bottom left, 3 bottom right
+#define QUBIC_ROW(cell) (((cell) / 32) * QUBIC_SIZE + ((cell) / QUBIC_SIZE) % QUBIC_SIZE)
+#define QUBIC_COL(cell) ((((cell) / 16) % 2) * QUBIC_SIZE + (cell) % QUBIC_SIZE)
+
+extern double qubicTimeBudget;  // Seconds per move, 0 = no limit
+extern int qubicMaxDepth;       // Deepest iteration, 1 to QUBIC_MAX_DEPTH
+extern bool qubicStatsDump;     // Print the counters of every computer move to stderr
+
+bool qubicHasWon(Bitboard cells);
+int qubicSearch(Bitboard computer, Bitboard player);
+void qubicAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+void qubicFree(void);
+
+#endif  /* End of header file */
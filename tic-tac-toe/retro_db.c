@@ -0,0 +1,94 @@
+/* Define preprocessor statements */
+#include "retro_db.h"
+#include "mapped_file.h"
+#include "board_config.h"
+#include <stdio.h>
+#include <string.h>
+
+// One mapping per win length, only 3 and 4 fit a 4x4 board
+static MappedFile databases[RETRO_SIZE + 1];
+
+/*******************************************************************
+function: retroValid
+    checks a mapped file is a complete database for a win length
+
+    Input:
+    map - Pointer to the mapped file
+    winLength - marks in a row the file must be solved for
+
+    Return:
+    boolean value - can the entries be used
+********************************************************************/
+static bool retroValid(const MappedFile *map, int winLength) {
+    RetroHeader header;
+
+    if(map->size != sizeof(header) + RETRO_POSITIONS) return false;
+    memcpy(&header, map->data, sizeof(header));
+
+    return memcmp(header.magic, RETRO_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == RETRO_VERSION && header.size == RETRO_SIZE &&
+           header.winLength == (uint32_t)winLength && header.positions == RETRO_POSITIONS;
+}
+
+/*******************************************************************
+function: retroLoad
+    maps the database of every 4x4 win length found in the
+    working directory. Missing or damaged files are skipped,
+    the engine then searches those positions instead
+********************************************************************/
+void retroLoad(void) {
+    for(int k = MIN_WIN_LENGTH; k <= RETRO_SIZE; k++) {
+        char path[32];
+        sprintf(path, RETRO_DB_FILE, k);
+
+        if(databases[k].data || !mapFile(&databases[k], path)) continue;
+        if(!retroValid(&databases[k], k)) {
+            fprintf(stderr, "Ignoring %s, not a 4x4 database for %d in a row\n", path, k);
+            unmapFile(&databases[k]);
+        }
+    }
+}
+
+/*******************************************************************
+function: retroUnload
+    releases every database mapped by retroLoad()
+********************************************************************/
+void retroUnload(void) {
+    for(int k = 0; k <= RETRO_SIZE; k++) unmapFile(&databases[k]);
+}
+
+/*******************************************************************
+function: retroEntries
+    entries of the database for a win length
+
+    Input:
+    winLength - marks in a row needed to win
+
+    Return:
+    RETRO_POSITIONS entries, NULL if no database is loaded
+********************************************************************/
+const uint8_t *retroEntries(int winLength) {
+    if(winLength < 0 || winLength > RETRO_SIZE || !databases[winLength].data) return NULL;
+    return databases[winLength].data + sizeof(RetroHeader);
+}
+
+/*******************************************************************
+function: retroIndex
+    position index of a 4x4 board
+
+    Input:
+    computer - cells marked by X
+    player - cells marked by O
+
+    Return:
+    entry index in the database
+********************************************************************/
+uint32_t retroIndex(uint64_t computer, uint64_t player) {
+    uint32_t index = 0;
+
+    // Highest cell first, so cell c ends up with weight 3^c
+    for(int cell = RETRO_CELLS - 1; cell >= 0; cell--) {
+        index = index * 3 + ((computer >> cell) & 1) + 2 * ((player >> cell) & 1);
+    }
+    return index;
+}
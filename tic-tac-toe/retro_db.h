@@ -0,0 +1,41 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef RETRO_DB_H  /* Run the following if RETRO_DB_H has not been defined */
+#define RETRO_DB_H  /* Defines RETRO_DB_H */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Solved 4x4 positions written by tools/solve_retro4x4.c. The file is a
+// RetroHeader followed by one byte per position, position index is the
+// base-3 number with digit 1 for X and 2 for O at cell (row * 4 + col)
+#define RETRO_MAGIC "TTTRETRO"
+#define RETRO_VERSION 1
+#define RETRO_SIZE 4                        // Board side the database covers
+#define RETRO_CELLS 16
+#define RETRO_POSITIONS 43046721            // 3^16
+#define RETRO_DB_FILE "retro4x4_k%d.db"     // File name for each win length
+
+// Entry byte: result for the side to move in the top 2 bits,
+// plies to the end of the game under perfect play in the low 6
+#define RETRO_UNKNOWN 0     // Unreachable position
+#define RETRO_WIN 1
+#define RETRO_DRAW 2
+#define RETRO_LOSS 3
+#define RETRO_ENTRY(result, distance) (uint8_t)(((result) << 6) | (distance))
+#define RETRO_RESULT(entry) ((entry) >> 6)
+#define RETRO_DISTANCE(entry) ((entry) & 0x3F)
+
+typedef struct {
+    char magic[8];          // RETRO_MAGIC, not 0 terminated
+    uint32_t version;       // RETRO_VERSION
+    uint32_t size;          // RETRO_SIZE
+    uint32_t winLength;     // Marks in a row the positions were solved for
+    uint32_t positions;     // RETRO_POSITIONS entries follow the header
+} RetroHeader;
+
+void retroLoad(void);
+void retroUnload(void);
+const uint8_t *retroEntries(int winLength);
+uint32_t retroIndex(uint64_t computer, uint64_t player);
+
+#endif  /* End of header file */
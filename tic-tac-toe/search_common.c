@@ -0,0 +1,45 @@
+/* Define preprocessor statements */
+#include <time.h>
+#include "search_common.h"
+
+/********************************************************
+function: nowSeconds
+    monotonic clock for search deadlines and timings
+
+    Return:
+    seconds since an arbitrary fixed point
+********************************************************/
+double nowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/*******************************************************************
+function: splitMix64
+    small deterministic generator used to fill the Zobrist keys,
+    kept separate from rand() so srand() has no effect on them
+
+    Input:
+    state - generator state, advanced on every call
+********************************************************************/
+uint64_t splitMix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/*******************************************************************
+function: zobristFill
+    fills hash keys from the generator, a fixed starting state
+    gives the same keys every run
+
+    Input:
+    keys - first key, count keys are written
+    count - number of keys
+    state - generator state, advanced so later keys differ
+********************************************************************/
+void zobristFill(uint64_t *keys, int count, uint64_t *state) {
+    for(int i = 0; i < count; i++) keys[i] = splitMix64(state);
+}
@@ -0,0 +1,58 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef SEARCH_COMMON_H  /* Run the following if SEARCH_COMMON_H has not been defined */
+#define SEARCH_COMMON_H  /* Defines SEARCH_COMMON_H */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ZOBRIST_SEED 0x9E3779B97F4A7C15ULL  // Default generator state, fixed so searches repeat
+
+// Scores beyond bound (either sign) are wins or losses counted in plies from the root
+#define SEARCH_IS_WIN_SCORE(score, bound) ((score) > (bound) || (score) < -(bound))
+
+double nowSeconds(void);
+uint64_t splitMix64(uint64_t *state);
+void zobristFill(uint64_t *keys, int count, uint64_t *state);
+
+/*******************************************************************
+function: scoreToTT / scoreFromTT
+    win scores count plies from the root, so they are stored
+    relative to the position and converted back for the ply of
+    the lookup. Heuristic scores are stored as they are
+
+    Input:
+    score - score to store or stored score
+    ply - plies from the root of the search
+    bound - scores past it are wins, see SEARCH_IS_WIN_SCORE
+********************************************************************/
+static inline int scoreToTT(int score, int ply, int bound) {
+    if(!SEARCH_IS_WIN_SCORE(score, bound)) return score;
+    return (score > 0) ? score + ply : score - ply;
+}
+
+static inline int scoreFromTT(int score, int ply, int bound) {
+    if(!SEARCH_IS_WIN_SCORE(score, bound)) return score;
+    return (score > 0) ? score - ply : score + ply;
+}
+
+/*******************************************************************
+function: mateWindow
+    narrows the window to what is still reachable ply plies from
+    the root: no better than winning on the next move, no worse
+    than losing right now
+
+    Input:
+    alpha, beta - search window, narrowed in place
+    win - score of a win at the root
+    ply - plies from the root
+
+    Return:
+    boolean value - is the window empty, alpha is then the score
+********************************************************************/
+static inline bool mateWindow(int *alpha, int *beta, int win, int ply) {
+    if(*alpha < -(win - ply)) *alpha = -(win - ply);
+    if(*beta > win - ply - 1) *beta = win - ply - 1;
+    return *alpha >= *beta;
+}
+
+#endif  /* End of header file */
@@ -0,0 +1,147 @@
+/* Define preprocessor statements */
+#include "symmetry.h"
+
+int symPerm[NUM_SYMMETRIES][MAX_CELLS];
+int symInverse[NUM_SYMMETRIES];
+
+static int symSize = 0;     // Board side the tables were built for, 0 = not built
+
+/*******************************************************************
+function: symInit
+    builds the permutation table for the 4 rotations and 4
+    reflections of the square board, again only when the
+    board size changes
+
+    Input:
+    size - board side
+********************************************************************/
+void symInit(int size) {
+    if(symSize == size) return;
+
+    const int cells = size * size;
+    const int last = size - 1;
+    for(int row = 0; row < size; row++) {
+        for(int col = 0; col < size; col++) {
+            // Destination (row, col) of this cell under every symmetry
+            const int dest[NUM_SYMMETRIES][2] = {
+                {row, col},                 // Identity
+                {col, last - row},          // Rotate 90
+                {last - row, last - col},   // Rotate 180
+                {last - col, row},          // Rotate 270
+                {row, last - col},          // Mirror left-right
+                {last - row, col},          // Mirror top-bottom
+                {col, row},                 // Main diagonal
+                {last - col, last - row}    // Anti diagonal
+            };
+            for(int s = 0; s < NUM_SYMMETRIES; s++) {
+                symPerm[s][row * size + col] = dest[s][0] * size + dest[s][1];
+            }
+        }
+    }
+
+    // Find the symmetry that maps every cell back to itself
+    for(int s = 0; s < NUM_SYMMETRIES; s++) {
+        for(int t = 0; t < NUM_SYMMETRIES; t++) {
+            bool undoes = true;
+            for(int cell = 0; cell < cells && undoes; cell++) {
+                undoes = (symPerm[t][symPerm[s][cell]] == cell);
+            }
+            if(undoes) {
+                symInverse[s] = t;
+                break;
+            }
+        }
+    }
+    symSize = size;
+}
+
+/*******************************************************************
+function: symTransform
+    applies a symmetry to a set of cells
+
+    Input:
+    cells - bitboard to transform
+    sym - symmetry index
+
+    Return:
+    transformed bitboard
+********************************************************************/
+Bitboard symTransform(Bitboard cells, int sym) {
+    Bitboard result = 0;
+    for(; cells; cells &= cells - 1) {
+        result |= BB_CELL(symPerm[sym][BB_FIRST(cells)]);
+    }
+    return result;
+}
+
+/*******************************************************************
+function: symStabilizers
+    finds the symmetries that leave a position unchanged.
+    Cheap hash comparison first, exact bitboard check after
+
+    Input:
+    game - Pointer to access all variables in GameState
+
+    Return:
+    bitmask with bit s set when symmetry s maps the position to itself
+********************************************************************/
+unsigned symStabilizers(const GameState *game) {
+    unsigned stabilizers = 1u << SYM_IDENTITY;
+
+    for(int s = 1; s < NUM_SYMMETRIES; s++) {
+        if(game->hash[s] != game->hash[SYM_IDENTITY]) continue;
+        if(symTransform(game->pieces[SIDE_X], s) == game->pieces[SIDE_X] &&
+           symTransform(game->pieces[SIDE_O], s) == game->pieces[SIDE_O]) {
+            stabilizers |= 1u << s;
+        }
+    }
+    return stabilizers;
+}
+
+/*******************************************************************
+function: symRedundantMoves
+    finds moves that are mirror images of a lower numbered move
+    in a symmetric position. They score the same as that move so
+    only the lowest cell of each group needs searching
+
+    Input:
+    moves - candidate moves
+    stabilizers - result of symStabilizers()
+
+    Return:
+    bitboard of moves that can be skipped
+********************************************************************/
+Bitboard symRedundantMoves(Bitboard moves, unsigned stabilizers) {
+    Bitboard redundant = 0;
+
+    if(stabilizers == (1u << SYM_IDENTITY)) return 0;
+    for(Bitboard rest = moves; rest; rest &= rest - 1) {
+        int cell = BB_FIRST(rest);
+        if(symRepresentative(cell, stabilizers) != cell) {
+            redundant |= BB_CELL(cell);
+        }
+    }
+    return redundant;
+}
+
+/*******************************************************************
+function: symRepresentative
+    lowest numbered cell a move can be mapped to by the
+    symmetries of the position
+
+    Input:
+    cell - cell index of move
+    stabilizers - result of symStabilizers()
+
+    Return:
+    cell index of equivalent move that gets searched
+********************************************************************/
+int symRepresentative(int cell, unsigned stabilizers) {
+    int lowest = cell;
+    for(int s = 1; s < NUM_SYMMETRIES; s++) {
+        if((stabilizers & (1u << s)) && symPerm[s][cell] < lowest) {
+            lowest = symPerm[s][cell];
+        }
+    }
+    return lowest;
+}
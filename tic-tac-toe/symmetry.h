@@ -0,0 +1,20 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef SYMMETRY_H  /* Run the following if SYMMETRY_H has not been defined */
+#define SYMMETRY_H  /* Defines SYMMETRY_H */
+
+#include "minimax.h"
+
+#define SYM_IDENTITY 0  // Symmetry index that leaves the board unchanged
+
+// symPerm[s][cell] = cell that `cell` moves to under symmetry s
+extern int symPerm[NUM_SYMMETRIES][MAX_CELLS];
+// symInverse[s] = symmetry that undoes symmetry s
+extern int symInverse[NUM_SYMMETRIES];
+
+void symInit(int size);
+Bitboard symTransform(Bitboard cells, int sym);
+unsigned symStabilizers(const GameState* game);
+Bitboard symRedundantMoves(Bitboard moves, unsigned stabilizers);
+int symRepresentative(int cell, unsigned stabilizers);
+
+#endif  /* End of header file */
@@ -0,0 +1,165 @@
+/* Define preprocessor statements */
+#include <stdio.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "threadpool.h"
+
+// Queued task and its argument
+typedef struct {
+    PoolTask task;
+    void *arg;
+    PoolGroup *group;
+} PoolItem;
+
+static pthread_t workers[POOL_MAX_THREADS];
+static int workerCount = 0;
+static PoolItem queue[POOL_QUEUE_LENGTH];  // Ring buffer of waiting tasks
+static int queueHead = 0;                  // Next task to run
+static int queueCount = 0;                 // Tasks waiting
+static bool stopping = false;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t workReady = PTHREAD_COND_INITIALIZER;   // Signalled when a task is queued or pool stops
+static pthread_cond_t workDone = PTHREAD_COND_INITIALIZER;    // Signalled when a task finishes or a slot frees
+
+/*******************************************************************
+function: workerLoop
+    runs queued tasks until the pool is stopped
+********************************************************************/
+static void *workerLoop(void *unused) {
+    (void)unused;
+    pthread_mutex_lock(&lock);
+    while(true) {
+        while(queueCount == 0 && !stopping) {
+            pthread_cond_wait(&workReady, &lock);
+        }
+        if(queueCount == 0 && stopping) break;
+
+        // Take the oldest task
+        PoolItem item = queue[queueHead];
+        queueHead = (queueHead + 1) % POOL_QUEUE_LENGTH;
+        queueCount--;
+        pthread_cond_broadcast(&workDone);
+
+        pthread_mutex_unlock(&lock);
+        item.task(item.arg);
+        pthread_mutex_lock(&lock);
+
+        item.group->pending--;
+        pthread_cond_broadcast(&workDone);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+/*******************************************************************
+function: poolStart
+    starts (or restarts) the pool with a number of workers.
+    0 or fewer workers leaves the pool stopped, tasks then
+    run on the calling thread
+
+    Input:
+    threads - number of worker threads
+
+    Return:
+    boolean value - were the workers started
+********************************************************************/
+bool poolStart(int threads) {
+    poolStop();
+    if(threads <= 0) return true;
+    if(threads > POOL_MAX_THREADS) threads = POOL_MAX_THREADS;
+
+    stopping = false;
+    for(workerCount = 0; workerCount < threads; workerCount++) {
+        if(pthread_create(&workers[workerCount], NULL, workerLoop, NULL) != 0) {
+            fprintf(stderr, "Failed to start worker thread %d\n", workerCount);
+            poolStop();
+            return false;
+        }
+    }
+    return true;
+}
+
+/*******************************************************************
+function: poolStop
+    finishes queued tasks then joins every worker
+********************************************************************/
+void poolStop(void) {
+    pthread_mutex_lock(&lock);
+    stopping = true;
+    pthread_cond_broadcast(&workReady);
+    pthread_mutex_unlock(&lock);
+
+    for(int i = 0; i < workerCount; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    workerCount = 0;
+}
+
+/*******************************************************************
+function: poolSize
+    Return: number of worker threads running
+********************************************************************/
+int poolSize(void) {
+    return workerCount;
+}
+
+/*******************************************************************
+function: poolCpuCount
+    Return: number of processors online, at least 1
+********************************************************************/
+int poolCpuCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = (int)info.dwNumberOfProcessors;
+#else
+    int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (count > 0) ? count : 1;
+}
+
+/*******************************************************************
+function: poolSubmit
+    queues a task for the workers, or runs it straight away
+    when the pool has no workers
+
+    Input:
+    group - group the task belongs to, zero initialised by caller
+    task - function to run
+    arg - argument passed to task
+********************************************************************/
+void poolSubmit(PoolGroup *group, PoolTask task, void *arg) {
+    if(workerCount == 0) {
+        task(arg);
+        return;
+    }
+
+    pthread_mutex_lock(&lock);
+    while(queueCount == POOL_QUEUE_LENGTH) {
+        pthread_cond_wait(&workDone, &lock);
+    }
+    queue[(queueHead + queueCount) % POOL_QUEUE_LENGTH] = (PoolItem){task, arg, group};
+    queueCount++;
+    group->pending++;
+    pthread_cond_signal(&workReady);
+    pthread_mutex_unlock(&lock);
+}
+
+/*******************************************************************
+function: poolWait
+    blocks until every task of a group has finished
+
+    Input:
+    group - group passed to poolSubmit()
+********************************************************************/
+void poolWait(PoolGroup *group) {
+    pthread_mutex_lock(&lock);
+    while(group->pending > 0) {
+        pthread_cond_wait(&workDone, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+}
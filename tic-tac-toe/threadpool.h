@@ -0,0 +1,25 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef THREADPOOL_H  /* Run the following if THREADPOOL_H has not been defined */
+#define THREADPOOL_H  /* Defines THREADPOOL_H */
+
+#include <stdbool.h>
+
+#define POOL_MAX_THREADS 64     // Upper limit on worker threads
+#define POOL_QUEUE_LENGTH 256   // Tasks that can wait at once, poolSubmit() blocks when full
+
+// Work item run on a worker thread
+typedef void (*PoolTask)(void *arg);
+
+// Tasks submitted together, so callers only wait for their own work
+typedef struct {
+    int pending;    // Tasks submitted and not yet finished
+} PoolGroup;
+
+bool poolStart(int threads);
+void poolStop(void);
+int poolSize(void);
+int poolCpuCount(void);
+void poolSubmit(PoolGroup *group, PoolTask task, void *arg);
+void poolWait(PoolGroup *group);
+
+#endif  /* End of header file */
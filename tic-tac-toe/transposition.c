@@ -0,0 +1,169 @@
+/* Define preprocessor statements */
+#include <string.h>
+#include <stdatomic.h>
+#include "transposition.h"
+#include "symmetry.h"
+#include "search_common.h"
+
+uint64_t zobristKeys[2][MAX_CELLS];
+uint64_t zobristSide;
+
+/*
+ * Slots are shared by every search thread without locks. A slot stores the
+ * packed entry and (key ^ data); a slot torn by two threads writing at once
+ * fails the key check on the next probe and is treated as a miss.
+ */
+typedef struct {
+    _Atomic uint64_t check;     // Zobrist key xor data, 0 = slot unused
+    _Atomic uint64_t data;      // score | depth << 16 | flag << 24 | bestMove << 32
+} TTSlot;
+
+static TTSlot *table = NULL;    // Table slots, persists across mmMove() calls
+static size_t tableMask = 0;    // Number of slots - 1
+static bool zobristReady = false;
+
+/*******************************************************************
+function: zobristInit
+    fills the Zobrist keys once per process
+********************************************************************/
+void zobristInit(void) {
+    if(zobristReady) return;
+
+    uint64_t seed = 0x5EEDC0FFEEULL;
+    zobristFill(&zobristKeys[0][0], 2 * MAX_CELLS, &seed);
+    zobristSide = splitMix64(&seed);
+    zobristReady = true;
+}
+
+/*******************************************************************
+function: zobristHash
+    computes the Zobrist hashes of a position from scratch, one
+    per symmetry. Searches then update them incrementally one
+    move at a time. Symmetry tables must be set up already
+
+    Input:
+    game - Pointer to access all variables in GameState
+           hash[] is filled in (side to move is not included)
+********************************************************************/
+void zobristHash(GameState *game) {
+    zobristInit();
+    for(int s = 0; s < NUM_SYMMETRIES; s++) {
+        game->hash[s] = 0;
+        for(int side = 0; side < 2; side++) {
+            for(Bitboard cells = game->pieces[side]; cells; cells &= cells - 1) {
+                game->hash[s] ^= zobristKeys[side][symPerm[s][BB_FIRST(cells)]];
+            }
+        }
+    }
+}
+
+/*******************************************************************
+function: ttInit
+    allocates (or resizes) the transposition table
+
+    Input:
+    entries - number of slots, rounded down to a power of two
+
+    Return:
+    boolean value - was the table allocated
+********************************************************************/
+bool ttInit(size_t entries) {
+    size_t size = 1;
+
+    zobristInit();
+    if(entries < 1) entries = 1;
+    while(size * 2 <= entries) size *= 2;
+
+    TTSlot *slots = calloc(size, sizeof(TTSlot));
+    if(!slots) {
+        fprintf(stderr, "Memory allocation failed for %zu transposition table entries\n", size);
+        return false;
+    }
+
+    free(table);
+    table = slots;
+    tableMask = size - 1;
+    return true;
+}
+
+/*******************************************************************
+function: ttEnsure
+    allocates the default size table if none exists yet.
+    Call before starting search threads
+
+    Return:
+    boolean value - is a table allocated
+********************************************************************/
+bool ttEnsure(void) {
+    return table || ttInit(TT_DEFAULT_ENTRIES);
+}
+
+/*******************************************************************
+function: ttClear
+    forgets every stored position
+********************************************************************/
+void ttClear(void) {
+    if(table) memset(table, 0, (tableMask + 1) * sizeof(TTSlot));
+}
+
+/*******************************************************************
+function: ttFree
+    releases the transposition table
+********************************************************************/
+void ttFree(void) {
+    free(table);
+    table = NULL;
+    tableMask = 0;
+}
+
+/*******************************************************************
+function: ttProbe
+    looks up a position
+
+    Input:
+    key - Zobrist key of the position
+    entry - filled with the stored slot when found
+
+    Return:
+    boolean value - was the position found
+********************************************************************/
+bool ttProbe(uint64_t key, TTEntry *entry) {
+    if(!table) return false;
+
+    TTSlot *slot = &table[key & tableMask];
+    uint64_t data = atomic_load_explicit(&slot->data, memory_order_relaxed);
+    uint64_t check = atomic_load_explicit(&slot->check, memory_order_relaxed);
+    if((check ^ data) != key) return false;
+
+    entry->key = key;
+    entry->score = (int16_t)(data & 0xFFFF);
+    entry->depth = (int8_t)((data >> 16) & 0xFF);
+    entry->flag = (uint8_t)((data >> 24) & 0xFF);
+    entry->bestMove = (int8_t)((data >> 32) & 0xFF);
+    return true;
+}
+
+/*******************************************************************
+function: ttStore
+    stores a searched position, replacing whatever used the slot.
+    Safe to call from several search threads at once
+
+    Input:
+    key - Zobrist key of the position
+    score - score relative to the position
+    depth - remaining plies searched
+    flag - TT_EXACT, TT_LOWER or TT_UPPER
+    bestMove - cell index of best move, -1 if none
+********************************************************************/
+void ttStore(uint64_t key, int score, int depth, int flag, int bestMove) {
+    if(!table) return;
+
+    uint64_t data = (uint64_t)(uint16_t)score |
+                    (uint64_t)(uint8_t)depth << 16 |
+                    (uint64_t)(uint8_t)flag << 24 |
+                    (uint64_t)(uint8_t)bestMove << 32;
+
+    TTSlot *slot = &table[key & tableMask];
+    atomic_store_explicit(&slot->data, data, memory_order_relaxed);
+    atomic_store_explicit(&slot->check, key ^ data, memory_order_relaxed);
+}
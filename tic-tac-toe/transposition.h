@@ -0,0 +1,38 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef TRANSPOSITION_H  /* Run the following if TRANSPOSITION_H has not been defined */
+#define TRANSPOSITION_H  /* Defines TRANSPOSITION_H */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "minimax.h"
+
+#define TT_DEFAULT_ENTRIES (1 << 16)    // Default number of table slots, must be a power of two
+
+// Bound stored with a score
+#define TT_EXACT 0      // Score is the exact minimax value
+#define TT_LOWER 1      // Search failed high, real value >= score
+#define TT_UPPER 2      // Search failed low, real value <= score
+
+// Unpacked transposition table entry
+typedef struct {
+    uint64_t key;       // Zobrist key of the position
+    int16_t score;      // Score relative to this position (see minimax.c)
+    int8_t depth;       // Remaining plies searched below this position
+    uint8_t flag;       // TT_EXACT, TT_LOWER or TT_UPPER
+    int8_t bestMove;    // Cell index of best move in the canonical orientation, -1 if none
+} TTEntry;
+
+extern uint64_t zobristKeys[2][MAX_CELLS];  // Random key per side per cell
+extern uint64_t zobristSide;                // Toggled in when player O is to move
+
+void zobristInit(void);
+void zobristHash(GameState* game);
+bool ttInit(size_t entries);
+bool ttEnsure(void);
+void ttClear(void);
+void ttFree(void);
+bool ttProbe(uint64_t key, TTEntry* entry);
+void ttStore(uint64_t key, int score, int depth, int flag, int bestMove);
+
+#endif  /* End of header file */
@@ -0,0 +1,472 @@
+/* Define preprocessor statements */
+#include "ultimate.h"
+#include "gui.h"
+#include "search_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+double ultimateTimeBudget = 0.5;
+int ultimateMaxDepth = ULTIMATE_MAX_DEPTH;
+bool ultimateStatsDump = false;
+
+#define ULTIMATE_WIN 100000                         // Score of the meta-board won at the root
+#define ULTIMATE_INFINITY 200000
+#define ULTIMATE_WIN_BOUND (ULTIMATE_WIN - 1000)    // Scores past this are wins or losses
+#define ULTIMATE_IS_WIN_SCORE(s) SEARCH_IS_WIN_SCORE(s, ULTIMATE_WIN_BOUND)
+#define SUB_FULL 0x1FF                              // Every cell of a sub-board
+#define STOP_POLL_NODES 1024                        // Nodes between clock reads
+#define HISTORY_LIMIT (1 << 20)                     // History scores are halved past this
+
+// Sub-board states, cached in status[] and only recomputed for the sub-board played in
+#define SUB_OPEN 0
+#define SUB_WON_X 1         // Won by side 0, the computer
+#define SUB_WON_O 2         // Won by side 1, the player
+#define SUB_DRAWN 3
+
+// Transposition table bounds
+#define ULTIMATE_EXACT 0
+#define ULTIMATE_LOWER 1
+#define ULTIMATE_UPPER 2
+
+typedef struct {
+    uint64_t key;
+    int32_t score;          // Win scores relative to the stored position
+    int8_t depth;           // Plies searched below the position
+    uint8_t flag;           // ULTIMATE_EXACT, ULTIMATE_LOWER or ULTIMATE_UPPER
+    uint8_t move;           // Best cell found, sub-board * 9 + cell
+} UltimateEntry;
+
+// The 8 lines of a 3x3 board, used for the sub-boards and the meta-board
+static const uint16_t lines3[8] = {0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054};
+// Meta-board lines through a sub-board count towards its weight
+static const int boardWeight[9] = {3, 2, 3, 2, 4, 2, 3, 2, 3};
+
+static bool won3[1 << 9];                       // Does a set of cells hold a line
+static uint64_t zobrist[2][ULTIMATE_CELLS];
+static uint64_t forcedKey[10];                  // Sub-board the next move must go to, slot 0 = any
+static bool tablesReady = false;
+
+// Position being searched. Side 0 is the computer (X), side 1 the player (O)
+static uint16_t sub[2][9];                      // Cells of each sub-board marked by each side
+static int status[9];                           // SUB_OPEN, SUB_WON_X, SUB_WON_O or SUB_DRAWN
+static uint16_t claimed[2];                     // Meta-board cells won by each side
+static int subScore[9];                         // Cached heuristic of each sub-board, computer's view
+static int forced;                              // Sub-board the side to move must play in, -1 = any
+static uint64_t key;
+
+static UltimateEntry *table = NULL;
+static int history[ULTIMATE_CELLS];             // Cutoffs caused by each move, aged every search
+static long nodes;
+static double deadline;                         // Monotonic seconds, 0 = no deadline
+static bool stopped;
+
+/*******************************************************************
+function: initTables
+    fills the 3x3 win table and the hash keys
+********************************************************************/
+static void initTables(void) {
+    for(int cells = 0; cells < (1 << 9); cells++) {
+        for(int i = 0; i < 8; i++) {
+            if((cells & lines3[i]) == lines3[i]) won3[cells] = true;
+        }
+    }
+
+    uint64_t seed = ZOBRIST_SEED;
+    zobristFill(&zobrist[0][0], 2 * ULTIMATE_CELLS, &seed);
+    zobristFill(forcedKey, 10, &seed);
+    tablesReady = true;
+}
+
+/*******************************************************************
+function: scoreSubBoard
+    heuristic value of one sub-board for the computer: a won
+    sub-board is worth its place on the meta-board, an open one
+    counts the lines each side can still complete in it
+
+    Input:
+    board - sub-board index
+
+    Return:
+    score, positive when the computer is ahead
+********************************************************************/
+static int scoreSubBoard(int board) {
+    if(status[board] == SUB_WON_X) return 100 * boardWeight[board];
+    if(status[board] == SUB_WON_O) return -100 * boardWeight[board];
+    if(status[board] == SUB_DRAWN) return 0;
+
+    static const int weight[4] = {0, 1, 8, 0};
+    int score = 0;
+    for(int i = 0; i < 8; i++) {
+        int own = __builtin_popcount(sub[0][board] & lines3[i]);
+        int other = __builtin_popcount(sub[1][board] & lines3[i]);
+        if(!other) score += weight[own];
+        if(!own) score -= weight[other];
+    }
+    return score * boardWeight[board];
+}
+
+/*******************************************************************
+function: evaluatePosition
+    heuristic score for the side to move: the cached sub-board
+    scores plus the meta-board lines still open to one side
+
+    Input:
+    side - side to move
+
+    Return:
+    score, positive when the side to move is ahead
+********************************************************************/
+static int evaluatePosition(int side) {
+    static const int metaWeight[4] = {0, 30, 300, 0};
+    uint16_t drawn = 0;
+    int score = 0;
+
+    for(int board = 0; board < 9; board++) {
+        score += subScore[board];
+        if(status[board] == SUB_DRAWN) drawn |= 1 << board;
+    }
+    for(int i = 0; i < 8; i++) {
+        if(lines3[i] & drawn) continue;
+        int own = __builtin_popcount(claimed[0] & lines3[i]);
+        int other = __builtin_popcount(claimed[1] & lines3[i]);
+        if(!other) score += metaWeight[own];
+        if(!own) score -= metaWeight[other];
+    }
+    return (side == 0) ? score : -score;
+}
+
+/*******************************************************************
+function: updateSubBoard
+    recomputes the cached status and score of the one sub-board
+    a move was made in, and the meta-board cells it claims
+
+    Input:
+    board - sub-board index
+********************************************************************/
+static void updateSubBoard(int board) {
+    claimed[0] &= ~(1 << board);
+    claimed[1] &= ~(1 << board);
+
+    if(won3[sub[0][board]]) {
+        status[board] = SUB_WON_X;
+        claimed[0] |= 1 << board;
+    }
+    else if(won3[sub[1][board]]) {
+        status[board] = SUB_WON_O;
+        claimed[1] |= 1 << board;
+    }
+    else if((sub[0][board] | sub[1][board]) == SUB_FULL) {
+        status[board] = SUB_DRAWN;
+    }
+    else {
+        status[board] = SUB_OPEN;
+    }
+    subScore[board] = scoreSubBoard(board);
+}
+
+/*******************************************************************
+function: playMove / takeBackMove
+    marks a cell and sends the other side to the matching
+    sub-board, or anywhere if that one is decided. Undo restores
+    the sub-board cache and the forced sub-board. The low bit of
+    the key flips with the side to move
+
+    Input:
+    move - sub-board * 9 + cell
+    side - side making the move
+    previous - forced sub-board before the move (takeBackMove only)
+********************************************************************/
+static void playMove(int move, int side) {
+    int board = move / 9;
+    int cell = move % 9;
+
+    sub[side][board] |= 1 << cell;
+    updateSubBoard(board);
+
+    key ^= zobrist[side][move] ^ forcedKey[forced + 1] ^ 1;
+    forced = (status[cell] == SUB_OPEN) ? cell : -1;
+    key ^= forcedKey[forced + 1];
+}
+
+static void takeBackMove(int move, int side, int previous) {
+    int board = move / 9;
+
+    key ^= forcedKey[forced + 1] ^ forcedKey[previous + 1] ^ zobrist[side][move] ^ 1;
+    forced = previous;
+
+    sub[side][board] &= ~(1 << (move % 9));
+    updateSubBoard(board);
+}
+
+/*******************************************************************
+function: generateMoves
+    legal moves, the table's best move first, then moves that
+    win their sub-board, then by history
+
+    Input:
+    side - side to move
+    first - move tried first, -1 for none
+    moves - receives the moves in search order
+
+    Return:
+    number of moves
+********************************************************************/
+static int generateMoves(int side, int first, int moves[ULTIMATE_CELLS]) {
+    int keys[ULTIMATE_CELLS];
+    int count = 0;
+
+    for(int board = 0; board < 9; board++) {
+        if(status[board] != SUB_OPEN || (forced >= 0 && board != forced)) continue;
+
+        for(int cell = 0; cell < 9; cell++) {
+            if((sub[0][board] | sub[1][board]) & (1 << cell)) continue;
+
+            int move = board * 9 + cell;
+            int sortKey = history[move];
+            if(won3[sub[side][board] | (1 << cell)]) sortKey += HISTORY_LIMIT * 2;
+            if(move == first) sortKey = HISTORY_LIMIT * 4;
+
+            // Insertion sort, highest key first
+            int i = count++;
+            for(; i > 0 && keys[i - 1] < sortKey; i--) {
+                keys[i] = keys[i - 1];
+                moves[i] = moves[i - 1];
+            }
+            keys[i] = sortKey;
+            moves[i] = move;
+        }
+    }
+    return count;
+}
+
+/*******************************************************************
+function: negamax
+    alpha-beta search with principal variation windows and a
+    transposition table
+
+    Input:
+    side - side to move, 0 computer, 1 player
+    depth - plies left before the heuristic is used
+    alpha, beta - search window
+    ply - plies from the root
+
+    Return:
+    score for the side to move
+********************************************************************/
+static int negamax(int side, int depth, int alpha, int beta, int ply) {
+    if((++nodes & (STOP_POLL_NODES - 1)) == 0 && deadline > 0 && nowSeconds() > deadline) stopped = true;
+    if(stopped) return 0;
+
+    // Last move completed a meta-board line
+    if(won3[claimed[!side]]) return -(ULTIMATE_WIN - ply);
+    if(depth <= 0) return evaluatePosition(side);
+
+    if(mateWindow(&alpha, &beta, ULTIMATE_WIN, ply)) return alpha;
+
+    UltimateEntry *entry = &table[key & (ULTIMATE_TT_ENTRIES - 1)];
+    int hashMove = -1;
+    if(entry->key == key) {
+        hashMove = entry->move;
+        if(entry->depth >= depth) {
+            int stored = scoreFromTT(entry->score, ply, ULTIMATE_WIN_BOUND);
+            if(entry->flag == ULTIMATE_EXACT) return stored;
+            if(entry->flag == ULTIMATE_LOWER && stored > alpha) alpha = stored;
+            if(entry->flag == ULTIMATE_UPPER && stored < beta) beta = stored;
+            if(alpha >= beta) return stored;
+        }
+    }
+
+    int moves[ULTIMATE_CELLS];
+    int count = generateMoves(side, hashMove, moves);
+    // Every sub-board decided without a meta-board line
+    if(count == 0) return 0;
+
+    int previous = forced;
+    int alphaOrig = alpha;
+    int bestScore = -ULTIMATE_INFINITY;
+    int bestMove = moves[0];
+
+    for(int i = 0; i < count; i++) {
+        int move = moves[i];
+        int score;
+
+        playMove(move, side);
+        if(i == 0) {
+            score = -negamax(!side, depth - 1, -beta, -alpha, ply + 1);
+        }
+        else {
+            score = -negamax(!side, depth - 1, -alpha - 1, -alpha, ply + 1);
+            if(score > alpha && score < beta) score = -negamax(!side, depth - 1, -beta, -alpha, ply + 1);
+        }
+        takeBackMove(move, side, previous);
+        if(stopped) return 0;
+
+        if(score > bestScore) {
+            bestScore = score;
+            bestMove = move;
+        }
+        if(score > alpha) alpha = score;
+        if(alpha >= beta) {
+            if((history[move] += depth * depth) > HISTORY_LIMIT) {
+                for(int j = 0; j < ULTIMATE_CELLS; j++) history[j] /= 2;
+            }
+            break;
+        }
+    }
+
+    entry->key = key;
+    entry->score = scoreToTT(bestScore, ply, ULTIMATE_WIN_BOUND);
+    entry->depth = depth;
+    entry->flag = (bestScore <= alphaOrig) ? ULTIMATE_UPPER : (bestScore >= beta) ? ULTIMATE_LOWER : ULTIMATE_EXACT;
+    entry->move = bestMove;
+    return bestScore;
+}
+
+/*******************************************************************
+function: searchRoot
+    one iteration of the search at the root, the best move of
+    the last iteration goes first
+
+    Input:
+    depth - plies to search
+    best - best move so far, replaced by this iteration's
+
+    Return:
+    score of the best move, meaningless if the search stopped
+********************************************************************/
+static int searchRoot(int depth, int *best) {
+    int moves[ULTIMATE_CELLS];
+    int count = generateMoves(0, *best, moves);
+    int previous = forced;
+    int alpha = -ULTIMATE_INFINITY;
+    int bestMove = moves[0];
+
+    for(int i = 0; i < count; i++) {
+        int move = moves[i];
+        int score;
+
+        playMove(move, 0);
+        if(i == 0) {
+            score = -negamax(1, depth - 1, -ULTIMATE_INFINITY, -alpha, 1);
+        }
+        else {
+            score = -negamax(1, depth - 1, -alpha - 1, -alpha, 1);
+            if(score > alpha) score = -negamax(1, depth - 1, -ULTIMATE_INFINITY, -alpha, 1);
+        }
+        takeBackMove(move, 0, previous);
+        if(stopped) break;
+
+        if(score > alpha) {
+            alpha = score;
+            bestMove = move;
+        }
+    }
+
+    // Keep the best move searched to the end, even when the deadline cut the rest
+    if(alpha > -ULTIMATE_INFINITY) *best = bestMove;
+    return alpha;
+}
+
+/*******************************************************************
+function: ultimateSearch
+    iterative deepening search of the computer's (X) move on the
+    ultimate board, stopping after ultimateTimeBudget seconds,
+    at ultimateMaxDepth or once the game is decided
+
+    Input:
+    board - game board, 9 x 9 cells are used
+    lastRow, lastCol - cell of the player's last move, -1 if none
+
+    Return:
+    cell index (row * 9 + col) of the best move, -1 if there is
+    no legal move
+********************************************************************/
+int ultimateSearch(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int lastRow, int lastCol) {
+    if(!tablesReady) initTables();
+    if(!table) {
+        table = calloc(ULTIMATE_TT_ENTRIES, sizeof(UltimateEntry));
+        if(!table) {
+            fprintf(stderr, "Failed to allocate ultimate transposition table\n");
+            return -1;
+        }
+    }
+
+    memset(sub, 0, sizeof(sub));
+    claimed[0] = claimed[1] = 0;
+    key = 0;
+    for(int row = 0; row < ULTIMATE_SIZE; row++) {
+        for(int col = 0; col < ULTIMATE_SIZE; col++) {
+            int move = ((row / 3) * 3 + col / 3) * 9 + (row % 3) * 3 + col % 3;
+            int side = (board[row][col] == X_PLAYER) ? 0 : (board[row][col] == O_PLAYER) ? 1 : -1;
+            if(side < 0) continue;
+            sub[side][move / 9] |= 1 << (move % 9);
+            key ^= zobrist[side][move];
+        }
+    }
+    for(int b = 0; b < 9; b++) updateSubBoard(b);
+
+    forced = -1;
+    if(lastRow >= 0 && lastCol >= 0) {
+        int target = (lastRow % 3) * 3 + lastCol % 3;
+        if(status[target] == SUB_OPEN) forced = target;
+    }
+    key ^= forcedKey[forced + 1];
+
+    nodes = 0;
+    stopped = false;
+    for(int move = 0; move < ULTIMATE_CELLS; move++) history[move] /= 2;
+
+    int moves[ULTIMATE_CELLS];
+    int count = generateMoves(0, -1, moves);
+    if(count == 0 || won3[claimed[0]] || won3[claimed[1]]) return -1;
+
+    double begin = nowSeconds();
+    int maxDepth = (ultimateMaxDepth < 1) ? 1 : (ultimateMaxDepth > ULTIMATE_MAX_DEPTH) ? ULTIMATE_MAX_DEPTH : ultimateMaxDepth;
+    int best = -1;
+    int result = 0;
+    int depth = 0;
+
+    for(int d = 1; d <= maxDepth; d++) {
+        // Depth 1 runs without a deadline, there must be a move to return
+        deadline = (d > 1 && ultimateTimeBudget > 0) ? begin + ultimateTimeBudget : 0;
+        int found = searchRoot(d, &best);
+        if(stopped) break;
+
+        result = found;
+        depth = d;
+        if(ULTIMATE_IS_WIN_SCORE(result) || count == 1) break;
+    }
+
+    double elapsed = nowSeconds() - begin;
+    if(ultimateStatsDump) fprintf(stderr, "ultimate: depth %d, %ld nodes, %.3fs, %.0f nodes/s, score %d\n",
+        depth, nodes, elapsed, (elapsed > 0) ? nodes / elapsed : 0.0, result);
+
+    int subBoard = best / 9;
+    int cell = best % 9;
+    return ((subBoard / 3) * 3 + cell / 3) * ULTIMATE_SIZE + (subBoard % 3) * 3 + cell % 3;
+}
+
+/*******************************************************************
+function: ultimateAi
+    searches the computer's move from the last move played and
+    marks it on the board
+
+    Input:
+    board - game board, 9 x 9 cells are used
+********************************************************************/
+void ultimateAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    int cell = ultimateSearch(board, lastMoveRow, lastMoveCol);
+    if(cell >= 0) update_board(board, cell / ULTIMATE_SIZE, cell % ULTIMATE_SIZE, X_PLAYER);
+}
+
+/*******************************************************************
+function: ultimateFree
+    releases the transposition table, the next search allocates
+    it again
+********************************************************************/
+void ultimateFree(void) {
+    free(table);
+    table = NULL;
+}
@@ -0,0 +1,23 @@
+/* Define include guards. Ensures contents of this file does not get included more than once*/
+#ifndef ULTIMATE_H  /* Run the following if ULTIMATE_H has not been defined */
+#define ULTIMATE_H  /* Defines ULTIMATE_H */
+
+#include <stdbool.h>
+#include "board_config.h"
+
+// 9x9 board made of 3x3 sub-boards. Sub-board (row / 3) * 3 + col / 3
+// holds the cell at (row % 3) * 3 + col % 3
+#define ULTIMATE_SIZE 9
+#define ULTIMATE_CELLS 81
+#define ULTIMATE_TT_ENTRIES (1 << 20)       // Transposition table slots, allocated on first search
+#define ULTIMATE_MAX_DEPTH 64
+
+extern double ultimateTimeBudget;   // Seconds per move, 0 = no limit
+extern int ultimateMaxDepth;        // Deepest iteration, 1 to ULTIMATE_MAX_DEPTH
+extern bool ultimateStatsDump;      // Print the counters of every computer move to stderr
+
+int ultimateSearch(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int lastRow, int lastCol);
+void ultimateAi(char board[MAX_BOARD_SIZE][MAX_BOARD_SIZE]);
+void ultimateFree(void);
+
+#endif  /* End of header file */
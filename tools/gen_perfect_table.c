@@ -0,0 +1,153 @@
+/***
+ * gen_perfect_table.c: Generator for tic-tac-toe/perfect_table.c
+ *
+ * Solves every reachable 3x3 position once and writes the score of each move
+ * for the computer (X) as a C table, so mmMove() can pick perfect moves with
+ * a lookup instead of a search. Scores are 10 - plies for a computer win,
+ * -10 + plies for a player win and 0 for a draw; mmMove() rescales them to
+ * the MM_WIN_SCORE scale of minimax().
+ *
+ * Build and run from the repository root:
+ *  gcc -O2 -o gen_perfect_table tools/gen_perfect_table.c
+ *  ./gen_perfect_table tic-tac-toe/perfect_table.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CELLS 9
+#define KEYS 19683          // 3^9 boards
+#define NO_MOVE -128        // Score of an occupied cell
+#define UNSOLVED 127        // Memo marker
+
+static const int winMasks[8] = {0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054};
+
+static int base3[1 << CELLS];           // Base-3 weight of every set of cells
+static signed char memo[2][KEYS];       // Solved value per side to move
+static signed char scores[KEYS][CELLS]; // Move scores of positions with X to move
+static char reachable[KEYS];            // Positions with X to move found by the walk
+
+static int won(int cells){
+    for(int i = 0; i < 8; i++){
+        if((cells & winMasks[i]) == winMasks[i]) return 1;
+    }
+    return 0;
+}
+
+static int key(int x, int o){
+    return base3[x] + 2 * base3[o];
+}
+
+/***
+ * solve(): Value of a position with the mover about to play, counted from
+ * this position (depth 0), exactly as minimax() scores it.
+ */
+static int solve(int x, int o, int xToMove){
+    int k = key(x, o);
+    if(memo[xToMove][k] != UNSOLVED) return memo[xToMove][k];
+
+    int value;
+    if(won(o)) value = -10;
+    else if(won(x)) value = 10;
+    else if((x | o) == (1 << CELLS) - 1) value = 0;
+    else{
+        value = xToMove ? -1000 : 1000;
+        for(int cell = 0; cell < CELLS; cell++){
+            int bit = 1 << cell;
+            if((x | o) & bit) continue;
+            int child = xToMove ? solve(x | bit, o, 0) : solve(x, o | bit, 1);
+            // A result one ply further away scores one closer to 0
+            child += (child > 0) ? -1 : (child < 0) ? 1 : 0;
+            if(xToMove ? child > value : child < value) value = child;
+        }
+    }
+    memo[xToMove][k] = (signed char)value;
+    return value;
+}
+
+/***
+ * walk(): Visit every position reachable from the empty board, with either
+ * side starting, and record move scores for positions where X is to move.
+ */
+static void walk(int x, int o, int xToMove){
+    if(won(x) || won(o) || (x | o) == (1 << CELLS) - 1) return;
+
+    int k = key(x, o);
+    if(xToMove && !reachable[k]){
+        reachable[k] = 1;
+        for(int cell = 0; cell < CELLS; cell++){
+            int bit = 1 << cell;
+            // Same call mmMove() makes: X plays, then minimax() from depth 0
+            scores[k][cell] = ((x | o) & bit) ? NO_MOVE : (signed char)solve(x | bit, o, 0);
+        }
+    }
+
+    for(int cell = 0; cell < CELLS; cell++){
+        int bit = 1 << cell;
+        if((x | o) & bit) continue;
+        if(xToMove) walk(x | bit, o, 0);
+        else walk(x, o | bit, 1);
+    }
+}
+
+int main(int argc, char *argv[]){
+    if(argc != 2){
+        fprintf(stderr, "Usage: %s <output.c>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for(int cells = 0; cells < (1 << CELLS); cells++){
+        int weight = 1;
+        for(int cell = 0; cell < CELLS; cell++, weight *= 3){
+            if(cells & (1 << cell)) base3[cells] += weight;
+        }
+    }
+    memset(memo, UNSOLVED, sizeof(memo));
+    walk(0, 0, 1);
+    walk(0, 0, 0);
+
+    FILE *out = fopen(argv[1], "w");
+    if(!out){
+        perror("Failed to open output file");
+        return EXIT_FAILURE;
+    }
+
+    // Number the reachable positions, row 0 of the score table means "absent"
+    static unsigned short index[KEYS];
+    int rows = 0;
+    for(int k = 0; k < KEYS; k++){
+        if(reachable[k]) index[k] = (unsigned short)++rows;
+    }
+
+    fprintf(out, "/* Generated by tools/gen_perfect_table.c - do not edit by hand */\n");
+    fprintf(out, "#include \"perfect_table.h\"\n\n");
+
+    fprintf(out, "const uint16_t perfectBase3[1 << PERFECT_TABLE_CELLS] = {");
+    for(int cells = 0; cells < (1 << CELLS); cells++){
+        fprintf(out, "%s%d%s", (cells % 16) ? " " : "\n    ", base3[cells], (cells + 1 < (1 << CELLS)) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const uint16_t perfectIndex[PERFECT_TABLE_KEYS] = {");
+    for(int k = 0; k < KEYS; k++){
+        fprintf(out, "%s%d%s", (k % 16) ? " " : "\n    ", index[k], (k + 1 < KEYS) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const int8_t perfectScores[][PERFECT_TABLE_CELLS] = {\n");
+    fprintf(out, "    {%d, %d, %d, %d, %d, %d, %d, %d, %d},\n", NO_MOVE, NO_MOVE, NO_MOVE, NO_MOVE, NO_MOVE, NO_MOVE, NO_MOVE, NO_MOVE, NO_MOVE);
+    for(int k = 0, row = 0; k < KEYS; k++){
+        if(!reachable[k]) continue;
+        fprintf(out, "    {");
+        for(int cell = 0; cell < CELLS; cell++){
+            fprintf(out, "%d%s", scores[k][cell], (cell + 1 < CELLS) ? ", " : "");
+        }
+        fprintf(out, "}%s\n", (++row < rows) ? "," : "");
+    }
+    fprintf(out, "};\n");
+
+    fclose(out);
+    printf("Wrote %d positions to %s\n", rows, argv[1]);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+/***
+ * qtable_to_c.c: Generator for tic-tac-toe/q_model.c
+ *
+ * Reads a Q-table saved by saveQTable() in any format and writes it as a
+ * const QTable in C, so a build with -DQ_EMBEDDED_MODEL=1 plays the model
+ * without opening q_table.bin. Values are printed with 9 significant digits,
+ * enough to give back the same floats.
+ *
+ * Build and run from the repository root:
+ *  gcc -O2 -pthread -Itic-tac-toe -o qtable_to_c tools/qtable_to_c.c tic-tac-toe/q_learning.c tic-tac-toe/mapped_file.c -lm
+ *  ./qtable_to_c tic-tac-toe/q_table.bin tic-tac-toe/q_model.c
+ */
+#include "q_learning.h"
+
+int main(int argc, char *argv[]){
+    if(argc != 3){
+        fprintf(stderr, "Usage: %s <q_table.bin> <output.c>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    QTable *table = newQTable();
+    if(!table || !loadQTable(table, argv[1])) return EXIT_FAILURE;
+
+    FILE *out = fopen(argv[2], "w");
+    if(!out){
+        perror("Failed to open output file");
+        return EXIT_FAILURE;
+    }
+
+    int known = 0;
+    fprintf(out, "/* Generated by tools/qtable_to_c.c - do not edit by hand */\n");
+    fprintf(out, "#include \"q_learning.h\"\n\n");
+    fprintf(out, "#if Q_EMBEDDED_MODEL\n\n");
+
+    fprintf(out, "const QTable qEmbeddedModel = {\n    .val = {");
+    for(int i = 0; i < QTABLE_STATES; i++){
+        // Boards never learned are 0, keep them short
+        if(table->val[i] == 0.0f) fprintf(out, "%s0%s", (i % 8) ? " " : "\n        ", (i + 1 < QTABLE_STATES) ? "," : "");
+        else fprintf(out, "%s%.9gf%s", (i % 8) ? " " : "\n        ", table->val[i], (i + 1 < QTABLE_STATES) ? "," : "");
+    }
+    fprintf(out, "\n    },\n    .known = {");
+    for(int i = 0; i < QTABLE_STATES; i++){
+        fprintf(out, "%s%d%s", (i % 32) ? " " : "\n        ", table->known[i] ? 1 : 0, (i + 1 < QTABLE_STATES) ? "," : "");
+        known += table->known[i];
+    }
+    fprintf(out, "\n    }\n};\n\n");
+    fprintf(out, "#endif\n");
+
+    fclose(out);
+    freeQTable(table);
+    printf("Wrote %d boards to %s\n", known, argv[2]);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/***
+ * solve_retro4x4.c: Retrograde solver for the 4x4 board, writes the database
+ * read by tic-tac-toe/retro_db.c
+ *
+ * Every position is stored at its base-3 index (digit 1 for X, 2 for O), so
+ * the engine finds it in O(1). The game only moves forward, so positions are
+ * solved one layer of stone count at a time from the full board back to the
+ * empty one: every position of a layer only needs the layer after it. Each
+ * layer is split over threads by the set of X cells. O always moves first,
+ * so the stone counts tell who is to move.
+ *
+ * Entries hold win/draw/loss for the side to move and the plies to the end of
+ * the game with the winner hurrying and the loser delaying, see retro_db.h.
+ *
+ * Build and run from the repository root (k = 3 or 4 in a row):
+ *  gcc -O2 -pthread -o solve_retro4x4 tools/solve_retro4x4.c
+ *  ./solve_retro4x4 4 tic-tac-toe/retro4x4_k4.db
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "../tic-tac-toe/retro_db.h"
+
+#define SIDE 4
+#define MASKS (1 << RETRO_CELLS)    // Every set of cells
+#define MAX_LINES 40
+#define MAX_THREADS 64
+
+static uint32_t base3[MASKS];       // Base-3 weight of every set of cells
+static uint32_t pow3[RETRO_CELLS];
+static uint16_t lines[MAX_LINES];
+static int lineCount = 0;
+static uint8_t *entries;            // RETRO_POSITIONS results being solved
+
+// Layer being solved, shared by the threads
+static int layerX;                  // X stones in the layer
+static int layerO;                  // O stones in the layer
+static atomic_int nextMask;         // Next set of X cells to hand out
+
+/***
+ * addLines(): Every run of k cells along rows, columns and both diagonals.
+ */
+static void addLines(int k){
+    const int steps[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    for(int d = 0; d < 4; d++){
+        for(int row = 0; row < SIDE; row++){
+            for(int col = 0; col < SIDE; col++){
+                int endRow = row + steps[d][0] * (k - 1);
+                int endCol = col + steps[d][1] * (k - 1);
+                if(endRow < 0 || endRow >= SIDE || endCol < 0 || endCol >= SIDE) continue;
+
+                uint16_t line = 0;
+                for(int i = 0; i < k; i++) line |= 1 << ((row + steps[d][0] * i) * SIDE + col + steps[d][1] * i);
+                lines[lineCount++] = line;
+            }
+        }
+    }
+}
+
+static int won(int cells){
+    for(int i = 0; i < lineCount; i++){
+        if((cells & lines[i]) == lines[i]) return 1;
+    }
+    return 0;
+}
+
+/***
+ * solvePosition(): Result of one position from the results of the next layer.
+ */
+static uint8_t solvePosition(int x, int o){
+    int xToMove = (layerO > layerX);
+    int mover = xToMove ? x : o;
+    int last = xToMove ? o : x;
+
+    // Side that just moved has won, the side to move has lost
+    if(won(last)) return RETRO_ENTRY(RETRO_LOSS, 0);
+    // Side to move won earlier and play went on, never reached
+    if(won(mover)) return RETRO_ENTRY(RETRO_UNKNOWN, 0);
+    if((x | o) == MASKS - 1) return RETRO_ENTRY(RETRO_DRAW, 0);
+
+    uint32_t index = base3[x] + 2 * base3[o];
+    uint32_t digit = xToMove ? 1 : 2;
+    int best = RETRO_LOSS;
+    int winDistance = 64;   // Shortest win found
+    int lossDistance = 0;   // Longest loss found
+
+    for(int cell = 0; cell < RETRO_CELLS; cell++){
+        if((x | o) & (1 << cell)) continue;
+        uint8_t child = entries[index + digit * pow3[cell]];
+        int distance = RETRO_DISTANCE(child) + 1;
+
+        // The child's result is for the opponent
+        if(RETRO_RESULT(child) == RETRO_LOSS){
+            best = RETRO_WIN;
+            if(distance < winDistance) winDistance = distance;
+        }
+        else if(RETRO_RESULT(child) == RETRO_DRAW){
+            if(best == RETRO_LOSS) best = RETRO_DRAW;
+        }
+        else if(distance > lossDistance){
+            lossDistance = distance;
+        }
+    }
+
+    if(best == RETRO_WIN) return RETRO_ENTRY(RETRO_WIN, winDistance);
+    if(best == RETRO_DRAW) return RETRO_ENTRY(RETRO_DRAW, 0);
+    return RETRO_ENTRY(RETRO_LOSS, lossDistance);
+}
+
+/***
+ * solveLayer(): Thread body, takes sets of X cells until none are left and
+ * solves every O placement beside each.
+ */
+static void *solveLayer(void *unused){
+    (void)unused;
+    for(int x; (x = atomic_fetch_add(&nextMask, 1)) < MASKS; ){
+        if(__builtin_popcount(x) != layerX) continue;
+
+        // Every subset of the free cells with the right number of O stones
+        int free = (MASKS - 1) & ~x;
+        for(int o = free; ; o = (o - 1) & free){
+            if(__builtin_popcount(o) == layerO) entries[base3[x] + 2 * base3[o]] = solvePosition(x, o);
+            if(o == 0) break;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[]){
+    if(argc != 3 || (atoi(argv[1]) != 3 && atoi(argv[1]) != 4)){
+        fprintf(stderr, "Usage: %s <3|4 in a row> <output file>\n", argv[0]);
+        return 1;
+    }
+    int k = atoi(argv[1]);
+
+    pow3[0] = 1;
+    for(int cell = 1; cell < RETRO_CELLS; cell++) pow3[cell] = pow3[cell - 1] * 3;
+    for(int mask = 1; mask < MASKS; mask++){
+        int cell = __builtin_ctz(mask);
+        base3[mask] = base3[mask & (mask - 1)] + pow3[cell];
+    }
+    addLines(k);
+
+    // Positions never written stay RETRO_UNKNOWN
+    entries = calloc(RETRO_POSITIONS, 1);
+    if(!entries){
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(threads < 1) threads = 1;
+    if(threads > MAX_THREADS) threads = MAX_THREADS;
+    pthread_t workers[MAX_THREADS];
+
+    for(int stones = RETRO_CELLS; stones >= 0; stones--){
+        // O moves first, so O has the extra stone on odd layers
+        layerO = (stones + 1) / 2;
+        layerX = stones / 2;
+        atomic_store(&nextMask, 0);
+
+        for(int i = 0; i < threads; i++) pthread_create(&workers[i], NULL, solveLayer, NULL);
+        for(int i = 0; i < threads; i++) pthread_join(workers[i], NULL);
+        fprintf(stderr, "Layer %2d solved\n", stones);
+    }
+
+    uint8_t empty = entries[0];
+    printf("%d in a row: empty board is a %s for O in %d plies\n", k,
+           RETRO_RESULT(empty) == RETRO_WIN ? "win" : RETRO_RESULT(empty) == RETRO_DRAW ? "draw" : "loss",
+           RETRO_DISTANCE(empty));
+
+    RetroHeader header = {.version = RETRO_VERSION, .size = RETRO_SIZE, .winLength = k, .positions = RETRO_POSITIONS};
+    memcpy(header.magic, RETRO_MAGIC, sizeof(header.magic));
+
+    FILE *out = fopen(argv[2], "wb");
+    if(!out || fwrite(&header, sizeof(header), 1, out) != 1 || fwrite(entries, 1, RETRO_POSITIONS, out) != RETRO_POSITIONS){
+        fprintf(stderr, "Failed to write %s\n", argv[2]);
+        return 1;
+    }
+    fclose(out);
+    free(entries);
+    return 0;
+}